@@ -0,0 +1,7212 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton implementation for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
+
+
+
+#include "vn_lang.ypp.hpp"
+
+
+// Unqualified %code blocks.
+#line 52 "src/vn/lang/vn_lang.ypp"
+ 
+  // Appears high-ish in the generated .cpp file
+  #include "vn_lang.lpp.hpp"  /* Generated by reflex. */
+  #include "vn_commands.hpp"
+  #include "vn_actions.hpp"     
+  #include "declarators.hpp" 
+  #include "tree/node_names.hpp"  
+  #include "vn_recogniser.hpp"
+  #include <iostream>
+  #include <fstream>  
+   
+  #undef yylex
+  #define yylex lexer.lex  /* Within bison's parse() we should invoke lexer.lex(), not the global yylex() */
+  
+  // Strings that could be translated have _() around them. 
+  // See https://www.gnu.org/software/gettext/manual/gettext.html
+  #define _(String) (String)
+  #define N_(String) String 
+
+#line 66 "build/src/vn/lang/vn_lang.ypp.cpp"
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
+#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(msgid) msgid
+# endif
+#endif
+
+#ifndef N_
+# define N_(Msgid) Msgid
+#endif
+
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
+# endif
+
+
+// Enable debugging if requested.
+#if YYDEBUG
+
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
+
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
+
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
+
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
+
+#else // !YYDEBUG
+
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
+
+#endif // !YYDEBUG
+
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
+
+#line 4 "src/vn/lang/vn_lang.ypp"
+namespace YY {
+#line 163 "build/src/vn/lang/vn_lang.ypp.cpp"
+
+  /// Build a parser object.
+  VNLangParser::VNLangParser (YY::VNLangScanner& lexer_yyarg, VN::VNLangActions *vn_yyarg, VN::VNLangRecogniser *recogniser_yyarg)
+#if YYDEBUG
+    : yydebug_ (false),
+      yycdebug_ (&std::cerr),
+#else
+    :
+#endif
+      yy_lac_established_ (false),
+      lexer (lexer_yyarg),
+      vn (vn_yyarg),
+      recogniser (recogniser_yyarg)
+  {}
+
+  VNLangParser::~VNLangParser ()
+  {}
+
+  VNLangParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+
+
+  // by_state.
+  VNLangParser::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
+
+  VNLangParser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
+
+  void
+  VNLangParser::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
+
+  void
+  VNLangParser::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
+
+  VNLangParser::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
+
+  VNLangParser::symbol_kind_type
+  VNLangParser::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
+
+  VNLangParser::stack_symbol_type::stack_symbol_type ()
+  {}
+
+  VNLangParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.YY_MOVE_OR_COPY< TreePtr<Node> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_item: // item
+        value.YY_MOVE_OR_COPY< VN::Item > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.YY_MOVE_OR_COPY< VN::Itemisation > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.YY_MOVE_OR_COPY< VN::Limit > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.YY_MOVE_OR_COPY< VN::NodeAndGnomon > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.YY_MOVE_OR_COPY< VN::QualifierData > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.YY_MOVE_OR_COPY< YY::TokenMetadata > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.YY_MOVE_OR_COPY< const ANDBlock * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.YY_MOVE_OR_COPY< list<TreePtr<Node>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.YY_MOVE_OR_COPY< list<VN::QualifierData> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.YY_MOVE_OR_COPY< list<shared_ptr<VN::Command>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.YY_MOVE_OR_COPY< multiset<string> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.YY_MOVE_OR_COPY< shared_ptr<VN::Command> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.YY_MOVE_OR_COPY< shared_ptr<VN::Gnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.YY_MOVE_OR_COPY< shared_ptr<VN::PrerestrictScopeGnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.YY_MOVE_OR_COPY< string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.YY_MOVE_OR_COPY< wstring > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  VNLangParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.move< TreePtr<Node> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_item: // item
+        value.move< VN::Item > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.move< VN::Itemisation > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.move< VN::Limit > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.move< VN::NodeAndGnomon > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.move< VN::QualifierData > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.move< YY::TokenMetadata > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.move< const ANDBlock * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.move< list<TreePtr<Node>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.move< list<VN::QualifierData> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.move< list<shared_ptr<VN::Command>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.move< multiset<string> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.move< shared_ptr<VN::Command> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.move< shared_ptr<VN::Gnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.move< shared_ptr<VN::PrerestrictScopeGnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.move< string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.move< wstring > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  VNLangParser::stack_symbol_type&
+  VNLangParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.copy< TreePtr<Node> > (that.value);
+        break;
+
+      case symbol_kind::S_item: // item
+        value.copy< VN::Item > (that.value);
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.copy< VN::Itemisation > (that.value);
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.copy< VN::Limit > (that.value);
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.copy< VN::NodeAndGnomon > (that.value);
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.copy< VN::QualifierData > (that.value);
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.copy< YY::TokenMetadata > (that.value);
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.copy< const ANDBlock * > (that.value);
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.copy< list<TreePtr<Node>> > (that.value);
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.copy< list<VN::QualifierData> > (that.value);
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.copy< list<shared_ptr<VN::Command>> > (that.value);
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.copy< multiset<string> > (that.value);
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.copy< shared_ptr<VN::Command> > (that.value);
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.copy< shared_ptr<VN::Gnomon> > (that.value);
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.copy< shared_ptr<VN::PrerestrictScopeGnomon> > (that.value);
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.copy< string > (that.value);
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.copy< wstring > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
+  VNLangParser::stack_symbol_type&
+  VNLangParser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.move< TreePtr<Node> > (that.value);
+        break;
+
+      case symbol_kind::S_item: // item
+        value.move< VN::Item > (that.value);
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.move< VN::Itemisation > (that.value);
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.move< VN::Limit > (that.value);
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.move< VN::NodeAndGnomon > (that.value);
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.move< VN::QualifierData > (that.value);
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.move< YY::TokenMetadata > (that.value);
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.move< const ANDBlock * > (that.value);
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.move< list<TreePtr<Node>> > (that.value);
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.move< list<VN::QualifierData> > (that.value);
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.move< list<shared_ptr<VN::Command>> > (that.value);
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.move< multiset<string> > (that.value);
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.move< shared_ptr<VN::Command> > (that.value);
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.move< shared_ptr<VN::Gnomon> > (that.value);
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.move< shared_ptr<VN::PrerestrictScopeGnomon> > (that.value);
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.move< string > (that.value);
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.move< wstring > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
+
+  template <typename Base>
+  void
+  VNLangParser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+  }
+
+#if YYDEBUG
+  template <typename Base>
+  void
+  VNLangParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
+  }
+#endif
+
+  void
+  VNLangParser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
+
+  void
+  VNLangParser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
+
+  void
+  VNLangParser::yypop_ (int n) YY_NOEXCEPT
+  {
+    yystack_.pop (n);
+  }
+
+#if YYDEBUG
+  std::ostream&
+  VNLangParser::debug_stream () const
+  {
+    return *yycdebug_;
+  }
+
+  void
+  VNLangParser::set_debug_stream (std::ostream& o)
+  {
+    yycdebug_ = &o;
+  }
+
+
+  VNLangParser::debug_level_type
+  VNLangParser::debug_level () const
+  {
+    return yydebug_;
+  }
+
+  void
+  VNLangParser::set_debug_level (debug_level_type l)
+  {
+    yydebug_ = l;
+  }
+#endif // YYDEBUG
+
+  VNLangParser::state_type
+  VNLangParser::yy_lr_goto_state_ (state_type yystate, int yysym)
+  {
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
+    else
+      return yydefgoto_[yysym - YYNTOKENS];
+  }
+
+  bool
+  VNLangParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yypact_ninf_;
+  }
+
+  bool
+  VNLangParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
+
+  int
+  VNLangParser::operator() ()
+  {
+    return parse ();
+  }
+
+  int
+  VNLangParser::parse ()
+  {
+    int yyn;
+    /// Length of the RHS of the rule being reduced.
+    int yylen = 0;
+
+    // Error handling.
+    int yynerrs_ = 0;
+    int yyerrstatus_ = 0;
+
+    /// The lookahead symbol.
+    symbol_type yyla;
+
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
+
+    /// The return value of parse ().
+    int yyresult;
+
+    // Discard the LAC context in case there still is one left from a
+    // previous invocation.
+    yy_lac_discard_ ("init");
+
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
+
+
+    /* Initialize the stack.  The initial state will be set in
+       yynewstate, since the latter expects the semantical and the
+       location values to have been already stored, initialize these
+       stacks with a primary value.  */
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
+
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
+  yynewstate:
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
+
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
+
+    goto yybackup;
+
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
+      goto yydefault;
+
+    // Read a lookahead token.
+    if (yyla.empty ())
+      {
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            symbol_type yylookahead (yylex ());
+            yyla.move (yylookahead);
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
+      }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
+
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        if (!yy_lac_establish_ (yyla.kind ()))
+          goto yyerrlab;
+        goto yydefault;
+      }
+
+    // Reduce or error.
+    yyn = yytable_[yyn];
+    if (yyn <= 0)
+      {
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        if (!yy_lac_establish_ (yyla.kind ()))
+          goto yyerrlab;
+
+        yyn = -yyn;
+        goto yyreduce;
+      }
+
+    // Count tokens shifted since error; after three, turn off error status.
+    if (yyerrstatus_)
+      --yyerrstatus_;
+
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
+    yy_lac_discard_ ("shift");
+    goto yynewstate;
+
+
+  /*-----------------------------------------------------------.
+  | yydefault -- do the default action for the current state.  |
+  `-----------------------------------------------------------*/
+  yydefault:
+    yyn = yydefact_[+yystack_[0].state];
+    if (yyn == 0)
+      goto yyerrlab;
+    goto yyreduce;
+
+
+  /*-----------------------------.
+  | yyreduce -- do a reduction.  |
+  `-----------------------------*/
+  yyreduce:
+    yylen = yyr2_[yyn];
+    {
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* Variants are always initialized to an empty instance of the
+         correct type. The default '$$ = $1' action is NOT applied
+         when using variants.  */
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        yylhs.value.emplace< TreePtr<Node> > ();
+        break;
+
+      case symbol_kind::S_item: // item
+        yylhs.value.emplace< VN::Item > ();
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        yylhs.value.emplace< VN::Itemisation > ();
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        yylhs.value.emplace< VN::Limit > ();
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        yylhs.value.emplace< VN::NodeAndGnomon > ();
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        yylhs.value.emplace< VN::QualifierData > ();
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        yylhs.value.emplace< YY::TokenMetadata > ();
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        yylhs.value.emplace< const ANDBlock * > ();
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        yylhs.value.emplace< list<TreePtr<Node>> > ();
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        yylhs.value.emplace< list<VN::QualifierData> > ();
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        yylhs.value.emplace< list<shared_ptr<VN::Command>> > ();
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        yylhs.value.emplace< multiset<string> > ();
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        yylhs.value.emplace< shared_ptr<VN::Command> > ();
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        yylhs.value.emplace< shared_ptr<VN::Gnomon> > ();
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        yylhs.value.emplace< shared_ptr<VN::PrerestrictScopeGnomon> > ();
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        yylhs.value.emplace< string > ();
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        yylhs.value.emplace< wstring > ();
+        break;
+
+      default:
+        break;
+    }
+
+
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // vnscript: commands
+#line 236 "src/vn/lang/vn_lang.ypp"
+                                                                                                { vn->OnVNScript(yystack_[0].value.as < list<shared_ptr<VN::Command>> > ()); }
+#line 1955 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 3: // stmt_boot: commands
+#line 238 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnEmbeddedCommands(yystack_[0].value.as < list<shared_ptr<VN::Command>> > ()); }
+#line 1961 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 4: // commands: sep_commands
+#line 241 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < list<shared_ptr<VN::Command>> > () = yystack_[0].value.as < list<shared_ptr<VN::Command>> > (); }
+#line 1967 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 5: // commands: sep_commands "command terminator ⨟"
+#line 242 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < list<shared_ptr<VN::Command>> > () = yystack_[1].value.as < list<shared_ptr<VN::Command>> > (); }
+#line 1973 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 6: // sep_commands: sep_commands "command terminator ⨟" script_command
+#line 245 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < list<shared_ptr<VN::Command>> > () = yystack_[2].value.as < list<shared_ptr<VN::Command>> > (); yylhs.value.as < list<shared_ptr<VN::Command>> > ().push_back(yystack_[0].value.as < shared_ptr<VN::Command> > ()); }
+#line 1979 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 7: // sep_commands: script_command
+#line 246 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < list<shared_ptr<VN::Command>> > ().push_back(yystack_[0].value.as < shared_ptr<VN::Command> > ()); }
+#line 1985 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 8: // sep_commands: sep_commands "command terminator ⨟" designation_command
+#line 247 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < list<shared_ptr<VN::Command>> > () = yystack_[2].value.as < list<shared_ptr<VN::Command>> > (); recogniser->AddGnomon(yystack_[0].value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 1991 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 9: // sep_commands: designation_command
+#line 248 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { recogniser->AddGnomon(yystack_[0].value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 1997 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 10: // script_command: "engine command ꩜" unified_entry
+#line 251 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < shared_ptr<VN::Command> > () = make_shared<VN::EngineCommand>(yystack_[0].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 2003 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 11: // script_command: stmt_entry
+#line 252 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < shared_ptr<VN::Command> > () = make_shared<VN::PatternCommand>(yystack_[0].value.as < TreePtr<Node> > (), yylhs.location); }
+#line 2009 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 12: // script_command: "attribute command ‡"
+#line 253 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < shared_ptr<VN::Command> > () = make_shared<VN::AttributeCommand>(yylhs.location); }
+#line 2015 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 13: // designation_command: vn_name "designate command ⪮" stmt_entry_nc
+#line 256 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::NormalDesignationGnomon>(yystack_[2].value.as < wstring > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2021 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 14: // designation_command: vn_name "designate command ⪮" type_entry
+#line 257 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::TypeDesignationGnomon>(yystack_[2].value.as < wstring > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2027 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 15: // designation_command: vn_name "designate command ⪮" decl_entry
+#line 258 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::DeclarationDesignationGnomon>(yystack_[2].value.as < wstring > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2033 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 16: // designation_command: vn_name "designate command ⪮" qualifier_node
+#line 259 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::QualifierDesignationGnomon>(yystack_[2].value.as < wstring > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2039 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 17: // designation_command: vn_name "designate command ⪮" compound_entry
+#line 260 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::CompoundDesignationGnomon>(yystack_[2].value.as < wstring > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2045 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 18: // itemisation: "open VN-params ⦅" items_bare "close VN-params ⦆"
+#line 265 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < VN::Itemisation > () = yystack_[1].value.as < VN::Itemisation > (); yylhs.value.as < VN::Itemisation > ().loc = yylhs.location; }
+#line 2051 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 19: // itemisation: "open VN-params ⦅" items_sep "close VN-params ⦆"
+#line 266 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < VN::Itemisation > () = yystack_[1].value.as < VN::Itemisation > (); yylhs.value.as < VN::Itemisation > ().loc = yylhs.location; yylhs.value.as < VN::Itemisation > ().items.push_back({{}, yystack_[0].location}); }
+#line 2057 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 20: // itemisation: "open VN-params ⦅" "close VN-params ⦆"
+#line 267 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < VN::Itemisation > ().loc = yylhs.location; }
+#line 2063 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 21: // items_bare: items_sep item
+#line 269 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < VN::Itemisation > () = yystack_[1].value.as < VN::Itemisation > (); yylhs.value.as < VN::Itemisation > ().items.push_back(yystack_[0].value.as < VN::Item > ()); }
+#line 2069 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 22: // items_bare: item
+#line 270 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < VN::Itemisation > ().items.push_back(yystack_[0].value.as < VN::Item > ()); }
+#line 2075 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 23: // items_sep: items_bare "VN-param separator ⚬"
+#line 272 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < VN::Itemisation > () = yystack_[1].value.as < VN::Itemisation > (); }
+#line 2081 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 24: // items_sep: items_sep "VN-param separator ⚬"
+#line 273 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < VN::Itemisation > () = yystack_[1].value.as < VN::Itemisation > (); yylhs.value.as < VN::Itemisation > ().items.push_back({{}, yystack_[0].location}); }
+#line 2087 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 25: // items_sep: "VN-param separator ⚬"
+#line 274 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < VN::Itemisation > ().items.push_front({{}, yystack_[0].location}); }
+#line 2093 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 26: // item: item "container separator 🞄" unified_entry
+#line 276 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < VN::Item > () = yystack_[2].value.as < VN::Item > (); yylhs.value.as < VN::Item > ().nodes.push_back(yystack_[0].value.as < TreePtr<Node> > ()); yylhs.value.as < VN::Item > ().loc = yylhs.location; }
+#line 2099 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 27: // item: unified_entry
+#line 277 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < VN::Item > ().nodes.push_back(yystack_[0].value.as < TreePtr<Node> > ()); yylhs.value.as < VN::Item > ().loc = yylhs.location; }
+#line 2105 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 28: // unified_entry: stmt_entry
+#line 282 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2111 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 29: // unified_entry: type_entry
+#line 283 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2117 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 30: // unified_entry: decl_entry
+#line 284 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2123 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 31: // unified_entry: qualifier_node
+#line 285 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2129 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 32: // unified_prefix: expr_prefix
+#line 287 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2135 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 33: // unified_prefix: type_prefix
+#line 288 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2141 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 34: // unified_prefix: decl_prefix
+#line 289 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2147 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 35: // compound_entry: compound_prefix
+#line 300 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2153 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 36: // compound_prefix: compound_primary
+#line 302 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2159 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 37: // compound_prefix: "negation operator ¬" compound_prefix
+#line 303 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2165 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 38: // compound_prefix: transform_op_named compound_prefix
+#line 304 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnTransform(yystack_[1].value.as < string > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2171 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 39: // compound_prefix: stuff_op_scope compound_prefix
+#line 305 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, VN::Limit()); }
+#line 2177 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 40: // compound_prefix: stuff_op_scope "open VN-params ⦅" unified_entry "close VN-params ⦆" compound_prefix
+#line 306 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), yystack_[2].value.as < TreePtr<Node> > (), VN::Limit()); }
+#line 2183 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 41: // compound_prefix: stuff_op_scope "open VN-params ⦅" stuff_depth "close VN-params ⦆" compound_prefix
+#line 307 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, yystack_[2].value.as < VN::Limit > ()); }
+#line 2189 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 42: // compound_prefix: prerestrict_op_named compound_prefix
+#line 308 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < const ANDBlock * > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2195 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 43: // compound_primary: compound_scope '{' "VN-param separator ⚬" '}'
+#line 310 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnCompound({}, yystack_[1].location, {}, yystack_[1].location); }
+#line 2201 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 44: // compound_primary: compound_scope '{' stmt_decls "VN-param separator ⚬" '}'
+#line 311 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnCompound(yystack_[2].value.as < list<TreePtr<Node>> > (), yystack_[2].location, {}, yystack_[0].location); }
+#line 2207 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 45: // compound_primary: compound_scope '{' "VN-param separator ⚬" stmt_decls '}'
+#line 312 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnCompound({}, yystack_[2].location, yystack_[1].value.as < list<TreePtr<Node>> > (), yystack_[1].location); }
+#line 2213 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 46: // compound_primary: compound_scope '{' stmt_decls "VN-param separator ⚬" stmt_decls '}'
+#line 313 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnCompound(yystack_[3].value.as < list<TreePtr<Node>> > (), yystack_[3].location, yystack_[1].value.as < list<TreePtr<Node>> > (), yystack_[1].location); }
+#line 2219 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 47: // compound_primary: "code unit ∞" code_unit_scope '{' stmt_decls '}'
+#line 314 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnCodeUnit(yystack_[1].value.as < list<TreePtr<Node>> > (), yystack_[1].location); }
+#line 2225 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 48: // compound_scope: %empty
+#line 316 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::CompoundScopeGnomon>(); 
+																			  vn->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 2232 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 49: // code_unit_scope: %empty
+#line 319 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::CodeUnitScopeGnomon>(); 
+																			  vn->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 2239 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 50: // stmt_decls: stmt_decl_l
+#line 322 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[0].value.as < list<TreePtr<Node>> > (); }
+#line 2245 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 51: // stmt_decls: stmt_decl_l stmt_decls
+#line 323 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[1].value.as < list<TreePtr<Node>> > () + yystack_[0].value.as < list<TreePtr<Node>> > (); }
+#line 2251 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 52: // stmt_decl_l: statement_l
+#line 325 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[0].value.as < list<TreePtr<Node>> > (); }
+#line 2257 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 53: // stmt_decl_l: compound_entry
+#line 326 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[0].value.as < TreePtr<Node> > ()}; }
+#line 2263 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 54: // stmt_decl_l: declaration
+#line 327 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[0].value.as < TreePtr<Node> > ()}; }
+#line 2269 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 55: // decl_boot: decl_entry
+#line 331 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2275 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 56: // decl_boot: decl_commands
+#line 332 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnEmbeddedCommands(yystack_[0].value.as < list<shared_ptr<VN::Command>> > ()); }
+#line 2281 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 57: // decl_commands: decl_entry "command terminator ⨟" commands
+#line 334 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < list<shared_ptr<VN::Command>> > () = yystack_[0].value.as < list<shared_ptr<VN::Command>> > (); yylhs.value.as < list<shared_ptr<VN::Command>> > ().push_front( make_shared<VN::PatternCommand>(yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location) ); }
+#line 2287 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 58: // decl_entry: decl_disjunction
+#line 336 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2293 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 59: // decl_disjunction: decl_conjunction
+#line 338 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2299 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 60: // decl_disjunction: decl_disjunction "disjunction operator ∨" decl_conjunction
+#line 339 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2305 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 61: // decl_conjunction: open_declaration
+#line 341 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2311 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 62: // decl_conjunction: decl_conjunction "conjunction operator ∧" open_declaration
+#line 342 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2317 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 63: // decl_conjunction: decl_conjunction "conjunction operator ∧" bare_statement
+#line 343 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2323 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 64: // decl_conjunction: decl_conjunction "conjunction operator ∧" expr_entry
+#line 344 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2329 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 65: // open_declaration: declaration
+#line 346 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2335 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 66: // open_declaration: bare_declaration
+#line 347 "src/vn/lang/vn_lang.ypp"
+                                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2341 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 67: // declaration: bare_declaration ';'
+#line 349 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 2347 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 68: // declaration: comp_decl_nvn
+#line 350 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2353 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 69: // bare_declaration: bare_decl_nvn
+#line 353 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2359 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 70: // bare_declaration: decl_prefix
+#line 354 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2365 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 71: // comp_decl_nvn: prototype compound_entry
+#line 356 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->ApplyInitialiser(yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2371 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 72: // bare_decl_nvn: prototype
+#line 358 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2377 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 73: // bare_decl_nvn: prototype bare_initialiser
+#line 359 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->ApplyInitialiser(yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2383 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 74: // bare_decl_nvn: prototype ':' memb_inits bare_initialiser
+#line 360 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->ApplyMemberInits(yystack_[3].value.as < TreePtr<Node> > (), yystack_[3].location, yystack_[1].value.as < list<TreePtr<Node>> > (), yystack_[1].location); 
+																		  yylhs.value.as < TreePtr<Node> > () = vn->ApplyInitialiser(yylhs.value.as < TreePtr<Node> > (), yystack_[3].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2390 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 75: // bare_decl_nvn: inheritance_record
+#line 362 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2396 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 76: // bare_decl_nvn: enum
+#line 363 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2402 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 77: // bare_initialiser: "C assignment operator =" assign_init
+#line 365 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2408 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 78: // bare_initialiser: "designated compound name"
+#line 366 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 2414 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 79: // bare_initialiser: "designated statement/expression name"
+#line 367 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 2420 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 80: // prototype: type_for_declarator declarator
+#line 369 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDeclaratorDecl({}, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2426 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 81: // prototype: qualifiers type_for_declarator declarator
+#line 370 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDeclaratorDecl(yystack_[2].value.as < list<VN::QualifierData> > (), yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2432 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 82: // prototype: type_for_declarator qualifiers declarator
+#line 371 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDeclaratorDecl(yystack_[1].value.as < list<VN::QualifierData> > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2438 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 83: // prototype: qualifiers type_for_declarator qualifiers declarator
+#line 372 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDeclaratorDecl(yystack_[3].value.as < list<VN::QualifierData> > ()+yystack_[1].value.as < list<VN::QualifierData> > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2444 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 84: // prototype: "constructor/destructor virtual type ⨤" id_primary parameterisation
+#line 373 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConstructorDecl(yylhs.location, {}, yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < list<TreePtr<Node>> > ()); }
+#line 2450 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 85: // prototype: qualifiers "constructor/destructor virtual type ⨤" id_primary parameterisation
+#line 374 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConstructorDecl(yylhs.location, yystack_[3].value.as < list<VN::QualifierData> > (), yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < list<TreePtr<Node>> > ()); }
+#line 2456 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 86: // assign_init: expr_entry
+#line 376 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2462 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 87: // assign_init: '{' '}'
+#line 377 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnArrayInitialiser({}); }
+#line 2468 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 88: // assign_init: '{' comma_sep_expr_decl '}'
+#line 378 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnArrayInitialiser(yystack_[1].value.as < list<TreePtr<Node>> > ()); }
+#line 2474 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 89: // decl_prefix: decl_postfix
+#line 380 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2480 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 90: // decl_prefix: "green-grass operator ⫴" decl_prefix
+#line 381 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnGrass(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2486 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 91: // decl_prefix: "pointer-is operator ⮎" decl_prefix
+#line 382 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnPointerIs(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2492 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 92: // decl_prefix: "negation operator ¬" decl_prefix
+#line 383 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2498 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 93: // decl_prefix: decl_prerestrict_op_named acc_memb_prefix
+#line 385 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < shared_ptr<VN::PrerestrictScopeGnomon> > ()->block, yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2504 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 94: // decl_postfix: decl_primary
+#line 387 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2510 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 95: // decl_primary: decl_vn_prim
+#line 389 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2516 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 96: // decl_primary: '(' decl_boot ')'
+#line 390 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 2522 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 97: // decl_vn_prim: decl_full_explicit_start itemisation
+#line 392 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 2528 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 98: // decl_vn_prim: "delta-compare operator ▲" decl_boot "delta-replace operator ⯈" decl_boot "delta-end operator ⯇"
+#line 393 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnDelta(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2534 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 99: // decl_vn_prim: "designated declaration name"
+#line 394 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 2540 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 100: // decl_vn_prim: "star operator ★" "open VN-params ⦅" decl_entry "close VN-params ⦆"
+#line 395 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2546 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 101: // decl_full_explicit_start: explicit_decl_node
+#line 397 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < VN::NodeAndGnomon > () = vn->MakeScopeGnomonForNode(yystack_[0].value.as < TreePtr<Node> > ()); 
+                                                                      vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 2553 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 102: // decl_prerestrict_op_named: prerestrict_op_scope resolved_decl_name
+#line 400 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < shared_ptr<VN::PrerestrictScopeGnomon> > () = make_shared<VN::PrerestrictScopeGnomon>(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); 
+                                                                          vn->AddGnomon(yylhs.value.as < shared_ptr<VN::PrerestrictScopeGnomon> > ()); }
+#line 2560 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 103: // memb_inits: memb_inits ',' memb_init_boot
+#line 403 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2566 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 104: // memb_inits: memb_init_boot
+#line 404 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[0].value.as < TreePtr<Node> > ()}; }
+#line 2572 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 105: // memb_init_boot: memb_init_entry
+#line 406 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2578 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 106: // memb_init_entry: memb_init_prefix
+#line 408 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2584 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 107: // memb_init_prefix: memb_init_postfix
+#line 410 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2590 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 108: // memb_init_prefix: "green-grass operator ⫴" memb_init_prefix
+#line 411 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnGrass(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2596 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 109: // memb_init_prefix: "negation operator ¬" memb_init_prefix
+#line 412 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2602 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 110: // memb_init_prefix: mi_prerestrict_op_named memb_init_prefix
+#line 413 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < const ANDBlock * > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 2608 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 111: // memb_init_prefix: stuff_op_scope memb_init_prefix
+#line 414 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, VN::Limit()); }
+#line 2614 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 112: // memb_init_prefix: stuff_op_scope "open VN-params ⦅" memb_init_boot "close VN-params ⦆" memb_init_prefix
+#line 415 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), yystack_[2].value.as < TreePtr<Node> > (), VN::Limit()); }
+#line 2620 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 113: // memb_init_prefix: stuff_op_scope "open VN-params ⦅" stuff_depth "close VN-params ⦆" memb_init_prefix
+#line 416 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, yystack_[2].value.as < VN::Limit > ()); }
+#line 2626 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 114: // memb_init_postfix: memb_init_primary
+#line 418 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2632 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 115: // memb_init_postfix: memb_init_primary '(' stmt_boot ')'
+#line 419 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnMemberInitialiser(yystack_[3].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 2638 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 116: // memb_init_primary: '(' memb_init_boot ')'
+#line 421 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 2644 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 117: // memb_init_primary: "delta-compare operator ▲" memb_init_boot "delta-replace operator ⯈" memb_init_boot "delta-end operator ⯇"
+#line 422 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDelta(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2650 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 118: // memb_init_primary: mi_full_explicit_start itemisation
+#line 423 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 2656 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 119: // memb_init_primary: "designated statement/expression name"
+#line 424 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 2662 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 120: // memb_init_primary: mi_id_by_name_op_named "open VN-params ⦅" "C string literal" "close VN-params ⦆"
+#line 425 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnIdByName(yystack_[3].value.as < const ANDBlock * > (), yystack_[3].location, yystack_[1].value.as < wstring > (), yystack_[1].location); }
+#line 2668 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 121: // memb_init_primary: mi_build_id_op_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" "close VN-params ⦆"
+#line 426 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, yystack_[2].value.as < wstring > (), yystack_[2].location, VN::Item{}); }
+#line 2674 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 122: // memb_init_primary: mi_build_id_op_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 427 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[5].value.as < const ANDBlock * > (), yystack_[5].location, yystack_[3].value.as < wstring > (), yystack_[3].location, yystack_[1].value.as < VN::Item > ()); }
+#line 2680 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 123: // memb_init_primary: mi_build_id_op_named "open VN-params ⦅" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 428 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, wstring(), yystack_[2].location, yystack_[1].value.as < VN::Item > ()); }
+#line 2686 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 124: // memb_init_primary: mi_transform_op_named "open VN-params ⦅" unified_prefix "close VN-params ⦆"
+#line 429 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnTransform(yystack_[3].value.as < string > (), yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 2692 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 125: // memb_init_primary: "star operator ★"
+#line 430 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(nullptr); }
+#line 2698 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 126: // memb_init_primary: "star operator ★" "open VN-params ⦅" memb_init_boot "close VN-params ⦆"
+#line 431 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2704 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 127: // memb_init_primary: "any node operator ☆"
+#line 432 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = nullptr; }
+#line 2710 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 128: // mi_full_explicit_start: explicit_mi_node
+#line 434 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < VN::NodeAndGnomon > () = vn->MakeScopeGnomonForNode(yystack_[0].value.as < TreePtr<Node> > ()); 
+																	  vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 2717 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 129: // mi_prerestrict_op_named: prerestrict_op_scope resolved_mi_name
+#line 436 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 2723 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 130: // mi_id_by_name_op_named: id_by_name_op_scope resolved_mi_name
+#line 437 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 2729 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 131: // mi_build_id_op_named: builder_id_op_scope resolved_mi_name
+#line 438 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 2735 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 132: // mi_transform_op_named: transform_op_scope "open_statement transform name"
+#line 439 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < string > () = yystack_[0].value.as < YY::TokenMetadata > ().as_ascii; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 2741 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 133: // declarator: declarator_prefix
+#line 443 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2747 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 134: // declarator_prefix: declarator_postfix
+#line 445 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2753 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 135: // declarator_prefix: '&' declarator_prefix
+#line 446 "src/vn/lang/vn_lang.ypp"
+                                                                                         { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Reference>(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2759 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 136: // declarator_prefix: '*' declarator_prefix
+#line 447 "src/vn/lang/vn_lang.ypp"
+                                                                                         { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals({}), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2765 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 137: // declarator_prefix: '*' qualifiers declarator_prefix
+#line 448 "src/vn/lang/vn_lang.ypp"
+                                                                                         { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals(yystack_[1].value.as < list<VN::QualifierData> > ()), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2771 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 138: // declarator_postfix: declarator_primary
+#line 450 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2777 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 139: // declarator_postfix: declarator_postfix parameterisation
+#line 451 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals({})); }
+#line 2783 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 140: // declarator_postfix: declarator_postfix parameterisation qualifiers
+#line 452 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(yystack_[2].value.as < TreePtr<Node> > (), yystack_[1].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals(yystack_[0].value.as < list<VN::QualifierData> > ())); }
+#line 2789 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 141: // declarator_postfix: declarator_postfix '[' stmt_entry ']'
+#line 453 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Array>(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2795 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 142: // declarator_primary: id_primary
+#line 455 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Concrete>(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2801 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 143: // declarator_primary: '(' stmt_boot ')'
+#line 456 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Concrete>(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2807 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 144: // ab_declarator: ab_declarator_prefix
+#line 460 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2813 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 145: // ab_declarator_prefix: ab_declarator_postfix
+#line 462 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2819 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 146: // ab_declarator_prefix: '&' ab_declarator_prefix
+#line 463 "src/vn/lang/vn_lang.ypp"
+                                                                                                    { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Reference>(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2825 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 147: // ab_declarator_prefix: '*' ab_declarator_prefix
+#line 464 "src/vn/lang/vn_lang.ypp"
+                                                                                                    { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals({}), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2831 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 148: // ab_declarator_prefix: '*' qualifiers ab_declarator_prefix
+#line 465 "src/vn/lang/vn_lang.ypp"
+                                                                                                    { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals(yystack_[1].value.as < list<VN::QualifierData> > ()), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2837 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 149: // ab_declarator_prefix: '&'
+#line 466 "src/vn/lang/vn_lang.ypp"
+                                                                                                                    { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Reference>(nullptr); }
+#line 2843 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 150: // ab_declarator_prefix: '*'
+#line 467 "src/vn/lang/vn_lang.ypp"
+                                                                                                                    { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals({}), nullptr); }
+#line 2849 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 151: // ab_declarator_prefix: '*' qualifiers
+#line 468 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Pointer>(vn->OnCVQuals(yystack_[0].value.as < list<VN::QualifierData> > ()), nullptr); }
+#line 2855 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 152: // ab_declarator_postfix: ab_declarator_postfix parameterisation
+#line 470 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals({})); }
+#line 2861 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 153: // ab_declarator_postfix: ab_declarator_postfix parameterisation qualifiers
+#line 471 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(yystack_[2].value.as < TreePtr<Node> > (), yystack_[1].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals(yystack_[0].value.as < list<VN::QualifierData> > ())); }
+#line 2867 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 154: // ab_declarator_postfix: ab_declarator_postfix '[' stmt_entry ']'
+#line 472 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Array>(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2873 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 155: // ab_declarator_postfix: parameterisation
+#line 473 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(nullptr, yystack_[0].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals({})); }
+#line 2879 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 156: // ab_declarator_postfix: parameterisation qualifiers
+#line 474 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Function>(nullptr, yystack_[1].value.as < list<TreePtr<Node>> > (), vn->OnCVQuals(yystack_[0].value.as < list<VN::QualifierData> > ())); }
+#line 2885 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 157: // ab_declarator_postfix: '[' stmt_entry ']'
+#line 475 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = make_shared<Declarators::Array>(nullptr, yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 2891 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 158: // parameterisation: params_scope parameters ')'
+#line 479 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[1].value.as < list<TreePtr<Node>> > (); }
+#line 2897 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 159: // parameterisation: params_scope ')'
+#line 480 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > ().clear(); }
+#line 2903 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 160: // params_scope: '('
+#line 482 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::ParameterisationScopeGnomon>(); 
+																  vn->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 2910 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 161: // parameters: parameter
+#line 485 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2916 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 162: // parameters: parameters ',' parameter
+#line 486 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2922 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 163: // parameter: decl_entry
+#line 488 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2928 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 164: // inheritance_record: irecord_scope '{' members '}'
+#line 492 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[3].value.as < VN::NodeAndGnomon > ().node, {}, yystack_[1].value.as < list<TreePtr<Node>> > () ); }
+#line 2934 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 165: // inheritance_record: irecord_scope ':' bases '{' members '}'
+#line 493 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[5].value.as < VN::NodeAndGnomon > ().node, yystack_[3].value.as < list<TreePtr<Node>> > (), yystack_[1].value.as < list<TreePtr<Node>> > () ); }
+#line 2940 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 166: // inheritance_record: irecord_scope '{' '}'
+#line 494 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[2].value.as < VN::NodeAndGnomon > ().node, {}, {} ); }
+#line 2946 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 167: // inheritance_record: irecord_scope ':' bases '{' '}'
+#line 495 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[4].value.as < VN::NodeAndGnomon > ().node, yystack_[2].value.as < list<TreePtr<Node>> > (), {} ); }
+#line 2952 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 168: // irecord_scope: irecord_node type_specified
+#line 497 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < VN::NodeAndGnomon > () = { vn->ApplyIdentifier(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].location, yystack_[0].value.as < TreePtr<Node> > ()), 
+																		             vn->MakeRecordScopeGnomon(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()) }; 
+																			  vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 2960 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 169: // irecord_node: "C class/struct/union keyword"
+#line 501 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->StartRecord(yylhs.location, yystack_[0].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 2966 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 170: // irecord_node: explicit_decl_node
+#line 502 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2972 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 171: // bases: base_spec
+#line 504 "src/vn/lang/vn_lang.ypp"
+                                                                                    { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2978 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 172: // bases: bases ',' base_spec
+#line 505 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2984 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 173: // base_spec: type_specified
+#line 507 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBase(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 2990 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 174: // base_spec: id_wildcard
+#line 508 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 2996 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 175: // base_spec: "designated statement/expression name"
+#line 509 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3002 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 176: // base_spec: access_spec type_specified
+#line 510 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnBase(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > (), yylhs.location); }
+#line 3008 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 177: // members: member
+#line 512 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3014 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 178: // members: members member
+#line 513 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[1].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3020 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 179: // acc_memb_boot: bare_member_nvn
+#line 515 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3026 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 180: // acc_memb_boot: bare_member_nvn ';'
+#line 516 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3032 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 181: // acc_memb_boot: comp_member
+#line 517 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3038 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 182: // acc_memb_boot: acc_memb_prefix
+#line 518 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3044 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 183: // member: bare_member ';'
+#line 520 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3050 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 184: // member: comp_member
+#line 521 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3056 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 185: // comp_member: comp_decl_nvn
+#line 524 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3062 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 186: // comp_member: access_clause comp_decl_nvn
+#line 525 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->ApplyAccessSpec(yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location, yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3068 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 187: // bare_member: bare_member_nvn
+#line 527 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3074 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 188: // bare_member: acc_memb_prefix
+#line 528 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3080 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 189: // bare_member_nvn: bare_decl_nvn
+#line 530 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3086 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 190: // bare_member_nvn: access_clause bare_decl_nvn
+#line 531 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->ApplyAccessSpec(yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location, yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3092 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 191: // access_clause: acc_memb_prefix ':'
+#line 533 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3098 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 192: // access_spec: qualifier_node
+#line 535 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3104 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 193: // acc_memb_prefix: acc_memb_postfix
+#line 541 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3110 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 194: // acc_memb_prefix: "green-grass operator ⫴" acc_memb_prefix
+#line 542 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnGrass(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3116 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 195: // acc_memb_prefix: "pointer-is operator ⮎" acc_memb_prefix
+#line 543 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPointerIs(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3122 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 196: // acc_memb_prefix: "negation operator ¬" acc_memb_prefix
+#line 544 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3128 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 197: // acc_memb_prefix: decl_prerestrict_op_named acc_memb_prefix
+#line 545 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < shared_ptr<VN::PrerestrictScopeGnomon> > ()->block, yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3134 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 198: // acc_memb_prefix: stuff_op_scope unified_prefix
+#line 546 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, VN::Limit()); }
+#line 3140 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 199: // acc_memb_prefix: stuff_op_scope "open VN-params ⦅" unified_entry "close VN-params ⦆" unified_prefix
+#line 547 "src/vn/lang/vn_lang.ypp"
+                                                                                               { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), yystack_[2].value.as < TreePtr<Node> > (), VN::Limit()); }
+#line 3146 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 200: // acc_memb_prefix: stuff_op_scope "open VN-params ⦅" stuff_depth "close VN-params ⦆" unified_prefix
+#line 548 "src/vn/lang/vn_lang.ypp"
+                                                                                              { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, yystack_[2].value.as < VN::Limit > ()); }
+#line 3152 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 201: // acc_memb_prefix: "build-container-size operator 🄽" unified_prefix
+#line 549 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildSize(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3158 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 202: // acc_memb_prefix: "stringise operator §" unified_prefix
+#line 550 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStringize(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3164 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 203: // acc_memb_postfix: acc_memb_paren
+#line 553 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3170 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 204: // acc_memb_paren: acc_memb_primary
+#line 555 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3176 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 205: // acc_memb_paren: '(' acc_memb_boot ')'
+#line 556 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3182 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 206: // acc_memb_primary: qualifier_node
+#line 558 "src/vn/lang/vn_lang.ypp"
+                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3188 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 207: // acc_memb_primary: "delta-compare operator ▲" acc_memb_boot "delta-replace operator ⯈" acc_memb_boot "delta-end operator ⯇"
+#line 559 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnDelta(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3194 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 208: // acc_memb_primary: decl_full_explicit_start itemisation
+#line 560 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 3200 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 209: // acc_memb_primary: "designated declaration name"
+#line 561 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3206 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 210: // acc_memb_primary: "designated statement/expression name"
+#line 562 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3212 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 211: // acc_memb_primary: "designated compound name"
+#line 563 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3218 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 212: // acc_memb_primary: transform_op_named "open VN-params ⦅" unified_prefix "close VN-params ⦆"
+#line 564 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnTransform(yystack_[3].value.as < string > (), yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3224 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 213: // acc_memb_primary: "star operator ★"
+#line 565 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(nullptr); }
+#line 3230 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 214: // acc_memb_primary: "star operator ★" "open VN-params ⦅" acc_memb_boot "close VN-params ⦆"
+#line 566 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3236 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 215: // acc_memb_primary: "any node operator ☆"
+#line 567 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = nullptr; }
+#line 3242 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 216: // enum: enum_scope '{' enumerators '}'
+#line 571 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[3].value.as < VN::NodeAndGnomon > ().node, {}, yystack_[1].value.as < list<TreePtr<Node>> > () ); }
+#line 3248 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 217: // enum: enum_scope '{' '}'
+#line 572 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishRecord( yylhs.location, yystack_[2].value.as < VN::NodeAndGnomon > ().node, {}, {} ); }
+#line 3254 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 218: // enum_scope: enum_node type_specified
+#line 574 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < VN::NodeAndGnomon > () = { vn->ApplyIdentifier(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].location, yystack_[0].value.as < TreePtr<Node> > ()), 
+																		             vn->MakeRecordScopeGnomon(yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()) }; 
+																			  vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 3262 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 219: // enum_node: "C enumeration keyword"
+#line 578 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->StartRecord(yylhs.location, yystack_[0].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 3268 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 220: // enumerators: enumerator
+#line 581 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3274 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 221: // enumerators: enumerators ',' enumerator
+#line 582 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3280 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 222: // enumerator: prototype_enumerator
+#line 585 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3286 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 223: // enumerator: prototype_enumerator "C assignment operator =" assign_init
+#line 586 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->ApplyInitialiser(yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3292 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 224: // enumerator: "designated declaration name"
+#line 587 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3298 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 225: // prototype_enumerator: id_primary
+#line 589 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnEnumerator(yystack_[0].location, yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3304 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 226: // stmt_entry: stmt_disjunction
+#line 593 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3310 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 227: // stmt_disjunction: stmt_conjunction
+#line 595 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3316 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 228: // stmt_disjunction: stmt_disjunction "disjunction operator ∨" stmt_conjunction
+#line 596 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3322 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 229: // stmt_disjunction: stmt_disjunction "disjunction operator ∨" decl_conjunction
+#line 597 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3328 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 230: // stmt_conjunction: open_statement
+#line 599 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3334 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 231: // stmt_conjunction: stmt_conjunction "conjunction operator ∧" open_statement
+#line 600 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3340 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 232: // stmt_conjunction: stmt_conjunction "conjunction operator ∧" open_declaration
+#line 601 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3346 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 233: // open_statement: open_statement_nc
+#line 603 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3352 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 234: // open_statement: compound_entry
+#line 604 "src/vn/lang/vn_lang.ypp"
+                                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3358 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 235: // stmt_entry_nc: stmt_disjunction_nc
+#line 606 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3364 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 236: // stmt_disjunction_nc: stmt_conjunction_nc
+#line 608 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3370 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 237: // stmt_disjunction_nc: stmt_disjunction_nc "disjunction operator ∨" stmt_conjunction_nc
+#line 609 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3376 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 238: // stmt_disjunction_nc: stmt_disjunction_nc "disjunction operator ∨" decl_conjunction
+#line 610 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3382 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 239: // stmt_conjunction_nc: open_statement_nc
+#line 612 "src/vn/lang/vn_lang.ypp"
+                      { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3388 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 240: // stmt_conjunction_nc: stmt_conjunction_nc "conjunction operator ∧" open_statement_nc
+#line 613 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3394 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 241: // stmt_conjunction_nc: stmt_conjunction_nc "conjunction operator ∧" open_declaration
+#line 614 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3400 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 242: // open_statement_nc: expr_entry
+#line 616 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3406 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 243: // open_statement_nc: statement
+#line 617 "src/vn/lang/vn_lang.ypp"
+                                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3412 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 244: // stmt_comp: statement_l
+#line 619 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNeedSoloStatement(yystack_[0].value.as < list<TreePtr<Node>> > (), yystack_[0].location); }
+#line 3418 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 245: // stmt_comp: compound_entry
+#line 620 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3424 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 246: // statement: statement_l
+#line 622 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNeedSoloStatement(yystack_[0].value.as < list<TreePtr<Node>> > (), yystack_[0].location); }
+#line 3430 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 247: // statement_l: statement_e
+#line 624 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[0].value.as < list<TreePtr<Node>> > (); }
+#line 3436 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 248: // statement_l: ';'
+#line 625 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = { vn->OnNop(yystack_[0].location) }; }
+#line 3442 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 249: // statement_e: statement_nc
+#line 628 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[0].value.as < list<TreePtr<Node>> > (); }
+#line 3448 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 250: // statement_nc: statement_nl
+#line 630 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[0].value.as < TreePtr<Node> > ()}; }
+#line 3454 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 251: // statement_nc: arrival statement_nl
+#line 631 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()}; }
+#line 3460 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 252: // statement_nc: arrival ';'
+#line 632 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = {yystack_[1].value.as < TreePtr<Node> > ()}; }
+#line 3466 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 253: // arrival: "C case keyword" expr_entry ':'
+#line 634 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnCase(yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3472 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 254: // arrival: "C case keyword" expr_entry "GCC range operator .." expr_entry ':'
+#line 635 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnRangeCase(yystack_[3].value.as < TreePtr<Node> > (), yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3478 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 255: // arrival: "C default keyword" ':'
+#line 636 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnDefault(yylhs.location); }
+#line 3484 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 256: // arrival: expr_prefix ':'
+#line 637 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnLabel(yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3490 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 257: // statement_nl: bare_statement ';'
+#line 639 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3496 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 258: // statement_nl: expr_entry ';'
+#line 640 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3502 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 259: // statement_nl: "keyword args-and-body statement" '(' semicolon_args ')' stmt_comp
+#line 642 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnArgsBodyStmt(yystack_[4].value.as < YY::TokenMetadata > ().as_ascii, yystack_[4].location, yystack_[2].value.as < list<TreePtr<Node>> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3508 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 260: // statement_nl: "C while keyword" '(' stmt_boot ')' stmt_comp
+#line 643 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnWhile(yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3514 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 261: // statement_nl: "keyword args-body-chain statement" '(' semicolon_args ')' stmt_comp
+#line 645 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnArgsBodyChainStmt(yystack_[4].value.as < YY::TokenMetadata > ().as_ascii, yystack_[4].location, yystack_[2].value.as < list<TreePtr<Node>> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location, "", yystack_[4].location, nullptr, yystack_[4].location); }
+#line 3520 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 262: // statement_nl: "keyword args-body-chain statement" '(' semicolon_args ')' stmt_comp "C chaining keyword" stmt_comp
+#line 647 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnArgsBodyChainStmt(yystack_[6].value.as < YY::TokenMetadata > ().as_ascii, yystack_[6].location, yystack_[4].value.as < list<TreePtr<Node>> > (), yystack_[4].location, yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[1].value.as < YY::TokenMetadata > ().as_ascii, yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3526 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 263: // bare_statement: "keyword simple statement"
+#line 649 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnSimpleStmt(yystack_[0].value.as < YY::TokenMetadata > ().as_ascii, yystack_[0].location); }
+#line 3532 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 264: // bare_statement: "keyword space-separated statement" expr_entry
+#line 650 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnSpaceSepStmt(yystack_[1].value.as < YY::TokenMetadata > ().as_ascii, yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3538 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 265: // bare_statement: "C do keyword" stmt_comp "C while keyword" '(' stmt_boot ')'
+#line 651 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDo(yystack_[4].value.as < TreePtr<Node> > (), yystack_[4].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3544 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 266: // semicolon_args: expr_entry
+#line 653 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3550 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 267: // semicolon_args: semicolon_args ';' expr_entry
+#line 654 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3556 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 268: // expr_entry: expr_comma_op
+#line 658 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3562 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 269: // expr_comma_op: expr_no_comma_op
+#line 660 "src/vn/lang/vn_lang.ypp"
+                      { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3568 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 270: // expr_no_comma_op: expr_id_value
+#line 664 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3574 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 271: // expr_id_value: expr_assignment
+#line 666 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3580 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 272: // expr_id_value: expr_id_value "map-argument operator ⦂" expr_assignment
+#line 667 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnIdValuePair(yystack_[2].value.as < TreePtr<Node> > (), yystack_[2].location, yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3586 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 273: // expr_assignment: expr_logical_or
+#line 669 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3592 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 274: // expr_assignment: expr_logical_or "C assignment operator =" expr_assignment
+#line 670 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3598 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 275: // expr_assignment: expr_logical_or "C compound-assignment operator" expr_assignment
+#line 671 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3604 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 276: // expr_assignment: expr_logical_or '?' expr_entry ':' expr_assignment
+#line 672 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConditionalOperator(yystack_[4].value.as < TreePtr<Node> > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3610 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 277: // expr_logical_or: expr_logical_and
+#line 674 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3616 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 278: // expr_logical_or: expr_logical_or "C logical-or operator ||" expr_logical_and
+#line 675 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3622 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 279: // expr_logical_and: expr_bitwise_or
+#line 677 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3628 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 280: // expr_logical_and: expr_logical_and "C logical-and operator &&" expr_bitwise_or
+#line 678 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3634 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 281: // expr_bitwise_or: expr_bitwise_xor
+#line 680 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3640 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 282: // expr_bitwise_or: expr_bitwise_or "C bitwise-or operator |" expr_bitwise_xor
+#line 681 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3646 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 283: // expr_bitwise_xor: expr_bitwise_and
+#line 683 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3652 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 284: // expr_bitwise_xor: expr_bitwise_xor "C bitwise-xor operator ^" expr_bitwise_and
+#line 684 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3658 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 285: // expr_bitwise_and: expr_equality
+#line 686 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3664 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 286: // expr_bitwise_and: expr_bitwise_and '&' expr_equality
+#line 687 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator("&", yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3670 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 287: // expr_equality: expr_relational
+#line 689 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3676 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 288: // expr_equality: expr_equality "C equality operator ==" expr_relational
+#line 690 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3682 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 289: // expr_relational: expr_shift
+#line 692 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3688 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 290: // expr_relational: expr_relational "C relational operator" expr_shift
+#line 693 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3694 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 291: // expr_shift: expr_add_etc
+#line 695 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3700 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 292: // expr_shift: expr_shift "C shift operator operator" expr_add_etc
+#line 696 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3706 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 293: // expr_add_etc: expr_mul_etc
+#line 698 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3712 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 294: // expr_add_etc: expr_add_etc "C add/subtract operator" expr_mul_etc
+#line 699 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3718 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 295: // expr_mul_etc: expr_prefix
+#line 701 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3724 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 296: // expr_mul_etc: expr_mul_etc "C divide/modulo operator" expr_prefix
+#line 702 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator(yystack_[1].value.as < string > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3730 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 297: // expr_mul_etc: expr_mul_etc '*' expr_prefix
+#line 703 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnInfixOperator("*", yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3736 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 298: // expr_prefix: expr_postfix
+#line 705 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3742 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 299: // expr_prefix: "C prefix operator" expr_prefix
+#line 706 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator(yystack_[1].value.as < string > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3748 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 300: // expr_prefix: '&' expr_prefix
+#line 707 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator("&", yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3754 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 301: // expr_prefix: '*' expr_prefix
+#line 708 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator("*", yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3760 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 302: // expr_prefix: "C add/subtract operator" expr_prefix
+#line 709 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator(yystack_[1].value.as < string > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3766 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 303: // expr_prefix: "C prefix/infix operator" expr_prefix
+#line 710 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator(yystack_[1].value.as < string > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3772 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 304: // expr_prefix: "C prefix/postfix operator" expr_prefix
+#line 711 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPrefixOperator(yystack_[1].value.as < string > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3778 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 305: // expr_prefix: "green-grass operator ⫴" expr_prefix
+#line 712 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnGrass(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3784 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 306: // expr_prefix: "pointer-is operator ⮎" expr_prefix
+#line 713 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPointerIs(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3790 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 307: // expr_prefix: "negation operator ¬" expr_prefix
+#line 714 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3796 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 308: // expr_prefix: prerestrict_op_named expr_prefix
+#line 715 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < const ANDBlock * > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3802 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 309: // expr_prefix: mi_prerestrict_op_named memb_init_prefix
+#line 716 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < const ANDBlock * > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3808 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 310: // expr_prefix: stuff_op_scope unified_prefix
+#line 717 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, VN::Limit()); }
+#line 3814 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 311: // expr_prefix: stuff_op_scope "open VN-params ⦅" unified_entry "close VN-params ⦆" unified_prefix
+#line 718 "src/vn/lang/vn_lang.ypp"
+                                                                                       { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), yystack_[2].value.as < TreePtr<Node> > (), VN::Limit()); }
+#line 3820 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 312: // expr_prefix: stuff_op_scope "open VN-params ⦅" stuff_depth "close VN-params ⦆" unified_prefix
+#line 719 "src/vn/lang/vn_lang.ypp"
+                                                                                      { yylhs.value.as < TreePtr<Node> > () = vn->OnStuff(yystack_[0].value.as < TreePtr<Node> > (), nullptr, yystack_[2].value.as < VN::Limit > ()); }
+#line 3826 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 313: // expr_prefix: "build-container-size operator 🄽" unified_prefix
+#line 720 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildSize(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3832 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 314: // expr_prefix: "stringise operator §" unified_prefix
+#line 721 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStringize(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 3838 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 315: // stuff_depth: "C assignment operator =" "C integer literal"
+#line 724 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < VN::Limit > () = VN::Limit{ yystack_[1].value.as < string > (), yystack_[1].location, yystack_[0].value.as < string > (), yystack_[0].location }; }
+#line 3844 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 316: // expr_postfix: expr_primary
+#line 726 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3850 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 317: // expr_postfix: expr_postfix "C prefix/postfix operator"
+#line 727 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnPostfixOperator(yystack_[0].value.as < string > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3856 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 318: // expr_postfix: expr_postfix '[' stmt_entry ']'
+#line 728 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnSubscript(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3862 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 319: // expr_postfix: expr_postfix "open map-arguments 〔" comma_sep_expr_decl "close map-arguments 〕"
+#line 729 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnMapArgsCall(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < list<TreePtr<Node>> > ()); }
+#line 3868 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 320: // expr_postfix: expr_postfix "open map-arguments 〔" "close map-arguments 〕"
+#line 730 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnMapArgsCall(yystack_[2].value.as < TreePtr<Node> > (), list<TreePtr<Node>>()); }
+#line 3874 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 321: // expr_postfix: expr_postfix '(' comma_sep_expr_decl ')'
+#line 731 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnSeqArgsCall(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < list<TreePtr<Node>> > ()); }
+#line 3880 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 322: // expr_postfix: expr_postfix '(' ')'
+#line 732 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnSeqArgsCall(yystack_[2].value.as < TreePtr<Node> > (), list<TreePtr<Node>>()); }
+#line 3886 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 323: // expr_postfix: expr_postfix '.' expr_primary
+#line 733 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnLookup(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 3892 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 324: // expr_primary: id_primary
+#line 735 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3898 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 325: // expr_primary: '(' stmt_boot ')'
+#line 736 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 3904 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 326: // expr_primary: "C integer literal"
+#line 737 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnIntegralLiteral(yystack_[0].value.as < string > (), yystack_[0].location); }
+#line 3910 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 327: // expr_primary: "C string literal"
+#line 738 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnStringLiteral(yystack_[0].value.as < wstring > ()); }
+#line 3916 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 328: // expr_primary: "C boolean literal"
+#line 739 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBoolLiteral(yystack_[0].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 3922 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 329: // expr_primary: "open_statement keyword operator"
+#line 740 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnNormalTerminalKeyword(yystack_[0].value.as < YY::TokenMetadata > ().as_ascii, yystack_[0].location); }
+#line 3928 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 330: // expr_primary: "function acting on a type" '(' type_boot ')'
+#line 741 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnFuncOnType(yystack_[3].value.as < YY::TokenMetadata > ().as_ascii, yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3934 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 331: // expr_primary: "designated compound name"
+#line 742 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3940 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 332: // id_primary: id_wildcard
+#line 744 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 3946 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 333: // id_primary: "delta-compare operator ▲" stmt_boot "delta-replace operator ⯈" stmt_boot "delta-end operator ⯇"
+#line 745 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnDelta(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 3952 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 334: // id_primary: norm_full_explicit_start itemisation
+#line 746 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 3958 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 335: // id_primary: "designated statement/expression name"
+#line 747 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 3964 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 336: // id_primary: id_by_name_op_named "open VN-params ⦅" "C string literal" "close VN-params ⦆"
+#line 748 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnIdByName(yystack_[3].value.as < const ANDBlock * > (), yystack_[3].location, yystack_[1].value.as < wstring > (), yystack_[1].location); }
+#line 3970 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 337: // id_primary: build_id_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" "close VN-params ⦆"
+#line 749 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, yystack_[2].value.as < wstring > (), yystack_[2].location, VN::Item{}); }
+#line 3976 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 338: // id_primary: build_id_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 750 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[5].value.as < const ANDBlock * > (), yystack_[5].location, yystack_[3].value.as < wstring > (), yystack_[3].location, yystack_[1].value.as < VN::Item > ()); }
+#line 3982 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 339: // id_primary: build_id_named "open VN-params ⦅" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 751 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, wstring(), yystack_[2].location, yystack_[1].value.as < VN::Item > ()); }
+#line 3988 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 340: // id_primary: transform_op_named "open VN-params ⦅" unified_prefix "close VN-params ⦆"
+#line 752 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnTransform(yystack_[3].value.as < string > (), yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 3994 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 341: // id_wildcard: "star operator ★"
+#line 754 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(nullptr); }
+#line 4000 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 342: // id_wildcard: "star operator ★" "open VN-params ⦅" stmt_entry "close VN-params ⦆"
+#line 755 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 4006 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 343: // id_wildcard: "any node operator ☆"
+#line 756 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = nullptr; }
+#line 4012 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 344: // comma_sep_expr_decl: expr_no_comma_op
+#line 758 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4018 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 345: // comma_sep_expr_decl: comma_sep_expr_decl ',' expr_no_comma_op
+#line 759 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < list<TreePtr<Node>> > () = yystack_[2].value.as < list<TreePtr<Node>> > (); yylhs.value.as < list<TreePtr<Node>> > ().push_back(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4024 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 346: // norm_full_explicit_start: explicit_norm_node
+#line 761 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < VN::NodeAndGnomon > () = vn->MakeScopeGnomonForNode(yystack_[0].value.as < TreePtr<Node> > ()); 
+																	  vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 4031 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 347: // prerestrict_op_named: prerestrict_op_scope resolved_norm_name
+#line 764 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4037 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 348: // id_by_name_op_named: id_by_name_op_scope resolved_norm_name
+#line 765 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4043 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 349: // build_id_named: builder_id_op_scope resolved_norm_name
+#line 766 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4049 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 350: // transform_op_named: transform_op_scope "open_statement transform name"
+#line 767 "src/vn/lang/vn_lang.ypp"
+                                                               { yylhs.value.as < string > () = yystack_[0].value.as < YY::TokenMetadata > ().as_ascii; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4055 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 351: // type_id: ab_type
+#line 772 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4061 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 352: // ab_type: type_for_declarator ab_declarator
+#line 774 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnAbDeclType(yylhs.location, {}, yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4067 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 353: // ab_type: qualifiers type_for_declarator ab_declarator
+#line 775 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnAbDeclType(yylhs.location, yystack_[2].value.as < list<VN::QualifierData> > (), yystack_[1].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4073 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 354: // ab_type: type_for_declarator qualifiers ab_declarator
+#line 776 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnAbDeclType(yylhs.location, yystack_[1].value.as < list<VN::QualifierData> > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4079 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 355: // ab_type: qualifiers type_for_declarator qualifiers ab_declarator
+#line 777 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnAbDeclType(yylhs.location, yystack_[3].value.as < list<VN::QualifierData> > ()+yystack_[1].value.as < list<VN::QualifierData> > (), yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4085 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 356: // ab_type: type_for_declarator
+#line 778 "src/vn/lang/vn_lang.ypp"
+                                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4091 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 357: // ab_type: "constructor/destructor virtual type ⨤" parameterisation
+#line 779 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnConstructorType(yystack_[0].value.as < list<TreePtr<Node>> > ()); }
+#line 4097 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 358: // type_boot: type_entry
+#line 783 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4103 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 359: // type_entry: type_disjunction
+#line 785 "src/vn/lang/vn_lang.ypp"
+                                  { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4109 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 360: // type_disjunction: type_conjunction
+#line 787 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4115 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 361: // type_disjunction: type_disjunction "disjunction operator ∨" type_conjunction
+#line 788 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnDisjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4121 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 362: // type_conjunction: type_specified
+#line 790 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4127 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 363: // type_conjunction: type_conjunction "conjunction operator ∧" type_specified
+#line 791 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnConjunction(yystack_[2].value.as < TreePtr<Node> > (), yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4133 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 364: // type_specified: type_prefix
+#line 794 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4139 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 365: // type_prefix: type_postfix
+#line 796 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4145 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 366: // type_prefix: "green-grass operator ⫴" type_prefix
+#line 797 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnGrass(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4151 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 367: // type_prefix: "pointer-is operator ⮎" type_prefix
+#line 798 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnPointerIs(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4157 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 368: // type_prefix: "negation operator ¬" type_prefix
+#line 799 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->OnNegation(yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4163 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 369: // type_prefix: type_prerestrict_op_named type_prefix
+#line 800 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnRestrict(yystack_[1].value.as < const ANDBlock * > (), yystack_[1].location, yystack_[0].value.as < TreePtr<Node> > (), yystack_[0].location); }
+#line 4169 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 370: // type_prefix: "type indicator ⍑" expr_prefix
+#line 801 "src/vn/lang/vn_lang.ypp"
+                                                                                                                    { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4175 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 371: // type_postfix: type_primary
+#line 803 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4181 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 372: // type_for_declarator: type_primary
+#line 806 "src/vn/lang/vn_lang.ypp"
+                      { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4187 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 373: // type_primary: type_vn_prim
+#line 808 "src/vn/lang/vn_lang.ypp"
+              { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4193 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 374: // type_primary: '(' type_boot ')'
+#line 809 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 4199 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 375: // type_primary: type_specifier_seq
+#line 810 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnTypeSpecifierSeq(yystack_[0].value.as < multiset<string> > (), yystack_[0].location); }
+#line 4205 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 376: // type_primary: "type indicator ⍑" "type indicator ⍑" '(' type_id ')'
+#line 811 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[1].value.as < TreePtr<Node> > (); }
+#line 4211 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 377: // type_vn_prim: type_full_explicit_start itemisation
+#line 813 "src/vn/lang/vn_lang.ypp"
+                                                                                                                 { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 4217 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 378: // type_vn_prim: "delta-compare operator ▲" type_boot "delta-replace operator ⯈" type_boot "delta-end operator ⯇"
+#line 814 "src/vn/lang/vn_lang.ypp"
+                                                                                             { yylhs.value.as < TreePtr<Node> > () = vn->OnDelta(yystack_[3].value.as < TreePtr<Node> > (), yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 4223 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 379: // type_vn_prim: "designated type name"
+#line 815 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                         { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 4229 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 380: // type_vn_prim: type_id_by_name_op_named "open VN-params ⦅" "C string literal" "close VN-params ⦆"
+#line 816 "src/vn/lang/vn_lang.ypp"
+                                                                                                         { yylhs.value.as < TreePtr<Node> > () = vn->OnIdByName(yystack_[3].value.as < const ANDBlock * > (), yystack_[3].location, yystack_[1].value.as < wstring > (), yystack_[1].location); }
+#line 4235 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 381: // type_vn_prim: type_build_id_op_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" "close VN-params ⦆"
+#line 817 "src/vn/lang/vn_lang.ypp"
+                                                                                                 { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, yystack_[2].value.as < wstring > (), yystack_[2].location, VN::Item{}); }
+#line 4241 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 382: // type_vn_prim: type_build_id_op_named "open VN-params ⦅" "C string literal" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 818 "src/vn/lang/vn_lang.ypp"
+                                                                                             { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[5].value.as < const ANDBlock * > (), yystack_[5].location, yystack_[3].value.as < wstring > (), yystack_[3].location, yystack_[1].value.as < VN::Item > ()); }
+#line 4247 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 383: // type_vn_prim: type_build_id_op_named "open VN-params ⦅" "VN-param separator ⚬" item "close VN-params ⦆"
+#line 819 "src/vn/lang/vn_lang.ypp"
+                                                                                                         { yylhs.value.as < TreePtr<Node> > () = vn->OnBuildId(yystack_[4].value.as < const ANDBlock * > (), yystack_[4].location, wstring(), yystack_[2].location, yystack_[1].value.as < VN::Item > ()); }
+#line 4253 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 384: // type_vn_prim: type_transform_op_named "open VN-params ⦅" unified_prefix "close VN-params ⦆"
+#line 820 "src/vn/lang/vn_lang.ypp"
+                                                                                                         { yylhs.value.as < TreePtr<Node> > () = vn->OnTransform(yystack_[3].value.as < string > (), yystack_[3].location, yystack_[1].value.as < TreePtr<Node> > (), yystack_[1].location); }
+#line 4259 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 385: // type_vn_prim: "type indicator ⍑" "star operator ★" "open VN-params ⦅" type_boot "close VN-params ⦆"
+#line 821 "src/vn/lang/vn_lang.ypp"
+                                                                                                                 { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 4265 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 386: // type_vn_prim: "star operator ★" "open VN-params ⦅" type_boot "close VN-params ⦆"
+#line 822 "src/vn/lang/vn_lang.ypp"
+                                                                                                                         { yylhs.value.as < TreePtr<Node> > () = vn->OnStar(yystack_[1].value.as < TreePtr<Node> > ()); }
+#line 4271 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 387: // type_full_explicit_start: explicit_type_node
+#line 824 "src/vn/lang/vn_lang.ypp"
+                                                                                                                { yylhs.value.as < VN::NodeAndGnomon > () = vn->MakeScopeGnomonForNode(yystack_[0].value.as < TreePtr<Node> > ()); 
+                                                                                  vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 4278 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 388: // type_prerestrict_op_named: prerestrict_op_scope resolved_type_name
+#line 826 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4284 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 389: // type_id_by_name_op_named: id_by_name_op_scope resolved_type_name
+#line 827 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4290 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 390: // type_build_id_op_named: builder_id_op_scope resolved_type_name
+#line 828 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < const ANDBlock * > () = yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4296 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 391: // type_transform_op_named: transform_op_scope "type transform name"
+#line 829 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < string > () = yystack_[0].value.as < YY::TokenMetadata > ().as_ascii; (void)yystack_[1].value.as < shared_ptr<VN::Gnomon> > (); }
+#line 4302 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 392: // type_specifier_seq: "C simple type specifier"
+#line 833 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < multiset<string> > ().insert(yystack_[0].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 4308 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 393: // type_specifier_seq: "C simple type specifier" type_specifier_seq
+#line 834 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < multiset<string> > () = yystack_[0].value.as < multiset<string> > (); yylhs.value.as < multiset<string> > ().insert(yystack_[1].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 4314 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 394: // qualifiers: qualifier
+#line 838 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < list<VN::QualifierData> > ().push_back(yystack_[0].value.as < VN::QualifierData > ()); }
+#line 4320 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 395: // qualifiers: qualifiers qualifier
+#line 839 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < list<VN::QualifierData> > () = yystack_[1].value.as < list<VN::QualifierData> > (); yylhs.value.as < list<VN::QualifierData> > ().push_back(yystack_[0].value.as < VN::QualifierData > ()); }
+#line 4326 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 396: // qualifier: qualifier_nw
+#line 841 "src/vn/lang/vn_lang.ypp"
+                          { yylhs.value.as < VN::QualifierData > () = yystack_[0].value.as < VN::QualifierData > (); }
+#line 4332 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 397: // qualifier_nw: qualifier_node
+#line 844 "src/vn/lang/vn_lang.ypp"
+                                                                                                                        { yylhs.value.as < VN::QualifierData > () = VN::QualifierData(yylhs.value.as < VN::QualifierData > (), VN::QualCat::NODE, yystack_[0].value.as < TreePtr<Node> > ()); }
+#line 4338 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 398: // qualifier_nw: "C static keyword"
+#line 845 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < VN::QualifierData > () = VN::QualifierData(yylhs.value.as < VN::QualifierData > (), VN::QualCat::STATIC); }
+#line 4344 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 399: // qualifier_nw: "C typedef keyword"
+#line 846 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < VN::QualifierData > () = VN::QualifierData(yylhs.value.as < VN::QualifierData > (), VN::QualCat::TYPEDEF); }
+#line 4350 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 400: // qualifier_node: qual_full_explicit_start itemisation
+#line 848 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->FinishExplicitNode(yystack_[1].value.as < VN::NodeAndGnomon > ().node, yystack_[1].location, yystack_[0].value.as < VN::Itemisation > ()); }
+#line 4356 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 401: // qualifier_node: "C qualifier"
+#line 849 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                        { yylhs.value.as < TreePtr<Node> > () = vn->OnQualifierNodeKeyword(yystack_[0].value.as < YY::TokenMetadata > ().as_ascii); }
+#line 4362 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 402: // qualifier_node: "designated qualifier name"
+#line 850 "src/vn/lang/vn_lang.ypp"
+                                                                                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < YY::TokenMetadata > ().node; }
+#line 4368 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 403: // qual_full_explicit_start: explicit_qual_node
+#line 852 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < VN::NodeAndGnomon > () = vn->MakeScopeGnomonForNode(yystack_[0].value.as < TreePtr<Node> > ()); 
+                                                                              vn->AddGnomon(yylhs.value.as < VN::NodeAndGnomon > ().gnomon); }
+#line 4375 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 404: // vn_name: "Unicode name"
+#line 860 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < wstring > () = yystack_[0].value.as < YY::TokenMetadata > ().as_unicode; }
+#line 4381 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 405: // vn_name: "ASCII name"
+#line 861 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < wstring > () = yystack_[0].value.as < YY::TokenMetadata > ().as_unicode; }
+#line 4387 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 406: // explicit_norm_node: explicit_op_scope resolved_norm_node
+#line 867 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4393 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 407: // resolved_norm_node: resolved_norm_name
+#line 869 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->NodeFromANDataBlock(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); }
+#line 4399 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 408: // resolved_norm_name: part_resolve "resolved open_statement node name"
+#line 871 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4405 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 409: // resolved_norm_name: "resolved open_statement node name"
+#line 872 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4411 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 410: // explicit_type_node: explicit_op_scope resolved_type_node
+#line 874 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4417 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 411: // resolved_type_node: resolved_type_name
+#line 876 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->NodeFromANDataBlock(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); }
+#line 4423 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 412: // resolved_type_name: part_resolve "resolved type node name"
+#line 878 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4429 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 413: // resolved_type_name: "resolved type node name"
+#line 879 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4435 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 414: // explicit_decl_node: explicit_op_scope resolved_decl_node
+#line 881 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4441 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 415: // resolved_decl_node: resolved_decl_name
+#line 883 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->NodeFromANDataBlock(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); }
+#line 4447 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 416: // resolved_decl_name: part_resolve "resolved declaration node name"
+#line 885 "src/vn/lang/vn_lang.ypp"
+                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4453 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 417: // resolved_decl_name: "resolved declaration node name"
+#line 886 "src/vn/lang/vn_lang.ypp"
+                                                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4459 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 418: // explicit_qual_node: explicit_op_scope resolved_qual_node
+#line 888 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4465 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 419: // resolved_qual_node: resolved_qual_name
+#line 890 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->NodeFromANDataBlock(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); }
+#line 4471 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 420: // resolved_qual_name: part_resolve "resolved qualifier node name"
+#line 892 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4477 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 421: // resolved_qual_name: "resolved qualifier node name"
+#line 893 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4483 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 422: // explicit_mi_node: explicit_op_scope resolved_mi_node
+#line 895 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < TreePtr<Node> > () = yystack_[0].value.as < TreePtr<Node> > (); }
+#line 4489 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 423: // resolved_mi_node: resolved_mi_name
+#line 897 "src/vn/lang/vn_lang.ypp"
+                                                                                { yylhs.value.as < TreePtr<Node> > () = vn->NodeFromANDataBlock(yystack_[0].value.as < YY::TokenMetadata > ().as_andata_block); }
+#line 4495 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 424: // resolved_mi_name: part_resolve "resolved member initialiser node name"
+#line 899 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4501 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 425: // resolved_mi_name: "resolved member initialiser node name"
+#line 900 "src/vn/lang/vn_lang.ypp"
+                                                                                        { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4507 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 426: // part_resolve: node_namespace "C scope-resolution operator ::"
+#line 905 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::ResolverGnomon>(yystack_[1].value.as < YY::TokenMetadata > ().as_andata_block);
+                                                          recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4514 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 427: // node_namespace: part_resolve "scope resolving name"
+#line 908 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4520 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 428: // node_namespace: "scope resolving name"
+#line 909 "src/vn/lang/vn_lang.ypp"
+                                                                                                { yylhs.value.as < YY::TokenMetadata > () = yystack_[0].value.as < YY::TokenMetadata > (); }
+#line 4526 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 429: // explicit_op_scope: "explicit node operator ⯁"
+#line 912 "src/vn/lang/vn_lang.ypp"
+                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::NodeNameScopeGnomon>(); 
+										      recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4533 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 430: // prerestrict_op_scope: "prerestriction operator ‽"
+#line 915 "src/vn/lang/vn_lang.ypp"
+                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::NodeNameScopeGnomon>(); 
+										      recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4540 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 431: // id_by_name_op_scope: "identifier-by-name operator ⊛"
+#line 918 "src/vn/lang/vn_lang.ypp"
+                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::NodeNameScopeGnomon>(); 
+											  recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4547 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 432: // builder_id_op_scope: "node-builder operator ⧇"
+#line 921 "src/vn/lang/vn_lang.ypp"
+                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::NodeNameScopeGnomon>(); 
+											  recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4554 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 433: // transform_op_scope: "transform operator ⤨"
+#line 924 "src/vn/lang/vn_lang.ypp"
+                                                        { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::TransformNameScopeGnomon>(); 
+											  recogniser->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4561 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+  case 434: // stuff_op_scope: "stuff operator ⩨"
+#line 927 "src/vn/lang/vn_lang.ypp"
+                                                                { yylhs.value.as < shared_ptr<VN::Gnomon> > () = make_shared<VN::UnknownScopeGnomon>("stuff pattern"); 
+											  vn->AddGnomon(yylhs.value.as < shared_ptr<VN::Gnomon> > ()); }
+#line 4568 "build/src/vn/lang/vn_lang.ypp.cpp"
+    break;
+
+
+#line 4572 "build/src/vn/lang/vn_lang.ypp.cpp"
+
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
+
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
+    }
+    goto yynewstate;
+
+
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
+  yyerrlab:
+    // If not already recovering from an error, report this error.
+    if (!yyerrstatus_)
+      {
+        ++yynerrs_;
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
+      }
+
+
+    yyerror_range[1].location = yyla.location;
+    if (yyerrstatus_ == 3)
+      {
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
+      }
+
+    // Else will try to reuse lookahead token after shifting the error token.
+    goto yyerrlab1;
+
+
+  /*---------------------------------------------------.
+  | yyerrorlab -- error raised explicitly by YYERROR.  |
+  `---------------------------------------------------*/
+  yyerrorlab:
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
+    if (false)
+      YYERROR;
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYERROR.  */
+    yypop_ (yylen);
+    yylen = 0;
+    YY_STACK_PRINT ();
+    goto yyerrlab1;
+
+
+  /*-------------------------------------------------------------.
+  | yyerrlab1 -- common code for both syntax error and YYERROR.  |
+  `-------------------------------------------------------------*/
+  yyerrlab1:
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
+
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
+
+      // Shift the error token.
+      yy_lac_discard_ ("error recovery");
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
+    }
+    goto yynewstate;
+
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
+  yyacceptlab:
+    yyresult = 0;
+    goto yyreturn;
+
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
+  yyabortlab:
+    yyresult = 1;
+    goto yyreturn;
+
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
+  yyreturn:
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYABORT or YYACCEPT.  */
+    yypop_ (yylen);
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
+      {
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
+      }
+
+    return yyresult;
+  }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+  VNLangParser::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+  const char *
+  VNLangParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    static const char *const yy_sname[] =
+    {
+    N_("end of file"), N_("error"), N_("invalid token"),
+  N_("designate command ⪮"), N_("engine command ꩜"),
+  N_("attribute command ‡"), N_("command terminator ⨟"),
+  N_("open VN-params ⦅"), N_("close VN-params ⦆"),
+  N_("VN-param separator ⚬"), N_("container separator 🞄"),
+  N_("open map-arguments 〔"), N_("close map-arguments 〕"),
+  N_("map-argument operator ⦂"), N_("stuff operator ⩨"),
+  N_("delta-compare operator ▲"), N_("delta-replace operator ⯈"),
+  N_("delta-end operator ⯇"), N_("explicit node operator ⯁"),
+  N_("any node operator ☆"), N_("star operator ★"),
+  N_("identifier-by-name operator ⊛"), N_("node-builder operator ⧇"),
+  N_("transform operator ⤨"), N_("negation operator ¬"),
+  N_("conjunction operator ∧"), N_("disjunction operator ∨"),
+  N_("green-grass operator ⫴"), N_("pointer-is operator ⮎"),
+  N_("build-container-size operator 🄽"), N_("stringise operator §"),
+  N_("prerestriction operator ‽"),
+  N_("constructor/destructor virtual type ⨤"), N_("type indicator ⍑"),
+  N_("code unit ∞"), N_("C scope-resolution operator ::"),
+  N_("GCC range operator .."), N_("C assignment operator ="),
+  N_("C compound-assignment operator"), N_("C logical-or operator ||"),
+  N_("C logical-and operator &&"), N_("C bitwise-or operator |"),
+  N_("C bitwise-xor operator ^"), N_("C equality operator =="),
+  N_("C relational operator"), N_("C shift operator operator"),
+  N_("C add/subtract operator"), N_("C divide/modulo operator"),
+  N_("C prefix operator"), N_("C prefix/infix operator"),
+  N_("C prefix/postfix operator"), N_("C string literal"),
+  N_("C integer literal"), N_("C format string"),
+  N_("C typename operator"), N_("C simple type specifier"),
+  N_("C boolean literal"), N_("type transform name"),
+  N_("open_statement transform name"), N_("ASCII name"),
+  N_("Unicode name"), N_("designated statement/expression name"),
+  N_("designated type name"), N_("designated declaration name"),
+  N_("designated qualifier name"), N_("designated compound name"),
+  N_("resolved open_statement node name"), N_("resolved type node name"),
+  N_("resolved declaration node name"), N_("resolved qualifier node name"),
+  N_("resolved member initialiser node name"), N_("scope resolving name"),
+  N_("open_statement keyword operator"), N_("keyword simple statement"),
+  N_("keyword space-separated statement"),
+  N_("keyword args-and-body statement"),
+  N_("keyword args-body-chain statement"), N_("C chaining keyword"),
+  N_("C do keyword"), N_("C while keyword"), N_("C case keyword"),
+  N_("C default keyword"), N_("function acting on a type"),
+  N_("C class/struct/union keyword"), N_("C enumeration keyword"),
+  N_("C qualifier"), N_("C static keyword"), N_("C typedef keyword"),
+  "stmt_low", "stmt_high", "'{'", "'}'", "';'", "':'", "'('", "')'", "','",
+  "'&'", "'*'", "'['", "']'", "'?'", "'.'", "$accept", "vnscript",
+  "stmt_boot", "commands", "sep_commands", "script_command",
+  "designation_command", "itemisation", "items_bare", "items_sep", "item",
+  "unified_entry", "unified_prefix", "compound_entry", "compound_prefix",
+  "compound_primary", "compound_scope", "code_unit_scope", "stmt_decls",
+  "stmt_decl_l", "decl_boot", "decl_commands", "decl_entry",
+  "decl_disjunction", "decl_conjunction", "open_declaration",
+  "declaration", "bare_declaration", "comp_decl_nvn", "bare_decl_nvn",
+  "bare_initialiser", "prototype", "assign_init", "decl_prefix",
+  "decl_postfix", "decl_primary", "decl_vn_prim",
+  "decl_full_explicit_start", "decl_prerestrict_op_named", "memb_inits",
+  "memb_init_boot", "memb_init_entry", "memb_init_prefix",
+  "memb_init_postfix", "memb_init_primary", "mi_full_explicit_start",
+  "mi_prerestrict_op_named", "mi_id_by_name_op_named",
+  "mi_build_id_op_named", "mi_transform_op_named", "declarator",
+  "declarator_prefix", "declarator_postfix", "declarator_primary",
+  "ab_declarator", "ab_declarator_prefix", "ab_declarator_postfix",
+  "parameterisation", "params_scope", "parameters", "parameter",
+  "inheritance_record", "irecord_scope", "irecord_node", "bases",
+  "base_spec", "members", "acc_memb_boot", "member", "comp_member",
+  "bare_member", "bare_member_nvn", "access_clause", "access_spec",
+  "acc_memb_prefix", "acc_memb_postfix", "acc_memb_paren",
+  "acc_memb_primary", "enum", "enum_scope", "enum_node", "enumerators",
+  "enumerator", "prototype_enumerator", "stmt_entry", "stmt_disjunction",
+  "stmt_conjunction", "open_statement", "stmt_entry_nc",
+  "stmt_disjunction_nc", "stmt_conjunction_nc", "open_statement_nc",
+  "stmt_comp", "statement", "statement_l", "statement_e", "statement_nc",
+  "arrival", "statement_nl", "bare_statement", "semicolon_args",
+  "expr_entry", "expr_comma_op", "expr_no_comma_op", "expr_id_value",
+  "expr_assignment", "expr_logical_or", "expr_logical_and",
+  "expr_bitwise_or", "expr_bitwise_xor", "expr_bitwise_and",
+  "expr_equality", "expr_relational", "expr_shift", "expr_add_etc",
+  "expr_mul_etc", "expr_prefix", "stuff_depth", "expr_postfix",
+  "expr_primary", "id_primary", "id_wildcard", "comma_sep_expr_decl",
+  "norm_full_explicit_start", "prerestrict_op_named",
+  "id_by_name_op_named", "build_id_named", "transform_op_named", "type_id",
+  "ab_type", "type_boot", "type_entry", "type_disjunction",
+  "type_conjunction", "type_specified", "type_prefix", "type_postfix",
+  "type_for_declarator", "type_primary", "type_vn_prim",
+  "type_full_explicit_start", "type_prerestrict_op_named",
+  "type_id_by_name_op_named", "type_build_id_op_named",
+  "type_transform_op_named", "type_specifier_seq", "qualifiers",
+  "qualifier", "qualifier_nw", "qualifier_node",
+  "qual_full_explicit_start", "vn_name", "explicit_norm_node",
+  "resolved_norm_node", "resolved_norm_name", "explicit_type_node",
+  "resolved_type_node", "resolved_type_name", "explicit_decl_node",
+  "resolved_decl_node", "resolved_decl_name", "explicit_qual_node",
+  "resolved_qual_node", "resolved_qual_name", "explicit_mi_node",
+  "resolved_mi_node", "resolved_mi_name", "part_resolve", "node_namespace",
+  "explicit_op_scope", "prerestrict_op_scope", "id_by_name_op_scope",
+  "builder_id_op_scope", "transform_op_scope", "stuff_op_scope", YY_NULLPTR
+    };
+    /* YYTRANSLATABLE[SYMBOL-NUM] -- Whether YY_SNAME[SYMBOL-NUM] is
+       internationalizable.  */
+    static signed char yytranslatable[] =
+    {
+         1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0
+    };
+    return (yysymbol < YYNTOKENS && yytranslatable[yysymbol]
+            ? _(yy_sname[yysymbol])
+            : yy_sname[yysymbol]);
+  }
+
+
+
+  // VNLangParser::context.
+  VNLangParser::context::context (const VNLangParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  VNLangParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+#if YYDEBUG
+    // Execute LAC once. We don't care if it is successful, we
+    // only do it for the sake of debugging output.
+    if (!yyparser_.yy_lac_established_)
+      yyparser_.yy_lac_check_ (yyla_.kind ());
+#endif
+
+    for (int yyx = 0; yyx < YYNTOKENS; ++yyx)
+      {
+        symbol_kind_type yysym = YY_CAST (symbol_kind_type, yyx);
+        if (yysym != symbol_kind::S_YYerror
+            && yysym != symbol_kind::S_YYUNDEF
+            && yyparser_.yy_lac_check_ (yysym))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = yysym;
+          }
+      }
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+  bool
+  VNLangParser::yy_lac_check_ (symbol_kind_type yytoken) const
+  {
+    // Logically, the yylac_stack's lifetime is confined to this function.
+    // Clear it, to get rid of potential left-overs from previous call.
+    yylac_stack_.clear ();
+    // Reduce until we encounter a shift and thereby accept the token.
+#if YYDEBUG
+    YYCDEBUG << "LAC: checking lookahead " << symbol_name (yytoken) << ':';
+#endif
+    std::ptrdiff_t lac_top = 0;
+    while (true)
+      {
+        state_type top_state = (yylac_stack_.empty ()
+                                ? yystack_[lac_top].state
+                                : yylac_stack_.back ());
+        int yyrule = yypact_[+top_state];
+        if (yy_pact_value_is_default_ (yyrule)
+            || (yyrule += yytoken) < 0 || yylast_ < yyrule
+            || yycheck_[yyrule] != yytoken)
+          {
+            // Use the default action.
+            yyrule = yydefact_[+top_state];
+            if (yyrule == 0)
+              {
+                YYCDEBUG << " Err\n";
+                return false;
+              }
+          }
+        else
+          {
+            // Use the action from yytable.
+            yyrule = yytable_[yyrule];
+            if (yy_table_value_is_error_ (yyrule))
+              {
+                YYCDEBUG << " Err\n";
+                return false;
+              }
+            if (0 < yyrule)
+              {
+                YYCDEBUG << " S" << yyrule << '\n';
+                return true;
+              }
+            yyrule = -yyrule;
+          }
+        // By now we know we have to simulate a reduce.
+        YYCDEBUG << " R" << yyrule - 1;
+        // Pop the corresponding number of values from the stack.
+        {
+          std::ptrdiff_t yylen = yyr2_[yyrule];
+          // First pop from the LAC stack as many tokens as possible.
+          std::ptrdiff_t lac_size = std::ptrdiff_t (yylac_stack_.size ());
+          if (yylen < lac_size)
+            {
+              yylac_stack_.resize (std::size_t (lac_size - yylen));
+              yylen = 0;
+            }
+          else if (lac_size)
+            {
+              yylac_stack_.clear ();
+              yylen -= lac_size;
+            }
+          // Only afterwards look at the main stack.
+          // We simulate popping elements by incrementing lac_top.
+          lac_top += yylen;
+        }
+        // Keep top_state in sync with the updated stack.
+        top_state = (yylac_stack_.empty ()
+                     ? yystack_[lac_top].state
+                     : yylac_stack_.back ());
+        // Push the resulting state of the reduction.
+        state_type state = yy_lr_goto_state_ (top_state, yyr1_[yyrule]);
+        YYCDEBUG << " G" << int (state);
+        yylac_stack_.push_back (state);
+      }
+  }
+
+  // Establish the initial context if no initial context currently exists.
+  bool
+  VNLangParser::yy_lac_establish_ (symbol_kind_type yytoken)
+  {
+    /* Establish the initial context for the current lookahead if no initial
+       context is currently established.
+
+       We define a context as a snapshot of the parser stacks.  We define
+       the initial context for a lookahead as the context in which the
+       parser initially examines that lookahead in order to select a
+       syntactic action.  Thus, if the lookahead eventually proves
+       syntactically unacceptable (possibly in a later context reached via a
+       series of reductions), the initial context can be used to determine
+       the exact set of tokens that would be syntactically acceptable in the
+       lookahead's place.  Moreover, it is the context after which any
+       further semantic actions would be erroneous because they would be
+       determined by a syntactically unacceptable token.
+
+       yy_lac_establish_ should be invoked when a reduction is about to be
+       performed in an inconsistent state (which, for the purposes of LAC,
+       includes consistent states that don't know they're consistent because
+       their default reductions have been disabled).
+
+       For parse.lac=full, the implementation of yy_lac_establish_ is as
+       follows.  If no initial context is currently established for the
+       current lookahead, then check if that lookahead can eventually be
+       shifted if syntactic actions continue from the current context.  */
+    if (yy_lac_established_)
+      return true;
+    else
+      {
+#if YYDEBUG
+        YYCDEBUG << "LAC: initial context established for "
+                 << symbol_name (yytoken) << '\n';
+#endif
+        yy_lac_established_ = true;
+        return yy_lac_check_ (yytoken);
+      }
+  }
+
+  // Discard any previous initial lookahead context.
+  void
+  VNLangParser::yy_lac_discard_ (const char* event)
+  {
+   /* Discard any previous initial lookahead context because of Event,
+      which may be a lookahead change or an invalidation of the currently
+      established initial context for the current lookahead.
+
+      The most common example of a lookahead change is a shift.  An example
+      of both cases is syntax error recovery.  That is, a syntax error
+      occurs when the lookahead is syntactically erroneous for the
+      currently established initial context, so error recovery manipulates
+      the parser stacks to try to find a new initial context in which the
+      current lookahead is syntactically acceptable.  If it fails to find
+      such a context, it discards the lookahead.  */
+    if (yy_lac_established_)
+      {
+        YYCDEBUG << "LAC: initial context discarded due to "
+                 << event << '\n';
+        yy_lac_established_ = false;
+      }
+  }
+
+
+  int
+  VNLangParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
+    /* There are many possibilities here to consider:
+       - If this state is a consistent state with a default action, then
+         the only way this function was invoked is if the default action
+         is an error action.  In that case, don't check for expected
+         tokens because there are none.
+       - The only way there can be no lookahead present (in yyla) is
+         if this state is a consistent state with a default action.
+         Thus, detecting the absence of a lookahead is sufficient to
+         determine that there is no unexpected or expected token to
+         report.  In that case, just report a simple "syntax error".
+       - Don't assume there isn't a lookahead just because this state is
+         a consistent state with a default action.  There might have
+         been a previous inconsistent state, consistent state with a
+         non-default action, or user semantic action that manipulated
+         yyla.  (However, yyla is currently not documented for users.)
+         In the first two cases, it might appear that the current syntax
+         error should have been detected in the previous state when
+         yy_lac_check was invoked.  However, at that time, there might
+         have been a different syntax error that discarded a different
+         initial context during error recovery, leaving behind the
+         current lookahead.
+    */
+
+    if (!yyctx.lookahead ().empty ())
+      {
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
+      }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  VNLangParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
+
+    char const* yyformat = YY_NULLPTR;
+    switch (yycount)
+      {
+#define YYCASE_(N, S)                         \
+        case N:                               \
+          yyformat = S;                       \
+        break
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+      }
+
+    std::string yyres;
+    // Argument number.
+    std::ptrdiff_t yyi = 0;
+    for (char const* yyp = yyformat; *yyp; ++yyp)
+      if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
+        {
+          yyres += symbol_name (yyarg[yyi++]);
+          ++yyp;
+        }
+      else
+        yyres += *yyp;
+    return yyres;
+  }
+
+
+  const short VNLangParser::yypact_ninf_ = -735;
+
+  const short VNLangParser::yytable_ninf_ = -372;
+
+  const short
+  VNLangParser::yypact_[] =
+  {
+    5541,  6432,  -735,  -735,  5541,  -735,  -735,    17,  -735,  -735,
+    -735,  7223,  7559,  7559,  7055,  7055,  -735,  -735,  7559,  7559,
+    7559,  7559,  -735,  -735,  -735,  -735,  -735,  -735,  -735,  -735,
+    -735,  7559,   -59,   -12,  6837,    40,  7559,    88,    95,  -735,
+    5541,  7559,  7559,    67,  -735,   156,  -735,  -735,  -735,  -735,
+    -735,   116,  1809,  -735,   201,   208,  -735,  -735,  -735,  -735,
+    -735,  -735,  6918,  -735,   162,   183,  -735,  -735,   274,  -735,
+     209,   276,   264,   270,   268,   334,   351,   430,   406,    27,
+     393,    96,  -735,  -735,  -735,   478,  7223,   500,   501,   272,
+     519,  -735,   154,   147,   154,   154,   469,  1134,  5158,   526,
+    6999,  7055,  7055,  1273,  7279,   492,  -735,  -735,  -735,  -735,
+    -735,  -735,  -735,  -735,  5158,  -735,  -735,   528,   535,  -735,
+    -735,   475,  -735,  -735,   737,  -735,  -735,  -735,  -735,   478,
+    2039,  -735,   211,  2065,  -735,   463,  2065,  -735,  -735,   545,
+     548,  -735,  -735,  -735,  1637,   114,  -735,   478,  2065,   576,
+     589,   596,  -735,  2562,  -735,  -735,   148,   478,  -735,   600,
+    -735,   265,   527,    84,    84,    -2,   592,  -735,  6837,  -735,
+    -735,  7559,  -735,  7559,   602,  2987,  -735,  7055,  -735,  -735,
+    -735,  -735,  -735,  -735,   659,  -735,   525,  -735,  -735,  -735,
+    -735,  -735,  -735,  7559,  7559,  -735,   537,  -735,   183,  5541,
+     -20,  -735,  2065,   539,  -735,  -735,  -735,  5460,  6027,  1809,
+    -735,   623,  1809,  1809,  -735,  1809,  -735,  -735,   538,   478,
+    1809,   629,   631,   632,  -735,    57,    57,    57,    57,   583,
+    1403,  6513,  6513,  -735,  -735,  -735,  -735,  7559,  7559,  7559,
+    7559,  7559,  7559,  7559,  7559,  7559,  7559,  7559,  7559,  7559,
+    7559,  7559,  -735,  2417,  -735,  7335,  6837,  1799,  5622,  -735,
+    -735,  -735,   591,    53,  7055,   597,  -735,   597,   597,   154,
+     439,  6432,  -735,  -735,  -735,  -735,   179,   614,  -735,  -735,
+    -735,   248,  -735,  -735,  -735,  6108,  -735,  -735,   636,  -735,
+     648,   647,  -735,  -735,  6432,  -735,  -735,  -735,  -735,  -735,
+    -735,   572,   660,   574,  -735,  -735,   582,   584,  4200,  6675,
+    -735,  7391,  -735,  -735,  1809,  -735,  -735,  -735,  5049,  -735,
+     674,  2039,  2039,  2039,  7055,  7055,  -735,  -735,  -735,  5049,
+     478,  2039,  -735,  -735,  -735,  -735,   675,  -735,   461,   258,
+    3554,  2846,  2192,  2065,   684,  2065,  2065,  2065,  2065,  -735,
+     168,   168,   168,   168,   641,   972,  -735,  2065,  2065,  5541,
+     735,  1637,  -735,  -735,   244,  -735,  -735,  1637,   125,  -735,
+    -735,   649,    70,  7055,  1273,    58,  1637,  -735,  -735,   320,
+    -735,  -735,  -735,  -735,  -735,  -735,  -735,  -735,  -735,  -735,
+     341,  -735,  -735,   534,  -735,   401,  -735,  -735,  5541,   694,
+    6108,   670,  6513,   257,  -735,   263,   615,   613,  7559,  -735,
+     616,  -735,  -735,  -735,  6189,  4852,  7447,  7447,  -735,   703,
+    6270,  -735,   475,  -735,   107,   698,  -735,  -735,  1809,  -735,
+    -735,   621,  5541,  -735,  -735,   683,   108,  7055,  -735,  -735,
+     100,  -735,  -735,  -735,  1666,  -735,   535,   208,  -735,  -735,
+    -735,  -735,  -735,   276,   628,   264,   270,   268,   334,   351,
+     430,   406,    27,  -735,  -735,  -735,  -735,    16,  -735,   369,
+     639,  -735,  -735,  -735,   256,  5703,   736,  -735,   740,  6432,
+     743,   741,  6108,  -735,  -735,  -735,   733,   738,  -735,  -735,
+      89,  -735,  -735,  -735,  -735,   710,   756,   759,  4200,  5541,
+    2065,   778,   782,  -735,  -735,  4029,  6756,  3303,  -735,  -735,
+    7719,   787,  1241,  1241,  1241,  7719,   535,   390,  7447,  -735,
+    -735,  -735,  7503,  -735,  -735,   215,  -735,  7693,   790,  7693,
+    -735,  -735,   783,  -735,   709,  3137,   711,    68,  5049,  -735,
+    -735,  -735,  -735,  -735,   719,  -735,  -735,  7055,   470,   370,
+    6108,  -735,  -735,  3413,  -735,  -735,   723,  -735,   711,   811,
+    -735,   -38,  -735,  2065,  -735,  -735,  -735,  2065,   200,  -735,
+    -735,   277,  -735,   785,  -735,   548,  -735,   728,  -735,  -735,
+    1637,  6837,    51,  -735,   293,   816,  6432,   817,   820,   572,
+     831,  -735,  1637,   558,  -735,  -735,  -735,   822,  -735,   834,
+     840,   761,  7559,  6837,  6837,  5541,  6837,   760,  -735,  -735,
+     768,  5375,   854,  5375,    22,  6351,  -735,   134,  1809,   856,
+    -735,   767,   857,  6432,   860,   858,   862,   863,  7559,  -735,
+    7559,  -735,  -735,  -735,  -735,  -735,  -735,   736,  6432,  -735,
+     189,  5784,  -735,   865,   867,  6594,  6594,  -735,  6999,  6999,
+     859,  -735,   861,  -735,  -735,  -735,  -735,   407,  -735,  5265,
+    7111,  7167,  7167,  5265,   873,    84,   449,   572,   788,  -735,
+     471,  2736,  1538,  1538,  1538,    74,  7719,  4200,   875,  4200,
+     258,   739,  -735,   283,  1809,  -735,  1971,  1971,  1971,  7693,
+    5049,  -735,  -735,  -735,  -735,  -735,   876,  -735,   880,   881,
+     882,  -735,  -735,  -735,  6756,  4955,  2192,  -735,  -735,  1264,
+    7391,  -735,  -735,   792,    51,    47,  -735,   373,  5865,  -735,
+    -735,  2065,  -735,  -735,  7055,  7055,  -735,  -735,  -735,   819,
+     798,  -735,  -735,  -735,  6513,   223,  -735,   806,   883,  -735,
+    -735,  -735,   392,  5946,  -735,  1809,  1809,  -735,  -735,  -735,
+    -735,  -735,   485,   597,   597,   535,   738,  -735,  -735,  -735,
+    -735,  -735,  -735,  -735,  -735,  -735,  4200,  7167,  -735,   779,
+    -735,  -735,   327,   471,  6837,  -735,  -735,   348,    51,   471,
+     471,    74,   412,  4200,  -735,  -735,   884,  -735,  -735,  7055,
+    7055,  -735,  7615,  -735,  -735,  -735,  -735,   266,  -735,  -735,
+     513,  6837,  -735,  -735,  -735,  -735,  -735,   532,  -735,  -735,
+    -735,  -735,  -735,  -735,   471,   799,  6837,    51,    51,  -735,
+    -735,   471,  -735,  -735,  -735,  -735,  -735,  -735,  -735,  -735,
+    -735,   805,    51,  -735,  -735
+  };
+
+  const short
+  VNLangParser::yydefact_[] =
+  {
+      48,    48,    12,   434,    48,   429,   343,   341,   431,   432,
+     433,    48,     0,     0,     0,     0,   430,    49,     0,     0,
+       0,     0,   327,   326,   328,   405,   404,   335,   331,   329,
+     263,     0,     0,     0,    48,     0,     0,     0,     0,   248,
+      48,     0,     0,     0,     2,     4,     7,     9,   234,    35,
+      36,     0,     0,    11,   226,   227,   230,   233,   243,   246,
+     247,   249,     0,   250,     0,   242,   268,   269,   270,   271,
+     273,   277,   279,   281,   283,   285,   287,   289,   291,   293,
+     295,   298,   316,   324,   332,     0,    48,     0,     0,    48,
+       0,   346,     0,     0,     0,     0,     0,    48,    48,   341,
+      48,     0,     0,     0,     0,   392,   379,    99,   402,   169,
+     219,   401,   398,   399,    48,    10,    30,    58,    59,    61,
+      65,    66,    68,    69,    72,    70,    89,    94,    95,     0,
+       0,    75,     0,     0,    76,     0,     0,    28,    29,   359,
+     360,   362,   364,   365,     0,   372,   373,     0,     0,     0,
+       0,     0,   375,     0,   394,   396,   397,     0,   387,   170,
+     403,     0,     0,     0,     0,     0,     0,     3,    48,    37,
+     307,     0,   305,     0,     0,     0,   306,     0,   313,    34,
+      32,    33,   371,   101,     0,   314,     0,   302,   299,   303,
+     304,   264,   295,     0,     0,   245,     0,   244,     0,    48,
+       0,   255,     0,     0,   300,   301,     1,     5,    48,     0,
+     127,   125,     0,     0,   119,     0,   309,   107,   114,     0,
+       0,     0,     0,     0,   128,     0,     0,     0,     0,     0,
+       0,    48,    48,   252,   251,   257,   258,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   256,     0,   317,     0,    48,     0,    48,   334,
+      42,   308,     0,     0,     0,    48,    38,    48,    48,     0,
+      48,    48,   409,   428,   406,   407,     0,     0,   425,   347,
+     129,     0,   348,   349,   350,    48,   310,    39,     0,    56,
+      55,     0,   358,   397,    48,    92,   368,    90,   366,    91,
+     367,     0,   341,     0,   370,   393,     0,     0,     0,     0,
+      67,     0,    79,    78,     0,    71,    73,    97,     0,   215,
+     213,     0,     0,     0,     0,     0,   210,   209,   211,     0,
+       0,     0,    93,   193,   203,   204,     0,   206,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   168,
+       0,     0,     0,     0,     0,     0,   218,     0,     0,    48,
+       0,     0,    80,   133,   134,   138,   142,     0,     0,   377,
+     369,     0,     0,     0,     0,     0,     0,   372,   395,     0,
+     400,   413,   417,   421,   410,   411,   414,   415,   418,   419,
+       0,   388,   102,     0,   389,     0,   390,   391,    48,     0,
+      48,     0,    48,     0,   266,     0,     0,     0,     0,   253,
+       0,   325,     6,     8,    48,    48,     0,     0,    53,     0,
+      50,    54,     0,    52,     0,     0,   105,   106,     0,   109,
+     108,     0,    48,   118,   110,     0,     0,     0,   422,   423,
+       0,   130,   131,   132,     0,   111,   229,   228,   232,   231,
+     272,   274,   275,   278,     0,   280,   282,   284,   286,   288,
+     290,   292,   294,   296,   297,   320,   344,     0,   322,     0,
+       0,   323,    20,    25,     0,    48,    22,    27,     0,    48,
+       0,     0,    48,    17,    15,    13,   235,   236,   239,    14,
+     397,   408,   427,   426,   424,     0,     0,     0,     0,    48,
+       0,     0,     0,   160,    84,     0,    48,     0,    96,   374,
+       0,     0,     0,     0,     0,     0,    60,     0,     0,    62,
+      63,    64,     0,    77,    86,     0,   104,     0,   213,     0,
+     185,   189,     0,   181,   179,     0,   182,   397,     0,   196,
+     194,   195,   201,   202,     0,   208,   197,     0,     0,     0,
+      48,   198,   166,     0,   177,   184,     0,   187,   188,   341,
+     175,     0,   171,     0,   174,   173,   192,     0,     0,   224,
+     217,     0,   220,   222,   225,   361,   363,     0,   135,   136,
+       0,    48,   139,    82,     0,     0,    48,     0,     0,     0,
+       0,    81,     0,     0,   412,   416,   420,     0,   342,     0,
+       0,     0,     0,    48,    48,    48,    48,     0,   330,    43,
+       0,    48,   341,    48,     0,    48,    51,     0,     0,     0,
+     116,     0,     0,    48,     0,     0,     0,     0,     0,   319,
+       0,   321,   318,    18,    23,    19,    24,    21,    48,   336,
+       0,    48,   340,     0,     0,     0,     0,   315,    48,    48,
+       0,    57,     0,   100,   386,   159,   163,     0,   161,    48,
+      48,     0,     0,    48,     0,     0,     0,     0,     0,   351,
+     356,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    87,     0,     0,    74,     0,     0,     0,     0,
+       0,   180,   186,   190,   170,   191,     0,   205,     0,     0,
+       0,   164,   178,   183,    48,     0,     0,   176,   216,     0,
+       0,   143,   137,     0,   140,     0,   380,     0,    48,   384,
+      85,     0,    83,   333,     0,     0,    47,   267,   259,   261,
+       0,   260,   254,    45,    48,     0,    44,     0,     0,   126,
+     115,   120,     0,    48,   124,     0,     0,   276,   345,    26,
+     339,   337,     0,    48,    48,   238,   237,   241,   240,   311,
+      40,   312,    41,    98,   378,   158,     0,     0,   385,     0,
+     357,   376,   149,   150,    48,   352,   144,   145,   155,     0,
+       0,     0,     0,     0,    88,   103,     0,   214,   212,     0,
+       0,   167,     0,   172,   221,   223,   141,     0,   383,   381,
+       0,    48,   265,    46,   117,   123,   121,     0,   112,   113,
+     338,   162,   146,   147,   151,     0,    48,   152,   156,   354,
+     353,     0,   207,   199,   200,   165,   382,   262,   122,   148,
+     157,     0,   153,   355,   154
+  };
+
+  const short
+  VNLangParser::yypgoto_[] =
+  {
+    -735,  -735,    52,     2,  -735,   691,   699,   -86,  -735,  -735,
+    -326,     5,    45,   -16,    83,  -735,  -735,  -735,  -337,  -735,
+     -95,  -735,   362,  -735,  -222,  -211,  -178,  -161,  -261,   550,
+     386,  -735,   202,  4628,  -735,  -735,  -735,   681,   803,  -735,
+    -188,  -735,   -27,  -735,  -735,  -735,   236,  -735,  -735,  -735,
+    -323,  -322,  -735,  -735,  -734,  -670,  -735,  -289,  -735,  -735,
+     150,  -735,  -735,  -735,  -735,   207,   212,  -257,  -530,  -321,
+    -735,  -315,  -735,  -735,   169,  -735,  -735,  -735,  -735,  -735,
+    -735,  -735,   205,  -735,    69,  -735,   687,   689,  -735,  -735,
+     278,  -249,  -540,  -735,    20,  -735,  -735,  -735,   866,   610,
+     742,   -26,  -735,  -224,  -735,  -189,  -735,   682,   690,   686,
+     693,   696,   685,   688,   692,   700,  4598,  -363,  -735,   677,
+     697,  -339,  -240,  -735,  1540,  -735,  -735,  1263,  -735,  -735,
+     380,   301,  -735,   581,  -132,  2443,  -735,  -146,  4042,  -735,
+    -735,  -735,  -735,  -735,  -735,   838,  -127,    26,  -735,   929,
+    -735,  -735,  -735,  -735,   -53,  -735,  -735,  -130,  4413,  -735,
+    -151,  -735,  -735,  -735,  -735,  -735,   336,  1556,  -735,    -1,
+    2060,  2627,  3194,  3761,   695
+  };
+
+  const short
+  VNLangParser::yydefgoto_[] =
+  {
+       0,    43,   166,   167,    45,    46,    47,   259,   474,   475,
+     476,   477,   286,    48,    49,    50,    51,   186,   419,   420,
+     288,   289,   116,   117,   118,   119,   120,   121,   122,   123,
+     316,   124,   523,   125,   126,   127,   128,   129,   130,   525,
+     425,   426,   427,   217,   218,   219,    52,   221,   222,   223,
+     362,   363,   364,   365,   775,   776,   777,   778,   505,   657,
+     658,   131,   132,   133,   561,   562,   553,   532,   554,   533,
+     556,   534,   535,   563,   536,   333,   334,   335,   134,   135,
+     136,   571,   572,   573,    53,    54,    55,    56,   485,   486,
+     487,    57,   196,    58,    59,    60,    61,    62,    63,    64,
+     403,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,   497,    81,    82,
+      83,    84,   467,    85,   173,    87,    88,   174,   668,   669,
+     291,   292,   139,   140,   141,   142,   143,   144,   182,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   293,
+     157,    90,    91,   274,   275,   158,   384,   385,   159,   386,
+     387,   160,   388,   389,   224,   438,   280,   276,   277,    92,
+      93,    94,    95,    96,   175
+  };
+
+  const short
+  VNLangParser::yytable_[] =
+  {
+     161,   349,    44,   564,   356,   191,   115,   376,   198,   446,
+     200,   392,   504,   184,   184,   469,   408,   367,   195,   306,
+     555,   448,   488,   702,   168,   216,   557,   431,   629,   466,
+     421,   466,   391,   394,   396,   193,   198,   600,   578,   579,
+     279,   282,   283,   317,   583,   819,   820,   422,   450,   451,
+     452,   225,   705,   591,   197,   397,   284,   530,   706,   178,
+     185,   369,   479,   728,   729,   601,   731,   206,   530,     5,
+     137,   380,   544,   409,   250,   582,  -206,   610,   590,   586,
+     530,   627,   194,   616,  -206,  -206,   516,   833,   272,   -16,
+     382,   303,   203,   273,   169,   -16,   184,   161,   519,   184,
+     184,   184,   812,   813,   480,   -16,   -16,   253,   315,   279,
+     282,   283,   630,   161,  -371,   108,   383,   623,   273,   644,
+    -371,   587,  -371,  -371,  -371,   251,   526,   278,   273,   338,
+    -371,  -371,   350,   433,   199,   350,   111,   112,   113,  -371,
+    -371,   381,   382,   368,   829,   273,   254,   350,   -31,   637,
+     272,   381,   379,   640,   -31,   273,   -31,   -31,   -31,   624,
+    -206,  -206,   207,  -206,   -31,   -31,   203,   404,   404,   260,
+     494,   492,   266,   272,   184,   382,   184,   278,   273,   378,
+     287,   201,   198,   169,   -16,   429,   430,   700,   392,   202,
+     255,   272,   418,   434,   383,   256,   273,   750,   257,   638,
+     491,   350,   595,   445,   494,   492,   208,   161,   225,  -371,
+     565,   225,   225,   272,   225,   454,   279,   278,   273,   225,
+     272,   391,   394,   396,   421,   273,   576,   231,   423,   225,
+     161,   161,   555,   232,   580,   381,   421,   399,   557,   273,
+     619,   422,   421,   -31,   545,   491,   238,   239,   240,   592,
+     492,   407,   311,   422,   235,   483,   626,   161,   712,   422,
+     717,   827,   702,   184,   633,   634,   530,   594,   530,   722,
+     161,   492,   544,   392,   692,   236,   312,   530,   737,   264,
+     313,   696,   683,   521,   161,   524,     3,   237,   220,   491,
+     496,   595,   530,   161,   492,    10,   265,   742,   466,   332,
+     720,   341,   138,    16,   342,   243,    17,   517,   161,   481,
+     241,   684,   244,   225,   491,   752,   242,   517,   494,   492,
+     338,   338,   338,   184,   184,   470,   382,   137,   517,   273,
+     338,   272,   381,   382,   383,   596,   273,   492,   503,   184,
+     517,   379,   350,   581,   350,   350,   350,   350,   169,   602,
+     260,   266,   603,   287,   137,   602,   350,   350,   604,   491,
+     368,   670,   596,   399,   492,   245,   368,   564,   708,   542,
+     543,   279,   184,   709,   784,   368,   198,   246,   770,   630,
+     671,   798,   607,   638,   555,   551,   418,   381,   198,   383,
+     557,   273,   800,   378,   198,   247,   488,   758,   418,   161,
+     805,   161,   638,   650,   418,   599,   748,   491,   594,   595,
+     596,   577,   492,   161,   614,   614,   614,   807,   588,   161,
+     306,   503,   423,   755,   772,   773,   774,   225,   530,   530,
+     738,   707,   696,   786,   423,   757,   184,   421,   595,   747,
+     423,   492,   503,   225,   530,   220,   482,   816,   220,   220,
+     597,   220,   249,     3,   422,   714,   220,   381,   382,   383,
+     290,   273,    10,   265,   631,   630,   220,   491,   594,   137,
+      16,   555,   492,    17,   161,   248,   290,   557,   161,   594,
+     595,   161,   625,   492,   621,   258,   252,   643,   817,     5,
+     539,   540,   541,   810,   307,   638,   785,   517,   169,   350,
+     546,   651,   765,   766,   517,   665,   379,   262,   263,   517,
+     558,   680,   680,   680,   517,   272,   381,   614,   306,   278,
+     273,   826,   271,   638,   392,   780,   517,   284,   517,   382,
+     383,   530,   273,   294,   517,   108,   391,   517,   595,   596,
+     828,   492,   638,   779,   137,   391,   184,   105,   137,   161,
+     220,   137,   517,   355,   308,   699,   111,   112,   113,   138,
+     309,   439,   350,   441,   442,   503,   350,   310,   772,   773,
+     774,   357,   489,   358,   565,   399,   727,   198,   198,   368,
+     198,   715,   410,   371,   306,   161,   138,   195,   195,   198,
+     195,   368,   698,   272,   381,   382,   372,   278,   273,   418,
+     491,   594,   595,   373,   494,   492,   378,  -101,   398,   264,
+     161,     3,   161,   279,   161,   402,   406,   225,   378,   137,
+      10,   265,   161,   197,   197,   594,   197,   596,    16,   492,
+     428,    17,   432,   484,   411,   423,   435,   161,   436,   437,
+     161,   443,   478,   749,   161,   161,   814,   184,   184,   493,
+     713,   818,   498,   821,   499,   137,   501,   730,   665,   665,
+     665,   665,   665,   500,   220,   203,   503,   506,   507,   715,
+     379,   781,   781,   781,   502,   517,   517,   508,   517,   509,
+     220,   538,   547,   225,   524,   517,   517,   517,   517,   517,
+     832,   567,   137,   759,   761,    97,    97,   378,   397,    97,
+     585,   138,   598,   665,   517,   379,    97,   137,   606,   605,
+     137,   608,   615,   715,   618,   203,   620,   161,   808,   809,
+     350,   628,   558,   184,   184,   272,   381,   382,   307,    97,
+     273,   760,   762,   161,   622,    97,   491,   594,   595,   632,
+     378,   492,   161,   169,   225,   225,   638,   230,   639,   642,
+       4,     3,   641,     5,     6,     7,     8,     9,    10,   645,
+      10,   265,   647,   646,   648,   517,   665,   649,    16,   759,
+     761,    17,   715,   399,   311,   198,   138,   715,   715,   715,
+     138,    97,   517,   138,   270,   195,   653,   137,   184,   184,
+     654,   517,    97,    97,   676,    97,    27,   689,   312,   690,
+     301,   691,   313,   399,   695,   378,   594,   595,   596,    97,
+     492,   330,   137,   715,   697,   703,   715,   715,   704,   270,
+     715,   197,   710,   711,   716,   340,   718,   -48,   719,   359,
+     314,   715,   360,   361,   823,   824,   760,   762,   721,   723,
+     378,   366,   724,   815,   378,   491,   594,   378,   725,   494,
+     492,   138,   726,   732,   220,   539,   540,   541,   378,   733,
+     290,   734,   740,    97,   739,   741,   744,   656,   531,   743,
+     745,   746,   290,   753,   558,   754,   763,   290,   764,   531,
+     652,   768,   783,   771,   787,   831,   664,   138,   788,   789,
+     790,   531,   796,   802,    97,   307,   801,   803,   412,   830,
+     804,   822,    97,    97,   230,   834,   413,   230,   230,   307,
+     230,   685,   795,   793,   794,   230,   811,   792,   447,   520,
+     220,   449,   453,   756,   138,   230,    97,    97,   234,   456,
+     156,   459,   455,   331,   471,   460,   405,   457,   575,   138,
+     461,   458,   138,   305,     0,     0,     0,   502,     0,   462,
+       0,    97,     0,    97,     0,     0,     0,     0,     0,     0,
+     270,   558,   270,   270,     0,   270,    97,     0,     0,     0,
+       0,     0,     0,   290,     0,   290,     0,     0,     0,     0,
+      97,   220,   220,     0,     0,     0,     0,     4,     0,    97,
+       5,     6,     7,     8,     9,    10,     0,     0,     0,   330,
+       0,     0,   330,   330,   330,     0,     0,     0,     0,   230,
+     330,     0,   330,   340,     0,     0,   340,   340,   340,   138,
+       0,     0,   330,     0,   340,     0,   340,     0,     0,     0,
+       0,     0,     0,    27,     0,   569,   340,     0,   501,   290,
+       0,   290,     0,   307,   138,     0,     0,     0,     0,     0,
+       0,     0,   574,     0,    97,     0,   502,   366,   366,   337,
+       0,     0,     0,   570,   366,     0,     0,     0,     0,   502,
+       0,   589,     0,   366,     0,     0,     0,   531,     0,   531,
+       0,     0,     0,     0,   502,   693,     0,     0,   531,     0,
+       0,     0,     0,    97,     0,    97,   501,    97,     0,     0,
+       0,   664,     0,   531,     0,     0,     0,     0,     0,    97,
+      97,     0,     0,     0,     0,    97,     0,     0,     0,     0,
+       0,   331,     0,   230,   331,   331,   331,    97,   656,     0,
+       0,     0,   331,     0,   331,     0,     0,     0,     0,   230,
+       0,   285,     0,     0,   331,   501,     0,     0,     3,    98,
+       0,     0,     5,     6,    99,     8,     9,    10,   100,     0,
+       0,   101,   102,    14,    15,    16,     0,   104,    17,     0,
+      97,     0,     0,     0,    97,     0,     0,    97,     0,     0,
+      18,     0,    19,    20,    21,    22,    23,   156,     0,   105,
+      24,     0,     0,     0,    97,    27,   106,   107,     0,    28,
+     490,    97,     0,     0,     0,     0,    29,     0,   330,     0,
+     330,     0,     0,     0,   156,     0,    38,     0,     0,   330,
+       0,     0,   340,     0,   340,     0,     0,     0,   114,     0,
+       0,    41,    42,   340,   330,     0,     0,     0,     0,   531,
+     531,     0,     0,     0,     0,    97,     0,   537,   340,     0,
+     337,   337,   337,     0,     0,   531,   677,     0,   537,     5,
+     337,   678,     0,    89,    89,   512,     0,    89,   513,   514,
+     537,   566,    16,     0,    89,     0,    97,   366,     0,     4,
+       0,    97,     5,     6,     7,     8,     9,    10,     4,   366,
+       0,     5,     6,     7,     8,     9,    10,    89,    97,    97,
+      97,    97,     0,    89,   107,     0,    97,     0,    97,     0,
+      97,     0,     0,   230,     0,     0,     0,     0,    97,     0,
+       0,     0,     0,     0,     0,    27,     0,   569,     0,   156,
+     331,     0,   331,    97,    27,   679,    97,     0,     0,     0,
+       0,   331,   531,    97,    97,     0,     0,     0,     0,    89,
+       0,     0,   268,     0,    97,    97,   331,     0,    97,     0,
+      89,    89,     0,    89,     0,     0,     0,   330,   330,   330,
+     330,   330,     0,     0,     0,     0,     0,    89,     0,   230,
+       0,   340,   340,   340,   340,   340,   330,   268,     0,     0,
+       0,     0,     0,   336,     0,     0,     0,     0,     0,    97,
+     340,     0,     0,     0,   156,     0,   574,     0,   156,     0,
+     444,   156,     0,    97,     0,     0,     0,     3,   209,     0,
+       0,     5,   210,   211,     8,     9,    10,   212,     0,    97,
+     213,    89,     0,     0,    16,     0,     0,     0,    97,     0,
+     230,   230,     0,     0,     0,     0,     0,     0,   270,   270,
+       0,     0,     0,     0,     0,     0,   537,     0,   537,     0,
+       0,     0,    89,     0,   214,     0,     0,   537,     0,    97,
+      89,    89,     0,   330,     0,     0,     0,     0,     0,   156,
+       0,     0,   537,     0,     0,     0,     0,   340,     0,   331,
+     331,   331,   331,   331,    89,    89,    97,   215,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   331,     0,
+       0,    97,     0,     0,     0,   156,     0,     0,     0,    89,
+       0,    89,     0,     0,     0,     0,     0,     0,   268,     0,
+     268,   268,     0,   268,    89,     0,     0,     0,     0,     0,
+      86,    86,     0,     0,    86,     0,     0,     0,    89,     0,
+       0,    86,   156,   510,     0,     0,     5,    89,   511,     8,
+       9,    10,   672,     0,     0,   673,   674,   156,     0,    16,
+     156,   104,     0,     0,    86,     0,     0,     0,     0,     0,
+      86,   336,     0,     0,   336,   336,   336,     0,     0,     0,
+       0,     0,   336,   105,   336,   331,     0,     0,     0,     0,
+     106,   107,     0,     0,   336,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   337,   337,   337,   537,   537,
+       0,     0,    89,     0,     0,     0,    86,     0,     0,   267,
+       0,     0,   515,     0,   537,   566,     0,    86,    86,     0,
+      86,     0,     0,     0,     0,     0,     0,   156,     0,   281,
+       0,     0,     4,     0,    86,     5,     6,     7,     8,     9,
+      10,    89,     0,    89,   267,    89,     0,     0,     0,     0,
+       0,     0,   156,     0,     0,     0,     0,    89,    89,     0,
+       3,   209,     0,    89,     5,   210,   211,     8,     9,    10,
+     212,     0,     0,   213,     0,    89,     0,    16,    27,     0,
+       0,   108,     0,   495,     0,     0,     0,     0,    86,     0,
+       0,     0,     0,     0,     0,     0,     0,   390,   393,   395,
+     395,   537,   111,   112,   113,     0,     0,   214,     0,     0,
+       0,   359,     0,     0,   360,   361,     0,     0,    89,    86,
+     401,     0,    89,     0,     0,    89,     0,    86,    86,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     215,     0,    89,     0,     0,     0,     0,     0,     0,    89,
+       0,    86,    86,     0,     0,     0,     0,     0,     0,     0,
+       0,   440,   440,   440,   440,     0,     0,     0,     0,     0,
+     336,     0,   336,     0,     0,     0,    86,     0,    86,     0,
+       0,   336,     0,     0,     0,   267,     0,   267,   267,     0,
+     267,    86,     0,    89,     4,     0,   336,     5,     6,     7,
+       8,     9,    10,     3,   209,    86,     0,     5,   210,   211,
+       8,     9,    10,   212,    86,     0,   213,     0,     0,     0,
+      16,     0,     0,     0,    89,     0,     0,     0,     0,    89,
+      22,    23,     0,     0,     0,    24,     0,     0,     0,     0,
+      27,     0,     0,     0,    28,     0,    89,    89,    89,    89,
+     214,    29,     0,     0,    89,     0,    89,     0,    89,     0,
+       0,    38,     0,     0,     0,     0,    89,     0,     0,     0,
+       0,     0,     0,    40,   548,   549,     0,     0,     0,    86,
+       0,    89,     0,   215,    89,     0,   568,   568,   568,   568,
+       0,    89,    89,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    89,    89,   584,     0,    89,     0,     0,     0,
+       0,     0,     0,     0,     0,   593,     0,     0,    86,     0,
+      86,     0,    86,     0,     0,     0,     0,     0,     0,   336,
+     336,   336,   336,   336,    86,    86,     0,     0,     0,     0,
+      86,     0,     0,     0,     0,     0,     0,    89,   336,     0,
+       0,     0,    86,     0,     0,     0,     0,     0,     0,     0,
+     617,    89,     0,     0,     0,     3,   527,     0,     0,     5,
+     319,   528,     8,     9,    10,   686,     0,    89,   687,   688,
+     324,   325,    16,     0,   104,     0,    89,     0,     0,     0,
+       0,     0,     0,     0,     0,    86,   268,   268,     0,    86,
+       0,     0,    86,     0,     0,     0,   105,     0,     0,     0,
+       0,     0,   326,   106,   327,   108,   328,    89,     0,    86,
+       0,     0,     0,     0,     0,     0,    86,     0,     0,     0,
+       0,     0,     0,     3,   318,   336,   111,     5,   319,   320,
+       0,   162,    10,   321,    89,   529,   322,   323,   324,   325,
+      16,     0,     0,   681,   162,   162,     0,     0,     0,    89,
+     343,     0,     0,     5,     0,   344,     8,     9,    10,   345,
+      86,     0,   346,   347,     0,     0,    16,     0,   104,     0,
+     326,     0,   327,   108,   328,     0,     0,     0,     0,     0,
+       0,     0,   226,     0,     0,     0,     0,     0,     0,     0,
+     105,    86,     0,     0,   111,     0,    86,   106,     0,     0,
+       0,     0,     0,   329,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    86,    86,    86,    86,     0,     0,   269,
+       0,    86,     0,    86,     0,    86,     0,   162,   162,   348,
+     162,   162,   162,    86,     0,     0,     0,     0,     0,     0,
+     735,     0,     0,     0,   162,     0,     0,     0,    86,     0,
+       0,    86,     0,     0,   269,     0,     0,     0,    86,    86,
+     339,     0,     0,   351,     0,     0,   351,     0,     0,    86,
+      86,     0,     0,    86,     0,     0,     0,   343,   351,     0,
+       5,     6,   559,     8,     9,    10,   345,     0,     0,   346,
+     347,   395,   769,    16,     0,   104,     0,     0,     0,     0,
+       0,   782,     0,     0,     0,   162,   549,   162,     0,     0,
+       0,     0,     0,     0,    86,     0,     0,   105,     0,     0,
+       0,     0,     0,   560,   106,     0,   108,     0,    86,     0,
+       0,     0,   351,     0,     0,     0,     0,     0,   424,   226,
+       0,   797,   226,   226,    86,   226,     0,   111,     0,     0,
+     226,     0,     0,    86,     0,     0,   348,     0,     0,     0,
+     226,   424,   424,   267,   267,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    86,     0,     0,     0,   162,     0,
+       0,     0,     0,     0,   162,   269,     0,   269,   269,     0,
+     269,   162,     0,     0,     0,     0,     0,   782,     0,     0,
+       0,    86,     0,     0,     0,   162,     0,     0,     0,     0,
+       0,     0,     0,     0,   162,     0,    86,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   339,   424,
+       0,     0,     0,     0,   226,     0,     0,     0,   339,     0,
+       0,   339,   339,   339,   162,   162,     0,     0,     0,   339,
+       0,   339,     0,     0,     0,     0,     0,     0,     0,     0,
+     162,   339,   351,   351,     0,   351,   351,   351,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,   351,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   465,
+       0,     3,     4,   162,     0,     5,     6,     7,     8,     9,
+      10,   171,     0,     0,    12,    13,    14,    15,    16,     0,
+       0,     0,     0,     0,     0,     0,     0,   181,   181,     0,
+     162,     0,   424,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,     0,    24,   424,   424,   424,   424,    27,     0,
+     424,     0,    28,     0,     0,     0,     0,     0,   226,    29,
+       0,     0,     0,     0,     0,     0,     0,   162,     0,    38,
+       0,     0,     0,     0,   226,     0,     0,     0,     0,     0,
+       0,    40,     0,     0,    41,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   162,     0,     0,     0,   162,
+     181,     0,   162,   296,   298,   300,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   339,     0,
+     351,     0,     0,     0,     0,   339,   666,     0,     0,     0,
+     675,     0,   339,   339,   339,   675,     0,   343,   424,     0,
+       5,     0,   344,     8,     9,    10,     0,   675,     0,   675,
+       0,   370,     0,     0,   374,   375,     0,     0,   339,     0,
+       0,     0,     0,     0,     0,     0,     0,   162,     0,     0,
+     162,     0,     0,   339,     0,     0,     0,   105,   181,     0,
+     296,     0,     0,   351,   106,     0,   108,   351,   163,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   163,   163,     0,     0,     0,   162,   111,   112,   113,
+       0,     0,     0,     0,     0,     0,   348,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   424,     0,   424,     0,   424,     0,     0,   226,   227,
+       0,     0,     0,   162,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   162,     0,
+       0,   162,     0,     0,     0,   424,   424,   181,   162,   162,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   666,
+     666,   666,   666,   666,   163,   163,     0,   163,   163,   163,
+       0,     0,   675,   675,   675,     0,   675,   339,     0,   339,
+       0,   163,     0,     0,   226,     0,   675,   675,   675,   675,
+     339,   343,     0,     0,     5,     0,   344,     8,     9,    10,
+     352,     0,     0,   352,   666,   339,   351,   181,   181,   375,
+       0,     0,     0,     0,     0,   352,     0,     0,   162,     0,
+     352,   351,     0,   181,   162,   162,     0,     0,   296,   298,
+     300,   105,     0,     0,   424,     0,     0,     0,   106,     0,
+     108,     0,   163,   162,   163,   226,   226,     0,     0,     0,
+       0,     0,     0,   269,   269,     0,   181,     0,     0,     0,
+       0,   111,   112,   113,     0,     0,   339,   666,     0,   352,
+     348,     0,     0,     0,     0,   163,   227,     0,     0,   227,
+     227,     0,   227,   339,     0,     0,     0,   227,     0,   162,
+     162,     0,   339,     0,     0,     0,     0,   227,   163,   163,
+       3,   527,     0,     0,     5,   319,   528,     8,     9,    10,
+     321,     0,     0,   322,   323,   324,   325,    16,   103,   375,
+     181,     0,     0,     0,     0,   163,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,     0,     0,     0,   163,     0,
+       0,   105,     0,     0,     0,     0,     0,   326,   106,   327,
+     108,   328,   163,     0,     0,     0,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,     0,     0,     0,     0,   109,
+     110,   111,   112,   113,     0,   352,   163,   552,     0,     0,
+     529,   227,     0,     0,     0,   352,     0,     0,     0,     0,
+       0,   163,   163,     0,     0,     0,   352,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   163,   352,   352,
+     352,     0,   352,   352,   352,   352,     0,     0,     0,     0,
+       0,     0,     0,     0,   352,   352,     0,     0,     0,     0,
+     181,     0,     0,     0,   400,     0,     0,     0,     0,     0,
+     163,     3,    98,     0,     0,     5,     6,    99,     8,     9,
+      10,   177,     0,     0,   101,   102,    14,    15,    16,     0,
+     104,     0,     0,     0,     0,     0,     0,   163,     0,   163,
+       0,     0,     0,    18,     0,    19,    20,    21,    22,    23,
+       0,   163,   105,    24,     0,     0,     0,   163,    27,   106,
+     107,     0,    28,     0,     0,   227,     0,     0,     0,    29,
+       0,     0,     0,     0,   163,     0,     0,     0,     0,    38,
+       0,   227,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   114,     0,     0,    41,    42,     0,     0,     0,     0,
+       0,   181,   181,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   163,   296,   298,   300,   163,     0,     0,   163,
+       0,     0,     0,     0,     0,   296,   298,   300,     0,     0,
+       0,     0,     0,     0,     0,   352,     0,   352,     0,   296,
+     298,   300,   352,   163,   352,     0,     0,   352,     0,     0,
+       0,     0,   352,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   343,     0,   352,     5,   352,   344,     8,     9,
+      10,     0,   352,     0,     0,   352,     0,   181,   181,   103,
+     375,     0,     0,     0,   163,     0,     0,   163,     0,     0,
+     352,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     352,     0,   105,     0,   352,   164,     0,     0,     0,   106,
+       0,   108,     0,     0,     0,     0,     0,     0,   164,   164,
+     296,     0,     0,   163,     0,     0,     0,     0,     0,     0,
+     109,   110,   111,   112,   113,     0,     0,     0,     0,     0,
+       0,   348,   181,   181,     0,     0,     0,     0,   163,     0,
+     163,     0,   163,     0,     0,   227,   228,     0,     0,     0,
+     163,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   163,     0,     0,   163,     0,
+       0,     0,   163,   163,     0,   163,   163,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   163,   163,   163,   163,
+     163,   164,   164,     0,   164,   164,   164,     0,   352,   352,
+     352,   352,     0,   352,   352,     0,   352,     0,   164,     0,
+       0,   227,     0,   352,   352,   352,   352,   352,   343,     0,
+       0,     5,     0,   344,     8,     9,    10,   353,     0,     0,
+     353,   163,   352,   352,     0,   667,   375,     0,     0,     0,
+       0,     0,   353,     0,     0,   163,     0,   353,   352,     0,
+       0,   163,   163,     0,     0,     0,     0,     0,   105,     0,
+       0,   163,     0,     0,     0,   106,     0,   108,     0,   164,
+     163,   164,   227,   227,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   111,   112,
+     113,     0,     0,   352,   163,     0,   353,   348,     0,     0,
+       0,     0,   164,   228,     0,     0,   228,   228,     0,   228,
+     352,     0,     0,     0,   228,     0,   163,   163,     0,   352,
+       0,     0,     0,     0,   228,   164,   164,     3,   527,     0,
+       0,     5,   319,   528,     8,     9,    10,   321,     0,     0,
+     322,   323,   324,   325,    16,   103,   375,     0,     0,     0,
+       0,     0,   164,     0,     0,     0,     0,     0,   164,     0,
+       0,     0,     0,     0,     0,   164,     0,     0,   105,     0,
+       0,     0,     0,     0,   326,   106,   327,   108,   328,   164,
+       0,     0,     0,     0,     0,     0,     0,     0,   164,     0,
+       0,     0,     0,     0,     0,     0,   109,   110,   111,   112,
+     113,     0,   353,   164,   701,     0,     0,   529,   228,     0,
+       0,     0,   353,     0,     0,     0,     0,     0,   164,   164,
+       0,     0,     0,   353,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   164,   353,   353,   353,     0,   353,
+     353,   353,   353,     0,     0,     0,     0,     0,     0,     0,
+       0,   353,   353,     0,     0,     0,     0,     0,     0,     0,
+       0,   550,     0,     0,     0,     0,     0,   164,     3,    98,
+       0,     0,     5,     6,    99,     8,     9,    10,   177,     0,
+       0,   101,   102,    14,    15,    16,     0,   104,     0,     0,
+       0,     0,     0,     0,   164,     0,   164,     0,     0,     0,
+      18,     0,    19,    20,    21,    22,    23,     0,   164,   105,
+      24,     0,     0,     0,   164,    27,   106,   107,     0,    28,
+       0,     0,   228,     0,     0,     0,    29,     0,     0,     0,
+       0,   164,     0,     0,     0,     0,    38,     0,   228,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   114,     0,
+       0,    41,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   164,
+       0,     0,     0,   164,     0,     0,   164,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   353,     0,   353,     0,     0,     0,     0,   353,
+     164,   353,     0,     0,   353,     0,     0,     0,     0,   353,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   353,     0,   353,     0,     0,     0,     0,     0,   353,
+       0,     0,   353,     0,     0,     0,     0,     0,     0,     0,
+       0,   164,     0,     0,   164,     0,     0,   353,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   353,     0,     0,
+       0,   353,   165,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   165,   165,     0,     0,     0,
+     164,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   164,     0,   164,     0,   164,
+       0,     0,   228,   229,     0,     0,     0,   164,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   164,     0,     0,   164,     0,     0,     0,   164,
+     164,     0,   164,   164,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   164,   164,   164,   164,   164,   165,   165,
+       0,   165,   165,   165,     0,   353,   353,   353,   353,     0,
+     353,   353,     0,   353,     0,   165,     0,     0,   228,     0,
+     353,   353,   353,   353,   353,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   354,     0,     0,   354,   164,   353,
+     353,     0,     0,     0,     0,     0,     0,     0,     0,   354,
+       0,     0,   164,     0,   354,   353,     0,     0,   164,   164,
+       0,     0,     0,     0,     0,     0,     0,     0,   164,     0,
+       0,     0,     0,     0,     0,     0,   165,   164,   165,   228,
+     228,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     353,   164,     0,   354,     0,     0,     0,     0,     0,   165,
+     229,     0,     0,   229,   229,     0,   229,   353,     0,     0,
+       0,   229,     0,   164,   164,     0,   353,     0,     0,     0,
+       0,   229,   165,   165,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   165,
+       0,     0,     0,     0,     0,   165,     0,     0,     0,     0,
+       0,     0,   165,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   145,   510,     0,   165,     5,     0,   511,
+       8,     9,    10,   512,     0,   165,   513,   514,     0,     0,
+      16,   103,   375,     0,     0,     0,     0,     0,     0,   354,
+     165,     0,     0,     0,     0,   229,     0,     0,     0,   165,
+       0,     0,     0,     0,   105,   165,   165,     0,     0,     0,
+     165,   106,   107,   108,     0,     0,     0,     0,     0,     0,
+       0,   165,   165,   354,   354,     0,   354,   354,   354,   354,
+       0,     0,   109,   110,   111,   112,   113,     0,   354,   354,
+       0,     0,     0,   515,   655,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   165,     0,     0,     0,     0,     0,
+     145,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   145,     0,     0,     0,
+       0,   165,     0,   165,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   165,     0,     0,     0,     0,
+       0,   165,     0,     0,     0,     0,     0,     0,     0,   229,
+       0,     0,     0,     0,     0,   377,     0,     0,   165,     0,
+       0,     0,     0,     0,     0,   229,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   510,     0,     0,     5,     0,
+     511,     8,     9,    10,   512,     0,     0,   513,   514,     0,
+       0,    16,   103,   375,     0,     0,   165,     0,     0,     0,
+     165,     0,     0,   165,     0,     0,     0,     0,     0,     0,
+     377,     0,     0,     0,     0,   105,     0,     0,     0,   354,
+       0,   354,   106,   107,   108,     0,   354,   165,   354,     0,
+       0,   354,     0,   377,   377,     0,   354,     0,     0,     0,
+       0,     0,     0,   109,   110,   111,   112,   113,   165,     0,
+     165,     0,     0,     0,   515,     0,   354,     0,     0,   165,
+     145,     0,     0,     0,     0,     0,     0,     0,   165,     0,
+       0,   165,     0,   145,   165,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   354,     0,     0,   145,   354,     0,
+       0,     0,     0,     0,     0,     0,   145,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   165,     0,     0,
+     377,   377,     0,     0,     0,     0,     0,     0,     0,     0,
+     377,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   377,   165,     0,   165,     0,   165,     0,     0,   229,
+       0,     0,     0,   377,   165,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   165,
+       0,     0,   165,     0,     0,     0,   165,   165,     0,   165,
+     165,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     165,   165,   165,   165,   165,     0,     0,   183,   183,     0,
+       0,     0,   354,   354,   354,   354,     0,   354,   354,     0,
+     354,     0,   145,     0,   377,   229,     0,   165,   165,   165,
+     165,   165,     0,     0,     0,     0,   377,     0,     0,     0,
+       0,     0,   377,     0,     0,   165,   165,   354,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   165,
+       0,     0,   354,     0,     0,   165,   165,     0,     0,     0,
+       0,     0,     0,     0,     0,   165,     0,     0,     0,     0,
+       0,     0,     0,     0,   165,     0,   229,   229,     0,     0,
+     183,     0,     0,   183,   183,   183,     0,   145,     0,     0,
+       0,   145,     0,     0,   145,     0,     0,   354,   165,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     377,     0,     0,   183,   354,     0,     0,   377,     0,   377,
+     165,   165,   145,   165,     0,     0,     0,   145,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   145,
+       0,   145,     0,     0,     0,     0,     0,   377,     0,     0,
+     377,     0,     0,     0,     0,     0,     0,     0,   183,     0,
+     183,     0,   145,     0,     0,   377,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   170,
+     172,   176,   180,   180,     0,     0,   187,   188,   189,   190,
+       0,     0,     0,     0,     0,     0,     0,     0,   145,   192,
+       0,     0,     0,     0,   192,     0,     0,     0,     0,   204,
+     205,     0,   179,   179,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   377,     0,   377,     0,   377,     0,     0,
+     192,     0,     0,     0,     0,   145,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   183,     0,     0,
+     145,     0,     0,   145,   261,     0,     0,   377,   377,     0,
+       0,     0,     0,     0,     0,   180,     0,     0,   170,   172,
+     176,     0,   304,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   377,     0,     0,     0,     0,   145,   377,
+       0,   377,     0,     0,     0,   179,     0,     0,   295,   297,
+     299,   145,   377,     0,   183,   183,   183,   183,   183,     0,
+       0,     0,     0,     0,   183,     0,     0,   377,     0,     0,
+       0,     0,     0,   183,     0,     0,     0,     0,     0,     0,
+     145,     0,     0,     0,     0,     0,     0,     0,     0,   170,
+       0,   261,     0,   180,     0,   170,   377,     0,     0,     0,
+       0,     0,     0,     0,     0,   145,   183,     0,     0,     0,
+       0,   192,   192,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   179,     0,   295,     0,     0,   377,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   377,     0,     0,   183,   183,
+     183,     0,     0,     0,   377,   192,   192,   192,   192,   192,
+     192,   192,   192,   192,   192,   192,   192,   192,   463,   464,
+     183,   192,     0,   192,     0,     0,     0,     0,     0,     0,
+       0,     0,   180,     0,     0,     0,     3,   611,     0,     0,
+       5,     6,   612,     8,     9,    10,   415,     0,     0,   416,
+     417,    14,    15,    16,     0,     0,    17,     0,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,    18,     0,
+      19,    20,    21,    22,    23,     0,     0,   192,    24,   192,
+       0,     0,     0,    27,     0,   107,     0,    28,     0,     0,
+       0,     0,   180,   180,    29,   183,   183,   183,     0,     0,
+       0,   183,     0,     0,    38,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,   613,     0,   694,    41,
+      42,     0,   179,   179,     0,     0,     0,     0,     0,     0,
+     183,     0,     0,     0,     0,     0,     0,     0,   179,     3,
+     527,   180,     0,     5,   319,   528,     8,     9,    10,   321,
+       0,     0,   322,   323,   324,   325,    16,   103,   375,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   179,     0,     0,     0,     0,   192,     0,     0,     0,
+     105,     0,     0,   170,   172,   176,   326,   106,   327,   108,
+     328,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   180,     0,     0,   109,   110,
+     111,   112,   113,   295,   297,   299,   791,     0,     0,   529,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   183,   183,     3,   527,   179,     0,     5,   319,   528,
+       8,     9,    10,   321,     0,     0,   322,   323,   324,   325,
+      16,   103,   375,     0,     0,   183,   183,   183,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   183,
+     183,   183,     0,     0,   105,     0,     0,     0,     0,     0,
+     326,   106,   327,   108,   328,     0,   170,     0,     0,     0,
+     192,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   109,   110,   111,   112,   113,   183,   183,     0,
+     295,   297,   299,   529,     0,   180,   295,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     1,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     3,    98,     0,   179,     5,     6,    99,     8,
+       9,    10,   100,     0,     0,   101,   102,    14,    15,    16,
+     103,   104,    17,     0,     0,     0,     0,     0,     0,     0,
+     192,     0,   183,   183,    18,     0,    19,    20,    21,    22,
+      23,     0,     0,   105,    24,     0,     0,    25,    26,    27,
+     106,   107,   108,    28,     0,     0,   192,     0,   192,     0,
+      29,    30,    31,    32,    33,     0,    34,    35,    36,    37,
+      38,   109,   110,   111,   112,   113,   180,   180,     0,     0,
+      39,     0,   114,     0,     0,    41,    42,     0,   170,   172,
+     176,     0,     0,     0,     0,     0,     0,     0,     0,     1,
+       2,     0,     0,     0,     0,     0,   179,   179,     0,     3,
+     659,     0,     0,     5,     6,   559,     8,     9,    10,   660,
+       0,     0,   661,   662,    14,    15,    16,     0,   104,    17,
+     295,   297,   299,     0,     0,     0,     0,     0,   192,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+     105,    24,   180,   180,    25,    26,    27,   106,     0,     0,
+      28,     0,     0,     0,     0,     0,     0,    29,    30,    31,
+      32,    33,     0,    34,    35,    36,    37,    38,     0,     0,
+       0,     0,   179,   179,     0,     0,     0,    39,     0,   663,
+       0,     0,    41,    42,     0,   170,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
+       2,     0,     0,     0,     0,     0,     0,   180,   180,     3,
+      98,     0,     0,     5,     6,    99,     8,     9,    10,   415,
+       0,     0,   416,   417,    14,    15,    16,   103,   375,    17,
+       0,     0,     0,     0,     0,     0,     0,   179,   179,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+     105,    24,     0,     0,    25,    26,    27,   106,   107,   108,
+      28,     0,     0,     0,     0,     0,     0,    29,    30,    31,
+      32,    33,     0,    34,    35,    36,    37,    38,   109,   110,
+     111,   112,   113,     0,     1,     2,     0,    39,     0,   114,
+       0,     0,    41,    42,     3,     4,     0,     0,     5,     6,
+       7,     8,     9,    10,    11,     0,     0,    12,    13,    14,
+      15,    16,     0,     0,    17,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    18,     0,    19,    20,
+      21,    22,    23,     0,     0,     0,    24,     0,     0,    25,
+      26,    27,     0,     0,     0,    28,     0,     0,     0,     0,
+       0,     0,    29,    30,    31,    32,    33,     0,    34,    35,
+      36,    37,    38,     0,     0,     1,     2,     0,     0,     0,
+     -48,     0,    39,     0,    40,     3,     4,    41,    42,     5,
+       6,     7,     8,     9,    10,    11,     0,     0,    12,    13,
+      14,    15,    16,     0,     0,    17,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    18,     0,    19,
+      20,    21,    22,    23,     0,     0,     0,    24,     0,     0,
+      25,    26,    27,     0,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,    29,    30,    31,    32,    33,     0,    34,
+      35,    36,    37,    38,     0,     0,     0,     0,     0,     0,
+     472,   473,     0,    39,     0,    40,     3,    98,    41,    42,
+       5,     6,    99,     8,     9,    10,   100,     0,     0,   101,
+     102,    14,    15,    16,   103,   104,    17,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    18,     0,
+      19,    20,    21,    22,    23,     0,     0,   105,    24,     0,
+       0,     0,     0,    27,   106,   107,   108,    28,     0,     0,
+       0,     0,     0,     0,    29,    30,    31,    32,    33,     0,
+      34,    35,    36,    37,    38,   109,   110,   111,   112,   113,
+       0,   635,   636,     0,    39,     0,   114,     3,    98,    41,
+      42,     5,     6,    99,     8,     9,    10,   100,     0,     0,
+     101,   102,    14,    15,    16,   103,   104,    17,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,   105,    24,
+       0,     0,     0,     0,    27,   106,   107,   108,    28,     0,
+       0,     0,     0,     0,     0,    29,    30,    31,    32,    33,
+       0,    34,    35,    36,    37,    38,   109,   110,   111,   112,
+     113,     0,   751,     0,     0,    39,     0,   114,     3,    98,
+      41,    42,     5,     6,    99,     8,     9,    10,   100,     0,
+       0,   101,   102,    14,    15,    16,   103,   104,    17,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      18,     0,    19,    20,    21,    22,    23,     0,     0,   105,
+      24,     0,     0,     0,     0,    27,   106,   107,   108,    28,
+       0,     0,     0,     0,     0,     0,    29,    30,    31,    32,
+      33,     0,    34,    35,    36,    37,    38,   109,   110,   111,
+     112,   113,     0,   799,     0,     0,    39,     0,   114,     3,
+      98,    41,    42,     5,     6,    99,     8,     9,    10,   100,
+       0,     0,   101,   102,    14,    15,    16,   103,   104,    17,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+     105,    24,     0,     0,     0,     0,    27,   106,   107,   108,
+      28,     0,     0,     0,     0,     0,     0,    29,    30,    31,
+      32,    33,     0,    34,    35,    36,    37,    38,   109,   110,
+     111,   112,   113,     0,   806,     0,     0,    39,     0,   114,
+       3,    98,    41,    42,     5,     6,    99,     8,     9,    10,
+     100,     0,     0,   101,   102,    14,    15,    16,   103,   104,
+      17,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    18,     0,    19,    20,    21,    22,    23,     0,
+       0,   105,    24,     0,     0,     0,     0,    27,   106,   107,
+     108,    28,     0,     0,     0,     0,     0,     0,    29,    30,
+      31,    32,    33,     0,    34,    35,    36,    37,    38,   109,
+     110,   111,   112,   113,     0,     0,   414,     0,    39,     0,
+     114,     3,    98,    41,    42,     5,     6,    99,     8,     9,
+      10,   415,     0,     0,   416,   417,    14,    15,    16,   103,
+     375,    17,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,   105,    24,     0,     0,     0,     0,    27,   106,
+     107,   108,    28,     0,     0,     0,     0,     0,     0,    29,
+      30,    31,    32,    33,     0,    34,    35,    36,    37,    38,
+     109,   110,   111,   112,   113,     0,     0,     0,     0,    39,
+       0,   114,     3,    98,    41,    42,     5,     6,    99,     8,
+       9,    10,   100,     0,     0,   101,   102,    14,    15,    16,
+     103,   104,    17,     0,     0,   495,     0,     0,     0,     0,
+       0,     0,     0,     0,    18,     0,    19,    20,    21,    22,
+      23,     0,     0,   105,    24,     0,     0,     0,     0,    27,
+     106,   107,   108,    28,     0,     0,     0,     0,     0,     0,
+      29,    30,    31,    32,    33,     0,    34,    35,    36,    37,
+      38,   109,   110,   111,   112,   113,     0,     0,     0,     0,
+      39,     0,   114,     3,    98,    41,    42,     5,     6,    99,
+       8,     9,    10,   415,     0,     0,   416,   417,    14,    15,
+      16,   103,   375,    17,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,   105,    24,     0,     0,     0,     0,
+      27,   106,   107,   108,    28,     0,     0,     0,     0,     0,
+       0,    29,    30,    31,    32,    33,     0,    34,    35,    36,
+      37,    38,   109,   110,   111,   112,   113,     0,     0,     0,
+     609,    39,     0,   114,     3,    98,    41,    42,     5,     6,
+      99,     8,     9,    10,   415,     0,     0,   416,   417,    14,
+      15,    16,   103,   375,    17,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    18,     0,    19,    20,
+      21,    22,    23,     0,     0,   105,    24,     0,     0,     0,
+       0,    27,   106,   107,   108,    28,     0,     0,     0,     0,
+       0,     0,    29,    30,    31,    32,    33,     0,    34,    35,
+      36,    37,    38,   109,   110,   111,   112,   113,     0,     0,
+     -48,     0,    39,     0,   114,     3,    98,    41,    42,     5,
+       6,    99,     8,     9,    10,   415,     0,     0,   416,   417,
+      14,    15,    16,   103,   375,    17,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    18,     0,    19,
+      20,    21,    22,    23,     0,     0,   105,    24,     0,     0,
+       0,     0,    27,   106,   107,   108,    28,     0,     0,     0,
+       0,     0,     0,    29,    30,    31,    32,    33,     0,    34,
+      35,    36,    37,    38,   109,   110,   111,   112,   113,     0,
+       0,     0,   736,    39,     0,   114,     3,    98,    41,    42,
+       5,     6,    99,     8,     9,    10,   100,     0,     0,   101,
+     102,    14,    15,    16,   103,   104,    17,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    18,     0,
+      19,    20,    21,    22,    23,     0,     0,   105,    24,     0,
+       0,     0,     0,    27,   106,   107,   108,    28,     0,     0,
+       0,     0,     0,     0,    29,    30,    31,    32,    33,     0,
+      34,    35,    36,    37,    38,   109,   110,   111,   112,   113,
+       0,     0,     0,     0,    39,     0,   114,     3,    98,    41,
+      42,     5,     6,    99,     8,     9,    10,   415,     0,     0,
+     416,   417,    14,    15,    16,   103,   375,    17,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,   105,    24,
+       0,     0,     0,     0,    27,   106,   107,   108,    28,     0,
+       0,     0,     0,     0,     0,    29,    30,    31,    32,    33,
+       0,    34,    35,    36,    37,    38,   109,   110,   111,   112,
+     113,     0,     0,     0,     0,    39,     0,   114,     3,    98,
+      41,    42,     5,     6,    99,     8,     9,    10,   518,     0,
+       0,   416,   417,    14,    15,    16,   103,   375,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      18,     0,    19,    20,    21,    22,    23,     0,     0,   105,
+      24,     0,     0,     0,     0,    27,   106,   107,   108,    28,
+       0,     0,     0,     0,     0,     0,    29,    30,    31,    32,
+      33,     0,    34,    35,    36,    37,    38,   109,   110,   111,
+     112,   113,     0,     0,     0,     0,    39,     0,   114,     3,
+      98,    41,    42,     5,     6,    99,     8,     9,    10,   518,
+       0,     0,   416,   417,    14,    15,    16,   103,   375,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+     105,    24,     0,     0,     0,     0,    27,   106,   107,   108,
+      28,     0,     0,     0,     0,     0,     0,    29,    30,    31,
+       0,     0,     0,    34,     0,     0,     0,    38,   109,   110,
+     111,   112,   113,     0,     0,     0,     0,     0,     0,   114,
+       3,   659,    41,    42,     5,     6,   559,     8,     9,    10,
+     660,     0,     0,   661,   662,    14,    15,    16,     0,   104,
+      17,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    18,     0,    19,    20,    21,    22,    23,     0,
+       0,   105,    24,     0,     0,     0,     0,    27,   106,     0,
+       0,    28,     0,     0,     0,     0,     0,     0,    29,    30,
+      31,    32,    33,     0,    34,    35,    36,    37,    38,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    39,     0,
+     663,     3,     4,    41,    42,     5,     6,     7,     8,     9,
+      10,    11,     0,     0,    12,    13,    14,    15,    16,     0,
+       0,    17,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,     0,    24,     0,     0,     0,     0,    27,     0,
+       0,     0,    28,     0,     0,     0,     0,     0,     0,    29,
+      30,    31,    32,    33,     0,    34,    35,    36,    37,    38,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    39,
+       0,    40,     3,     4,    41,    42,     5,     6,     7,     8,
+       9,    10,   171,     0,     0,    12,    13,    14,    15,    16,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    18,     0,    19,    20,    21,    22,
+      23,     0,     0,     0,    24,     0,     0,     0,     0,    27,
+       0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+      29,    30,    31,    32,    33,     0,    34,    35,     0,     0,
+      38,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     233,     0,    40,     3,    98,    41,    42,     5,     6,    99,
+       8,     9,    10,   100,     0,     0,   101,   102,    14,    15,
+      16,     0,   104,    17,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,   105,    24,     0,     0,     0,     0,
+      27,   106,   107,     0,    28,     0,     0,     0,     0,     3,
+      98,    29,     0,     5,     6,    99,     8,     9,    10,   177,
+       0,    38,   101,   102,    14,    15,    16,     0,   104,     0,
+       0,     0,     0,   114,     0,     0,    41,    42,     0,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+     105,    24,     0,     0,     0,     0,    27,   106,   107,     0,
+      28,     0,     0,     0,     0,     3,   659,    29,     0,     5,
+       6,   559,     8,     9,    10,   660,     0,    38,   661,   662,
+      14,    15,    16,     0,   104,    17,     0,     0,     0,   114,
+       0,     0,    41,    42,     0,     0,     0,    18,     0,    19,
+      20,    21,    22,    23,     0,     0,   105,    24,     0,     0,
+       0,     0,    27,   106,     0,     0,    28,     0,     0,     0,
+       0,     3,   659,    29,     0,     5,     6,   559,     8,     9,
+      10,   767,     0,    38,   661,   662,    14,    15,    16,     0,
+     104,     0,     0,     0,     0,   663,     0,     0,    41,    42,
+       0,     0,     0,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,   105,    24,     0,     0,     0,     0,    27,   106,
+       0,     0,    28,     0,     0,     0,     0,     3,     4,    29,
+       0,     5,     6,     7,     8,     9,    10,    11,     0,    38,
+      12,    13,    14,    15,    16,     0,     0,    17,     0,     0,
+       0,   663,     0,     0,    41,    42,     0,     0,     0,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,    24,
+       0,     0,     0,     0,    27,     0,     0,     0,    28,     0,
+       0,     0,     0,     3,     4,    29,     0,     5,     6,   302,
+       8,     9,    10,   171,     0,    38,    12,    13,    14,    15,
+      16,     0,   303,     0,     0,     0,     0,    40,     0,     0,
+      41,    42,     0,     0,     0,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,     0,    24,     0,     0,     0,     0,
+      27,     0,     0,     0,    28,     0,     0,     0,     0,     3,
+       4,    29,     0,     5,     6,     7,     8,     9,    10,   171,
+       0,    38,    12,    13,    14,    15,    16,     0,     0,     0,
+       0,     0,     0,    40,     0,     0,    41,    42,     0,     0,
+       0,    18,     0,    19,    20,    21,    22,    23,     0,     0,
+       0,    24,     0,     0,     0,     0,    27,     0,     0,     0,
+      28,     0,     0,     0,     0,     3,     4,    29,     0,     5,
+       6,     7,     8,     9,    10,   171,     0,    38,    12,    13,
+      14,    15,    16,     0,     0,     0,     0,     0,     0,    40,
+     468,     0,    41,    42,     0,     0,     0,    18,     0,    19,
+      20,    21,    22,    23,     0,     0,     0,    24,     0,     0,
+       0,     0,    27,     0,     0,     0,    28,     0,     0,     0,
+       0,     3,   611,    29,     0,     5,     6,   612,     8,     9,
+      10,   518,     0,    38,   416,   417,    14,    15,    16,     0,
+       0,   522,     0,     0,     0,    40,     0,     0,    41,    42,
+       0,     0,     0,    18,     0,    19,    20,    21,    22,    23,
+       0,     0,     0,    24,     0,     0,     0,     0,    27,     0,
+     107,     0,    28,     0,     0,     0,     0,     3,     4,    29,
+       0,     5,     6,     7,     8,     9,    10,   171,     0,    38,
+      12,    13,    14,    15,    16,     0,     0,     0,     0,     0,
+       0,   613,     0,     0,    41,    42,     0,     0,     0,    18,
+       0,    19,    20,    21,    22,    23,     0,     0,     0,    24,
+       0,     0,     0,     0,    27,     0,     0,     0,    28,     0,
+       0,     0,     0,     3,     4,    29,     0,     5,     6,     7,
+       8,     9,    10,   171,     0,    38,    12,    13,    14,    15,
+      16,     0,     0,     0,   682,     0,     0,    40,     0,     0,
+      41,    42,     0,     0,     0,    18,     0,    19,    20,    21,
+      22,    23,     0,     0,     0,    24,     0,     0,     0,     0,
+      27,     0,     0,     0,    28,     0,     0,     0,     0,     3,
+     527,    29,     0,     5,   319,   528,     8,     9,    10,   321,
+       0,    38,   322,   323,   324,   325,    16,   103,   375,     0,
+       0,     0,     0,    40,     0,     0,    41,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     105,     0,     0,     0,     0,     0,   326,   106,   327,   108,
+     328,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   109,   110,
+     111,   112,   113,     0,     0,     0,   825,     3,   527,   529,
+       0,     5,   319,   528,     8,     9,    10,   686,     0,     0,
+     687,   688,   324,   325,    16,   103,   104,     0,     0,     0,
+       0,     0,     0,     0,   510,     0,     0,     5,     0,   511,
+       8,     9,    10,   672,     0,     0,   673,   674,   105,     0,
+      16,   103,   104,     0,   326,   106,   327,   108,   328,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   105,     0,   109,   110,   111,   112,
+     113,   106,   107,   108,     0,     0,     0,   529,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   109,   110,   111,   112,   113,     0,     0,     0,
+       0,     0,     0,   515
+  };
+
+  const short
+  VNLangParser::yycheck_[] =
+  {
+       1,   133,     0,   342,   136,    31,     1,   153,    34,   231,
+      36,   162,   301,    14,    15,   255,    36,   144,    34,   114,
+     341,   232,   271,   553,     7,    52,   341,   215,    12,   253,
+     208,   255,   162,   163,   164,    94,    62,   400,   360,   361,
+      93,    94,    95,   129,   367,   779,   780,   208,   237,   238,
+     239,    52,    90,   376,    34,    57,    58,   318,    96,    14,
+      15,   147,     9,   603,   604,   402,   606,     0,   329,    18,
+       1,   157,   329,    93,    47,   364,     8,   414,    20,     9,
+     341,   444,    94,   420,    16,    17,   308,   821,    66,     0,
+      68,    33,    40,    71,    11,     6,    97,    98,   309,   100,
+     101,   102,   772,   773,    51,    16,    17,    11,   124,   162,
+     163,   164,    96,   114,     0,    64,    69,     9,    71,   482,
+       6,    51,     8,     9,    10,    98,   314,    70,    71,   130,
+      16,    17,   133,   219,    94,   136,    85,    86,    87,    25,
+      26,    67,    68,   144,   814,    71,    50,   148,     0,   475,
+      66,    67,   153,   479,     6,    71,     8,     9,    10,    51,
+      92,    93,     6,    95,    16,    17,   114,   193,   194,    86,
+      70,    71,    89,    66,   175,    68,   177,    70,    71,   153,
+      97,    93,   208,   100,    95,   212,   213,   550,   339,    94,
+      94,    66,   208,   220,    69,    99,    71,     8,   102,    10,
+      66,   202,    68,   230,    70,    71,    90,   208,   209,    95,
+     342,   212,   213,    66,   215,   241,   269,    70,    71,   220,
+      66,   351,   352,   353,   402,    71,   358,    26,   208,   230,
+     231,   232,   553,    25,   361,    67,   414,   168,   553,    71,
+     428,   402,   420,    95,   330,    66,    37,    38,    39,   376,
+      71,   199,    37,   414,    92,   271,   444,   258,   580,   420,
+     586,   801,   792,   264,     8,     9,   527,    67,   529,   592,
+     271,    71,   529,   424,   535,    92,    61,   538,   615,     7,
+      65,   538,   522,   309,   285,   311,    14,    13,    52,    66,
+     285,    68,   553,   294,    71,    23,    24,   623,   522,   130,
+     589,    90,     1,    31,    93,    41,    34,   308,   309,   264,
+     101,    96,    42,   314,    66,   641,    40,   318,    70,    71,
+     321,   322,   323,   324,   325,   256,    68,   258,   329,    71,
+     331,    66,    67,    68,    69,    69,    71,    71,    94,   340,
+     341,   342,   343,    99,   345,   346,   347,   348,   265,    92,
+     267,   268,    95,   270,   285,    92,   357,   358,    95,    66,
+     361,   507,    69,   294,    71,    97,   367,   706,    91,   324,
+     325,   424,   373,    96,    91,   376,   402,    43,   667,    96,
+     507,     8,   408,    10,   705,   340,   402,    67,   414,    69,
+     705,    71,   718,   367,   420,    44,   645,   646,   414,   400,
+       8,   402,    10,   498,   420,   400,   630,    66,    67,    68,
+      69,   359,    71,   414,   415,   416,   417,   743,   373,   420,
+     515,    94,   402,   645,    97,    98,    99,   428,   689,   690,
+     618,   563,   689,   690,   414,   646,   437,   615,    68,   628,
+     420,    71,    94,   444,   705,   209,     7,    99,   212,   213,
+     398,   215,    46,    14,   615,   582,   220,    67,    68,    69,
+      98,    71,    23,    24,    95,    96,   230,    66,    67,   400,
+      31,   792,    71,    34,   475,    45,   114,   792,   479,    67,
+      68,   482,   437,    71,   432,     7,    93,   482,   777,    18,
+     321,   322,   323,     8,   114,    10,   684,   498,   415,   500,
+     331,   499,    95,    96,   505,   506,   507,     7,     7,   510,
+     341,   512,   513,   514,   515,    66,    67,   518,   613,    70,
+      71,     8,     3,    10,   675,   671,   527,    58,   529,    68,
+      69,   792,    71,     7,   535,    64,   666,   538,    68,    69,
+       8,    71,    10,   670,   475,   675,   547,    55,   479,   550,
+     314,   482,   553,    90,    26,   550,    85,    86,    87,   258,
+      25,   225,   563,   227,   228,    94,   567,    92,    97,    98,
+      99,    26,   271,    25,   706,   506,   602,   603,   604,   580,
+     606,   582,   202,     7,   679,   586,   285,   603,   604,   615,
+     606,   592,   547,    66,    67,    68,     7,    70,    71,   615,
+      66,    67,    68,     7,    70,    71,   580,     7,    16,     7,
+     611,    14,   613,   666,   615,    90,    79,   618,   592,   550,
+      23,    24,   623,   603,   604,    67,   606,    69,    31,    71,
+       7,    34,    94,   271,    95,   615,     7,   638,     7,     7,
+     641,    58,    51,   638,   645,   646,   773,   648,   649,    35,
+     581,   778,    16,   780,     6,   586,   294,   605,   659,   660,
+     661,   662,   663,    16,   428,   613,    94,     7,    94,   670,
+     671,   672,   673,   674,   294,   676,   677,    95,   679,    95,
+     444,     7,     7,   684,   710,   686,   687,   688,   689,   690,
+     817,     7,   623,   648,   649,     0,     1,   671,    57,     4,
+      51,   400,     8,   704,   705,   706,    11,   638,    95,    94,
+     641,    95,     9,   714,    16,   663,    95,   718,   745,   746,
+     721,    93,   553,   724,   725,    66,    67,    68,   348,    34,
+      71,   648,   649,   734,    51,    40,    66,    67,    68,   100,
+     714,    71,   743,   660,   745,   746,    10,    52,     8,     8,
+      15,    14,     9,    18,    19,    20,    21,    22,    23,    26,
+      23,    24,    52,    25,     8,   766,   767,     8,    31,   724,
+     725,    34,   773,   704,    37,   801,   475,   778,   779,   780,
+     479,    86,   783,   482,    89,   801,     8,   718,   789,   790,
+       8,   792,    97,    98,     7,   100,    61,     7,    61,    16,
+     103,    92,    65,   734,    93,   779,    67,    68,    69,   114,
+      71,   130,   743,   814,    95,    92,   817,   818,     7,   124,
+     821,   801,    37,    95,     8,   130,     9,    90,     8,    94,
+      93,   832,    97,    98,   789,   790,   753,   754,     7,    17,
+     814,   144,     8,   774,   818,    66,    67,   821,     8,    70,
+      71,   550,    91,    93,   618,   686,   687,   688,   832,    91,
+     498,     7,    95,   168,     8,     8,     8,   505,   318,     9,
+       8,     8,   510,     8,   705,     8,    17,   515,    17,   329,
+     500,     8,     7,    95,     8,   816,   506,   586,     8,     8,
+       8,   341,   100,    95,   199,   515,    77,    91,   207,   100,
+      17,    17,   207,   208,   209,   100,   207,   212,   213,   529,
+     215,   525,   710,   706,   709,   220,   766,   705,   231,   309,
+     684,   232,   240,   645,   623,   230,   231,   232,    62,   243,
+       1,   246,   242,   130,   257,   247,   194,   244,   357,   638,
+     248,   245,   641,   105,    -1,    -1,    -1,   567,    -1,   249,
+      -1,   256,    -1,   258,    -1,    -1,    -1,    -1,    -1,    -1,
+     265,   792,   267,   268,    -1,   270,   271,    -1,    -1,    -1,
+      -1,    -1,    -1,   611,    -1,   613,    -1,    -1,    -1,    -1,
+     285,   745,   746,    -1,    -1,    -1,    -1,    15,    -1,   294,
+      18,    19,    20,    21,    22,    23,    -1,    -1,    -1,   318,
+      -1,    -1,   321,   322,   323,    -1,    -1,    -1,    -1,   314,
+     329,    -1,   331,   318,    -1,    -1,   321,   322,   323,   718,
+      -1,    -1,   341,    -1,   329,    -1,   331,    -1,    -1,    -1,
+      -1,    -1,    -1,    61,    -1,    63,   341,    -1,   676,   677,
+      -1,   679,    -1,   663,   743,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   355,    -1,   359,    -1,   676,   360,   361,   130,
+      -1,    -1,    -1,    91,   367,    -1,    -1,    -1,    -1,   689,
+      -1,   374,    -1,   376,    -1,    -1,    -1,   527,    -1,   529,
+      -1,    -1,    -1,    -1,   704,   535,    -1,    -1,   538,    -1,
+      -1,    -1,    -1,   398,    -1,   400,   734,   402,    -1,    -1,
+      -1,   721,    -1,   553,    -1,    -1,    -1,    -1,    -1,   414,
+     415,    -1,    -1,    -1,    -1,   420,    -1,    -1,    -1,    -1,
+      -1,   318,    -1,   428,   321,   322,   323,   432,   766,    -1,
+      -1,    -1,   329,    -1,   331,    -1,    -1,    -1,    -1,   444,
+      -1,     7,    -1,    -1,   341,   783,    -1,    -1,    14,    15,
+      -1,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    27,    28,    29,    30,    31,    -1,    33,    34,    -1,
+     475,    -1,    -1,    -1,   479,    -1,    -1,   482,    -1,    -1,
+      46,    -1,    48,    49,    50,    51,    52,   258,    -1,    55,
+      56,    -1,    -1,    -1,   499,    61,    62,    63,    -1,    65,
+     271,   506,    -1,    -1,    -1,    -1,    72,    -1,   527,    -1,
+     529,    -1,    -1,    -1,   285,    -1,    82,    -1,    -1,   538,
+      -1,    -1,   527,    -1,   529,    -1,    -1,    -1,    94,    -1,
+      -1,    97,    98,   538,   553,    -1,    -1,    -1,    -1,   689,
+     690,    -1,    -1,    -1,    -1,   550,    -1,   318,   553,    -1,
+     321,   322,   323,    -1,    -1,   705,    15,    -1,   329,    18,
+     331,    20,    -1,     0,     1,    24,    -1,     4,    27,    28,
+     341,   342,    31,    -1,    11,    -1,   581,   580,    -1,    15,
+      -1,   586,    18,    19,    20,    21,    22,    23,    15,   592,
+      -1,    18,    19,    20,    21,    22,    23,    34,   603,   604,
+     605,   606,    -1,    40,    63,    -1,   611,    -1,   613,    -1,
+     615,    -1,    -1,   618,    -1,    -1,    -1,    -1,   623,    -1,
+      -1,    -1,    -1,    -1,    -1,    61,    -1,    63,    -1,   400,
+     527,    -1,   529,   638,    61,    94,   641,    -1,    -1,    -1,
+      -1,   538,   792,   648,   649,    -1,    -1,    -1,    -1,    86,
+      -1,    -1,    89,    -1,   659,   660,   553,    -1,   663,    -1,
+      97,    98,    -1,   100,    -1,    -1,    -1,   686,   687,   688,
+     689,   690,    -1,    -1,    -1,    -1,    -1,   114,    -1,   684,
+      -1,   686,   687,   688,   689,   690,   705,   124,    -1,    -1,
+      -1,    -1,    -1,   130,    -1,    -1,    -1,    -1,    -1,   704,
+     705,    -1,    -1,    -1,   475,    -1,   709,    -1,   479,    -1,
+       7,   482,    -1,   718,    -1,    -1,    -1,    14,    15,    -1,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,   734,
+      27,   168,    -1,    -1,    31,    -1,    -1,    -1,   743,    -1,
+     745,   746,    -1,    -1,    -1,    -1,    -1,    -1,   753,   754,
+      -1,    -1,    -1,    -1,    -1,    -1,   527,    -1,   529,    -1,
+      -1,    -1,   199,    -1,    61,    -1,    -1,   538,    -1,   774,
+     207,   208,    -1,   792,    -1,    -1,    -1,    -1,    -1,   550,
+      -1,    -1,   553,    -1,    -1,    -1,    -1,   792,    -1,   686,
+     687,   688,   689,   690,   231,   232,   801,    94,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   705,    -1,
+      -1,   816,    -1,    -1,    -1,   586,    -1,    -1,    -1,   256,
+      -1,   258,    -1,    -1,    -1,    -1,    -1,    -1,   265,    -1,
+     267,   268,    -1,   270,   271,    -1,    -1,    -1,    -1,    -1,
+       0,     1,    -1,    -1,     4,    -1,    -1,    -1,   285,    -1,
+      -1,    11,   623,    15,    -1,    -1,    18,   294,    20,    21,
+      22,    23,    24,    -1,    -1,    27,    28,   638,    -1,    31,
+     641,    33,    -1,    -1,    34,    -1,    -1,    -1,    -1,    -1,
+      40,   318,    -1,    -1,   321,   322,   323,    -1,    -1,    -1,
+      -1,    -1,   329,    55,   331,   792,    -1,    -1,    -1,    -1,
+      62,    63,    -1,    -1,   341,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   686,   687,   688,   689,   690,
+      -1,    -1,   359,    -1,    -1,    -1,    86,    -1,    -1,    89,
+      -1,    -1,    94,    -1,   705,   706,    -1,    97,    98,    -1,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   718,    -1,    93,
+      -1,    -1,    15,    -1,   114,    18,    19,    20,    21,    22,
+      23,   398,    -1,   400,   124,   402,    -1,    -1,    -1,    -1,
+      -1,    -1,   743,    -1,    -1,    -1,    -1,   414,   415,    -1,
+      14,    15,    -1,   420,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    27,    -1,   432,    -1,    31,    61,    -1,
+      -1,    64,    -1,    37,    -1,    -1,    -1,    -1,   168,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   161,   162,   163,
+     164,   792,    85,    86,    87,    -1,    -1,    61,    -1,    -1,
+      -1,    94,    -1,    -1,    97,    98,    -1,    -1,   475,   199,
+     184,    -1,   479,    -1,    -1,   482,    -1,   207,   208,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      94,    -1,   499,    -1,    -1,    -1,    -1,    -1,    -1,   506,
+      -1,   231,   232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   225,   226,   227,   228,    -1,    -1,    -1,    -1,    -1,
+     527,    -1,   529,    -1,    -1,    -1,   256,    -1,   258,    -1,
+      -1,   538,    -1,    -1,    -1,   265,    -1,   267,   268,    -1,
+     270,   271,    -1,   550,    15,    -1,   553,    18,    19,    20,
+      21,    22,    23,    14,    15,   285,    -1,    18,    19,    20,
+      21,    22,    23,    24,   294,    -1,    27,    -1,    -1,    -1,
+      31,    -1,    -1,    -1,   581,    -1,    -1,    -1,    -1,   586,
+      51,    52,    -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,
+      61,    -1,    -1,    -1,    65,    -1,   603,   604,   605,   606,
+      61,    72,    -1,    -1,   611,    -1,   613,    -1,   615,    -1,
+      -1,    82,    -1,    -1,    -1,    -1,   623,    -1,    -1,    -1,
+      -1,    -1,    -1,    94,   338,   339,    -1,    -1,    -1,   359,
+      -1,   638,    -1,    94,   641,    -1,   350,   351,   352,   353,
+      -1,   648,   649,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   659,   660,   368,    -1,   663,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   379,    -1,    -1,   398,    -1,
+     400,    -1,   402,    -1,    -1,    -1,    -1,    -1,    -1,   686,
+     687,   688,   689,   690,   414,   415,    -1,    -1,    -1,    -1,
+     420,    -1,    -1,    -1,    -1,    -1,    -1,   704,   705,    -1,
+      -1,    -1,   432,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     424,   718,    -1,    -1,    -1,    14,    15,    -1,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,   734,    27,    28,
+      29,    30,    31,    -1,    33,    -1,   743,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   475,   753,   754,    -1,   479,
+      -1,    -1,   482,    -1,    -1,    -1,    55,    -1,    -1,    -1,
+      -1,    -1,    61,    62,    63,    64,    65,   774,    -1,   499,
+      -1,    -1,    -1,    -1,    -1,    -1,   506,    -1,    -1,    -1,
+      -1,    -1,    -1,    14,    15,   792,    85,    18,    19,    20,
+      -1,     1,    23,    24,   801,    94,    27,    28,    29,    30,
+      31,    -1,    -1,   517,    14,    15,    -1,    -1,    -1,   816,
+      15,    -1,    -1,    18,    -1,    20,    21,    22,    23,    24,
+     550,    -1,    27,    28,    -1,    -1,    31,    -1,    33,    -1,
+      61,    -1,    63,    64,    65,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      55,   581,    -1,    -1,    85,    -1,   586,    62,    -1,    -1,
+      -1,    -1,    -1,    94,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   603,   604,   605,   606,    -1,    -1,    89,
+      -1,   611,    -1,   613,    -1,   615,    -1,    97,    98,    94,
+     100,   101,   102,   623,    -1,    -1,    -1,    -1,    -1,    -1,
+     614,    -1,    -1,    -1,   114,    -1,    -1,    -1,   638,    -1,
+      -1,   641,    -1,    -1,   124,    -1,    -1,    -1,   648,   649,
+     130,    -1,    -1,   133,    -1,    -1,   136,    -1,    -1,   659,
+     660,    -1,    -1,   663,    -1,    -1,    -1,    15,   148,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    27,
+      28,   665,   666,    31,    -1,    33,    -1,    -1,    -1,    -1,
+      -1,   675,    -1,    -1,    -1,   175,   680,   177,    -1,    -1,
+      -1,    -1,    -1,    -1,   704,    -1,    -1,    55,    -1,    -1,
+      -1,    -1,    -1,    61,    62,    -1,    64,    -1,   718,    -1,
+      -1,    -1,   202,    -1,    -1,    -1,    -1,    -1,   208,   209,
+      -1,   715,   212,   213,   734,   215,    -1,    85,    -1,    -1,
+     220,    -1,    -1,   743,    -1,    -1,    94,    -1,    -1,    -1,
+     230,   231,   232,   753,   754,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   774,    -1,    -1,    -1,   258,    -1,
+      -1,    -1,    -1,    -1,   264,   265,    -1,   267,   268,    -1,
+     270,   271,    -1,    -1,    -1,    -1,    -1,   781,    -1,    -1,
+      -1,   801,    -1,    -1,    -1,   285,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   294,    -1,   816,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   308,   309,
+      -1,    -1,    -1,    -1,   314,    -1,    -1,    -1,   318,    -1,
+      -1,   321,   322,   323,   324,   325,    -1,    -1,    -1,   329,
+      -1,   331,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     340,   341,   342,   343,    -1,   345,   346,   347,   348,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   357,   358,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,
+      -1,    14,    15,   373,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    27,    28,    29,    30,    31,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    14,    15,    -1,
+     400,    -1,   402,    46,    -1,    48,    49,    50,    51,    52,
+      -1,    -1,    -1,    56,   414,   415,   416,   417,    61,    -1,
+     420,    -1,    65,    -1,    -1,    -1,    -1,    -1,   428,    72,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   437,    -1,    82,
+      -1,    -1,    -1,    -1,   444,    -1,    -1,    -1,    -1,    -1,
+      -1,    94,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   475,    -1,    -1,    -1,   479,
+      97,    -1,   482,   100,   101,   102,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   498,    -1,
+     500,    -1,    -1,    -1,    -1,   505,   506,    -1,    -1,    -1,
+     510,    -1,   512,   513,   514,   515,    -1,    15,   518,    -1,
+      18,    -1,    20,    21,    22,    23,    -1,   527,    -1,   529,
+      -1,   148,    -1,    -1,    32,    33,    -1,    -1,   538,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   547,    -1,    -1,
+     550,    -1,    -1,   553,    -1,    -1,    -1,    55,   175,    -1,
+     177,    -1,    -1,   563,    62,    -1,    64,   567,     1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    14,    15,    -1,    -1,    -1,   586,    85,    86,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   611,    -1,   613,    -1,   615,    -1,    -1,   618,    52,
+      -1,    -1,    -1,   623,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   638,    -1,
+      -1,   641,    -1,    -1,    -1,   645,   646,   264,   648,   649,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   659,
+     660,   661,   662,   663,    97,    98,    -1,   100,   101,   102,
+      -1,    -1,   672,   673,   674,    -1,   676,   677,    -1,   679,
+      -1,   114,    -1,    -1,   684,    -1,   686,   687,   688,   689,
+     690,    15,    -1,    -1,    18,    -1,    20,    21,    22,    23,
+     133,    -1,    -1,   136,   704,   705,   706,   324,   325,    33,
+      -1,    -1,    -1,    -1,    -1,   148,    -1,    -1,   718,    -1,
+     153,   721,    -1,   340,   724,   725,    -1,    -1,   345,   346,
+     347,    55,    -1,    -1,   734,    -1,    -1,    -1,    62,    -1,
+      64,    -1,   175,   743,   177,   745,   746,    -1,    -1,    -1,
+      -1,    -1,    -1,   753,   754,    -1,   373,    -1,    -1,    -1,
+      -1,    85,    86,    87,    -1,    -1,   766,   767,    -1,   202,
+      94,    -1,    -1,    -1,    -1,   208,   209,    -1,    -1,   212,
+     213,    -1,   215,   783,    -1,    -1,    -1,   220,    -1,   789,
+     790,    -1,   792,    -1,    -1,    -1,    -1,   230,   231,   232,
+      14,    15,    -1,    -1,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    27,    28,    29,    30,    31,    32,    33,
+     437,    -1,    -1,    -1,    -1,   258,    -1,    -1,    -1,    -1,
+      -1,   264,    -1,    -1,    -1,    -1,    -1,    -1,   271,    -1,
+      -1,    55,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,
+      64,    65,   285,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   294,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    86,    87,    -1,   308,   309,    91,    -1,    -1,
+      94,   314,    -1,    -1,    -1,   318,    -1,    -1,    -1,    -1,
+      -1,   324,   325,    -1,    -1,    -1,   329,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,   341,   342,
+     343,    -1,   345,   346,   347,   348,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   357,   358,    -1,    -1,    -1,    -1,
+     547,    -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,
+     373,    14,    15,    -1,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    27,    28,    29,    30,    31,    -1,
+      33,    -1,    -1,    -1,    -1,    -1,    -1,   400,    -1,   402,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      -1,   414,    55,    56,    -1,    -1,    -1,   420,    61,    62,
+      63,    -1,    65,    -1,    -1,   428,    -1,    -1,    -1,    72,
+      -1,    -1,    -1,    -1,   437,    -1,    -1,    -1,    -1,    82,
+      -1,   444,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    94,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,
+      -1,   648,   649,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   475,   660,   661,   662,   479,    -1,    -1,   482,
+      -1,    -1,    -1,    -1,    -1,   672,   673,   674,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   498,    -1,   500,    -1,   686,
+     687,   688,   505,   506,   507,    -1,    -1,   510,    -1,    -1,
+      -1,    -1,   515,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    15,    -1,   527,    18,   529,    20,    21,    22,
+      23,    -1,   535,    -1,    -1,   538,    -1,   724,   725,    32,
+      33,    -1,    -1,    -1,   547,    -1,    -1,   550,    -1,    -1,
+     553,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     563,    -1,    55,    -1,   567,     1,    -1,    -1,    -1,    62,
+      -1,    64,    -1,    -1,    -1,    -1,    -1,    -1,    14,    15,
+     767,    -1,    -1,   586,    -1,    -1,    -1,    -1,    -1,    -1,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    94,   789,   790,    -1,    -1,    -1,    -1,   611,    -1,
+     613,    -1,   615,    -1,    -1,   618,    52,    -1,    -1,    -1,
+     623,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   638,    -1,    -1,   641,    -1,
+      -1,    -1,   645,   646,    -1,   648,   649,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   659,   660,   661,   662,
+     663,    97,    98,    -1,   100,   101,   102,    -1,   671,   672,
+     673,   674,    -1,   676,   677,    -1,   679,    -1,   114,    -1,
+      -1,   684,    -1,   686,   687,   688,   689,   690,    15,    -1,
+      -1,    18,    -1,    20,    21,    22,    23,   133,    -1,    -1,
+     136,   704,   705,   706,    -1,    32,    33,    -1,    -1,    -1,
+      -1,    -1,   148,    -1,    -1,   718,    -1,   153,   721,    -1,
+      -1,   724,   725,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      -1,   734,    -1,    -1,    -1,    62,    -1,    64,    -1,   175,
+     743,   177,   745,   746,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,
+      87,    -1,    -1,   766,   767,    -1,   202,    94,    -1,    -1,
+      -1,    -1,   208,   209,    -1,    -1,   212,   213,    -1,   215,
+     783,    -1,    -1,    -1,   220,    -1,   789,   790,    -1,   792,
+      -1,    -1,    -1,    -1,   230,   231,   232,    14,    15,    -1,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      27,    28,    29,    30,    31,    32,    33,    -1,    -1,    -1,
+      -1,    -1,   258,    -1,    -1,    -1,    -1,    -1,   264,    -1,
+      -1,    -1,    -1,    -1,    -1,   271,    -1,    -1,    55,    -1,
+      -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,   285,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   294,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
+      87,    -1,   308,   309,    91,    -1,    -1,    94,   314,    -1,
+      -1,    -1,   318,    -1,    -1,    -1,    -1,    -1,   324,   325,
+      -1,    -1,    -1,   329,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   340,   341,   342,   343,    -1,   345,
+     346,   347,   348,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   357,   358,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     7,    -1,    -1,    -1,    -1,    -1,   373,    14,    15,
+      -1,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    27,    28,    29,    30,    31,    -1,    33,    -1,    -1,
+      -1,    -1,    -1,    -1,   400,    -1,   402,    -1,    -1,    -1,
+      46,    -1,    48,    49,    50,    51,    52,    -1,   414,    55,
+      56,    -1,    -1,    -1,   420,    61,    62,    63,    -1,    65,
+      -1,    -1,   428,    -1,    -1,    -1,    72,    -1,    -1,    -1,
+      -1,   437,    -1,    -1,    -1,    -1,    82,    -1,   444,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,
+      -1,    97,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   475,
+      -1,    -1,    -1,   479,    -1,    -1,   482,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   498,    -1,   500,    -1,    -1,    -1,    -1,   505,
+     506,   507,    -1,    -1,   510,    -1,    -1,    -1,    -1,   515,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   527,    -1,   529,    -1,    -1,    -1,    -1,    -1,   535,
+      -1,    -1,   538,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   547,    -1,    -1,   550,    -1,    -1,   553,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   563,    -1,    -1,
+      -1,   567,     1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    14,    15,    -1,    -1,    -1,
+     586,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   611,    -1,   613,    -1,   615,
+      -1,    -1,   618,    52,    -1,    -1,    -1,   623,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   638,    -1,    -1,   641,    -1,    -1,    -1,   645,
+     646,    -1,   648,   649,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   659,   660,   661,   662,   663,    97,    98,
+      -1,   100,   101,   102,    -1,   671,   672,   673,   674,    -1,
+     676,   677,    -1,   679,    -1,   114,    -1,    -1,   684,    -1,
+     686,   687,   688,   689,   690,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   133,    -1,    -1,   136,   704,   705,
+     706,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   148,
+      -1,    -1,   718,    -1,   153,   721,    -1,    -1,   724,   725,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   734,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   743,   177,   745,
+     746,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     766,   767,    -1,   202,    -1,    -1,    -1,    -1,    -1,   208,
+     209,    -1,    -1,   212,   213,    -1,   215,   783,    -1,    -1,
+      -1,   220,    -1,   789,   790,    -1,   792,    -1,    -1,    -1,
+      -1,   230,   231,   232,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   258,
+      -1,    -1,    -1,    -1,    -1,   264,    -1,    -1,    -1,    -1,
+      -1,    -1,   271,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     1,    15,    -1,   285,    18,    -1,    20,
+      21,    22,    23,    24,    -1,   294,    27,    28,    -1,    -1,
+      31,    32,    33,    -1,    -1,    -1,    -1,    -1,    -1,   308,
+     309,    -1,    -1,    -1,    -1,   314,    -1,    -1,    -1,   318,
+      -1,    -1,    -1,    -1,    55,   324,   325,    -1,    -1,    -1,
+     329,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   340,   341,   342,   343,    -1,   345,   346,   347,   348,
+      -1,    -1,    83,    84,    85,    86,    87,    -1,   357,   358,
+      -1,    -1,    -1,    94,    95,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   373,    -1,    -1,    -1,    -1,    -1,
+      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   114,    -1,    -1,    -1,
+      -1,   400,    -1,   402,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   414,    -1,    -1,    -1,    -1,
+      -1,   420,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   428,
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,   437,    -1,
+      -1,    -1,    -1,    -1,    -1,   444,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    15,    -1,    -1,    18,    -1,
+      20,    21,    22,    23,    24,    -1,    -1,    27,    28,    -1,
+      -1,    31,    32,    33,    -1,    -1,   475,    -1,    -1,    -1,
+     479,    -1,    -1,   482,    -1,    -1,    -1,    -1,    -1,    -1,
+     208,    -1,    -1,    -1,    -1,    55,    -1,    -1,    -1,   498,
+      -1,   500,    62,    63,    64,    -1,   505,   506,   507,    -1,
+      -1,   510,    -1,   231,   232,    -1,   515,    -1,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    86,    87,   527,    -1,
+     529,    -1,    -1,    -1,    94,    -1,   535,    -1,    -1,   538,
+     258,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   547,    -1,
+      -1,   550,    -1,   271,   553,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   563,    -1,    -1,   285,   567,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   294,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   586,    -1,    -1,
+     308,   309,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     318,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   329,   611,    -1,   613,    -1,   615,    -1,    -1,   618,
+      -1,    -1,    -1,   341,   623,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   638,
+      -1,    -1,   641,    -1,    -1,    -1,   645,   646,    -1,   648,
+     649,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     659,   660,   661,   662,   663,    -1,    -1,    14,    15,    -1,
+      -1,    -1,   671,   672,   673,   674,    -1,   676,   677,    -1,
+     679,    -1,   400,    -1,   402,   684,    -1,   686,   687,   688,
+     689,   690,    -1,    -1,    -1,    -1,   414,    -1,    -1,    -1,
+      -1,    -1,   420,    -1,    -1,   704,   705,   706,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   718,
+      -1,    -1,   721,    -1,    -1,   724,   725,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   734,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   743,    -1,   745,   746,    -1,    -1,
+      97,    -1,    -1,   100,   101,   102,    -1,   475,    -1,    -1,
+      -1,   479,    -1,    -1,   482,    -1,    -1,   766,   767,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     498,    -1,    -1,   130,   783,    -1,    -1,   505,    -1,   507,
+     789,   790,   510,   792,    -1,    -1,    -1,   515,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   527,
+      -1,   529,    -1,    -1,    -1,    -1,    -1,   535,    -1,    -1,
+     538,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,    -1,
+     177,    -1,   550,    -1,    -1,   553,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    11,
+      12,    13,    14,    15,    -1,    -1,    18,    19,    20,    21,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   586,    31,
+      -1,    -1,    -1,    -1,    36,    -1,    -1,    -1,    -1,    41,
+      42,    -1,    14,    15,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   611,    -1,   613,    -1,   615,    -1,    -1,
+      62,    -1,    -1,    -1,    -1,   623,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,    -1,    -1,
+     638,    -1,    -1,   641,    86,    -1,    -1,   645,   646,    -1,
+      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,   100,   101,
+     102,    -1,   104,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   671,    -1,    -1,    -1,    -1,   676,   677,
+      -1,   679,    -1,    -1,    -1,    97,    -1,    -1,   100,   101,
+     102,   689,   690,    -1,   321,   322,   323,   324,   325,    -1,
+      -1,    -1,    -1,    -1,   331,    -1,    -1,   705,    -1,    -1,
+      -1,    -1,    -1,   340,    -1,    -1,    -1,    -1,    -1,    -1,
+     718,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   171,
+      -1,   173,    -1,   175,    -1,   177,   734,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   743,   373,    -1,    -1,    -1,
+      -1,   193,   194,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,    -1,   177,    -1,    -1,   766,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   783,    -1,    -1,   415,   416,
+     417,    -1,    -1,    -1,   792,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     437,   253,    -1,   255,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   264,    -1,    -1,    -1,    14,    15,    -1,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    27,
+      28,    29,    30,    31,    -1,    -1,    34,    -1,    -1,    -1,
+      -1,    -1,   264,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    -1,    -1,   309,    56,   311,
+      -1,    -1,    -1,    61,    -1,    63,    -1,    65,    -1,    -1,
+      -1,    -1,   324,   325,    72,   512,   513,   514,    -1,    -1,
+      -1,   518,    -1,    -1,    82,    -1,    -1,    -1,   340,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    94,    -1,   535,    97,
+      98,    -1,   324,   325,    -1,    -1,    -1,    -1,    -1,    -1,
+     547,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   340,    14,
+      15,   373,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    29,    30,    31,    32,    33,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   373,    -1,    -1,    -1,    -1,   408,    -1,    -1,    -1,
+      55,    -1,    -1,   415,   416,   417,    61,    62,    63,    64,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   437,    -1,    -1,    83,    84,
+      85,    86,    87,   415,   416,   417,    91,    -1,    -1,    94,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   648,   649,    14,    15,   437,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    27,    28,    29,    30,
+      31,    32,    33,    -1,    -1,   672,   673,   674,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   686,
+     687,   688,    -1,    -1,    55,    -1,    -1,    -1,    -1,    -1,
+      61,    62,    63,    64,    65,    -1,   518,    -1,    -1,    -1,
+     522,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    83,    84,    85,    86,    87,   724,   725,    -1,
+     512,   513,   514,    94,    -1,   547,   518,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     4,     5,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    14,    15,    -1,   547,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    27,    28,    29,    30,    31,
+      32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     602,    -1,   789,   790,    46,    -1,    48,    49,    50,    51,
+      52,    -1,    -1,    55,    56,    -1,    -1,    59,    60,    61,
+      62,    63,    64,    65,    -1,    -1,   628,    -1,   630,    -1,
+      72,    73,    74,    75,    76,    -1,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,   648,   649,    -1,    -1,
+      92,    -1,    94,    -1,    -1,    97,    98,    -1,   660,   661,
+     662,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,
+       5,    -1,    -1,    -1,    -1,    -1,   648,   649,    -1,    14,
+      15,    -1,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    29,    30,    31,    -1,    33,    34,
+     672,   673,   674,    -1,    -1,    -1,    -1,    -1,   710,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,   724,   725,    59,    60,    61,    62,    -1,    -1,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,
+      75,    76,    -1,    78,    79,    80,    81,    82,    -1,    -1,
+      -1,    -1,   724,   725,    -1,    -1,    -1,    92,    -1,    94,
+      -1,    -1,    97,    98,    -1,   767,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,
+       5,    -1,    -1,    -1,    -1,    -1,    -1,   789,   790,    14,
+      15,    -1,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   789,   790,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,    -1,    -1,    59,    60,    61,    62,    63,    64,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,
+      75,    76,    -1,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,     4,     5,    -1,    92,    -1,    94,
+      -1,    -1,    97,    98,    14,    15,    -1,    -1,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    27,    28,    29,
+      30,    31,    -1,    -1,    34,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    48,    49,
+      50,    51,    52,    -1,    -1,    -1,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,
+      -1,    -1,    72,    73,    74,    75,    76,    -1,    78,    79,
+      80,    81,    82,    -1,    -1,     4,     5,    -1,    -1,    -1,
+      90,    -1,    92,    -1,    94,    14,    15,    97,    98,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    27,    28,
+      29,    30,    31,    -1,    -1,    34,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    -1,    -1,    -1,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    72,    73,    74,    75,    76,    -1,    78,
+      79,    80,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+       8,     9,    -1,    92,    -1,    94,    14,    15,    97,    98,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    27,
+      28,    29,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    -1,    -1,    55,    56,    -1,
+      -1,    -1,    -1,    61,    62,    63,    64,    65,    -1,    -1,
+      -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,    -1,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      -1,     8,     9,    -1,    92,    -1,    94,    14,    15,    97,
+      98,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      27,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    -1,    -1,    55,    56,
+      -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,    -1,
+      -1,    -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,
+      -1,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,     8,    -1,    -1,    92,    -1,    94,    14,    15,
+      97,    98,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    27,    28,    29,    30,    31,    32,    33,    34,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    48,    49,    50,    51,    52,    -1,    -1,    55,
+      56,    -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,    75,
+      76,    -1,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    -1,     8,    -1,    -1,    92,    -1,    94,    14,
+      15,    97,    98,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    29,    30,    31,    32,    33,    34,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,    -1,    -1,    -1,    -1,    61,    62,    63,    64,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,
+      75,    76,    -1,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,     8,    -1,    -1,    92,    -1,    94,
+      14,    15,    97,    98,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    27,    28,    29,    30,    31,    32,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    48,    49,    50,    51,    52,    -1,
+      -1,    55,    56,    -1,    -1,    -1,    -1,    61,    62,    63,
+      64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
+      74,    75,    76,    -1,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    -1,    -1,     9,    -1,    92,    -1,
+      94,    14,    15,    97,    98,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    27,    28,    29,    30,    31,    32,
+      33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      -1,    -1,    55,    56,    -1,    -1,    -1,    -1,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      73,    74,    75,    76,    -1,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    92,
+      -1,    94,    14,    15,    97,    98,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    27,    28,    29,    30,    31,
+      32,    33,    34,    -1,    -1,    37,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,
+      52,    -1,    -1,    55,    56,    -1,    -1,    -1,    -1,    61,
+      62,    63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,
+      72,    73,    74,    75,    76,    -1,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,
+      92,    -1,    94,    14,    15,    97,    98,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    27,    28,    29,    30,
+      31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    48,    49,    50,
+      51,    52,    -1,    -1,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    63,    64,    65,    -1,    -1,    -1,    -1,    -1,
+      -1,    72,    73,    74,    75,    76,    -1,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      91,    92,    -1,    94,    14,    15,    97,    98,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    27,    28,    29,
+      30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    48,    49,
+      50,    51,    52,    -1,    -1,    55,    56,    -1,    -1,    -1,
+      -1,    61,    62,    63,    64,    65,    -1,    -1,    -1,    -1,
+      -1,    -1,    72,    73,    74,    75,    76,    -1,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    -1,    -1,
+      90,    -1,    92,    -1,    94,    14,    15,    97,    98,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    27,    28,
+      29,    30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    -1,    -1,    55,    56,    -1,    -1,
+      -1,    -1,    61,    62,    63,    64,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    72,    73,    74,    75,    76,    -1,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    -1,
+      -1,    -1,    91,    92,    -1,    94,    14,    15,    97,    98,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    27,
+      28,    29,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    -1,    -1,    55,    56,    -1,
+      -1,    -1,    -1,    61,    62,    63,    64,    65,    -1,    -1,
+      -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,    -1,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      -1,    -1,    -1,    -1,    92,    -1,    94,    14,    15,    97,
+      98,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      27,    28,    29,    30,    31,    32,    33,    34,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    -1,    -1,    55,    56,
+      -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,    -1,
+      -1,    -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,
+      -1,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    92,    -1,    94,    14,    15,
+      97,    98,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    27,    28,    29,    30,    31,    32,    33,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    48,    49,    50,    51,    52,    -1,    -1,    55,
+      56,    -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,    75,
+      76,    -1,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    92,    -1,    94,    14,
+      15,    97,    98,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    29,    30,    31,    32,    33,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,    -1,    -1,    -1,    -1,    61,    62,    63,    64,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,    74,
+      -1,    -1,    -1,    78,    -1,    -1,    -1,    82,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    94,
+      14,    15,    97,    98,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    27,    28,    29,    30,    31,    -1,    33,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    48,    49,    50,    51,    52,    -1,
+      -1,    55,    56,    -1,    -1,    -1,    -1,    61,    62,    -1,
+      -1,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
+      74,    75,    76,    -1,    78,    79,    80,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,    -1,
+      94,    14,    15,    97,    98,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    27,    28,    29,    30,    31,    -1,
+      -1,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,    61,    -1,
+      -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      73,    74,    75,    76,    -1,    78,    79,    80,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,
+      -1,    94,    14,    15,    97,    98,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    27,    28,    29,    30,    31,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,
+      52,    -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,    61,
+      -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,    -1,
+      72,    73,    74,    75,    76,    -1,    78,    79,    -1,    -1,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    -1,    94,    14,    15,    97,    98,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    27,    28,    29,    30,
+      31,    -1,    33,    34,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    48,    49,    50,
+      51,    52,    -1,    -1,    55,    56,    -1,    -1,    -1,    -1,
+      61,    62,    63,    -1,    65,    -1,    -1,    -1,    -1,    14,
+      15,    72,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    82,    27,    28,    29,    30,    31,    -1,    33,    -1,
+      -1,    -1,    -1,    94,    -1,    -1,    97,    98,    -1,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,    -1,    -1,    -1,    -1,    61,    62,    63,    -1,
+      65,    -1,    -1,    -1,    -1,    14,    15,    72,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,    82,    27,    28,
+      29,    30,    31,    -1,    33,    34,    -1,    -1,    -1,    94,
+      -1,    -1,    97,    98,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    -1,    -1,    55,    56,    -1,    -1,
+      -1,    -1,    61,    62,    -1,    -1,    65,    -1,    -1,    -1,
+      -1,    14,    15,    72,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    82,    27,    28,    29,    30,    31,    -1,
+      33,    -1,    -1,    -1,    -1,    94,    -1,    -1,    97,    98,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      -1,    -1,    55,    56,    -1,    -1,    -1,    -1,    61,    62,
+      -1,    -1,    65,    -1,    -1,    -1,    -1,    14,    15,    72,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    82,
+      27,    28,    29,    30,    31,    -1,    -1,    34,    -1,    -1,
+      -1,    94,    -1,    -1,    97,    98,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,    65,    -1,
+      -1,    -1,    -1,    14,    15,    72,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    82,    27,    28,    29,    30,
+      31,    -1,    33,    -1,    -1,    -1,    -1,    94,    -1,    -1,
+      97,    98,    -1,    -1,    -1,    46,    -1,    48,    49,    50,
+      51,    52,    -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,
+      61,    -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,    14,
+      15,    72,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    82,    27,    28,    29,    30,    31,    -1,    -1,    -1,
+      -1,    -1,    -1,    94,    -1,    -1,    97,    98,    -1,    -1,
+      -1,    46,    -1,    48,    49,    50,    51,    52,    -1,    -1,
+      -1,    56,    -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,
+      65,    -1,    -1,    -1,    -1,    14,    15,    72,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,    82,    27,    28,
+      29,    30,    31,    -1,    -1,    -1,    -1,    -1,    -1,    94,
+      95,    -1,    97,    98,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    -1,    -1,    -1,    56,    -1,    -1,
+      -1,    -1,    61,    -1,    -1,    -1,    65,    -1,    -1,    -1,
+      -1,    14,    15,    72,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    82,    27,    28,    29,    30,    31,    -1,
+      -1,    90,    -1,    -1,    -1,    94,    -1,    -1,    97,    98,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,    61,    -1,
+      63,    -1,    65,    -1,    -1,    -1,    -1,    14,    15,    72,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    82,
+      27,    28,    29,    30,    31,    -1,    -1,    -1,    -1,    -1,
+      -1,    94,    -1,    -1,    97,    98,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    -1,    -1,    -1,    56,
+      -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,    65,    -1,
+      -1,    -1,    -1,    14,    15,    72,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    82,    27,    28,    29,    30,
+      31,    -1,    -1,    -1,    91,    -1,    -1,    94,    -1,    -1,
+      97,    98,    -1,    -1,    -1,    46,    -1,    48,    49,    50,
+      51,    52,    -1,    -1,    -1,    56,    -1,    -1,    -1,    -1,
+      61,    -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,    14,
+      15,    72,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    82,    27,    28,    29,    30,    31,    32,    33,    -1,
+      -1,    -1,    -1,    94,    -1,    -1,    97,    98,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      55,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,    64,
+      65,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    91,    14,    15,    94,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      27,    28,    29,    30,    31,    32,    33,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    15,    -1,    -1,    18,    -1,    20,
+      21,    22,    23,    24,    -1,    -1,    27,    28,    55,    -1,
+      31,    32,    33,    -1,    61,    62,    63,    64,    65,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    55,    -1,    83,    84,    85,    86,
+      87,    62,    63,    64,    -1,    -1,    -1,    94,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      -1,    -1,    -1,    94
+  };
+
+  const short
+  VNLangParser::yystos_[] =
+  {
+       0,     4,     5,    14,    15,    18,    19,    20,    21,    22,
+      23,    24,    27,    28,    29,    30,    31,    34,    46,    48,
+      49,    50,    51,    52,    56,    59,    60,    61,    65,    72,
+      73,    74,    75,    76,    78,    79,    80,    81,    82,    92,
+      94,    97,    98,   104,   106,   107,   108,   109,   116,   117,
+     118,   119,   149,   187,   188,   189,   190,   194,   196,   197,
+     198,   199,   200,   201,   202,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   221,   222,   223,   224,   226,   227,   228,   229,   230,
+     254,   255,   272,   273,   274,   275,   276,   277,    15,    20,
+      24,    27,    28,    32,    33,    55,    62,    63,    64,    83,
+      84,    85,    86,    87,    94,   114,   125,   126,   127,   128,
+     129,   130,   131,   132,   134,   136,   137,   138,   139,   140,
+     141,   164,   165,   166,   181,   182,   183,   187,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   258,   261,
+     264,   272,   273,   274,   275,   276,   105,   106,     7,   117,
+     219,    24,   219,   227,   230,   277,   219,    24,   115,   136,
+     219,   238,   241,   261,   272,   115,   120,   219,   219,   219,
+     219,   204,   219,    94,    94,   116,   195,   197,   204,    94,
+     204,    93,    94,   105,   219,   219,     0,     6,    90,    15,
+      19,    20,    24,    27,    61,    94,   145,   146,   147,   148,
+     149,   150,   151,   152,   267,   272,   273,   274,   275,   276,
+     277,    26,    25,    92,   201,    92,    92,    13,    37,    38,
+      39,   101,    40,    41,    42,    97,    43,    44,    45,    46,
+      47,    98,    93,    11,    50,    94,    99,   102,     7,   110,
+     117,   219,     7,     7,     7,    24,   117,   227,   230,   273,
+     277,     3,    66,    71,   256,   257,   270,   271,    70,   257,
+     269,   270,   257,   257,    58,     7,   115,   117,   123,   124,
+     125,   233,   234,   252,     7,   136,   238,   136,   238,   136,
+     238,   223,    20,    33,   219,   248,   123,   233,    26,    25,
+      92,    37,    61,    65,    93,   116,   133,   110,    15,    19,
+      20,    24,    27,    28,    29,    30,    61,    63,    65,    94,
+     140,   141,   177,   178,   179,   180,   230,   252,   272,   273,
+     277,    90,    93,    15,    20,    24,    27,    28,    94,   237,
+     272,   273,   274,   275,   276,    90,   237,    26,    25,    94,
+      97,    98,   153,   154,   155,   156,   223,   249,   272,   110,
+     238,     7,     7,     7,    32,    33,   240,   241,   250,   272,
+     110,    67,    68,    69,   259,   260,   262,   263,   265,   266,
+     270,   260,   263,   270,   260,   270,   260,    57,    16,   187,
+       7,   270,    90,   203,   204,   203,    79,   105,    36,    93,
+     233,    95,   108,   109,     9,    24,    27,    28,   116,   121,
+     122,   129,   130,   197,   273,   143,   144,   145,     7,   145,
+     145,   143,    94,   110,   145,     7,     7,     7,   268,   269,
+     270,   269,   269,    58,     7,   145,   127,   189,   128,   190,
+     208,   208,   208,   210,   204,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   219,    12,   206,   225,    95,   225,
+     187,   222,     8,     9,   111,   112,   113,   114,    51,     9,
+      51,   115,     7,   116,   125,   191,   192,   193,   194,   234,
+     252,    66,    71,    35,    70,    37,   114,   220,    16,     6,
+      16,   125,   233,    94,   160,   161,     7,    94,    95,    95,
+      15,    20,    24,    27,    28,    94,   127,   272,    24,   128,
+     202,   204,    90,   135,   204,   142,   143,    15,    20,    94,
+     131,   132,   170,   172,   174,   175,   177,   252,     7,   177,
+     177,   177,   115,   115,   170,   110,   177,     7,   270,   270,
+       7,   115,    91,   169,   171,   172,   173,   174,   177,    20,
+      61,   167,   168,   176,   224,   237,   252,     7,   270,    63,
+      91,   184,   185,   186,   223,   236,   237,   105,   154,   154,
+     249,    99,   160,   153,   270,    51,     9,    51,   115,   223,
+      20,   153,   249,   270,    67,    68,    69,   105,     8,   114,
+     220,   121,    92,    95,    95,    94,    95,   204,    95,    91,
+     121,    15,    20,    94,   272,     9,   121,   270,    16,   143,
+      95,   105,    51,     9,    51,   115,   143,   220,    93,    12,
+      96,    95,   100,     8,     9,     8,     9,   113,    10,     8,
+     113,     9,     8,   114,   220,    26,    25,    52,     8,     8,
+     123,   106,   233,     8,     8,    95,   125,   162,   163,    15,
+      24,    27,    28,    94,   233,   272,   273,    32,   231,   232,
+     240,   249,    24,    27,    28,   273,     7,    15,    20,    94,
+     272,   270,    91,   225,    96,   133,    24,    27,    28,     7,
+      16,    92,   131,   132,   261,    93,   170,    95,   115,   114,
+     220,    91,   171,    92,     7,    90,    96,   237,    91,    96,
+      37,    95,   154,   187,   249,   272,     8,   113,     9,     8,
+     160,     7,   153,    17,     8,     8,    91,   204,   195,   195,
+     105,   195,    93,    91,     7,   270,    91,   121,   143,     8,
+      95,     8,   113,     9,     8,     8,     8,   208,   206,   114,
+       8,     8,   113,     8,     8,   127,   193,   128,   194,   115,
+     117,   115,   117,    17,    17,    95,    96,    24,     8,   270,
+     160,    95,    97,    98,    99,   157,   158,   159,   160,   249,
+     240,   272,   270,     7,    91,   143,   170,     8,     8,     8,
+       8,    91,   169,   168,   185,   135,   100,   270,     8,     8,
+     113,    77,    95,    91,    17,     8,     8,   113,   145,   145,
+       8,   163,   158,   158,   249,   187,    99,   160,   249,   157,
+     157,   249,    17,   115,   115,    91,     8,   195,     8,   158,
+     100,   187,   249,   157,   100
+  };
+
+  const short
+  VNLangParser::yyr1_[] =
+  {
+       0,   103,   104,   105,   106,   106,   107,   107,   107,   107,
+     108,   108,   108,   109,   109,   109,   109,   109,   110,   110,
+     110,   111,   111,   112,   112,   112,   113,   113,   114,   114,
+     114,   114,   115,   115,   115,   116,   117,   117,   117,   117,
+     117,   117,   117,   118,   118,   118,   118,   118,   119,   120,
+     121,   121,   122,   122,   122,   123,   123,   124,   125,   126,
+     126,   127,   127,   127,   127,   128,   128,   129,   129,   130,
+     130,   131,   132,   132,   132,   132,   132,   133,   133,   133,
+     134,   134,   134,   134,   134,   134,   135,   135,   135,   136,
+     136,   136,   136,   136,   137,   138,   138,   139,   139,   139,
+     139,   140,   141,   142,   142,   143,   144,   145,   145,   145,
+     145,   145,   145,   145,   146,   146,   147,   147,   147,   147,
+     147,   147,   147,   147,   147,   147,   147,   147,   148,   149,
+     150,   151,   152,   153,   154,   154,   154,   154,   155,   155,
+     155,   155,   156,   156,   157,   158,   158,   158,   158,   158,
+     158,   158,   159,   159,   159,   159,   159,   159,   160,   160,
+     161,   162,   162,   163,   164,   164,   164,   164,   165,   166,
+     166,   167,   167,   168,   168,   168,   168,   169,   169,   170,
+     170,   170,   170,   171,   171,   172,   172,   173,   173,   174,
+     174,   175,   176,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   178,   179,   179,   180,   180,   180,   180,
+     180,   180,   180,   180,   180,   180,   181,   181,   182,   183,
+     184,   184,   185,   185,   185,   186,   187,   188,   188,   188,
+     189,   189,   189,   190,   190,   191,   192,   192,   192,   193,
+     193,   193,   194,   194,   195,   195,   196,   197,   197,   198,
+     199,   199,   199,   200,   200,   200,   200,   201,   201,   201,
+     201,   201,   201,   202,   202,   202,   203,   203,   204,   205,
+     206,   207,   207,   208,   208,   208,   208,   209,   209,   210,
+     210,   211,   211,   212,   212,   213,   213,   214,   214,   215,
+     215,   216,   216,   217,   217,   218,   218,   218,   219,   219,
+     219,   219,   219,   219,   219,   219,   219,   219,   219,   219,
+     219,   219,   219,   219,   219,   220,   221,   221,   221,   221,
+     221,   221,   221,   221,   222,   222,   222,   222,   222,   222,
+     222,   222,   223,   223,   223,   223,   223,   223,   223,   223,
+     223,   224,   224,   224,   225,   225,   226,   227,   228,   229,
+     230,   231,   232,   232,   232,   232,   232,   232,   233,   234,
+     235,   235,   236,   236,   237,   238,   238,   238,   238,   238,
+     238,   239,   240,   241,   241,   241,   241,   242,   242,   242,
+     242,   242,   242,   242,   242,   242,   242,   243,   244,   245,
+     246,   247,   248,   248,   249,   249,   250,   251,   251,   251,
+     252,   252,   252,   253,   254,   254,   255,   256,   257,   257,
+     258,   259,   260,   260,   261,   262,   263,   263,   264,   265,
+     266,   266,   267,   268,   269,   269,   270,   271,   271,   272,
+     273,   274,   275,   276,   277
+  };
+
+  const signed char
+  VNLangParser::yyr2_[] =
+  {
+       0,     2,     1,     1,     1,     2,     3,     1,     3,     1,
+       2,     1,     1,     3,     3,     3,     3,     3,     3,     3,
+       2,     2,     1,     2,     2,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     2,     2,
+       5,     5,     2,     4,     5,     5,     6,     5,     0,     0,
+       1,     2,     1,     1,     1,     1,     1,     3,     1,     1,
+       3,     1,     3,     3,     3,     1,     1,     2,     1,     1,
+       1,     2,     1,     2,     4,     1,     1,     2,     1,     1,
+       2,     3,     3,     4,     3,     4,     1,     2,     3,     1,
+       2,     2,     2,     2,     1,     1,     3,     2,     5,     1,
+       4,     1,     2,     3,     1,     1,     1,     1,     2,     2,
+       2,     2,     5,     5,     1,     4,     3,     5,     2,     1,
+       4,     5,     6,     5,     4,     1,     4,     1,     1,     2,
+       2,     2,     2,     1,     1,     2,     2,     3,     1,     2,
+       3,     4,     1,     3,     1,     1,     2,     2,     3,     1,
+       1,     2,     2,     3,     4,     1,     2,     3,     3,     2,
+       1,     1,     3,     1,     4,     6,     3,     5,     2,     1,
+       1,     1,     3,     1,     1,     1,     2,     1,     2,     1,
+       2,     1,     1,     2,     1,     1,     2,     1,     1,     1,
+       2,     2,     1,     1,     2,     2,     2,     2,     2,     5,
+       5,     2,     2,     1,     1,     3,     1,     5,     2,     1,
+       1,     1,     4,     1,     4,     1,     4,     3,     2,     1,
+       1,     3,     1,     3,     1,     1,     1,     1,     3,     3,
+       1,     3,     3,     1,     1,     1,     1,     3,     3,     1,
+       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     2,     3,     5,     2,     2,     2,     2,     5,
+       5,     5,     7,     1,     2,     6,     1,     3,     1,     1,
+       1,     1,     3,     1,     3,     3,     5,     1,     3,     1,
+       3,     1,     3,     1,     3,     1,     3,     1,     3,     1,
+       3,     1,     3,     1,     3,     1,     3,     3,     1,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     5,     5,     2,     2,     2,     1,     2,     4,     4,
+       3,     4,     3,     3,     1,     3,     1,     1,     1,     1,
+       4,     1,     1,     5,     2,     1,     4,     5,     6,     5,
+       4,     1,     4,     1,     1,     3,     1,     2,     2,     2,
+       2,     1,     2,     3,     3,     4,     1,     2,     1,     1,
+       1,     3,     1,     3,     1,     1,     2,     2,     2,     2,
+       2,     1,     1,     1,     3,     1,     5,     2,     5,     1,
+       4,     5,     6,     5,     4,     5,     4,     1,     2,     2,
+       2,     2,     1,     2,     1,     2,     1,     1,     1,     1,
+       2,     1,     1,     1,     1,     1,     2,     1,     2,     1,
+       2,     1,     2,     1,     2,     1,     2,     1,     2,     1,
+       2,     1,     2,     1,     2,     1,     2,     2,     1,     1,
+       1,     1,     1,     1,     1
+  };
+
+
+
+
+#if YYDEBUG
+  const short
+  VNLangParser::yyrline_[] =
+  {
+       0,   236,   236,   238,   241,   242,   245,   246,   247,   248,
+     251,   252,   253,   256,   257,   258,   259,   260,   265,   266,
+     267,   269,   270,   272,   273,   274,   276,   277,   282,   283,
+     284,   285,   287,   288,   289,   300,   302,   303,   304,   305,
+     306,   307,   308,   310,   311,   312,   313,   314,   316,   319,
+     322,   323,   325,   326,   327,   331,   332,   334,   336,   338,
+     339,   341,   342,   343,   344,   346,   347,   349,   350,   353,
+     354,   356,   358,   359,   360,   362,   363,   365,   366,   367,
+     369,   370,   371,   372,   373,   374,   376,   377,   378,   380,
+     381,   382,   383,   385,   387,   389,   390,   392,   393,   394,
+     395,   397,   400,   403,   404,   406,   408,   410,   411,   412,
+     413,   414,   415,   416,   418,   419,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   434,   436,
+     437,   438,   439,   443,   445,   446,   447,   448,   450,   451,
+     452,   453,   455,   456,   460,   462,   463,   464,   465,   466,
+     467,   468,   470,   471,   472,   473,   474,   475,   479,   480,
+     482,   485,   486,   488,   492,   493,   494,   495,   497,   501,
+     502,   504,   505,   507,   508,   509,   510,   512,   513,   515,
+     516,   517,   518,   520,   521,   524,   525,   527,   528,   530,
+     531,   533,   535,   541,   542,   543,   544,   545,   546,   547,
+     548,   549,   550,   553,   555,   556,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   571,   572,   574,   578,
+     581,   582,   585,   586,   587,   589,   593,   595,   596,   597,
+     599,   600,   601,   603,   604,   606,   608,   609,   610,   612,
+     613,   614,   616,   617,   619,   620,   622,   624,   625,   628,
+     630,   631,   632,   634,   635,   636,   637,   639,   640,   642,
+     643,   644,   646,   649,   650,   651,   653,   654,   658,   660,
+     664,   666,   667,   669,   670,   671,   672,   674,   675,   677,
+     678,   680,   681,   683,   684,   686,   687,   689,   690,   692,
+     693,   695,   696,   698,   699,   701,   702,   703,   705,   706,
+     707,   708,   709,   710,   711,   712,   713,   714,   715,   716,
+     717,   718,   719,   720,   721,   724,   726,   727,   728,   729,
+     730,   731,   732,   733,   735,   736,   737,   738,   739,   740,
+     741,   742,   744,   745,   746,   747,   748,   749,   750,   751,
+     752,   754,   755,   756,   758,   759,   761,   764,   765,   766,
+     767,   772,   774,   775,   776,   777,   778,   779,   783,   785,
+     787,   788,   790,   791,   794,   796,   797,   798,   799,   800,
+     801,   803,   806,   808,   809,   810,   811,   813,   814,   815,
+     816,   817,   818,   819,   820,   821,   822,   824,   826,   827,
+     828,   829,   833,   834,   838,   839,   841,   844,   845,   846,
+     848,   849,   850,   852,   860,   861,   867,   869,   871,   872,
+     874,   876,   878,   879,   881,   883,   885,   886,   888,   890,
+     892,   893,   895,   897,   899,   900,   905,   908,   909,   912,
+     915,   918,   921,   924,   927
+  };
+
+  void
+  VNLangParser::yy_stack_print_ () const
+  {
+    *yycdebug_ << "Stack now";
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
+  }
+
+  void
+  VNLangParser::yy_reduce_print_ (int yyrule) const
+  {
+    int yylno = yyrline_[yyrule];
+    int yynrhs = yyr2_[yyrule];
+    // Print the symbols being reduced, and their result.
+    *yycdebug_ << "Reducing stack by rule " << yyrule - 1
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
+    for (int yyi = 0; yyi < yynrhs; yyi++)
+      YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
+                       yystack_[(yynrhs) - (yyi + 1)]);
+  }
+#endif // YYDEBUG
+
+
+#line 4 "src/vn/lang/vn_lang.ypp"
+} // YY
+#line 7210 "build/src/vn/lang/vn_lang.ypp.cpp"
+
+#line 930 "src/vn/lang/vn_lang.ypp"
+
@@ -0,0 +1,4576 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton interface for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+
+/**
+ ** \file build/src/vn/lang/vn_lang.ypp.hpp
+ ** Define the YY::parser class.
+ */
+
+// C++ LALR(1) parser skeleton written by Akim Demaille.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_BUILD_SRC_VN_LANG_VN_LANG_YPP_HPP_INCLUDED
+# define YY_YY_BUILD_SRC_VN_LANG_VN_LANG_YPP_HPP_INCLUDED
+// "%code requires" blocks.
+#line 20 "src/vn/lang/vn_lang.ypp"
+
+  // Appears high-ish in the generated .hpp file
+  // Use full paths because we can be included from elsewhere and build/src/x is not "near" src/x
+  
+  #include <string>
+  #include "vn/lang/vn_types.hpp"     
+  #include "node/tree_ptr.hpp"
+
+  struct ANDBlock;
+
+  namespace YY {
+    class VNLangScanner;  
+  	struct TokenMetadata
+	{
+		TreePtr<Node> node;
+		string as_ascii;
+		wstring as_unicode;
+		const ANDBlock *as_andata_block;
+	};     	
+  };
+  
+  namespace VN { 
+    // Things we point to from semantic values
+    class Command;
+    class Gnomon;
+    class ResolverGnomon;
+    // Infrastructure
+    class VNLangActions;
+	class VNLangRecogniser;
+  }
+
+#line 81 "build/src/vn/lang/vn_lang.ypp.hpp"
+
+
+# include <cstdlib> // std::abort
+# include <iostream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
+# include "vn_lang.location.hpp"
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+
+#line 4 "src/vn/lang/vn_lang.ypp"
+namespace YY {
+#line 217 "build/src/vn/lang/vn_lang.ypp.hpp"
+
+
+
+
+  /// A Bison parser.
+  class VNLangParser
+  {
+  public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
+  ///
+  /// Sort of a variant, but does not keep track of the nature
+  /// of the stored data, since that knowledge is available
+  /// via the current parser state.
+  class value_type
+  {
+  public:
+    /// Type of *this.
+    typedef value_type self_type;
+
+    /// Empty construction.
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+    {}
+
+    /// Construct and fill.
+    template <typename T>
+    value_type (YY_RVREF (T) t)
+    {
+      new (yyas_<T> ()) T (YY_MOVE (t));
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
+    /// Destruction, allowed only if empty.
+    ~value_type () YY_NOEXCEPT
+    {}
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
+    /// Instantiate an empty \a T in here.
+    template <typename T>
+    T&
+    emplace ()
+    {
+      return *new (yyas_<T> ()) T ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    template <typename T>
+    T&
+    emplace (const T& t)
+    {
+      return *new (yyas_<T> ()) T (t);
+    }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
+
+    /// Accessor to a built \a T.
+    template <typename T>
+    T&
+    as () YY_NOEXCEPT
+    {
+      return *yyas_<T> ();
+    }
+
+    /// Const accessor to a built \a T (for %printer).
+    template <typename T>
+    const T&
+    as () const YY_NOEXCEPT
+    {
+      return *yyas_<T> ();
+    }
+
+    /// Swap the content with \a that, of same type.
+    ///
+    /// Both variants must be built beforehand, because swapping the actual
+    /// data requires reading it (with as()), and this is not possible on
+    /// unconstructed variants: it would require some dynamic testing, which
+    /// should not be the variant's responsibility.
+    /// Swapping between built and (possibly) non-built is done with
+    /// self_type::move ().
+    template <typename T>
+    void
+    swap (self_type& that) YY_NOEXCEPT
+    {
+      std::swap (as<T> (), that.as<T> ());
+    }
+
+    /// Move the content of \a that to this.
+    ///
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
+    template <typename T>
+    void
+    move (self_type&& that)
+    {
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
+    }
+#endif
+
+    /// Copy the content of \a that to this.
+    template <typename T>
+    void
+    copy (const self_type& that)
+    {
+      emplace<T> (that.as<T> ());
+    }
+
+    /// Destroy the stored \a T.
+    template <typename T>
+    void
+    destroy ()
+    {
+      as<T> ().~T ();
+    }
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
+
+    /// Accessor to raw memory as \a T.
+    template <typename T>
+    T*
+    yyas_ () YY_NOEXCEPT
+    {
+      void *yyp = yyraw_;
+      return static_cast<T*> (yyp);
+     }
+
+    /// Const accessor to raw memory as \a T.
+    template <typename T>
+    const T*
+    yyas_ () const YY_NOEXCEPT
+    {
+      const void *yyp = yyraw_;
+      return static_cast<const T*> (yyp);
+     }
+
+    /// An auxiliary type to compute the largest semantic type.
+    union union_type
+    {
+      // stmt_boot
+      // unified_entry
+      // unified_prefix
+      // compound_entry
+      // compound_prefix
+      // compound_primary
+      // decl_boot
+      // decl_entry
+      // decl_disjunction
+      // decl_conjunction
+      // open_declaration
+      // declaration
+      // bare_declaration
+      // comp_decl_nvn
+      // bare_decl_nvn
+      // bare_initialiser
+      // prototype
+      // assign_init
+      // decl_prefix
+      // decl_postfix
+      // decl_primary
+      // decl_vn_prim
+      // memb_init_boot
+      // memb_init_entry
+      // memb_init_prefix
+      // memb_init_postfix
+      // memb_init_primary
+      // declarator
+      // declarator_prefix
+      // declarator_postfix
+      // declarator_primary
+      // ab_declarator
+      // ab_declarator_prefix
+      // ab_declarator_postfix
+      // parameter
+      // inheritance_record
+      // irecord_node
+      // base_spec
+      // acc_memb_boot
+      // member
+      // comp_member
+      // bare_member
+      // bare_member_nvn
+      // access_clause
+      // access_spec
+      // acc_memb_prefix
+      // acc_memb_postfix
+      // acc_memb_paren
+      // acc_memb_primary
+      // enum
+      // enum_node
+      // enumerator
+      // prototype_enumerator
+      // stmt_entry
+      // stmt_disjunction
+      // stmt_conjunction
+      // open_statement
+      // stmt_entry_nc
+      // stmt_disjunction_nc
+      // stmt_conjunction_nc
+      // open_statement_nc
+      // stmt_comp
+      // statement
+      // arrival
+      // statement_nl
+      // bare_statement
+      // expr_entry
+      // expr_comma_op
+      // expr_no_comma_op
+      // expr_id_value
+      // expr_assignment
+      // expr_logical_or
+      // expr_logical_and
+      // expr_bitwise_or
+      // expr_bitwise_xor
+      // expr_bitwise_and
+      // expr_equality
+      // expr_relational
+      // expr_shift
+      // expr_add_etc
+      // expr_mul_etc
+      // expr_prefix
+      // expr_postfix
+      // expr_primary
+      // id_primary
+      // id_wildcard
+      // type_id
+      // ab_type
+      // type_boot
+      // type_entry
+      // type_disjunction
+      // type_conjunction
+      // type_specified
+      // type_prefix
+      // type_postfix
+      // type_for_declarator
+      // type_primary
+      // type_vn_prim
+      // qualifier_node
+      // explicit_norm_node
+      // resolved_norm_node
+      // explicit_type_node
+      // resolved_type_node
+      // explicit_decl_node
+      // resolved_decl_node
+      // explicit_qual_node
+      // resolved_qual_node
+      // explicit_mi_node
+      // resolved_mi_node
+      char dummy1[sizeof (TreePtr<Node>)];
+
+      // item
+      char dummy2[sizeof (VN::Item)];
+
+      // itemisation
+      // items_bare
+      // items_sep
+      char dummy3[sizeof (VN::Itemisation)];
+
+      // stuff_depth
+      char dummy4[sizeof (VN::Limit)];
+
+      // decl_full_explicit_start
+      // mi_full_explicit_start
+      // irecord_scope
+      // enum_scope
+      // norm_full_explicit_start
+      // type_full_explicit_start
+      // qual_full_explicit_start
+      char dummy5[sizeof (VN::NodeAndGnomon)];
+
+      // qualifier
+      // qualifier_nw
+      char dummy6[sizeof (VN::QualifierData)];
+
+      // "C simple type specifier"
+      // "C boolean literal"
+      // "type transform name"
+      // "open_statement transform name"
+      // "ASCII name"
+      // "Unicode name"
+      // "designated statement/expression name"
+      // "designated type name"
+      // "designated declaration name"
+      // "designated qualifier name"
+      // "designated compound name"
+      // "resolved open_statement node name"
+      // "resolved type node name"
+      // "resolved declaration node name"
+      // "resolved qualifier node name"
+      // "resolved member initialiser node name"
+      // "scope resolving name"
+      // "open_statement keyword operator"
+      // "keyword simple statement"
+      // "keyword space-separated statement"
+      // "keyword args-and-body statement"
+      // "keyword args-body-chain statement"
+      // "C chaining keyword"
+      // "C do keyword"
+      // "C while keyword"
+      // "C case keyword"
+      // "C default keyword"
+      // "function acting on a type"
+      // "C class/struct/union keyword"
+      // "C enumeration keyword"
+      // "C qualifier"
+      // "C static keyword"
+      // "C typedef keyword"
+      // stmt_low
+      // stmt_high
+      // resolved_norm_name
+      // resolved_type_name
+      // resolved_decl_name
+      // resolved_qual_name
+      // resolved_mi_name
+      // node_namespace
+      char dummy7[sizeof (YY::TokenMetadata)];
+
+      // mi_prerestrict_op_named
+      // mi_id_by_name_op_named
+      // mi_build_id_op_named
+      // prerestrict_op_named
+      // id_by_name_op_named
+      // build_id_named
+      // type_prerestrict_op_named
+      // type_id_by_name_op_named
+      // type_build_id_op_named
+      char dummy8[sizeof (const ANDBlock *)];
+
+      // stmt_decls
+      // stmt_decl_l
+      // memb_inits
+      // parameterisation
+      // parameters
+      // bases
+      // members
+      // enumerators
+      // statement_l
+      // statement_e
+      // statement_nc
+      // semicolon_args
+      // comma_sep_expr_decl
+      char dummy9[sizeof (list<TreePtr<Node>>)];
+
+      // qualifiers
+      char dummy10[sizeof (list<VN::QualifierData>)];
+
+      // commands
+      // sep_commands
+      // decl_commands
+      char dummy11[sizeof (list<shared_ptr<VN::Command>>)];
+
+      // type_specifier_seq
+      char dummy12[sizeof (multiset<string>)];
+
+      // script_command
+      char dummy13[sizeof (shared_ptr<VN::Command>)];
+
+      // designation_command
+      // compound_scope
+      // code_unit_scope
+      // params_scope
+      // part_resolve
+      // explicit_op_scope
+      // prerestrict_op_scope
+      // id_by_name_op_scope
+      // builder_id_op_scope
+      // transform_op_scope
+      // stuff_op_scope
+      char dummy14[sizeof (shared_ptr<VN::Gnomon>)];
+
+      // decl_prerestrict_op_named
+      char dummy15[sizeof (shared_ptr<VN::PrerestrictScopeGnomon>)];
+
+      // "C assignment operator ="
+      // "C compound-assignment operator"
+      // "C logical-or operator ||"
+      // "C logical-and operator &&"
+      // "C bitwise-or operator |"
+      // "C bitwise-xor operator ^"
+      // "C equality operator =="
+      // "C relational operator"
+      // "C shift operator operator"
+      // "C add/subtract operator"
+      // "C divide/modulo operator"
+      // "C prefix operator"
+      // "C prefix/infix operator"
+      // "C prefix/postfix operator"
+      // "C integer literal"
+      // "C format string"
+      // "C typename operator"
+      // mi_transform_op_named
+      // transform_op_named
+      // type_transform_op_named
+      char dummy16[sizeof (string)];
+
+      // "C string literal"
+      // vn_name
+      char dummy17[sizeof (wstring)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+  };
+
+#endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
+    /// Symbol locations.
+    typedef location location_type;
+
+    /// Syntax errors thrown from user actions.
+    struct syntax_error : std::runtime_error
+    {
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
+      location_type location;
+    };
+
+    /// Token kinds.
+    struct token
+    {
+      enum token_kind_type
+      {
+        TOK_YYEMPTY = -2,
+    TOK_YYEOF = 0,                 // "end of file"
+    TOK_YYerror = 256,             // error
+    TOK_YYUNDEF = 257,             // "invalid token"
+    TOK_DESIGNATE_COMMAND = 258,   // "designate command ⪮"
+    TOK_ENGINE_COMMAND = 259,      // "engine command ꩜"
+    TOK_ATTRIBUTE_COMMAND = 260,   // "attribute command ‡"
+    TOK_COMMAND_TERM = 261,        // "command terminator ⨟"
+    TOK_OPEN_VN = 262,             // "open VN-params ⦅"
+    TOK_CLOSE_VN = 263,            // "close VN-params ⦆"
+    TOK_VN_SEP = 264,              // "VN-param separator ⚬"
+    TOK_VN_SUB_SEP = 265,          // "container separator 🞄"
+    TOK_OPEN_MAP_CALL = 266,       // "open map-arguments 〔"
+    TOK_CLOSE_MAP_CALL = 267,      // "close map-arguments 〕"
+    TOK_MAP_ARG_OP = 268,          // "map-argument operator ⦂"
+    TOK_STUFF_OP = 269,            // "stuff operator ⩨"
+    TOK_DELTA_COMPARE_OP = 270,    // "delta-compare operator ▲"
+    TOK_DELTA_REPLACE_OP = 271,    // "delta-replace operator ⯈"
+    TOK_DELTA_END_OP = 272,        // "delta-end operator ⯇"
+    TOK_EXPLICIT_OP = 273,         // "explicit node operator ⯁"
+    TOK_ANY_NODE_OP = 274,         // "any node operator ☆"
+    TOK_STAR_OP = 275,             // "star operator ★"
+    TOK_ID_BY_NAME_OP = 276,       // "identifier-by-name operator ⊛"
+    TOK_BUILDER_ID_OP = 277,       // "node-builder operator ⧇"
+    TOK_TRANSFORM_OP = 278,        // "transform operator ⤨"
+    TOK_NEGATION_OP = 279,         // "negation operator ¬"
+    TOK_CONJUNCTION_OP = 280,      // "conjunction operator ∧"
+    TOK_DISJUNCTION_OP = 281,      // "disjunction operator ∨"
+    TOK_GREEN_GRASS_OP = 282,      // "green-grass operator ⫴"
+    TOK_POINTER_IS_OP = 283,       // "pointer-is operator ⮎"
+    TOK_BUILD_SIZE_OP = 284,       // "build-container-size operator 🄽"
+    TOK_STRINGIZE_OP = 285,        // "stringise operator §"
+    TOK_PRERESTRICT_OP = 286,      // "prerestriction operator ‽"
+    TOK_XSTRUCTOR = 287,           // "constructor/destructor virtual type ⨤"
+    TOK_TYPE_INDICATOR = 288,      // "type indicator ⍑"
+    TOK_CODE_UNIT = 289,           // "code unit ∞"
+    TOK_RESOLUTION_OP = 290,       // "C scope-resolution operator ::"
+    TOK_RANGE_OP = 291,            // "GCC range operator .."
+    TOK_C_ASSIGN = 292,            // "C assignment operator ="
+    TOK_C_COMPOUND_ASSIGN = 293,   // "C compound-assignment operator"
+    TOK_C_LOGICAL_OR_OP = 294,     // "C logical-or operator ||"
+    TOK_C_LOGICAL_AND_OP = 295,    // "C logical-and operator &&"
+    TOK_C_BITWISE_OR_OP = 296,     // "C bitwise-or operator |"
+    TOK_C_BITWISE_XOR_OP = 297,    // "C bitwise-xor operator ^"
+    TOK_C_EQUALITY_OP = 298,       // "C equality operator =="
+    TOK_C_RELATIONAL_OP = 299,     // "C relational operator"
+    TOK_C_SHIFT_OP = 300,          // "C shift operator operator"
+    TOK_C_ADD_SUB_OP = 301,        // "C add/subtract operator"
+    TOK_C_DIV_MOD_OP = 302,        // "C divide/modulo operator"
+    TOK_C_PREFIX_OP = 303,         // "C prefix operator"
+    TOK_C_PRE_OR_INFIX_OP = 304,   // "C prefix/infix operator"
+    TOK_C_PRE_OR_POSTFIX_OP = 305, // "C prefix/postfix operator"
+    TOK_STRING_LITERAL = 306,      // "C string literal"
+    TOK_INTEGRAL_LITERAL = 307,    // "C integer literal"
+    TOK_ASCII_FORMAT = 308,        // "C format string"
+    TOK_TYPENAME = 309,            // "C typename operator"
+    TOK_TYPE_SPECIFIER = 310,      // "C simple type specifier"
+    TOK_BOOL_LITERAL = 311,        // "C boolean literal"
+    TOK_TRANSFORM_NAME_TYPE = 312, // "type transform name"
+    TOK_TRANSFORM_NAME_NORMAL = 313, // "open_statement transform name"
+    TOK_ASCII_NAME = 314,          // "ASCII name"
+    TOK_UNICODE_NAME = 315,        // "Unicode name"
+    TOK_DESIGNATED_NORMAL = 316,   // "designated statement/expression name"
+    TOK_DESIGNATED_TYPE = 317,     // "designated type name"
+    TOK_DESIGNATED_DECL = 318,     // "designated declaration name"
+    TOK_DESIGNATED_QUAL = 319,     // "designated qualifier name"
+    TOK_DESIGNATED_COMPOUND = 320, // "designated compound name"
+    TOK_RESOLVED_NORMAL = 321,     // "resolved open_statement node name"
+    TOK_RESOLVED_TYPE = 322,       // "resolved type node name"
+    TOK_RESOLVED_DECL = 323,       // "resolved declaration node name"
+    TOK_RESOLVED_QUAL = 324,       // "resolved qualifier node name"
+    TOK_RESOLVED_MEMB_INIT = 325,  // "resolved member initialiser node name"
+    TOK_NODE_NAMESPACE = 326,      // "scope resolving name"
+    TOK_KEYWORD_PRIMARY_OP = 327,  // "open_statement keyword operator"
+    TOK_KEYWORD_SIMPLE_STMT = 328, // "keyword simple statement"
+    TOK_KEYWORD_SPACE_SEP_STMT = 329, // "keyword space-separated statement"
+    TOK_KEYWORD_ARGS_BODY_STMT = 330, // "keyword args-and-body statement"
+    TOK_KEYWORD_ARGS_BODY_WITH_ELSE = 331, // "keyword args-body-chain statement"
+    TOK_CHAINING_KEYWORD = 332,    // "C chaining keyword"
+    TOK_DO_KEYWORD = 333,          // "C do keyword"
+    TOK_WHILE_KEYWORD = 334,       // "C while keyword"
+    TOK_CASE_KEYWORD = 335,        // "C case keyword"
+    TOK_DEFAULT_KEYWORD = 336,     // "C default keyword"
+    TOK_FUNC_ON_TYPE = 337,        // "function acting on a type"
+    TOK_IRECORD_KEYWORD = 338,     // "C class/struct/union keyword"
+    TOK_ENUM_KEYWORD = 339,        // "C enumeration keyword"
+    TOK_QUAL_NODE_KEYWORD = 340,   // "C qualifier"
+    TOK_STATIC_KEYWORD = 341,      // "C static keyword"
+    TOK_TYPEDEF_KEYWORD = 342,     // "C typedef keyword"
+    TOK_stmt_low = 343,            // stmt_low
+    TOK_stmt_high = 344            // stmt_high
+      };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
+    };
+
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 103, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_DESIGNATE_COMMAND = 3,                 // "designate command ⪮"
+        S_ENGINE_COMMAND = 4,                    // "engine command ꩜"
+        S_ATTRIBUTE_COMMAND = 5,                 // "attribute command ‡"
+        S_COMMAND_TERM = 6,                      // "command terminator ⨟"
+        S_OPEN_VN = 7,                           // "open VN-params ⦅"
+        S_CLOSE_VN = 8,                          // "close VN-params ⦆"
+        S_VN_SEP = 9,                            // "VN-param separator ⚬"
+        S_VN_SUB_SEP = 10,                       // "container separator 🞄"
+        S_OPEN_MAP_CALL = 11,                    // "open map-arguments 〔"
+        S_CLOSE_MAP_CALL = 12,                   // "close map-arguments 〕"
+        S_MAP_ARG_OP = 13,                       // "map-argument operator ⦂"
+        S_STUFF_OP = 14,                         // "stuff operator ⩨"
+        S_DELTA_COMPARE_OP = 15,                 // "delta-compare operator ▲"
+        S_DELTA_REPLACE_OP = 16,                 // "delta-replace operator ⯈"
+        S_DELTA_END_OP = 17,                     // "delta-end operator ⯇"
+        S_EXPLICIT_OP = 18,                      // "explicit node operator ⯁"
+        S_ANY_NODE_OP = 19,                      // "any node operator ☆"
+        S_STAR_OP = 20,                          // "star operator ★"
+        S_ID_BY_NAME_OP = 21,                    // "identifier-by-name operator ⊛"
+        S_BUILDER_ID_OP = 22,                    // "node-builder operator ⧇"
+        S_TRANSFORM_OP = 23,                     // "transform operator ⤨"
+        S_NEGATION_OP = 24,                      // "negation operator ¬"
+        S_CONJUNCTION_OP = 25,                   // "conjunction operator ∧"
+        S_DISJUNCTION_OP = 26,                   // "disjunction operator ∨"
+        S_GREEN_GRASS_OP = 27,                   // "green-grass operator ⫴"
+        S_POINTER_IS_OP = 28,                    // "pointer-is operator ⮎"
+        S_BUILD_SIZE_OP = 29,                    // "build-container-size operator 🄽"
+        S_STRINGIZE_OP = 30,                     // "stringise operator §"
+        S_PRERESTRICT_OP = 31,                   // "prerestriction operator ‽"
+        S_XSTRUCTOR = 32,                        // "constructor/destructor virtual type ⨤"
+        S_TYPE_INDICATOR = 33,                   // "type indicator ⍑"
+        S_CODE_UNIT = 34,                        // "code unit ∞"
+        S_RESOLUTION_OP = 35,                    // "C scope-resolution operator ::"
+        S_RANGE_OP = 36,                         // "GCC range operator .."
+        S_C_ASSIGN = 37,                         // "C assignment operator ="
+        S_C_COMPOUND_ASSIGN = 38,                // "C compound-assignment operator"
+        S_C_LOGICAL_OR_OP = 39,                  // "C logical-or operator ||"
+        S_C_LOGICAL_AND_OP = 40,                 // "C logical-and operator &&"
+        S_C_BITWISE_OR_OP = 41,                  // "C bitwise-or operator |"
+        S_C_BITWISE_XOR_OP = 42,                 // "C bitwise-xor operator ^"
+        S_C_EQUALITY_OP = 43,                    // "C equality operator =="
+        S_C_RELATIONAL_OP = 44,                  // "C relational operator"
+        S_C_SHIFT_OP = 45,                       // "C shift operator operator"
+        S_C_ADD_SUB_OP = 46,                     // "C add/subtract operator"
+        S_C_DIV_MOD_OP = 47,                     // "C divide/modulo operator"
+        S_C_PREFIX_OP = 48,                      // "C prefix operator"
+        S_C_PRE_OR_INFIX_OP = 49,                // "C prefix/infix operator"
+        S_C_PRE_OR_POSTFIX_OP = 50,              // "C prefix/postfix operator"
+        S_STRING_LITERAL = 51,                   // "C string literal"
+        S_INTEGRAL_LITERAL = 52,                 // "C integer literal"
+        S_ASCII_FORMAT = 53,                     // "C format string"
+        S_TYPENAME = 54,                         // "C typename operator"
+        S_TYPE_SPECIFIER = 55,                   // "C simple type specifier"
+        S_BOOL_LITERAL = 56,                     // "C boolean literal"
+        S_TRANSFORM_NAME_TYPE = 57,              // "type transform name"
+        S_TRANSFORM_NAME_NORMAL = 58,            // "open_statement transform name"
+        S_ASCII_NAME = 59,                       // "ASCII name"
+        S_UNICODE_NAME = 60,                     // "Unicode name"
+        S_DESIGNATED_NORMAL = 61,                // "designated statement/expression name"
+        S_DESIGNATED_TYPE = 62,                  // "designated type name"
+        S_DESIGNATED_DECL = 63,                  // "designated declaration name"
+        S_DESIGNATED_QUAL = 64,                  // "designated qualifier name"
+        S_DESIGNATED_COMPOUND = 65,              // "designated compound name"
+        S_RESOLVED_NORMAL = 66,                  // "resolved open_statement node name"
+        S_RESOLVED_TYPE = 67,                    // "resolved type node name"
+        S_RESOLVED_DECL = 68,                    // "resolved declaration node name"
+        S_RESOLVED_QUAL = 69,                    // "resolved qualifier node name"
+        S_RESOLVED_MEMB_INIT = 70,               // "resolved member initialiser node name"
+        S_NODE_NAMESPACE = 71,                   // "scope resolving name"
+        S_KEYWORD_PRIMARY_OP = 72,               // "open_statement keyword operator"
+        S_KEYWORD_SIMPLE_STMT = 73,              // "keyword simple statement"
+        S_KEYWORD_SPACE_SEP_STMT = 74,           // "keyword space-separated statement"
+        S_KEYWORD_ARGS_BODY_STMT = 75,           // "keyword args-and-body statement"
+        S_KEYWORD_ARGS_BODY_WITH_ELSE = 76,      // "keyword args-body-chain statement"
+        S_CHAINING_KEYWORD = 77,                 // "C chaining keyword"
+        S_DO_KEYWORD = 78,                       // "C do keyword"
+        S_WHILE_KEYWORD = 79,                    // "C while keyword"
+        S_CASE_KEYWORD = 80,                     // "C case keyword"
+        S_DEFAULT_KEYWORD = 81,                  // "C default keyword"
+        S_FUNC_ON_TYPE = 82,                     // "function acting on a type"
+        S_IRECORD_KEYWORD = 83,                  // "C class/struct/union keyword"
+        S_ENUM_KEYWORD = 84,                     // "C enumeration keyword"
+        S_QUAL_NODE_KEYWORD = 85,                // "C qualifier"
+        S_STATIC_KEYWORD = 86,                   // "C static keyword"
+        S_TYPEDEF_KEYWORD = 87,                  // "C typedef keyword"
+        S_stmt_low = 88,                         // stmt_low
+        S_stmt_high = 89,                        // stmt_high
+        S_90_ = 90,                              // '{'
+        S_91_ = 91,                              // '}'
+        S_92_ = 92,                              // ';'
+        S_93_ = 93,                              // ':'
+        S_94_ = 94,                              // '('
+        S_95_ = 95,                              // ')'
+        S_96_ = 96,                              // ','
+        S_97_ = 97,                              // '&'
+        S_98_ = 98,                              // '*'
+        S_99_ = 99,                              // '['
+        S_100_ = 100,                            // ']'
+        S_101_ = 101,                            // '?'
+        S_102_ = 102,                            // '.'
+        S_YYACCEPT = 103,                        // $accept
+        S_vnscript = 104,                        // vnscript
+        S_stmt_boot = 105,                       // stmt_boot
+        S_commands = 106,                        // commands
+        S_sep_commands = 107,                    // sep_commands
+        S_script_command = 108,                  // script_command
+        S_designation_command = 109,             // designation_command
+        S_itemisation = 110,                     // itemisation
+        S_items_bare = 111,                      // items_bare
+        S_items_sep = 112,                       // items_sep
+        S_item = 113,                            // item
+        S_unified_entry = 114,                   // unified_entry
+        S_unified_prefix = 115,                  // unified_prefix
+        S_compound_entry = 116,                  // compound_entry
+        S_compound_prefix = 117,                 // compound_prefix
+        S_compound_primary = 118,                // compound_primary
+        S_compound_scope = 119,                  // compound_scope
+        S_code_unit_scope = 120,                 // code_unit_scope
+        S_stmt_decls = 121,                      // stmt_decls
+        S_stmt_decl_l = 122,                     // stmt_decl_l
+        S_decl_boot = 123,                       // decl_boot
+        S_decl_commands = 124,                   // decl_commands
+        S_decl_entry = 125,                      // decl_entry
+        S_decl_disjunction = 126,                // decl_disjunction
+        S_decl_conjunction = 127,                // decl_conjunction
+        S_open_declaration = 128,                // open_declaration
+        S_declaration = 129,                     // declaration
+        S_bare_declaration = 130,                // bare_declaration
+        S_comp_decl_nvn = 131,                   // comp_decl_nvn
+        S_bare_decl_nvn = 132,                   // bare_decl_nvn
+        S_bare_initialiser = 133,                // bare_initialiser
+        S_prototype = 134,                       // prototype
+        S_assign_init = 135,                     // assign_init
+        S_decl_prefix = 136,                     // decl_prefix
+        S_decl_postfix = 137,                    // decl_postfix
+        S_decl_primary = 138,                    // decl_primary
+        S_decl_vn_prim = 139,                    // decl_vn_prim
+        S_decl_full_explicit_start = 140,        // decl_full_explicit_start
+        S_decl_prerestrict_op_named = 141,       // decl_prerestrict_op_named
+        S_memb_inits = 142,                      // memb_inits
+        S_memb_init_boot = 143,                  // memb_init_boot
+        S_memb_init_entry = 144,                 // memb_init_entry
+        S_memb_init_prefix = 145,                // memb_init_prefix
+        S_memb_init_postfix = 146,               // memb_init_postfix
+        S_memb_init_primary = 147,               // memb_init_primary
+        S_mi_full_explicit_start = 148,          // mi_full_explicit_start
+        S_mi_prerestrict_op_named = 149,         // mi_prerestrict_op_named
+        S_mi_id_by_name_op_named = 150,          // mi_id_by_name_op_named
+        S_mi_build_id_op_named = 151,            // mi_build_id_op_named
+        S_mi_transform_op_named = 152,           // mi_transform_op_named
+        S_declarator = 153,                      // declarator
+        S_declarator_prefix = 154,               // declarator_prefix
+        S_declarator_postfix = 155,              // declarator_postfix
+        S_declarator_primary = 156,              // declarator_primary
+        S_ab_declarator = 157,                   // ab_declarator
+        S_ab_declarator_prefix = 158,            // ab_declarator_prefix
+        S_ab_declarator_postfix = 159,           // ab_declarator_postfix
+        S_parameterisation = 160,                // parameterisation
+        S_params_scope = 161,                    // params_scope
+        S_parameters = 162,                      // parameters
+        S_parameter = 163,                       // parameter
+        S_inheritance_record = 164,              // inheritance_record
+        S_irecord_scope = 165,                   // irecord_scope
+        S_irecord_node = 166,                    // irecord_node
+        S_bases = 167,                           // bases
+        S_base_spec = 168,                       // base_spec
+        S_members = 169,                         // members
+        S_acc_memb_boot = 170,                   // acc_memb_boot
+        S_member = 171,                          // member
+        S_comp_member = 172,                     // comp_member
+        S_bare_member = 173,                     // bare_member
+        S_bare_member_nvn = 174,                 // bare_member_nvn
+        S_access_clause = 175,                   // access_clause
+        S_access_spec = 176,                     // access_spec
+        S_acc_memb_prefix = 177,                 // acc_memb_prefix
+        S_acc_memb_postfix = 178,                // acc_memb_postfix
+        S_acc_memb_paren = 179,                  // acc_memb_paren
+        S_acc_memb_primary = 180,                // acc_memb_primary
+        S_enum = 181,                            // enum
+        S_enum_scope = 182,                      // enum_scope
+        S_enum_node = 183,                       // enum_node
+        S_enumerators = 184,                     // enumerators
+        S_enumerator = 185,                      // enumerator
+        S_prototype_enumerator = 186,            // prototype_enumerator
+        S_stmt_entry = 187,                      // stmt_entry
+        S_stmt_disjunction = 188,                // stmt_disjunction
+        S_stmt_conjunction = 189,                // stmt_conjunction
+        S_open_statement = 190,                  // open_statement
+        S_stmt_entry_nc = 191,                   // stmt_entry_nc
+        S_stmt_disjunction_nc = 192,             // stmt_disjunction_nc
+        S_stmt_conjunction_nc = 193,             // stmt_conjunction_nc
+        S_open_statement_nc = 194,               // open_statement_nc
+        S_stmt_comp = 195,                       // stmt_comp
+        S_statement = 196,                       // statement
+        S_statement_l = 197,                     // statement_l
+        S_statement_e = 198,                     // statement_e
+        S_statement_nc = 199,                    // statement_nc
+        S_arrival = 200,                         // arrival
+        S_statement_nl = 201,                    // statement_nl
+        S_bare_statement = 202,                  // bare_statement
+        S_semicolon_args = 203,                  // semicolon_args
+        S_expr_entry = 204,                      // expr_entry
+        S_expr_comma_op = 205,                   // expr_comma_op
+        S_expr_no_comma_op = 206,                // expr_no_comma_op
+        S_expr_id_value = 207,                   // expr_id_value
+        S_expr_assignment = 208,                 // expr_assignment
+        S_expr_logical_or = 209,                 // expr_logical_or
+        S_expr_logical_and = 210,                // expr_logical_and
+        S_expr_bitwise_or = 211,                 // expr_bitwise_or
+        S_expr_bitwise_xor = 212,                // expr_bitwise_xor
+        S_expr_bitwise_and = 213,                // expr_bitwise_and
+        S_expr_equality = 214,                   // expr_equality
+        S_expr_relational = 215,                 // expr_relational
+        S_expr_shift = 216,                      // expr_shift
+        S_expr_add_etc = 217,                    // expr_add_etc
+        S_expr_mul_etc = 218,                    // expr_mul_etc
+        S_expr_prefix = 219,                     // expr_prefix
+        S_stuff_depth = 220,                     // stuff_depth
+        S_expr_postfix = 221,                    // expr_postfix
+        S_expr_primary = 222,                    // expr_primary
+        S_id_primary = 223,                      // id_primary
+        S_id_wildcard = 224,                     // id_wildcard
+        S_comma_sep_expr_decl = 225,             // comma_sep_expr_decl
+        S_norm_full_explicit_start = 226,        // norm_full_explicit_start
+        S_prerestrict_op_named = 227,            // prerestrict_op_named
+        S_id_by_name_op_named = 228,             // id_by_name_op_named
+        S_build_id_named = 229,                  // build_id_named
+        S_transform_op_named = 230,              // transform_op_named
+        S_type_id = 231,                         // type_id
+        S_ab_type = 232,                         // ab_type
+        S_type_boot = 233,                       // type_boot
+        S_type_entry = 234,                      // type_entry
+        S_type_disjunction = 235,                // type_disjunction
+        S_type_conjunction = 236,                // type_conjunction
+        S_type_specified = 237,                  // type_specified
+        S_type_prefix = 238,                     // type_prefix
+        S_type_postfix = 239,                    // type_postfix
+        S_type_for_declarator = 240,             // type_for_declarator
+        S_type_primary = 241,                    // type_primary
+        S_type_vn_prim = 242,                    // type_vn_prim
+        S_type_full_explicit_start = 243,        // type_full_explicit_start
+        S_type_prerestrict_op_named = 244,       // type_prerestrict_op_named
+        S_type_id_by_name_op_named = 245,        // type_id_by_name_op_named
+        S_type_build_id_op_named = 246,          // type_build_id_op_named
+        S_type_transform_op_named = 247,         // type_transform_op_named
+        S_type_specifier_seq = 248,              // type_specifier_seq
+        S_qualifiers = 249,                      // qualifiers
+        S_qualifier = 250,                       // qualifier
+        S_qualifier_nw = 251,                    // qualifier_nw
+        S_qualifier_node = 252,                  // qualifier_node
+        S_qual_full_explicit_start = 253,        // qual_full_explicit_start
+        S_vn_name = 254,                         // vn_name
+        S_explicit_norm_node = 255,              // explicit_norm_node
+        S_resolved_norm_node = 256,              // resolved_norm_node
+        S_resolved_norm_name = 257,              // resolved_norm_name
+        S_explicit_type_node = 258,              // explicit_type_node
+        S_resolved_type_node = 259,              // resolved_type_node
+        S_resolved_type_name = 260,              // resolved_type_name
+        S_explicit_decl_node = 261,              // explicit_decl_node
+        S_resolved_decl_node = 262,              // resolved_decl_node
+        S_resolved_decl_name = 263,              // resolved_decl_name
+        S_explicit_qual_node = 264,              // explicit_qual_node
+        S_resolved_qual_node = 265,              // resolved_qual_node
+        S_resolved_qual_name = 266,              // resolved_qual_name
+        S_explicit_mi_node = 267,                // explicit_mi_node
+        S_resolved_mi_node = 268,                // resolved_mi_node
+        S_resolved_mi_name = 269,                // resolved_mi_name
+        S_part_resolve = 270,                    // part_resolve
+        S_node_namespace = 271,                  // node_namespace
+        S_explicit_op_scope = 272,               // explicit_op_scope
+        S_prerestrict_op_scope = 273,            // prerestrict_op_scope
+        S_id_by_name_op_scope = 274,             // id_by_name_op_scope
+        S_builder_id_op_scope = 275,             // builder_id_op_scope
+        S_transform_op_scope = 276,              // transform_op_scope
+        S_stuff_op_scope = 277                   // stuff_op_scope
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
+
+    /// A complete symbol.
+    ///
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
+    ///
+    /// Provide access to semantic value and location.
+    template <typename Base>
+    struct basic_symbol : Base
+    {
+      /// Alias to Base.
+      typedef Base super_type;
+
+      /// Default constructor.
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.move< TreePtr<Node> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_item: // item
+        value.move< VN::Item > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.move< VN::Itemisation > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.move< VN::Limit > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.move< VN::NodeAndGnomon > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.move< VN::QualifierData > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.move< YY::TokenMetadata > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.move< const ANDBlock * > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.move< list<TreePtr<Node>> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.move< list<VN::QualifierData> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.move< list<shared_ptr<VN::Command>> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.move< multiset<string> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.move< shared_ptr<VN::Command> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.move< shared_ptr<VN::Gnomon> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.move< shared_ptr<VN::PrerestrictScopeGnomon> > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.move< string > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.move< wstring > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, TreePtr<Node>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const TreePtr<Node>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, VN::Item&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const VN::Item& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, VN::Itemisation&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const VN::Itemisation& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, VN::Limit&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const VN::Limit& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, VN::NodeAndGnomon&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const VN::NodeAndGnomon& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, VN::QualifierData&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const VN::QualifierData& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, YY::TokenMetadata&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const YY::TokenMetadata& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, const ANDBlock *&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const const ANDBlock *& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, list<TreePtr<Node>>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const list<TreePtr<Node>>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, list<VN::QualifierData>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const list<VN::QualifierData>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, list<shared_ptr<VN::Command>>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const list<shared_ptr<VN::Command>>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, multiset<string>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const multiset<string>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, shared_ptr<VN::Command>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const shared_ptr<VN::Command>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, shared_ptr<VN::Gnomon>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const shared_ptr<VN::Gnomon>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, shared_ptr<VN::PrerestrictScopeGnomon>&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const shared_ptr<VN::PrerestrictScopeGnomon>& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, wstring&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const wstring& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
+
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
+
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.template destroy< TreePtr<Node> > ();
+        break;
+
+      case symbol_kind::S_item: // item
+        value.template destroy< VN::Item > ();
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.template destroy< VN::Itemisation > ();
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.template destroy< VN::Limit > ();
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.template destroy< VN::NodeAndGnomon > ();
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.template destroy< VN::QualifierData > ();
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.template destroy< YY::TokenMetadata > ();
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.template destroy< const ANDBlock * > ();
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.template destroy< list<TreePtr<Node>> > ();
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.template destroy< list<VN::QualifierData> > ();
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.template destroy< list<shared_ptr<VN::Command>> > ();
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.template destroy< multiset<string> > ();
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.template destroy< shared_ptr<VN::Command> > ();
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.template destroy< shared_ptr<VN::Gnomon> > ();
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.template destroy< shared_ptr<VN::PrerestrictScopeGnomon> > ();
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.template destroy< string > ();
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.template destroy< wstring > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      const char *name () const YY_NOEXCEPT
+      {
+        return VNLangParser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
+
+      /// The semantic value.
+      value_type value;
+
+      /// The location.
+      location_type location;
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
+    };
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, YY::TokenMetadata v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const YY::TokenMetadata& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, wstring v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const wstring& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {}
+    };
+
+    /// Build a parser object.
+    VNLangParser (YY::VNLangScanner& lexer_yyarg, VN::VNLangActions *vn_yyarg, VN::VNLangRecogniser *recogniser_yyarg);
+    virtual ~VNLangParser ();
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    VNLangParser (const VNLangParser&) = delete;
+    /// Non copyable.
+    VNLangParser& operator= (const VNLangParser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
+
+#if YYDEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
+
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
+
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
+
+    /// Report a syntax error.
+    void error (const syntax_error& err);
+
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static const char *symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYEOF (location_type l)
+      {
+        return symbol_type (token::TOK_YYEOF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYEOF (const location_type& l)
+      {
+        return symbol_type (token::TOK_YYEOF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYerror (location_type l)
+      {
+        return symbol_type (token::TOK_YYerror, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYerror (const location_type& l)
+      {
+        return symbol_type (token::TOK_YYerror, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYUNDEF (location_type l)
+      {
+        return symbol_type (token::TOK_YYUNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYUNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOK_YYUNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATE_COMMAND (location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATE_COMMAND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATE_COMMAND (const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATE_COMMAND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENGINE_COMMAND (location_type l)
+      {
+        return symbol_type (token::TOK_ENGINE_COMMAND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENGINE_COMMAND (const location_type& l)
+      {
+        return symbol_type (token::TOK_ENGINE_COMMAND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ATTRIBUTE_COMMAND (location_type l)
+      {
+        return symbol_type (token::TOK_ATTRIBUTE_COMMAND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ATTRIBUTE_COMMAND (const location_type& l)
+      {
+        return symbol_type (token::TOK_ATTRIBUTE_COMMAND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMAND_TERM (location_type l)
+      {
+        return symbol_type (token::TOK_COMMAND_TERM, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMAND_TERM (const location_type& l)
+      {
+        return symbol_type (token::TOK_COMMAND_TERM, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPEN_VN (location_type l)
+      {
+        return symbol_type (token::TOK_OPEN_VN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPEN_VN (const location_type& l)
+      {
+        return symbol_type (token::TOK_OPEN_VN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLOSE_VN (location_type l)
+      {
+        return symbol_type (token::TOK_CLOSE_VN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLOSE_VN (const location_type& l)
+      {
+        return symbol_type (token::TOK_CLOSE_VN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VN_SEP (location_type l)
+      {
+        return symbol_type (token::TOK_VN_SEP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VN_SEP (const location_type& l)
+      {
+        return symbol_type (token::TOK_VN_SEP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VN_SUB_SEP (location_type l)
+      {
+        return symbol_type (token::TOK_VN_SUB_SEP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VN_SUB_SEP (const location_type& l)
+      {
+        return symbol_type (token::TOK_VN_SUB_SEP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPEN_MAP_CALL (location_type l)
+      {
+        return symbol_type (token::TOK_OPEN_MAP_CALL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPEN_MAP_CALL (const location_type& l)
+      {
+        return symbol_type (token::TOK_OPEN_MAP_CALL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLOSE_MAP_CALL (location_type l)
+      {
+        return symbol_type (token::TOK_CLOSE_MAP_CALL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLOSE_MAP_CALL (const location_type& l)
+      {
+        return symbol_type (token::TOK_CLOSE_MAP_CALL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAP_ARG_OP (location_type l)
+      {
+        return symbol_type (token::TOK_MAP_ARG_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAP_ARG_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_MAP_ARG_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STUFF_OP (location_type l)
+      {
+        return symbol_type (token::TOK_STUFF_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STUFF_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_STUFF_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DELTA_COMPARE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_DELTA_COMPARE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DELTA_COMPARE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_DELTA_COMPARE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DELTA_REPLACE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_DELTA_REPLACE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DELTA_REPLACE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_DELTA_REPLACE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DELTA_END_OP (location_type l)
+      {
+        return symbol_type (token::TOK_DELTA_END_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DELTA_END_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_DELTA_END_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXPLICIT_OP (location_type l)
+      {
+        return symbol_type (token::TOK_EXPLICIT_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXPLICIT_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_EXPLICIT_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ANY_NODE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_ANY_NODE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ANY_NODE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_ANY_NODE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STAR_OP (location_type l)
+      {
+        return symbol_type (token::TOK_STAR_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STAR_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_STAR_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ID_BY_NAME_OP (location_type l)
+      {
+        return symbol_type (token::TOK_ID_BY_NAME_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ID_BY_NAME_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_ID_BY_NAME_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BUILDER_ID_OP (location_type l)
+      {
+        return symbol_type (token::TOK_BUILDER_ID_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BUILDER_ID_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_BUILDER_ID_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TRANSFORM_OP (location_type l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TRANSFORM_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEGATION_OP (location_type l)
+      {
+        return symbol_type (token::TOK_NEGATION_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEGATION_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_NEGATION_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONJUNCTION_OP (location_type l)
+      {
+        return symbol_type (token::TOK_CONJUNCTION_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONJUNCTION_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_CONJUNCTION_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DISJUNCTION_OP (location_type l)
+      {
+        return symbol_type (token::TOK_DISJUNCTION_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DISJUNCTION_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_DISJUNCTION_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GREEN_GRASS_OP (location_type l)
+      {
+        return symbol_type (token::TOK_GREEN_GRASS_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GREEN_GRASS_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_GREEN_GRASS_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POINTER_IS_OP (location_type l)
+      {
+        return symbol_type (token::TOK_POINTER_IS_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POINTER_IS_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_POINTER_IS_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BUILD_SIZE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_BUILD_SIZE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BUILD_SIZE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_BUILD_SIZE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRINGIZE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_STRINGIZE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRINGIZE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_STRINGIZE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PRERESTRICT_OP (location_type l)
+      {
+        return symbol_type (token::TOK_PRERESTRICT_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PRERESTRICT_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_PRERESTRICT_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_XSTRUCTOR (location_type l)
+      {
+        return symbol_type (token::TOK_XSTRUCTOR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_XSTRUCTOR (const location_type& l)
+      {
+        return symbol_type (token::TOK_XSTRUCTOR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE_INDICATOR (location_type l)
+      {
+        return symbol_type (token::TOK_TYPE_INDICATOR, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE_INDICATOR (const location_type& l)
+      {
+        return symbol_type (token::TOK_TYPE_INDICATOR, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CODE_UNIT (location_type l)
+      {
+        return symbol_type (token::TOK_CODE_UNIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CODE_UNIT (const location_type& l)
+      {
+        return symbol_type (token::TOK_CODE_UNIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLUTION_OP (location_type l)
+      {
+        return symbol_type (token::TOK_RESOLUTION_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLUTION_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLUTION_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RANGE_OP (location_type l)
+      {
+        return symbol_type (token::TOK_RANGE_OP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RANGE_OP (const location_type& l)
+      {
+        return symbol_type (token::TOK_RANGE_OP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_ASSIGN (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_ASSIGN (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_COMPOUND_ASSIGN (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_COMPOUND_ASSIGN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_COMPOUND_ASSIGN (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_COMPOUND_ASSIGN, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_LOGICAL_OR_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_LOGICAL_OR_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_LOGICAL_OR_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_LOGICAL_OR_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_LOGICAL_AND_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_LOGICAL_AND_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_LOGICAL_AND_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_LOGICAL_AND_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_BITWISE_OR_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_BITWISE_OR_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_BITWISE_OR_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_BITWISE_OR_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_BITWISE_XOR_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_BITWISE_XOR_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_BITWISE_XOR_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_BITWISE_XOR_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_EQUALITY_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_EQUALITY_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_EQUALITY_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_EQUALITY_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_RELATIONAL_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_RELATIONAL_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_RELATIONAL_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_RELATIONAL_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_SHIFT_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_SHIFT_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_SHIFT_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_SHIFT_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_ADD_SUB_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_ADD_SUB_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_ADD_SUB_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_ADD_SUB_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_DIV_MOD_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_DIV_MOD_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_DIV_MOD_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_DIV_MOD_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_PREFIX_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_PREFIX_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_PREFIX_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_PREFIX_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_PRE_OR_INFIX_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_PRE_OR_INFIX_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_PRE_OR_INFIX_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_PRE_OR_INFIX_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_C_PRE_OR_POSTFIX_OP (string v, location_type l)
+      {
+        return symbol_type (token::TOK_C_PRE_OR_POSTFIX_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_C_PRE_OR_POSTFIX_OP (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_C_PRE_OR_POSTFIX_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING_LITERAL (wstring v, location_type l)
+      {
+        return symbol_type (token::TOK_STRING_LITERAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING_LITERAL (const wstring& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_STRING_LITERAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGRAL_LITERAL (string v, location_type l)
+      {
+        return symbol_type (token::TOK_INTEGRAL_LITERAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGRAL_LITERAL (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_INTEGRAL_LITERAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASCII_FORMAT (string v, location_type l)
+      {
+        return symbol_type (token::TOK_ASCII_FORMAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASCII_FORMAT (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_ASCII_FORMAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPENAME (string v, location_type l)
+      {
+        return symbol_type (token::TOK_TYPENAME, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPENAME (const string& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_TYPENAME, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE_SPECIFIER (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_TYPE_SPECIFIER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE_SPECIFIER (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_TYPE_SPECIFIER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOL_LITERAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_BOOL_LITERAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOL_LITERAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_BOOL_LITERAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TRANSFORM_NAME_TYPE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_NAME_TYPE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TRANSFORM_NAME_TYPE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_NAME_TYPE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TRANSFORM_NAME_NORMAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_NAME_NORMAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TRANSFORM_NAME_NORMAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_TRANSFORM_NAME_NORMAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASCII_NAME (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_ASCII_NAME, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASCII_NAME (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_ASCII_NAME, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNICODE_NAME (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_UNICODE_NAME, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNICODE_NAME (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_UNICODE_NAME, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATED_NORMAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_NORMAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATED_NORMAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_NORMAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATED_TYPE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_TYPE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATED_TYPE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_TYPE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATED_DECL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_DECL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATED_DECL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_DECL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATED_QUAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_QUAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATED_QUAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_QUAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DESIGNATED_COMPOUND (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_COMPOUND, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DESIGNATED_COMPOUND (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DESIGNATED_COMPOUND, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLVED_NORMAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_RESOLVED_NORMAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLVED_NORMAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLVED_NORMAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLVED_TYPE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_RESOLVED_TYPE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLVED_TYPE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLVED_TYPE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLVED_DECL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_RESOLVED_DECL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLVED_DECL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLVED_DECL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLVED_QUAL (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_RESOLVED_QUAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLVED_QUAL (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLVED_QUAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESOLVED_MEMB_INIT (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_RESOLVED_MEMB_INIT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESOLVED_MEMB_INIT (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_RESOLVED_MEMB_INIT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NODE_NAMESPACE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_NODE_NAMESPACE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NODE_NAMESPACE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_NODE_NAMESPACE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_PRIMARY_OP (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_KEYWORD_PRIMARY_OP, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_PRIMARY_OP (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_KEYWORD_PRIMARY_OP, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_SIMPLE_STMT (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_KEYWORD_SIMPLE_STMT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_SIMPLE_STMT (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_KEYWORD_SIMPLE_STMT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_SPACE_SEP_STMT (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_KEYWORD_SPACE_SEP_STMT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_SPACE_SEP_STMT (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_KEYWORD_SPACE_SEP_STMT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_ARGS_BODY_STMT (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_KEYWORD_ARGS_BODY_STMT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_ARGS_BODY_STMT (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_KEYWORD_ARGS_BODY_STMT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_ARGS_BODY_WITH_ELSE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_KEYWORD_ARGS_BODY_WITH_ELSE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_ARGS_BODY_WITH_ELSE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_KEYWORD_ARGS_BODY_WITH_ELSE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CHAINING_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_CHAINING_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CHAINING_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_CHAINING_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DO_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DO_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DO_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DO_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHILE_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_WHILE_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHILE_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_WHILE_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CASE_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_CASE_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CASE_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_CASE_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEFAULT_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_DEFAULT_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEFAULT_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_DEFAULT_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FUNC_ON_TYPE (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_FUNC_ON_TYPE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FUNC_ON_TYPE (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_FUNC_ON_TYPE, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IRECORD_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_IRECORD_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IRECORD_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_IRECORD_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENUM_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_ENUM_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENUM_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_ENUM_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUAL_NODE_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_QUAL_NODE_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUAL_NODE_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_QUAL_NODE_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STATIC_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_STATIC_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STATIC_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_STATIC_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPEDEF_KEYWORD (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_TYPEDEF_KEYWORD, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPEDEF_KEYWORD (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_TYPEDEF_KEYWORD, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_stmt_low (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_stmt_low, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_stmt_low (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_stmt_low, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_stmt_high (YY::TokenMetadata v, location_type l)
+      {
+        return symbol_type (token::TOK_stmt_high, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_stmt_high (const YY::TokenMetadata& v, const location_type& l)
+      {
+        return symbol_type (token::TOK_stmt_high, v, l);
+      }
+#endif
+
+
+    class context
+    {
+    public:
+      context (const VNLangParser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const VNLangParser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    VNLangParser (const VNLangParser&);
+    /// Non copyable.
+    VNLangParser& operator= (const VNLangParser&);
+#endif
+
+    /// Check the lookahead yytoken.
+    /// \returns  true iff the token will be eventually shifted.
+    bool yy_lac_check_ (symbol_kind_type yytoken) const;
+    /// Establish the initial context if no initial context currently exists.
+    /// \returns  true iff the token will be eventually shifted.
+    bool yy_lac_establish_ (symbol_kind_type yytoken);
+    /// Discard any previous initial lookahead context because of event.
+    /// \param event  the event which caused the lookahead to be discarded.
+    ///               Only used for debbuging output.
+    void yy_lac_discard_ (const char* event);
+
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
+
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
+
+    static const short yypact_ninf_;
+    static const short yytable_ninf_;
+
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
+
+
+
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
+
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
+
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
+
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
+
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
+
+    static const short yycheck_[];
+
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
+
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
+
+
+#if YYDEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
+
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
+
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
+
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
+
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
+
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
+
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
+
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
+
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
+
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
+
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
+
+    /// The stack.
+    stack_type yystack_;
+    /// The stack for LAC.
+    /// Logically, the yy_lac_stack's lifetime is confined to the function
+    /// yy_lac_check_. We just store it as a member of this class to hold
+    /// on to the memory and to avoid frequent reallocations.
+    /// Since yy_lac_check_ is const, this member must be mutable.
+    mutable std::vector<state_type> yylac_stack_;
+    /// Whether an initial LAC context was established.
+    bool yy_lac_established_;
+
+
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
+
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
+
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
+
+    /// Constants.
+    enum
+    {
+      yylast_ = 7813,     ///< Last index in yytable_.
+      yynnts_ = 175,  ///< Number of nonterminal symbols.
+      yyfinal_ = 206 ///< Termination state number.
+    };
+
+
+    // User arguments.
+    YY::VNLangScanner& lexer;
+    VN::VNLangActions *vn;
+    VN::VNLangRecogniser *recogniser;
+
+  };
+
+  inline
+  VNLangParser::symbol_kind_type
+  VNLangParser::yytranslate_ (int t) YY_NOEXCEPT
+  {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    97,     2,
+      94,    95,    98,     2,    96,     2,   102,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    93,    92,
+       2,     2,     2,   101,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    99,     2,   100,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    90,     2,    91,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89
+    };
+    // Last valid token kind.
+    const int code_max = 344;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
+  }
+
+  // basic_symbol.
+  template <typename Base>
+  VNLangParser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
+  {
+    switch (this->kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.copy< TreePtr<Node> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_item: // item
+        value.copy< VN::Item > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.copy< VN::Itemisation > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.copy< VN::Limit > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.copy< VN::NodeAndGnomon > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.copy< VN::QualifierData > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.copy< YY::TokenMetadata > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.copy< const ANDBlock * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.copy< list<TreePtr<Node>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.copy< list<VN::QualifierData> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.copy< list<shared_ptr<VN::Command>> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.copy< multiset<string> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.copy< shared_ptr<VN::Command> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.copy< shared_ptr<VN::Gnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.copy< shared_ptr<VN::PrerestrictScopeGnomon> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.copy< string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.copy< wstring > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+  }
+
+
+
+
+  template <typename Base>
+  VNLangParser::symbol_kind_type
+  VNLangParser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+  template <typename Base>
+  bool
+  VNLangParser::basic_symbol<Base>::empty () const YY_NOEXCEPT
+  {
+    return this->kind () == symbol_kind::S_YYEMPTY;
+  }
+
+  template <typename Base>
+  void
+  VNLangParser::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_stmt_boot: // stmt_boot
+      case symbol_kind::S_unified_entry: // unified_entry
+      case symbol_kind::S_unified_prefix: // unified_prefix
+      case symbol_kind::S_compound_entry: // compound_entry
+      case symbol_kind::S_compound_prefix: // compound_prefix
+      case symbol_kind::S_compound_primary: // compound_primary
+      case symbol_kind::S_decl_boot: // decl_boot
+      case symbol_kind::S_decl_entry: // decl_entry
+      case symbol_kind::S_decl_disjunction: // decl_disjunction
+      case symbol_kind::S_decl_conjunction: // decl_conjunction
+      case symbol_kind::S_open_declaration: // open_declaration
+      case symbol_kind::S_declaration: // declaration
+      case symbol_kind::S_bare_declaration: // bare_declaration
+      case symbol_kind::S_comp_decl_nvn: // comp_decl_nvn
+      case symbol_kind::S_bare_decl_nvn: // bare_decl_nvn
+      case symbol_kind::S_bare_initialiser: // bare_initialiser
+      case symbol_kind::S_prototype: // prototype
+      case symbol_kind::S_assign_init: // assign_init
+      case symbol_kind::S_decl_prefix: // decl_prefix
+      case symbol_kind::S_decl_postfix: // decl_postfix
+      case symbol_kind::S_decl_primary: // decl_primary
+      case symbol_kind::S_decl_vn_prim: // decl_vn_prim
+      case symbol_kind::S_memb_init_boot: // memb_init_boot
+      case symbol_kind::S_memb_init_entry: // memb_init_entry
+      case symbol_kind::S_memb_init_prefix: // memb_init_prefix
+      case symbol_kind::S_memb_init_postfix: // memb_init_postfix
+      case symbol_kind::S_memb_init_primary: // memb_init_primary
+      case symbol_kind::S_declarator: // declarator
+      case symbol_kind::S_declarator_prefix: // declarator_prefix
+      case symbol_kind::S_declarator_postfix: // declarator_postfix
+      case symbol_kind::S_declarator_primary: // declarator_primary
+      case symbol_kind::S_ab_declarator: // ab_declarator
+      case symbol_kind::S_ab_declarator_prefix: // ab_declarator_prefix
+      case symbol_kind::S_ab_declarator_postfix: // ab_declarator_postfix
+      case symbol_kind::S_parameter: // parameter
+      case symbol_kind::S_inheritance_record: // inheritance_record
+      case symbol_kind::S_irecord_node: // irecord_node
+      case symbol_kind::S_base_spec: // base_spec
+      case symbol_kind::S_acc_memb_boot: // acc_memb_boot
+      case symbol_kind::S_member: // member
+      case symbol_kind::S_comp_member: // comp_member
+      case symbol_kind::S_bare_member: // bare_member
+      case symbol_kind::S_bare_member_nvn: // bare_member_nvn
+      case symbol_kind::S_access_clause: // access_clause
+      case symbol_kind::S_access_spec: // access_spec
+      case symbol_kind::S_acc_memb_prefix: // acc_memb_prefix
+      case symbol_kind::S_acc_memb_postfix: // acc_memb_postfix
+      case symbol_kind::S_acc_memb_paren: // acc_memb_paren
+      case symbol_kind::S_acc_memb_primary: // acc_memb_primary
+      case symbol_kind::S_enum: // enum
+      case symbol_kind::S_enum_node: // enum_node
+      case symbol_kind::S_enumerator: // enumerator
+      case symbol_kind::S_prototype_enumerator: // prototype_enumerator
+      case symbol_kind::S_stmt_entry: // stmt_entry
+      case symbol_kind::S_stmt_disjunction: // stmt_disjunction
+      case symbol_kind::S_stmt_conjunction: // stmt_conjunction
+      case symbol_kind::S_open_statement: // open_statement
+      case symbol_kind::S_stmt_entry_nc: // stmt_entry_nc
+      case symbol_kind::S_stmt_disjunction_nc: // stmt_disjunction_nc
+      case symbol_kind::S_stmt_conjunction_nc: // stmt_conjunction_nc
+      case symbol_kind::S_open_statement_nc: // open_statement_nc
+      case symbol_kind::S_stmt_comp: // stmt_comp
+      case symbol_kind::S_statement: // statement
+      case symbol_kind::S_arrival: // arrival
+      case symbol_kind::S_statement_nl: // statement_nl
+      case symbol_kind::S_bare_statement: // bare_statement
+      case symbol_kind::S_expr_entry: // expr_entry
+      case symbol_kind::S_expr_comma_op: // expr_comma_op
+      case symbol_kind::S_expr_no_comma_op: // expr_no_comma_op
+      case symbol_kind::S_expr_id_value: // expr_id_value
+      case symbol_kind::S_expr_assignment: // expr_assignment
+      case symbol_kind::S_expr_logical_or: // expr_logical_or
+      case symbol_kind::S_expr_logical_and: // expr_logical_and
+      case symbol_kind::S_expr_bitwise_or: // expr_bitwise_or
+      case symbol_kind::S_expr_bitwise_xor: // expr_bitwise_xor
+      case symbol_kind::S_expr_bitwise_and: // expr_bitwise_and
+      case symbol_kind::S_expr_equality: // expr_equality
+      case symbol_kind::S_expr_relational: // expr_relational
+      case symbol_kind::S_expr_shift: // expr_shift
+      case symbol_kind::S_expr_add_etc: // expr_add_etc
+      case symbol_kind::S_expr_mul_etc: // expr_mul_etc
+      case symbol_kind::S_expr_prefix: // expr_prefix
+      case symbol_kind::S_expr_postfix: // expr_postfix
+      case symbol_kind::S_expr_primary: // expr_primary
+      case symbol_kind::S_id_primary: // id_primary
+      case symbol_kind::S_id_wildcard: // id_wildcard
+      case symbol_kind::S_type_id: // type_id
+      case symbol_kind::S_ab_type: // ab_type
+      case symbol_kind::S_type_boot: // type_boot
+      case symbol_kind::S_type_entry: // type_entry
+      case symbol_kind::S_type_disjunction: // type_disjunction
+      case symbol_kind::S_type_conjunction: // type_conjunction
+      case symbol_kind::S_type_specified: // type_specified
+      case symbol_kind::S_type_prefix: // type_prefix
+      case symbol_kind::S_type_postfix: // type_postfix
+      case symbol_kind::S_type_for_declarator: // type_for_declarator
+      case symbol_kind::S_type_primary: // type_primary
+      case symbol_kind::S_type_vn_prim: // type_vn_prim
+      case symbol_kind::S_qualifier_node: // qualifier_node
+      case symbol_kind::S_explicit_norm_node: // explicit_norm_node
+      case symbol_kind::S_resolved_norm_node: // resolved_norm_node
+      case symbol_kind::S_explicit_type_node: // explicit_type_node
+      case symbol_kind::S_resolved_type_node: // resolved_type_node
+      case symbol_kind::S_explicit_decl_node: // explicit_decl_node
+      case symbol_kind::S_resolved_decl_node: // resolved_decl_node
+      case symbol_kind::S_explicit_qual_node: // explicit_qual_node
+      case symbol_kind::S_resolved_qual_node: // resolved_qual_node
+      case symbol_kind::S_explicit_mi_node: // explicit_mi_node
+      case symbol_kind::S_resolved_mi_node: // resolved_mi_node
+        value.move< TreePtr<Node> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_item: // item
+        value.move< VN::Item > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_itemisation: // itemisation
+      case symbol_kind::S_items_bare: // items_bare
+      case symbol_kind::S_items_sep: // items_sep
+        value.move< VN::Itemisation > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_stuff_depth: // stuff_depth
+        value.move< VN::Limit > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_decl_full_explicit_start: // decl_full_explicit_start
+      case symbol_kind::S_mi_full_explicit_start: // mi_full_explicit_start
+      case symbol_kind::S_irecord_scope: // irecord_scope
+      case symbol_kind::S_enum_scope: // enum_scope
+      case symbol_kind::S_norm_full_explicit_start: // norm_full_explicit_start
+      case symbol_kind::S_type_full_explicit_start: // type_full_explicit_start
+      case symbol_kind::S_qual_full_explicit_start: // qual_full_explicit_start
+        value.move< VN::NodeAndGnomon > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_qualifier: // qualifier
+      case symbol_kind::S_qualifier_nw: // qualifier_nw
+        value.move< VN::QualifierData > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_TYPE_SPECIFIER: // "C simple type specifier"
+      case symbol_kind::S_BOOL_LITERAL: // "C boolean literal"
+      case symbol_kind::S_TRANSFORM_NAME_TYPE: // "type transform name"
+      case symbol_kind::S_TRANSFORM_NAME_NORMAL: // "open_statement transform name"
+      case symbol_kind::S_ASCII_NAME: // "ASCII name"
+      case symbol_kind::S_UNICODE_NAME: // "Unicode name"
+      case symbol_kind::S_DESIGNATED_NORMAL: // "designated statement/expression name"
+      case symbol_kind::S_DESIGNATED_TYPE: // "designated type name"
+      case symbol_kind::S_DESIGNATED_DECL: // "designated declaration name"
+      case symbol_kind::S_DESIGNATED_QUAL: // "designated qualifier name"
+      case symbol_kind::S_DESIGNATED_COMPOUND: // "designated compound name"
+      case symbol_kind::S_RESOLVED_NORMAL: // "resolved open_statement node name"
+      case symbol_kind::S_RESOLVED_TYPE: // "resolved type node name"
+      case symbol_kind::S_RESOLVED_DECL: // "resolved declaration node name"
+      case symbol_kind::S_RESOLVED_QUAL: // "resolved qualifier node name"
+      case symbol_kind::S_RESOLVED_MEMB_INIT: // "resolved member initialiser node name"
+      case symbol_kind::S_NODE_NAMESPACE: // "scope resolving name"
+      case symbol_kind::S_KEYWORD_PRIMARY_OP: // "open_statement keyword operator"
+      case symbol_kind::S_KEYWORD_SIMPLE_STMT: // "keyword simple statement"
+      case symbol_kind::S_KEYWORD_SPACE_SEP_STMT: // "keyword space-separated statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_STMT: // "keyword args-and-body statement"
+      case symbol_kind::S_KEYWORD_ARGS_BODY_WITH_ELSE: // "keyword args-body-chain statement"
+      case symbol_kind::S_CHAINING_KEYWORD: // "C chaining keyword"
+      case symbol_kind::S_DO_KEYWORD: // "C do keyword"
+      case symbol_kind::S_WHILE_KEYWORD: // "C while keyword"
+      case symbol_kind::S_CASE_KEYWORD: // "C case keyword"
+      case symbol_kind::S_DEFAULT_KEYWORD: // "C default keyword"
+      case symbol_kind::S_FUNC_ON_TYPE: // "function acting on a type"
+      case symbol_kind::S_IRECORD_KEYWORD: // "C class/struct/union keyword"
+      case symbol_kind::S_ENUM_KEYWORD: // "C enumeration keyword"
+      case symbol_kind::S_QUAL_NODE_KEYWORD: // "C qualifier"
+      case symbol_kind::S_STATIC_KEYWORD: // "C static keyword"
+      case symbol_kind::S_TYPEDEF_KEYWORD: // "C typedef keyword"
+      case symbol_kind::S_stmt_low: // stmt_low
+      case symbol_kind::S_stmt_high: // stmt_high
+      case symbol_kind::S_resolved_norm_name: // resolved_norm_name
+      case symbol_kind::S_resolved_type_name: // resolved_type_name
+      case symbol_kind::S_resolved_decl_name: // resolved_decl_name
+      case symbol_kind::S_resolved_qual_name: // resolved_qual_name
+      case symbol_kind::S_resolved_mi_name: // resolved_mi_name
+      case symbol_kind::S_node_namespace: // node_namespace
+        value.move< YY::TokenMetadata > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_mi_prerestrict_op_named: // mi_prerestrict_op_named
+      case symbol_kind::S_mi_id_by_name_op_named: // mi_id_by_name_op_named
+      case symbol_kind::S_mi_build_id_op_named: // mi_build_id_op_named
+      case symbol_kind::S_prerestrict_op_named: // prerestrict_op_named
+      case symbol_kind::S_id_by_name_op_named: // id_by_name_op_named
+      case symbol_kind::S_build_id_named: // build_id_named
+      case symbol_kind::S_type_prerestrict_op_named: // type_prerestrict_op_named
+      case symbol_kind::S_type_id_by_name_op_named: // type_id_by_name_op_named
+      case symbol_kind::S_type_build_id_op_named: // type_build_id_op_named
+        value.move< const ANDBlock * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_stmt_decls: // stmt_decls
+      case symbol_kind::S_stmt_decl_l: // stmt_decl_l
+      case symbol_kind::S_memb_inits: // memb_inits
+      case symbol_kind::S_parameterisation: // parameterisation
+      case symbol_kind::S_parameters: // parameters
+      case symbol_kind::S_bases: // bases
+      case symbol_kind::S_members: // members
+      case symbol_kind::S_enumerators: // enumerators
+      case symbol_kind::S_statement_l: // statement_l
+      case symbol_kind::S_statement_e: // statement_e
+      case symbol_kind::S_statement_nc: // statement_nc
+      case symbol_kind::S_semicolon_args: // semicolon_args
+      case symbol_kind::S_comma_sep_expr_decl: // comma_sep_expr_decl
+        value.move< list<TreePtr<Node>> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_qualifiers: // qualifiers
+        value.move< list<VN::QualifierData> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_commands: // commands
+      case symbol_kind::S_sep_commands: // sep_commands
+      case symbol_kind::S_decl_commands: // decl_commands
+        value.move< list<shared_ptr<VN::Command>> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_type_specifier_seq: // type_specifier_seq
+        value.move< multiset<string> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_script_command: // script_command
+        value.move< shared_ptr<VN::Command> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_designation_command: // designation_command
+      case symbol_kind::S_compound_scope: // compound_scope
+      case symbol_kind::S_code_unit_scope: // code_unit_scope
+      case symbol_kind::S_params_scope: // params_scope
+      case symbol_kind::S_part_resolve: // part_resolve
+      case symbol_kind::S_explicit_op_scope: // explicit_op_scope
+      case symbol_kind::S_prerestrict_op_scope: // prerestrict_op_scope
+      case symbol_kind::S_id_by_name_op_scope: // id_by_name_op_scope
+      case symbol_kind::S_builder_id_op_scope: // builder_id_op_scope
+      case symbol_kind::S_transform_op_scope: // transform_op_scope
+      case symbol_kind::S_stuff_op_scope: // stuff_op_scope
+        value.move< shared_ptr<VN::Gnomon> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_decl_prerestrict_op_named: // decl_prerestrict_op_named
+        value.move< shared_ptr<VN::PrerestrictScopeGnomon> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_C_ASSIGN: // "C assignment operator ="
+      case symbol_kind::S_C_COMPOUND_ASSIGN: // "C compound-assignment operator"
+      case symbol_kind::S_C_LOGICAL_OR_OP: // "C logical-or operator ||"
+      case symbol_kind::S_C_LOGICAL_AND_OP: // "C logical-and operator &&"
+      case symbol_kind::S_C_BITWISE_OR_OP: // "C bitwise-or operator |"
+      case symbol_kind::S_C_BITWISE_XOR_OP: // "C bitwise-xor operator ^"
+      case symbol_kind::S_C_EQUALITY_OP: // "C equality operator =="
+      case symbol_kind::S_C_RELATIONAL_OP: // "C relational operator"
+      case symbol_kind::S_C_SHIFT_OP: // "C shift operator operator"
+      case symbol_kind::S_C_ADD_SUB_OP: // "C add/subtract operator"
+      case symbol_kind::S_C_DIV_MOD_OP: // "C divide/modulo operator"
+      case symbol_kind::S_C_PREFIX_OP: // "C prefix operator"
+      case symbol_kind::S_C_PRE_OR_INFIX_OP: // "C prefix/infix operator"
+      case symbol_kind::S_C_PRE_OR_POSTFIX_OP: // "C prefix/postfix operator"
+      case symbol_kind::S_INTEGRAL_LITERAL: // "C integer literal"
+      case symbol_kind::S_ASCII_FORMAT: // "C format string"
+      case symbol_kind::S_TYPENAME: // "C typename operator"
+      case symbol_kind::S_mi_transform_op_named: // mi_transform_op_named
+      case symbol_kind::S_transform_op_named: // transform_op_named
+      case symbol_kind::S_type_transform_op_named: // type_transform_op_named
+        value.move< string > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_STRING_LITERAL: // "C string literal"
+      case symbol_kind::S_vn_name: // vn_name
+        value.move< wstring > (YY_MOVE (s.value));
+        break;
+
+      default:
+        break;
+    }
+
+    location = YY_MOVE (s.location);
+  }
+
+  // by_kind.
+  inline
+  VNLangParser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
+
+#if 201103L <= YY_CPLUSPLUS
+  inline
+  VNLangParser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
+  inline
+  VNLangParser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
+
+  inline
+  VNLangParser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
+
+
+  inline
+  void
+  VNLangParser::by_kind::clear () YY_NOEXCEPT
+  {
+    kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+  inline
+  void
+  VNLangParser::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
+
+  inline
+  VNLangParser::symbol_kind_type
+  VNLangParser::by_kind::kind () const YY_NOEXCEPT
+  {
+    return kind_;
+  }
+
+
+  inline
+  VNLangParser::symbol_kind_type
+  VNLangParser::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+#line 4 "src/vn/lang/vn_lang.ypp"
+} // YY
+#line 4572 "build/src/vn/lang/vn_lang.ypp.hpp"
+
+
+
+
+#endif // !YY_YY_BUILD_SRC_VN_LANG_VN_LANG_YPP_HPP_INCLUDED
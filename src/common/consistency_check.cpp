@@ -0,0 +1,61 @@
+#include "consistency_check.hpp"
+#include "read_args.hpp"
+#include "trace.hpp"
+
+#include <functional>
+
+mutex ConsistencyCheck::registry_mutex;
+
+
+ConsistencyCheck::ConsistencyCheck( string name_ ) :
+    name( name_ ),
+    random( hash<string>()(name_) )
+{
+    lock_guard<mutex> lock( registry_mutex );
+    ASSERTS( GetRegistry().count(name)==0 )("Consistency check name not unique: ")(name);
+    GetRegistry()[name] = this;
+}
+
+
+bool ConsistencyCheck::ShouldRun()
+{
+    num_calls++;
+    bool run;
+    switch( ReadArgs::check_level )
+    {
+    case ReadArgs::CheckLevel::NONE:
+        return false;
+    case ReadArgs::CheckLevel::SAMPLE:
+    {
+        lock_guard<mutex> lock( registry_mutex ); // planning jobs may share checks
+        run = random() % (unsigned)ReadArgs::check_sample_interval == 0;
+        break;
+    }
+    case ReadArgs::CheckLevel::FULL:
+        run = true;
+        break;
+    default:
+        ASSERTFAILS("Unknown consistency check level");
+    }
+    if( run )
+        num_runs++;
+    return run;
+}
+
+
+void ConsistencyCheck::Dump()
+{
+    lock_guard<mutex> lock( registry_mutex );
+    for( auto p : GetRegistry() )
+        printf("Consistency check %s: %lu runs of %lu calls\n",
+               p.first.c_str(), p.second->num_runs.load(), p.second->num_calls.load());
+}
+
+
+ConsistencyCheck::Registry &ConsistencyCheck::GetRegistry()
+{
+    // Function-local so that checks declared at file scope in other
+    // translation units can register during static initialisation
+    static Registry registry;
+    return registry;
+}
@@ -0,0 +1,47 @@
+#ifndef CONSISTENCY_CHECK_HPP
+#define CONSISTENCY_CHECK_HPP
+
+#include "standard.hpp"
+
+#include <string>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <random>
+
+// Gates an expensive (often O(n) in the size of the trees) consistency
+// check according to the level chosen with -check=<none|sample|full>:
+//   none:   never run it
+//   sample: run it on a random one in every ReadArgs::check_sample_interval calls
+//   full:   run it every time
+// Declare one of these for each check, at file scope, with a unique name:
+//   static ConsistencyCheck my_check("MyClass::MyCheck");
+//   ...
+//   if( my_check.ShouldRun() )
+//       MyCheck();
+// All such checks are kept in a central registry so that the numbers of
+// calls and runs can be dumped.
+class ConsistencyCheck
+{
+public:
+    explicit ConsistencyCheck( string name );
+
+    // Decide whether to do the check this time
+    bool ShouldRun();
+
+    // Dump calls and runs for every registered check
+    static void Dump();
+
+private:
+    typedef map<string, ConsistencyCheck *> Registry;
+    static Registry &GetRegistry();
+    static mutex registry_mutex; // also guards random
+
+    const string name;
+    // Seeded from the name so that sampling is repeatable from run to run
+    minstd_rand random;
+    atomic<unsigned long> num_calls = 0;
+    atomic<unsigned long> num_runs = 0;
+};
+
+#endif
@@ -135,5 +135,5 @@ void HitCount::Enable( bool e )
 
 HitCount HitCount::instance; 
 
-bool HitCount::enable = false; ///< call HitCount::Enable(true) to begin counting hits
+thread_local bool HitCount::enable = false; ///< call HitCount::Enable(true) to begin counting hits
 
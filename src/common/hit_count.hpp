@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 
 class HitCount
@@ -30,6 +31,7 @@ public:
         c.instance = instance;        
         c.function = function;
         c.prefix = prefix;
+        lock_guard<mutex> lock( counter_mutex ); // planning jobs share the counts
         int count=0;
         if( counter.count( c ) > 0 )        
             count = counter[c];
@@ -47,8 +49,9 @@ public:
     static HitCount instance;    
 private:
     map<Category, unsigned> counter;
+    mutex counter_mutex;
     typedef pair<Category, unsigned> pc;
-    static bool enable;
+    static thread_local bool enable;
 };
 
 extern bool operator<( const HitCount::Category &l, const HitCount::Category &r );
@@ -0,0 +1,169 @@
+#ifndef INLINE_SET_HPP
+#define INLINE_SET_HPP
+
+#include "standard.hpp"
+#include "trace.hpp"
+
+#include <array>
+#include <set>
+#include <iterator>
+#include <algorithm>
+
+// A set kept as a sorted array, which lives inside the object while there
+// are no more than N elements. Beyond that, it moves to a std::set, so that
+// big sets are still logarithmic to change. Intended for sets that nearly
+// always have zero or one elements, where std::set would allocate a node
+// for each one. Iteration order is the same as std::set with std::less.
+// Elements are immutable in place, as for std::set.
+template<typename T, size_t N>
+class InlineSet
+{
+public:
+    typedef T key_type;
+    typedef T value_type;
+
+    // Walks the inline array if p is set, otherwise the spill set
+    class const_iterator
+    {
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const_iterator() = default;
+        explicit const_iterator( const T *p_ ) : p( p_ ) {}
+        explicit const_iterator( typename set<T>::const_iterator it_ ) : it( it_ ) {}
+        const T &operator*() const { return p ? *p : *it; }
+        const T *operator->() const { return &**this; }
+        const_iterator &operator++() { if( p ) p++; else ++it; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        bool operator==( const const_iterator &other ) const { return p ? p == other.p : (!other.p && it == other.it); }
+        bool operator!=( const const_iterator &other ) const { return !(*this == other); }
+
+    private:
+        const T *p = nullptr;
+        typename set<T>::const_iterator it;
+    };
+    typedef const_iterator iterator;
+
+    InlineSet() = default;
+
+    const_iterator begin() const
+    {
+        return spill.empty() ? const_iterator( inline_elts.data() ) : const_iterator( spill.begin() );
+    }
+
+    const_iterator end() const
+    {
+        return spill.empty() ? const_iterator( inline_elts.data()+num_inline ) : const_iterator( spill.end() );
+    }
+
+    size_t size() const
+    {
+        return spill.empty() ? num_inline : spill.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    const_iterator find( const T &x ) const
+    {
+        if( !spill.empty() )
+            return const_iterator( spill.find(x) );
+        const T *p = lower_bound( inline_elts.data(), inline_elts.data()+num_inline, x );
+        return (p != inline_elts.data()+num_inline && !(x < *p)) ? const_iterator( p ) : end();
+    }
+
+    size_t count( const T &x ) const
+    {
+        return find(x) != end() ? 1 : 0;
+    }
+
+    pair<const_iterator, bool> insert( const T &x )
+    {
+        if( spill.empty() )
+        {
+            const T *p = lower_bound( inline_elts.data(), inline_elts.data()+num_inline, x );
+            size_t index = p - inline_elts.data();
+            if( index < num_inline && !(x < *p) )
+                return make_pair( const_iterator( p ), false );
+            if( num_inline < N )
+            {
+                for( size_t i=num_inline; i>index; i-- )
+                    inline_elts[i] = inline_elts[i-1];
+                inline_elts[index] = x;
+                num_inline++;
+                return make_pair( const_iterator( inline_elts.data()+index ), true );
+            }
+            // Inline is full: move everything out
+            spill.insert( inline_elts.begin(), inline_elts.begin()+num_inline );
+            ClearInline();
+        }
+        auto spill_result = spill.insert( x );
+        return make_pair( const_iterator( spill_result.first ), spill_result.second );
+    }
+
+    size_t erase( const T &x )
+    {
+        if( !spill.empty() )
+        {
+            if( spill.erase(x) == 0 )
+                return 0;
+            if( spill.size() <= N ) // Fits again: move back in
+            {
+                copy( spill.begin(), spill.end(), inline_elts.begin() );
+                num_inline = spill.size();
+                spill.clear();
+            }
+            return 1;
+        }
+
+        const T *p = lower_bound( inline_elts.data(), inline_elts.data()+num_inline, x );
+        size_t index = p - inline_elts.data();
+        if( index == num_inline || x < *p )
+            return 0;
+        for( size_t i=index; i+1<num_inline; i++ )
+            inline_elts[i] = inline_elts[i+1];
+        inline_elts[--num_inline] = T(); // drop any reference held
+        return 1;
+    }
+
+    void clear()
+    {
+        ClearInline();
+        spill.clear();
+    }
+
+    bool operator==( const InlineSet &other ) const
+    {
+        return size() == other.size() && equal( begin(), end(), other.begin() );
+    }
+
+private:
+    void ClearInline()
+    {
+        for( size_t i=0; i<num_inline; i++ )
+            inline_elts[i] = T();
+        num_inline = 0;
+    }
+
+    array<T, N> inline_elts;
+    size_t num_inline = 0;
+    set<T> spill;
+};
+
+
+template<typename T, size_t N>
+string Trace(const InlineSet<T, N> &s)
+{
+    list<string> elts;
+    for( const auto &x : s )
+        elts.push_back( Trace(x) );
+    return Join( elts, CONTAINER_SEP, "{", "}" );
+}
+
+#endif
@@ -0,0 +1,281 @@
+#include "profiler.hpp"
+#include "trace.hpp"
+
+#include <new>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <cstdio>
+#include <time.h>
+#include <sys/resource.h>
+
+// Counting allocations means replacing the global operator new for the 
+// whole program, so it's opt-in. Without it, the reports have no 
+// allocation columns.
+//#define PROFILE_ALLOCATIONS
+
+// Allocation counts for the current thread, maintained by our global
+// operator new whether or not profiling is enabled (it's cheaper than
+// testing). Plain data, so there's no dynamic initialisation to worry
+// about in operator new.
+static thread_local unsigned long thread_num_allocs = 0;
+static thread_local unsigned long thread_num_alloc_bytes = 0;
+
+// Chrome trace events want a small thread number
+static atomic<int> next_thread_number(0);
+static thread_local int thread_number = next_thread_number++;
+
+static chrono::steady_clock::time_point epoch = chrono::steady_clock::now();
+
+
+#ifdef PROFILE_ALLOCATIONS
+void *operator new( size_t size )
+{
+    thread_num_allocs++;
+    thread_num_alloc_bytes += size;
+    while(true)
+    {
+        if( void *p = malloc( size ? size : 1 ) )
+            return p;
+        new_handler handler = get_new_handler();
+        if( !handler )
+            throw bad_alloc();
+        handler();
+    }
+}
+
+
+void operator delete( void *p ) noexcept
+{
+    free( p );
+}
+
+
+void operator delete( void *p, size_t ) noexcept
+{
+    free( p );
+}
+#endif
+
+// ------------------------- Profiler --------------------------
+
+bool Profiler::enabled = false;
+bool Profiler::chrome_trace = false;
+string Profiler::path;
+mutex Profiler::profiler_mutex;
+map<pair<Progress, Profiler::Kind>, Profiler::Totals> Profiler::totals;
+vector<Profiler::TraceEvent> Profiler::trace_events;
+
+
+void Profiler::Enable( string path_, bool chrome_trace_ )
+{
+    ASSERTS( !enabled );
+    enabled = true;
+    epoch = chrono::steady_clock::now();
+    chrome_trace = chrome_trace_;
+    path = path_;
+    // Includes quitting via exit() eg after -q
+    atexit( WriteReports );
+}
+
+
+void Profiler::WriteReports()
+{
+    lock_guard<mutex> lock( profiler_mutex );
+    WriteJSON( path + ".json" );
+    WriteCSV( path + ".csv" );
+    if( chrome_trace )
+        WriteChromeTrace( path + ".trace.json" );
+}
+
+
+// Labels are step names and stage texts, but be careful anyway
+static string QuoteJSON( string s )
+{
+    string q = "\"";
+    for( char c : s )
+    {
+        if( c=='"' || c=='\\' )
+            q += '\\';
+        if( c >= ' ' )
+            q += c;
+    }
+    return q + "\"";
+}
+
+
+static string QuoteCSV( string s )
+{
+    string q = "\"";
+    for( char c : s )
+    {
+        if( c=='"' )
+            q += '"';
+        q += c;
+    }
+    return q + "\"";
+}
+
+
+// We're called at exit, so a report we can't write only gets a warning
+static FILE *OpenReportFile( string filepath )
+{
+    FILE *fp = fopen( filepath.c_str(), "wt" );
+    if( !fp )
+        fprintf(stderr, "Warning: cannot write profile file %s\n", filepath.c_str());
+    return fp;
+}
+
+
+void Profiler::WriteJSON( string filepath )
+{
+    FILE *fp = OpenReportFile( filepath );
+    if( !fp )
+        return;
+    fprintf( fp, "{\n  \"spans\": [" );
+    bool first = true;
+    for( const auto &p : totals )
+    {
+        const Totals &t = p.second;
+        string allocs;
+#ifdef PROFILE_ALLOCATIONS
+        allocs = SSPrintf("\"allocs\": %lu, \"alloc_bytes\": %lu, ", t.num_allocs, t.num_alloc_bytes);
+#endif
+        fprintf( fp, "%s\n    { \"progress\": %s, \"kind\": %s, \"label\": %s, "
+                     "\"count\": %lu, \"wall_us\": %.0f, \"cpu_us\": %.0f, "
+                     "%s\"peak_rss_kb\": %ld }",
+                 first ? "" : ",",
+                 QuoteJSON(p.first.first.GetPrefix()).c_str(), QuoteJSON(GetKindName(p.first.second)).c_str(),
+                 QuoteJSON(t.label).c_str(), t.count, t.wall_us, t.cpu_us,
+                 allocs.c_str(), t.peak_rss_kb );
+        first = false;
+    }
+    fprintf( fp, "\n  ]\n}\n" );
+    fclose( fp );
+}
+
+
+void Profiler::WriteCSV( string filepath )
+{
+    FILE *fp = OpenReportFile( filepath );
+    if( !fp )
+        return;
+#ifdef PROFILE_ALLOCATIONS
+    fprintf( fp, "progress,kind,label,count,wall_us,cpu_us,allocs,alloc_bytes,peak_rss_kb\n" );
+#else
+    fprintf( fp, "progress,kind,label,count,wall_us,cpu_us,peak_rss_kb\n" );
+#endif
+    for( const auto &p : totals )
+    {
+        const Totals &t = p.second;
+        string allocs;
+#ifdef PROFILE_ALLOCATIONS
+        allocs = SSPrintf("%lu,%lu,", t.num_allocs, t.num_alloc_bytes);
+#endif
+        fprintf( fp, "%s,%s,%s,%lu,%.0f,%.0f,%s%ld\n",
+                 p.first.first.GetPrefix().c_str(), GetKindName(p.first.second).c_str(),
+                 QuoteCSV(t.label).c_str(), t.count, t.wall_us, t.cpu_us,
+                 allocs.c_str(), t.peak_rss_kb );
+    }
+    fclose( fp );
+}
+
+
+void Profiler::WriteChromeTrace( string filepath )
+{
+    FILE *fp = OpenReportFile( filepath );
+    if( !fp )
+        return;
+    fprintf( fp, "{\n  \"traceEvents\": [" );
+    bool first = true;
+    for( const TraceEvent &e : trace_events )
+    {
+        // Complete events: begin and duration in one
+        fprintf( fp, "%s\n    { \"name\": %s, \"cat\": %s, \"ph\": \"X\", "
+                     "\"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %d }",
+                 first ? "" : ",",
+                 QuoteJSON(e.name).c_str(), QuoteJSON(GetKindName(e.kind)).c_str(),
+                 e.start_us, e.duration_us, e.thread_number );
+        first = false;
+    }
+    fprintf( fp, "\n  ],\n  \"displayTimeUnit\": \"ms\"\n}\n" );
+    fclose( fp );
+}
+
+
+string Profiler::GetKindName( Kind kind )
+{
+    switch( kind )
+    {
+    case Kind::STAGE:
+        return "stage";
+    case Kind::STEP:
+        return "step";
+    case Kind::SCR_HIT:
+        return "scr_hit";
+    case Kind::SCR_MISS:
+        return "scr_miss";
+    case Kind::SOLVER_RUN:
+        return "solver_run";
+    }
+    ASSERTFAILS("Unknown profiler kind");
+}
+
+// ------------------------- Span --------------------------
+
+Profiler::Span::Span( Kind kind_, string label_, Progress progress_ ) :
+    enabled( Profiler::enabled ),
+    kind( kind_ )
+{
+    if( !enabled )
+        return;
+    label = label_;
+    progress = progress_;
+    start = GetSample();
+}
+
+
+Profiler::Span::~Span()
+{
+    if( !enabled )
+        return;
+    Sample end = GetSample();
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+
+    lock_guard<mutex> lock( profiler_mutex );
+    Totals &t = totals[make_pair(progress, kind)];
+    if( t.count == 0 )
+        t.label = label;
+    t.count++;
+    t.wall_us += end.wall_us - start.wall_us;
+    t.cpu_us += end.cpu_us - start.cpu_us;
+    t.num_allocs += end.num_allocs - start.num_allocs;
+    t.num_alloc_bytes += end.num_alloc_bytes - start.num_alloc_bytes;
+    t.peak_rss_kb = max( t.peak_rss_kb, (long)usage.ru_maxrss ); // high-water mark so far
+
+    if( chrome_trace && (kind==Kind::STAGE || kind==Kind::STEP || kind==Kind::SCR_HIT) )
+    {
+        string name = label.empty() ? progress.GetPrefix() : progress.GetPrefix() + " " + label;
+        trace_events.push_back( { kind, name, start.wall_us, end.wall_us - start.wall_us, thread_number } );
+    }
+}
+
+
+void Profiler::Span::SetKind( Kind kind_ )
+{
+    kind = kind_;
+}
+
+
+Profiler::Span::Sample Profiler::Span::GetSample()
+{
+    Sample sample;
+    sample.wall_us = chrono::duration<double, micro>( chrono::steady_clock::now() - epoch ).count();
+    struct timespec ts;
+    clock_gettime( CLOCK_THREAD_CPUTIME_ID, &ts );
+    sample.cpu_us = ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+    sample.num_allocs = thread_num_allocs;
+    sample.num_alloc_bytes = thread_num_alloc_bytes;
+    return sample;
+}
@@ -0,0 +1,99 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include "standard.hpp"
+#include "progress.hpp"
+
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+
+// Built-in profiling, enabled with -tp. Measures spans of execution:
+// wall-clock time, CPU time and allocations (count and bytes, counted in
+// global operator new if built with PROFILE_ALLOCATIONS) of the calling 
+// thread, and peak RSS of the process at the end of the span. Peak RSS 
+// is the process's high-water mark so far, so it never goes down and 
+// isn't attributable to the span. Spans are totalled by Progress (stage and step)
+// and kind. A span includes the spans nested inside it, eg a step includes
+// its SCR hits, which include their solver runs. At exit we write
+// <path>.json and <path>.csv and, with -tc, a Chrome trace-event file
+// <path>.trace.json of the stage, step and hit spans (solver runs and
+// misses are too numerous for that).
+class Profiler
+{
+public:
+    enum class Kind
+    {
+        STAGE,
+        STEP,
+        SCR_HIT,    // SCREngine::SingleCompareReplace() that hit
+        SCR_MISS,   // ... that didn't hit
+        SOLVER_RUN  // CSP solver run by an and-rule engine
+    };
+
+    // Measures from construction to destruction. Does nothing unless
+    // enabled. Progress defaults to the current one at construction.
+    class Span
+    {
+    public:
+        explicit Span( Kind kind, string label = string(), Progress progress = Progress::GetCurrent() );
+        ~Span();
+        void SetKind( Kind kind ); // eg when we find out it was a hit
+
+    private:
+        struct Sample
+        {
+            double wall_us;
+            double cpu_us;
+            unsigned long num_allocs;
+            unsigned long num_alloc_bytes;
+        };
+        static Sample GetSample();
+
+        const bool enabled;
+        Kind kind;
+        string label;
+        Progress progress;
+        Sample start;
+    };
+
+    // Reports are written to <path>.* when the program exits
+    static void Enable( string path, bool chrome_trace );
+
+private:
+    struct Totals
+    {
+        string label;
+        unsigned long count = 0;
+        double wall_us = 0.0;
+        double cpu_us = 0.0;
+        unsigned long num_allocs = 0;
+        unsigned long num_alloc_bytes = 0;
+        long peak_rss_kb = 0; // process-wide, at the end of the latest span
+    };
+
+    struct TraceEvent
+    {
+        Kind kind;
+        string name;
+        double start_us;
+        double duration_us;
+        int thread_number;
+    };
+
+    static void WriteReports();
+    static void WriteJSON( string filepath );
+    static void WriteCSV( string filepath );
+    static void WriteChromeTrace( string filepath );
+    static string GetKindName( Kind kind );
+
+    static bool enabled;
+    static bool chrome_trace;
+    static string path;
+    static mutex profiler_mutex; // concurrent planning jobs
+    static map<pair<Progress, Kind>, Totals> totals;
+    static vector<TraceEvent> trace_events;
+};
+
+#endif
@@ -63,7 +63,9 @@ string Progress::GetPrefix(int width) const
             return stage_code + string( width_after_stage_code, ' ');
     
     case STEPPY:        
-         if( width==0 )
+         if( step==NO_STEP ) // eg the whole stage
+             return stage_code + string( width_after_stage_code, ' ');
+         else if( width==0 )
              return stage_code + to_string(step);   
          else
              return stage_code + SSPrintf( "%0"+to_string(width_after_stage_code)+"d", step );
@@ -129,5 +131,5 @@ const map<Progress::Stage, Progress::StageInfoBlock> Progress::stage_info =
 
 
 // MMAX is actually created at init time, so pretend that's part of step building time
-Progress Progress::current = BUILDING_STEPS;
+thread_local Progress Progress::current = BUILDING_STEPS;
 
@@ -71,7 +71,7 @@ private:
     };
 
     static const map<Stage, StageInfoBlock> stage_info;
-    static Progress current;
+    static thread_local Progress current; // each planning job has its own
 };
 
 #endif
@@ -12,6 +12,7 @@ using namespace std;
 string ReadArgs::exename;
 list<string> ReadArgs::vn_paths;
 string ReadArgs::input_x_path;
+list<string> ReadArgs::batch_paths;
 string ReadArgs::output_x_path;
 bool ReadArgs::intermediate_graph = false;
 int ReadArgs::pattern_graph_index = -1; // -1 disables
@@ -25,9 +26,14 @@ bool ReadArgs::trace_hits = false;
 bool ReadArgs::trace_quiet = false;
 bool ReadArgs::trace_no_stack = false;
 string ReadArgs::hits_format;
+string ReadArgs::profile_path = ""; // "" disables
+bool ReadArgs::profile_chrome_trace = false;
 bool ReadArgs::test_units = false;
 bool ReadArgs::test_csp = false;
 bool ReadArgs::test_db = false;
+bool ReadArgs::test_fixpoint = false;
+ReadArgs::CheckLevel ReadArgs::check_level = ReadArgs::CheckLevel::FULL; // default behaviour
+int ReadArgs::check_sample_interval = 10; // default behaviour
 int ReadArgs::runonlystep = 0; 
 bool ReadArgs::runonlyenable = false; 
 bool ReadArgs::quitafter = false;
@@ -36,6 +42,7 @@ vector<int> ReadArgs::quitafter_counts;
 bool ReadArgs::quitafter_still_do_lowering = false;
 int ReadArgs::repetitions = 100; // default behaviour
 bool ReadArgs::rep_error = true; // default behaviour
+int ReadArgs::jobs = 1; // default behaviour
 bool ReadArgs::documentation_graphs = false;
 bool ReadArgs::output_all = false;
 set<string> ReadArgs::use;
@@ -49,14 +56,30 @@ void ReadArgs::Usage(string msg)
                     "<vn_path>       Run this Vida Nova script.\n"
                     "-i<input_path>  Read input program (C/C++) from <input_x_path>.\n"
                     "-o<output_path> Write output program to <output_x_path>. C/C++ by default. Writes to stdout if omitted.\n"
+                    "-b<input_path>  Add input program or directory of programs to a batch. Planning is done once for\n"
+                    "                the batch. <output_path> is a directory, under which each output goes at its\n"
+                    "                input's path. Without -o, all output goes to stdout, each after a // comment\n"
+                    "                naming its input.\n"
                     "-t          Turn on tracing internals (very verbose).\n"                    
                     "-th<fmt>    Dump hit counts at the end of execution based on <fmt>.\n"
                     "            Note: use -th? for help on <fmt>.\n"
                     "-tq         No output to console.\n"
                     "-ts         Trace but don't show mini-stacks (for when re-architecting).\n"
+                    "-tp<path>   Profile time, allocations and peak RSS per stage, step, hit and solver run.\n"
+                    "            Writes <path>.json and <path>.csv at exit.\n"
+                    "            Peak RSS is the process's high-water mark so far. Allocations are only\n"
+                    "            counted (and reported) if built with PROFILE_ALLOCATIONS, which replaces\n"
+                    "            operator new.\n"
+                    "-tc<path>   As -tp and also write a Chrome trace-event file <path>.trace.json.\n"
                     "-su         Run unit tests and quit.\n"
                     "-sc         Enable CSP solver self-test.\n"
                     "-sd         Enable DB self-checks: relation integrity and compare with new build.\n"
+                    "            These run on every update, whatever -check says.\n"
+                    "-sf         Enable fixpoint self-check: once a fixpoint group settles, run each of its steps\n"
+                    "            again and check that none of them changes anything.\n"
+                    "-check=<l>  Level of internal consistency checks in the X tree database and tree update:\n"
+                    "            none, sample or full (default). sample runs each check on a random one in 10\n"
+                    "            occasions, or use sample:<n> for one in <n>.\n"
                     "-q<p>.<c>...   Stop after stage+step <p>, and optional match count(s) <c>. Eg -qA\n"
                     "               to stop after analysis, or -qT12.2.3 to stop after transformation 12,\n"
                     "               root match 2, first embedded match 3. Append + to still run the lowering steps.\n"    
@@ -73,8 +96,14 @@ void ReadArgs::Usage(string msg)
                     "            or number, or generate all into a directory if name ends in /.\n"
                     "-rn<n>      Stop search and replace after n repetitions and do not generate an error.\n"
                     "-re<n>      Stop search and replace after n repetitions and do generate an error.\n"
+                    "-j<n>       Pattern transform and plan up to <n> steps concurrently. Ignored with -t.\n"
                     "-f          Output all intermediates: .cpp and .dot. <output_x_path> is path/basename.\n"
                     "-u<x>       Use feature x.\n"
+                    "            Note: -uresume resumes searching near the changes made by the previous hit.\n"
+                    "            Note: -ubatch gathers further matches during a search and tries them first.\n"
+                    "            -ubatch and -uresume cannot be used together.\n"
+                    "            Note: -ubdd and -utruthtable force the symbolic solver's choice of backend.\n"
+                    "            Otherwise it uses BDDs for expressions of more than 10 predicates.\n"
                     "Hint: use eg I=-sd or I=\"-sd -t\" with make\n",
                     exename.c_str() );
     exit(1);
@@ -117,6 +146,10 @@ ReadArgs::ReadArgs( int ac, char *av[] )
         {
             input_x_path = GetArg();
         }
+        else if( option=='b' )
+        {
+            batch_paths.push_back( GetArg() );
+        }
         else if( option=='o' )
         {
             output_x_path = GetArg();
@@ -142,6 +175,15 @@ ReadArgs::ReadArgs( int ac, char *av[] )
                 trace = true;
                 trace_no_stack = true;
             }
+            else if( trace_option=='p' )
+            {
+                profile_path = GetArg(2);
+            }
+            else if( trace_option=='c' )
+            {
+                profile_chrome_trace = true;
+                profile_path = GetArg(2);
+            }
             else
             {
                 Usage("Unknown argument after -t");
@@ -221,6 +263,8 @@ ReadArgs::ReadArgs( int ac, char *av[] )
                 test_csp = true;
             else if( assert_option=='d' )
                 test_db = true;
+            else if( assert_option=='f' )
+                test_fixpoint = true;
             else
                 Usage("Unknown argument after -s");
         }
@@ -233,6 +277,16 @@ ReadArgs::ReadArgs( int ac, char *av[] )
             runonlystep = strtoul( GetArg().c_str(), nullptr, 10 );
             runonlyenable = true;
         }
+        else if( option=='j' )
+        {
+            jobs = strtoul( GetArg().c_str(), nullptr, 10 );
+            if( jobs < 1 )
+                Usage("Need at least one job for -j");
+        }
+        else if( string(argv[curarg]).rfind("-check=", 0)==0 )
+        {
+            ParseCheckLevel( string(argv[curarg]+7) );
+        }
         else if( option=='f' )
         {
             output_all = true;
@@ -247,6 +301,10 @@ ReadArgs::ReadArgs( int ac, char *av[] )
             Usage( string("Unknown option: ") + string(argv[curarg]) );
         }
     }    
+    
+    // Both pick where the next search starts, so only one can be in charge
+    if( use.contains("batch") && use.contains("resume") )
+        Usage("-ubatch and -uresume cannot be used together");
 }
 
 // quitafter syntax
@@ -291,3 +349,35 @@ void ReadArgs::ParseQuitAfter(string arg)
         first = false;
     } while( dot != string::npos );
 }
+
+
+// check level syntax
+// "none", "full", "sample" or "sample:<n>"
+void ReadArgs::ParseCheckLevel(string arg)
+{
+    if( arg=="none" )
+    {
+        check_level = CheckLevel::NONE;
+    }
+    else if( arg=="full" )
+    {
+        check_level = CheckLevel::FULL;
+    }
+    else if( arg.rfind("sample", 0)==0 )
+    {
+        check_level = CheckLevel::SAMPLE;
+        string s = arg.substr(6);
+        if( !s.empty() )
+        {
+            if( s[0] != ':' )
+                Usage("Unknown check level: " + arg);
+            check_sample_interval = strtoul( s.substr(1).c_str(), nullptr, 10 );
+            if( check_sample_interval < 1 )
+                Usage("Need a sample interval of at least 1 for -check=sample:<n>");
+        }
+    }
+    else
+    {
+        Usage("Unknown check level: " + arg);
+    }
+}
@@ -26,6 +26,7 @@ public:
     static string exename;
     static list<string> vn_paths;
     static string input_x_path;
+    static list<string> batch_paths;
     static string output_x_path;
     static bool intermediate_graph;
     static int pattern_graph_index;
@@ -39,6 +40,8 @@ public:
     static bool trace_quiet;   
     static bool trace_no_stack; 
     static string hits_format;
+    static string profile_path;
+    static bool profile_chrome_trace;
     static bool quitafter;
     static Progress quitafter_progress;
     static vector<int> quitafter_counts;
@@ -47,15 +50,21 @@ public:
     static bool runonlyenable;
     static int repetitions;
     static bool rep_error;
+    static int jobs;
     static bool test_units;
     static bool test_csp;
     static bool test_db;
+    static bool test_fixpoint;
+    enum class CheckLevel { NONE, SAMPLE, FULL };
+    static CheckLevel check_level;
+    static int check_sample_interval;
     static bool documentation_graphs;
     static bool output_all;
     static set<string> use;
     
 private:
     void ParseQuitAfter(string arg);
+    void ParseCheckLevel(string arg);
     int curarg;
     char **argv;
     int argc;
@@ -16,13 +16,16 @@ SerialNumber::SerialNumber()
 	// Some clients are static, and we don't want to depend on init order.
 	// So, we manage the cache (with refcounting) explicitly on top of 
 	// static members that are compatible with system init-to-zero.
+    lock_guard<mutex> lock( cache_mutex );
     if( !cache )
 		cache = new Cache;
 	cache_refs++;
 	//FTRACE("Cons: cache %p refs %u\n", cache, cache_refs);
-	SNType &sr = cache->main_serial_by_progress[progress];
 	
+	// Concurrent planning jobs count separately for each step, so that 
+	// the numbering within a step doesn't depend on how they interleave.
     progress = Progress::GetCurrent();   
+	SNType &sr = cache->main_serial_by_progress[count_per_progress ? progress : Progress()];
     serial = sr;
     
     // produce a new construction serial number
@@ -33,6 +36,7 @@ SerialNumber::SerialNumber()
 SerialNumber::~SerialNumber()
 {
 	//FTRACE("Des: cache %p refs %u\n", cache, cache_refs);
+    lock_guard<mutex> lock( cache_mutex );
 	ASSERT( cache );
 	if( --cache_refs==0 )
 	{
@@ -66,7 +70,7 @@ Orderable::Diff SerialNumber::Compare3WayIdentity(const SerialNumber &l, const S
 
 SerialNumber::SNType SerialNumber::GetSerialNumber() const 
 {
-    return serial; // This is enough for uniqueness
+    return serial; // Unique within the progress it was constructed during
 }
 
 
@@ -97,6 +101,8 @@ shared_ptr<SerialNumber::Hook> SerialNumber::GetHook() const
 // No initialsiers for these two: rely on system zero-init of statics
 SerialNumber::Cache *SerialNumber::cache;
 unsigned SerialNumber::cache_refs;
+mutex SerialNumber::cache_mutex; // constexpr constructor, so also safe for static clients
+thread_local bool SerialNumber::count_per_progress;
 
 //////////////////////////// SatelliteSerial ///////////////////////////////
 
@@ -157,9 +163,7 @@ Orderable::Diff SatelliteSerial::Compare3WayIdentity(const SatelliteSerial &l, c
 
 int SatelliteSerial::MotherBlock::AssignSerial(const SatelliteSerial *)
 {
-    int ns = next_serial;
-    next_serial++;
-    return ns;
+    return next_serial++;
 }
 
 
@@ -170,6 +174,8 @@ shared_ptr<SatelliteSerial::MotherBlock> SatelliteSerial::GetMotherBlock( const
         return nullptr;
     }
     
+    // Concurrent planning jobs can share nodes, eg archetypes
+    lock_guard<mutex> lock( mother_block_mutex );
     shared_ptr<MotherBlock> mother_block;
     if( mother->HasHook() )
     {
@@ -186,6 +192,9 @@ shared_ptr<SatelliteSerial::MotherBlock> SatelliteSerial::GetMotherBlock( const
 }
 
 
+mutex SatelliteSerial::mother_block_mutex;
+
+
 //////////////////////////// LeakCheck ///////////////////////////////
 
 LeakCheck::LeakCheck() :
@@ -11,6 +11,8 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
+#include <atomic>
 
 using namespace std;
 
@@ -59,6 +61,25 @@ public:
     bool HasHook() const;
     shared_ptr<Hook> GetHook() const;
     
+    // Normally there is one count for everything. While one of these is in 
+    // scope, objects constructed by this thread are counted separately for 
+    // each Progress, so that concurrent jobs give repeatable serials.
+    class RAIICountPerProgress
+    {
+    public:
+        inline RAIICountPerProgress() :
+            old_count_per_progress(count_per_progress)
+        {
+            count_per_progress = true;
+        }
+        inline ~RAIICountPerProgress()
+        {
+            count_per_progress = old_count_per_progress;
+        }
+    private:
+        const bool old_count_per_progress;
+    };
+    
 private:    
     SNType serial;
     Progress progress;
@@ -69,6 +90,8 @@ private:
     };
     static Cache *cache; 
     static unsigned cache_refs; 
+    static mutex cache_mutex; // nodes may be constructed by concurrent planning jobs
+    static thread_local bool count_per_progress;
     
     mutable shared_ptr<Hook> hook;
 };
@@ -95,11 +118,12 @@ private:
     // These are hooked to the mother SerialNumber instance
     struct MotherBlock : SerialNumber::Hook
     {
-        int next_serial=0;
+        atomic<int> next_serial{0};
         int AssignSerial(const SatelliteSerial *ss_for_trace);
     };  
 
     static shared_ptr<MotherBlock> GetMotherBlock( const SerialNumber *mother, const void *satellite );
+    static mutex mother_block_mutex;
 
     // Ordinary pointer is OK as long as we keep mother object alive, which
     // we do if used with TreePtr
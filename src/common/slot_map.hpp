@@ -0,0 +1,258 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include "standard.hpp"
+#include "trace.hpp"
+
+#include <deque>
+#include <vector>
+#include <functional>
+#include <bit>
+
+// Map whose elements are stored in slots in chunks of contiguous memory, 
+// rather than in a node each. The index is an open-addressed hash table of
+// slot numbers, compared against the keys held in the slots, so there is no
+// per-key allocation. Erased slots go on a free list and are re-used first,
+// and free slots at the end are given back, so the slots stay about as 
+// dense as the elements allow. References to elements stay valid until that
+// element is erased, as for std::unordered_map. Iteration is in slot order, 
+// skipping empty slots. Elements can only be reached through const 
+// iterators, but at() and [] give mutable access to the mapped value.
+template<typename K, typename V>
+class SlotMap
+{
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef pair<K, V> value_type;
+
+    class const_iterator
+    {
+    public:
+        const_iterator( const SlotMap *map_, size_t slot_ ) :
+            map( map_ ),
+            slot( slot_ )
+        {
+            SkipEmpty();
+        }
+        const value_type &operator*() const { return map->slots[slot]; }
+        const value_type *operator->() const { return &map->slots[slot]; }
+        const_iterator &operator++() { slot++; SkipEmpty(); return *this; }
+        bool operator==( const const_iterator &other ) const { return slot == other.slot; }
+        bool operator!=( const const_iterator &other ) const { return slot != other.slot; }
+
+    private:
+        void SkipEmpty()
+        {
+            while( slot < map->slots.size() && !map->occupied[slot] )
+                slot++;
+        }
+        const SlotMap *map;
+        size_t slot;
+    };
+    typedef const_iterator iterator;
+
+    const_iterator begin() const
+    {
+        return const_iterator( this, 0 );
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator( this, slots.size() );
+    }
+
+    size_t size() const
+    {
+        return num_elements;
+    }
+
+    bool empty() const
+    {
+        return num_elements == 0;
+    }
+
+    size_t count( const K &key ) const
+    {
+        return index[Find(key)] == NO_SLOT ? 0 : 1;
+    }
+
+    const V &at( const K &key ) const
+    {
+        size_t slot = index[Find(key)];
+        ASSERTS( slot != NO_SLOT )("SlotMap::at() key not found");
+        return slots[slot].second;
+    }
+
+    V &at( const K &key )
+    {
+        size_t slot = index[Find(key)];
+        ASSERTS( slot != NO_SLOT )("SlotMap::at() key not found");
+        return slots[slot].second;
+    }
+
+    // Default-constructs the value if not already there
+    V &operator[]( const K &key )
+    {
+        size_t bucket = Find(key);
+        if( index[bucket] != NO_SLOT )
+            return slots[index[bucket]].second;
+        return slots[Allocate( bucket, value_type(key, V()) )].second;
+    }
+
+    pair<const_iterator, bool> insert( const value_type &p )
+    {
+        size_t bucket = Find(p.first);
+        if( index[bucket] != NO_SLOT )
+            return make_pair( const_iterator(this, index[bucket]), false );
+        return make_pair( const_iterator(this, Allocate(bucket, p)), true );
+    }
+
+    size_t erase( const K &key )
+    {
+        size_t bucket = Find(key);
+        size_t slot = index[bucket];
+        if( slot == NO_SLOT )
+            return 0;
+        Unindex( bucket );
+        num_elements--;
+        slots[slot] = value_type(); // drop any references held
+        occupied[slot] = false;
+        free_slots.push_back(slot);
+        
+        // Give back free slots at the end. Popping a deque doesn't move
+        // any other element. Their entries in free_slots go stale, and
+        // are skipped when popped. Drop them all if they build up.
+        while( !slots.empty() && !occupied.back() )
+        {
+            slots.pop_back();
+            occupied.pop_back();
+        }
+        while( !free_slots.empty() && free_slots.back() >= slots.size() )
+            free_slots.pop_back();
+        if( free_slots.size() > slots.size() - num_elements )
+            PurgeFreeSlots();
+        return 1;
+    }
+
+    void clear()
+    {
+        slots.clear();
+        occupied.clear();
+        free_slots.clear();
+        num_elements = 0;
+        Rehash( MIN_INDEX_SIZE );
+    }
+
+private:
+    static const size_t NO_SLOT = SIZE_MAX;
+    static const size_t MIN_INDEX_SIZE = 16; // power of 2
+
+    // Hashes of pointers go up in steps, so scramble them (Fibonacci hashing)
+    // and use the top bits
+    size_t GetHome( const K &key ) const
+    {
+        return ((uint64_t)hash<K>()(key) * 0x9E3779B97F4A7C15ull) >> index_shift;
+    }
+
+    // Bucket holding key's slot, or the empty bucket where it would go
+    size_t Find( const K &key ) const
+    {
+        size_t mask = index.size()-1;
+        for( size_t bucket = GetHome(key); ; bucket = (bucket+1) & mask )
+            if( index[bucket] == NO_SLOT || slots[index[bucket]].first == key )
+                return bucket;
+    }
+
+    size_t Allocate( size_t bucket, const value_type &p )
+    {
+        size_t slot = NO_SLOT;
+        while( slot == NO_SLOT && !free_slots.empty() )
+        {
+            size_t s = free_slots.back();
+            free_slots.pop_back();
+            if( s < slots.size() && !occupied[s] )
+                slot = s;
+        }
+        if( slot == NO_SLOT )
+        {
+            slot = slots.size();
+            slots.push_back(p);  // deque: no existing element moves
+            occupied.push_back(true);
+        }
+        else
+        {
+            slots[slot] = p;
+            occupied[slot] = true;
+        }
+        num_elements++;
+        
+        // Keep the index at most half full so probe sequences stay short
+        if( 2*num_elements > index.size() )
+            Rehash( 2*index.size() );
+        else
+            index[bucket] = slot;
+        return slot;
+    }
+
+    // Linear probing lets us close the gap instead of leaving a tombstone: 
+    // later entries in the run move back if that's no further from home
+    void Unindex( size_t bucket )
+    {
+        size_t mask = index.size()-1;
+        size_t gap = bucket;
+        for( size_t b = (gap+1) & mask; index[b] != NO_SLOT; b = (b+1) & mask )
+        {
+            size_t home = GetHome(slots[index[b]].first);
+            if( ((b - home) & mask) >= ((b - gap) & mask) )
+            {
+                index[gap] = index[b];
+                gap = b;
+            }
+        }
+        index[gap] = NO_SLOT;
+    }
+
+    void Rehash( size_t new_size )
+    {
+        index.assign( new_size, NO_SLOT );
+        index_shift = 64 - countr_zero( (uint64_t)new_size );
+        for( size_t slot=0; slot<slots.size(); slot++ )
+            if( occupied[slot] )
+                index[Find(slots[slot].first)] = slot;
+    }
+
+    void PurgeFreeSlots()
+    {
+        vector<bool> seen( slots.size(), false );
+        vector<size_t> purged;
+        for( size_t s : free_slots )
+        {
+            if( s < slots.size() && !occupied[s] && !seen[s] )
+            {
+                seen[s] = true;
+                purged.push_back(s);
+            }
+        }
+        free_slots.swap(purged);
+    }
+
+    vector<size_t> index = vector<size_t>( MIN_INDEX_SIZE, NO_SLOT );
+    unsigned index_shift = 64 - countr_zero( (uint64_t)MIN_INDEX_SIZE );
+    deque<value_type> slots;
+    vector<bool> occupied;
+    vector<size_t> free_slots; // used as a stack, may hold stale entries
+    size_t num_elements = 0;
+};
+
+
+template<typename K, typename V>
+string Trace(const SlotMap<K, V> &m)
+{
+    list<string> elts;
+    for( const auto &p : m )
+        elts.push_back( Trace(p.first) + ": " + Trace(p.second) );
+    return Join( elts, CONTAINER_SEP, "{", "}" );
+}
+
+#endif
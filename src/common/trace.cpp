@@ -319,12 +319,12 @@ void Tracer::MaybePrintBanner()
     }    
 }
 
-bool Tracer::require_endl_at_destruct = false;
-bool Tracer::require_banner = true;
-bool Tracer::enable = false; ///< call Tracer::Enable(true) to begin tracing
-bool Tracer::disable = false;
-string Tracer::Descend::pre;
-string Tracer::Descend::last_traced_pre, Tracer::Descend::leftmost_pre;
+thread_local bool Tracer::require_endl_at_destruct = false;
+thread_local bool Tracer::require_banner = true;
+thread_local bool Tracer::enable = false; ///< call Tracer::Enable(true) to begin tracing
+thread_local bool Tracer::disable = false;
+thread_local string Tracer::Descend::pre;
+thread_local string Tracer::Descend::last_traced_pre, Tracer::Descend::leftmost_pre;
 
 ////////////////////////// TraceTo //////////////////////////
 
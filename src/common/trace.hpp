@@ -328,8 +328,8 @@ public:
         ~Descend();
         static void Indent(string sprogress);
     private:
-        static string pre;
-        static string last_traced_pre, leftmost_pre;
+        static thread_local string pre;
+        static thread_local string last_traced_pre, leftmost_pre;
         const int os;
         const int num_exceptions;
         friend class Tracer;
@@ -364,10 +364,10 @@ private:
     string instance;
     const char * const function;
     Flags flags;
-    static bool require_endl_at_destruct;
-    static bool require_banner;
-    static bool enable;
-    static bool disable;
+    static thread_local bool require_endl_at_destruct;
+    static thread_local bool require_banner;
+    static thread_local bool enable;
+    static thread_local bool disable;
 };
 
 ////////////////////////// TraceTo //////////////////////////
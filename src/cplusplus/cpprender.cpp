@@ -31,6 +31,7 @@ string CppRender::RenderToString( TreePtr<Node> root )
     // Context is used for various lookups but does not need
     // to be a Scope.
     context = root; 
+    scope_index.reset();
     utils = make_unique<DefaultTransUtils>(context);
     trans_kit = TransKit{ utils.get() };
             
@@ -2,15 +2,20 @@
 #include "common/trace.hpp"
 
 
-SimpleCompare::SimpleCompare( Orderable::OrderProperty order_property_ ) :
-    order_property( order_property_ )
+SimpleCompare::SimpleCompare( Orderable::OrderProperty order_property_, 
+                              const ClassSource *class_source_ ) :
+    order_property( order_property_ ),
+    class_source( class_source_ )
 {
+    // Classes are only valid for TOTAL
+    ASSERT( !class_source || order_property == Orderable::TOTAL );
 }
 
 
 SimpleCompare &SimpleCompare::operator=(const SimpleCompare &other)
 {
     order_property = other.order_property;
+    class_source = other.class_source;
     return *this;
 }
 
@@ -48,40 +53,46 @@ Orderable::Diff SimpleCompare::Compare3Way( const Node &l, const Node &r ) const
     if( &l==&r )
         return 0;
         
+    // Same equivalence class means same structure, so no need to walk
+    if( class_source )
+    {
+        ClassSource::ClassId l_class = class_source->TryGetClass(l);
+        if( l_class && l_class == class_source->TryGetClass(r) )
+            return 0;
+    }
+        
     // Local comparison deals with node type and value if there is one
     if( Orderable::Diff cd = Node::OrderCompare3Way(l, r, order_property) )
         return cd;
 
     // Itemise them both and chuck out if sizes do not match
-    vector< Itemiser::Element * > l_items = l.Itemise();
-    vector< Itemiser::Element * > r_items = r.Itemise();
+    Itemiser::ElementTable l_items = l.GetItemiseTable();
+    Itemiser::ElementTable r_items = r.GetItemiseTable();
     int sd = (int)(l_items.size()) - (int)(r_items.size());
     if( sd != 0 )
         return sd; 
     
-    for( vector< Itemiser::Element * >::size_type i=0; i<l_items.size(); i++ )
+    for( size_t i=0; i<l_items.size(); i++ )
     {
-        ASSERT( l_items[i] )( "itemise returned null element");
-        ASSERT( r_items[i] )( "itemise returned null element");
-
-        if( SequenceInterface *l_seq = dynamic_cast<SequenceInterface *>(l_items[i]) )
+        ASSERT( l_items.GetKind(i) == r_items.GetKind(i) );
+        switch( l_items.GetKind(i) )
+        {
+        case Itemiser::ElementKind::SEQUENCE:
         {
-            SequenceInterface *r_seq = dynamic_cast<SequenceInterface *>(r_items[i]);
-            ASSERT( r_seq );
-            if( Orderable::Diff d = Compare3Way( *l_seq, *r_seq ) )            
+            if( Orderable::Diff d = Compare3Way( *l_items.GetSequence(i), *r_items.GetSequence(i) ) )            
                 return d;                
+            break;
         }
-        else if( CollectionInterface *l_col = dynamic_cast<CollectionInterface *>(l_items[i]) )
+        case Itemiser::ElementKind::COLLECTION:
         {
-            CollectionInterface *r_col = dynamic_cast<CollectionInterface *>(r_items[i]);
-            ASSERT( r_col );
-            if( Orderable::Diff d = Compare3Way( *l_col, *r_col ) )
+            if( Orderable::Diff d = Compare3Way( *l_items.GetCollection(i), *r_items.GetCollection(i) ) )
                 return d;                
+            break;
         }
-        else if( TreePtrInterface *l_singular = dynamic_cast<TreePtrInterface *>(l_items[i]) )
+        case Itemiser::ElementKind::SINGULAR:
         {
-            TreePtrInterface *r_singular = dynamic_cast<TreePtrInterface *>(r_items[i]);
-            ASSERT( r_singular );
+            TreePtrInterface *l_singular = l_items.GetSingular(i);
+            TreePtrInterface *r_singular = r_items.GetSingular(i);
             
             // MakeValueArchetype() can generate nodes with NULL pointers (eg in PointerIs)
             // and these get SimpleCompared even though they are not allowed in input trees.
@@ -92,10 +103,8 @@ Orderable::Diff SimpleCompare::Compare3Way( const Node &l, const Node &r ) const
             // Both non-null, so we are allowed to recurse
             if( Orderable::Diff d = Compare3Way( *(TreePtr<Node>)*l_singular, *(TreePtr<Node>)*r_singular ) )
                 return d;                
+            break;
         }
-        else
-        {
-            ASSERTFAIL("got something from itemise that isnt a Sequence, Collection or a TreePtr");
         }
     }
 
@@ -16,7 +16,18 @@ public:
     // Use a reference to SimpleCompare so derived classes can use it.
     typedef multiset<reference_wrapper<Node>, const SimpleCompare &> NodeOrdering;
 
-    SimpleCompare( Orderable::OrderProperty order_property = Orderable::TOTAL );
+    /// Optional source of equivalence classes for (sub)trees. Nodes with 
+    /// the same non-zero class are known to be equivalent under TOTAL,
+    /// so we can skip walking them. Zero means class not known.
+    class ClassSource
+    {
+    public:
+        typedef uint64_t ClassId;
+        virtual ClassId TryGetClass( const Node &node ) const = 0;
+    };
+
+    SimpleCompare( Orderable::OrderProperty order_property = Orderable::TOTAL, 
+                   const ClassSource *class_source = nullptr );
     SimpleCompare(const SimpleCompare&) = default;
     SimpleCompare &operator=(const SimpleCompare &other);
 
@@ -48,6 +59,7 @@ public:
 
 private:
     Orderable::OrderProperty order_property;
+    const ClassSource *class_source;
 };
 
 #endif
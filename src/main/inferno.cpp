@@ -7,6 +7,8 @@
 #include "vn/lang/render.hpp"
 #include "vn/graph/graph.hpp"
 #include "common/read_args.hpp"
+#include "common/consistency_check.hpp"
+#include "common/profiler.hpp"
 #include "helpers/walk.hpp"
 #include "tree/validate.hpp"
 #include "steps/split_instance_declarations.hpp"
@@ -30,6 +32,9 @@
 
 #include <cstdlib>
 #include <filesystem>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 //#define TEST_754
 //#define REPRODUCE_833
@@ -37,10 +42,16 @@
 using namespace Steps;
 
 // Build a vector of transformations, in the order that we will run them
-// (ordered by hand for now, until the auto sequencer is ready)
-void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence )
+// (ordered by hand for now, until the auto sequencer is ready). Runs of
+// steps that must be repeated until they stop changing anything are 
+// listed in fixpoint_groups, rather than being unrolled, so they only 
+// take up step indices once.
+void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence, 
+                           list<VNSequence::FixpointGroup> *fixpoint_groups )
 {
     ASSERT( sequence );
+    ASSERT( fixpoint_groups );
+    int group_first;
         
 #ifdef TEST_754
     sequence->push_back( make_shared<DroppedTreeZone>() );
@@ -102,16 +113,15 @@ void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence )
 	// Ineffectual gotos, unused and duplicate labels result from compound tidy-up after construct lowering, but if not 
 	// removed before AddGotoBeforeLabel, they will generate spurious states. We also remove dead code which can be exposed by
 	// removal of unused labels - we must repeat because dead code removal can generate unused labels.
-	for( int i=0; i<2; i++ )
-	{
-		sequence->push_back( make_shared<CleanupCompoundMulti>() );
-		sequence->push_back( make_shared<CleanupCompoundSingle>() );
-		sequence->push_back( make_shared<CleanupNop>() );
-		sequence->push_back( make_shared<CleanupUnusedLabels>() );
-		sequence->push_back( make_shared<CleanupDuplicateLabels>() );
-		sequence->push_back( make_shared<CleanupIneffectualLabels>() );
-		sequence->push_back( make_shared<CleanUpDeadCode>() );
-	}
+	group_first = sequence->size();
+	sequence->push_back( make_shared<CleanupCompoundMulti>() );
+	sequence->push_back( make_shared<CleanupCompoundSingle>() );
+	sequence->push_back( make_shared<CleanupNop>() );
+	sequence->push_back( make_shared<CleanupUnusedLabels>() );
+	sequence->push_back( make_shared<CleanupDuplicateLabels>() );
+	sequence->push_back( make_shared<CleanupIneffectualLabels>() );
+	sequence->push_back( make_shared<CleanUpDeadCode>() );
+	fixpoint_groups->push_back( { group_first, (int)sequence->size() } );
 #endif
 
 	{
@@ -138,16 +148,15 @@ void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence )
 	// Ineffectual gotos, unused and duplicate labels result from compound tidy-up after construct lowering, but if not 
 	// removed before AddGotoBeforeLabel, they will generate spurious states. We also remove dead code which can be exposed by
 	// removal of unused labels - we must repeat because dead code removal can generate unused labels.
-	for( int i=0; i<2; i++ )
-	{
-		sequence->push_back( make_shared<CleanupCompoundMulti>() );
-		sequence->push_back( make_shared<CleanupCompoundSingle>() );
-		sequence->push_back( make_shared<CleanupNop>() );
-		sequence->push_back( make_shared<CleanupUnusedLabels>() );
-		sequence->push_back( make_shared<CleanupDuplicateLabels>() );
-		sequence->push_back( make_shared<CleanupIneffectualLabels>() );
-		sequence->push_back( make_shared<CleanUpDeadCode>() );
-	}
+	group_first = sequence->size();
+	sequence->push_back( make_shared<CleanupCompoundMulti>() );
+	sequence->push_back( make_shared<CleanupCompoundSingle>() );
+	sequence->push_back( make_shared<CleanupNop>() );
+	sequence->push_back( make_shared<CleanupUnusedLabels>() );
+	sequence->push_back( make_shared<CleanupDuplicateLabels>() );
+	sequence->push_back( make_shared<CleanupIneffectualLabels>() );
+	sequence->push_back( make_shared<CleanUpDeadCode>() );
+	fixpoint_groups->push_back( { group_first, (int)sequence->size() } );
    
     { 
 		// ---------------------- Install state enum and lmap ----------------------
@@ -166,11 +175,10 @@ void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence )
 
     { 
 		// ---------------------- Create fallthrough machine ----------------------
-        for( int i=0; i<5; i++ )
-        {
-            sequence->push_back( make_shared<ApplyCombGotoPolicy>() );
-            sequence->push_back( make_shared<ApplyYieldGotoPolicy>() );
-        }
+        group_first = sequence->size();
+        sequence->push_back( make_shared<ApplyCombGotoPolicy>() );
+        sequence->push_back( make_shared<ApplyYieldGotoPolicy>() );
+        fixpoint_groups->push_back( { group_first, (int)sequence->size() } );
         sequence->push_back( make_shared<ApplyBottomPolicy>() );
         sequence->push_back( make_shared<ApplyLabelPolicy>() );
         sequence->push_back( make_shared<CleanupDuplicateLabels>() );
@@ -198,13 +206,12 @@ void BuildDefaultSequence( vector< shared_ptr<VNStep> > *sequence )
     }
     
 	// ---------------------- Final cleanups ----------------------
-    for( int i=0; i<2; i++ )
-	{
-		sequence->push_back( make_shared<CleanupUnusedLabels>() );
-		sequence->push_back( make_shared<CleanupDuplicateLabels>() );
-		sequence->push_back( make_shared<CleanupIneffectualLabels>() );
-		sequence->push_back( make_shared<CleanUpDeadCode>() );
-	}		
+	group_first = sequence->size();
+	sequence->push_back( make_shared<CleanupUnusedLabels>() );
+	sequence->push_back( make_shared<CleanupDuplicateLabels>() );
+	sequence->push_back( make_shared<CleanupIneffectualLabels>() );
+	sequence->push_back( make_shared<CleanUpDeadCode>() );
+	fixpoint_groups->push_back( { group_first, (int)sequence->size() } );
 	
 	// ---------------------- SystemC lowering ----------------------
 	// Lower SystemC nodes to C++ constructs for rendering
@@ -283,8 +290,8 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Parse input X
     Stage stage_parse_X(
         { Progress::PARSING, 
-          true, false, false, false,
-          SSPrintf("Parsing input %s", ReadArgs::input_x_path.c_str()), 
+          true, false, false, false, false,
+          ReadArgs::batch_paths.empty() ? SSPrintf("Parsing input %s", ReadArgs::input_x_path.c_str()) : "Parsing input", 
           nullptr, 
           [this]()
           { 
@@ -296,7 +303,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Render output X
     Stage stage_render_X(
         { Progress::RENDERING, 
-          false, true, false, false,
+          false, true, false, false, false,
           "Rendering output to code", 
           nullptr, [&]()
           { 
@@ -308,7 +315,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Output a pattern graph
     Stage stage_pattern_graphs( 
         { Progress::RENDERING, 
-          false, false, false, false,
+          false, false, false, false, false,
           "Rendering pattern graphs",
           nullptr,  
           [this]()
@@ -324,7 +331,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Output a pattern render
     Stage stage_pattern_renders( 
         { Progress::RENDERING, 
-          false, false, false, false,
+          false, false, false, false, false,
           "Rendering pattern to VN lang",
           nullptr,  
           [this]()
@@ -339,7 +346,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Output an intermediate/output graph
     Stage stage_X_graph(
         { Progress::RENDERING, 
-          false, true, false, false,
+          false, true, false, false, false,
           "Rendering output to graph", 
           nullptr, 
           [this]()
@@ -349,22 +356,35 @@ Inferno::Plan::Plan(Inferno *algo_) :
           } }
     );
     
+    // Run the input stages over each input in a batch
+    Stage stage_batch(
+        { Progress::PARSING, 
+          false, false, false, false, false,
+          "Processing batch", 
+          nullptr, 
+          [this]()
+          { 
+              algo->RunBatch(); 
+          } }
+    );
+    
     // Dump the hit counts
     Stage stage_dump_hits(
         { Progress::RENDERING, 
-          false, false, false, false,
+          false, false, false, false, false,
           "Dumping hit counts", 
           nullptr, 
           [this]()
           { 
               HitCount::instance.Dump(); 
+              ConsistencyCheck::Dump(); 
           } }
     );
             
     // Pattern transformations
     Stage stage_pattern_transformation( 
         { Progress::PATTERN_TRANS, 
-          true, false, false, false,
+          true, false, false, false, true,
           "Pattern transforming", 
           [this](const Step &sp)
           { 
@@ -376,7 +396,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Planning
     vector<Stage> stages_planning( {
         { Progress::PLANNING_ONE, 
-          true, false, false, false,
+          true, false, false, false, true,
           "Planning stage one", 
           [this](const Step &sp)
           { 
@@ -384,7 +404,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
           }, 
           nullptr },
         { Progress::PLANNING_TWO, 
-          true, false, false, false,
+          true, false, false, false, true,
           "Planning stage two", 
           [this](const Step &sp)
           { 
@@ -392,7 +412,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
           }, 
           nullptr },
         { Progress::PLANNING_THREE, 
-          true, false, false, false,
+          true, false, false, false, true,
           "Planning stage three", 
           [this](const Step &sp)
           { 
@@ -400,7 +420,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
           }, 
           nullptr },    
         { Progress::PLANNING_FOUR, 
-          true, false, false, false,
+          true, false, false, false, false,
           "Planning stage four", 
           nullptr,
           [this]()
@@ -408,7 +428,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
               algo->vn_sequence->PlanningStageFour(); 
           } },    
         { Progress::PLANNING_FIVE, 
-          true, false, false, false,
+          true, false, false, false, true,
           "Planning stage five", 
           [this](const Step &sp)
           {   
@@ -420,7 +440,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // Analyse X tree
     Stage stage_analyse(
         { Progress::ANALYSING, 
-          true, true, false, false,
+          true, true, false, false, false,
           "Analysing", 
           nullptr,
           [this]()
@@ -432,7 +452,7 @@ Inferno::Plan::Plan(Inferno *algo_) :
     // X transformation
     Stage stage_transform_X(
         { Progress::TRANSFORMING, 
-          true, true, true, true,
+          true, true, true, true, false,
           "Transforming", 
           [this](const Step &sp)
           { 
@@ -484,30 +504,37 @@ Inferno::Plan::Plan(Inferno *algo_) :
     if( ReadArgs::documentation_graphs || generate_pattern_graphs )
         return;
 
-    if( ReadArgs::input_x_path=="" )
+    if( ReadArgs::input_x_path=="" && ReadArgs::batch_paths.empty() )
     {
         fprintf(stderr, "No input file provided so performing planning only. -h for help.\n");     
         goto FINAL_TRACE;
     }
 
-    stages.push_back( stage_parse_X );   
+    // Stages for one input. In batch mode, these are run for each input 
+    // in turn, re-using the planning.
+    input_stages.push_back( stage_parse_X );   
     if( ShouldIQuitAfter(stage_parse_X.progress_stage) ) 
         goto FINAL_RENDER;         
     // Now input has been parsed, we always want to render even if quitting early.  
     
-    stages.push_back( stage_analyse );   
+    input_stages.push_back( stage_analyse );   
     if( ShouldIQuitAfter(stage_analyse.progress_stage) ) 
         goto FINAL_RENDER; 
         
-    stages.push_back( stage_transform_X );        
+    input_stages.push_back( stage_transform_X );        
     if( ShouldIQuitAfter(stage_transform_X.progress_stage) ) 
         goto FINAL_RENDER;
         
     FINAL_RENDER:
     if( ReadArgs::intermediate_graph && !ReadArgs::output_all )
-        stages.push_back( stage_X_graph );
+        input_stages.push_back( stage_X_graph );
     else if( !ReadArgs::output_all )   
-        stages.push_back( stage_render_X );          
+        input_stages.push_back( stage_render_X );          
+    
+    if( ReadArgs::batch_paths.empty() )
+        stages.insert( stages.end(), input_stages.begin(), input_stages.end() );
+    else
+        stages.push_back( stage_batch );
         
     FINAL_TRACE:
     if( ReadArgs::trace_hits )
@@ -519,6 +546,7 @@ void Inferno::RunStage( Stage stage )
 {
     if( !ReadArgs::trace_quiet )
         fprintf(stderr, "%s\n", stage.text.c_str());     
+    Profiler::Span stage_span( Profiler::Kind::STAGE, stage.text, Progress(stage.progress_stage) );
     
     switch( Progress(stage.progress_stage).GetSteppiness() )
     {
@@ -530,23 +558,77 @@ void Inferno::RunStage( Stage stage )
         break;
     
     case Progress::STEPPY:        
+        // Concurrent trace output would be unreadable, so stay serial with -t
+        if( stage.allow_jobs && ReadArgs::jobs > 1 && !ReadArgs::trace )
+        {
+            RunStepsConcurrently( stage );
+            break;
+        }
         for( const Step &sp : plan.steps )
         {
-            Progress(stage.progress_stage, sp.step_index).SetAsCurrent();
-            Tracer::Enable( stage.allow_trace && sp.allow_trace ); 
-            HitCount::Enable( stage.allow_hits && sp.allow_hits ); 
-            if( stage.allow_reps && sp.allow_reps )
-                VNSequence::SetMaxReps( ReadArgs::repetitions, ReadArgs::rep_error );
-            else
-                VNSequence::SetMaxReps( 100, true );
-            if( stage.allow_stop && sp.allow_stop )
-                vn_sequence->SetStopAfter(sp.step_index, ReadArgs::quitafter_counts, 0);
+            SetUpStep( stage, sp );
+            Profiler::Span step_span( Profiler::Kind::STEP, vn_sequence->GetStepName(sp.step_index) );
             stage.step_function(sp);
         }        
         break;
     }
 }
 
+
+void Inferno::RunStepsConcurrently( const Stage &stage )
+{
+    // Each job takes the next step that no other job has taken yet. Progress,
+    // Tracer and HitCount enables and max reps are per-thread so each job 
+    // sets up its own. Stop-after is per-step anyway.
+    atomic<vector<Step>::size_type> next_step_index(0);
+    vector<exception_ptr> exceptions( plan.steps.size() );
+    auto job = [&]()
+    {
+        SerialNumber::RAIICountPerProgress count_per_progress;
+        for( vector<Step>::size_type i = next_step_index++; 
+             i < plan.steps.size(); 
+             i = next_step_index++ )
+        {
+            const Step &sp = plan.steps[i];
+            SetUpStep( stage, sp );
+            Profiler::Span step_span( Profiler::Kind::STEP, vn_sequence->GetStepName(sp.step_index) );
+            try
+            {
+                stage.step_function(sp);
+            }
+            catch(...)
+            {
+                exceptions[i] = current_exception();
+            }
+        }
+    };
+    
+    vector<thread> threads;
+    for( int j=0; j<ReadArgs::jobs && j<(int)(plan.steps.size()); j++ )
+        threads.push_back( thread(job) );
+    for( thread &t : threads )
+        t.join();
+    
+    // Report the failure that a serial run would have hit first
+    for( exception_ptr e : exceptions )
+        if( e )
+            rethrow_exception( e );
+}
+
+
+void Inferno::SetUpStep( const Stage &stage, const Step &sp )
+{
+    Progress(stage.progress_stage, sp.step_index).SetAsCurrent();
+    Tracer::Enable( stage.allow_trace && sp.allow_trace ); 
+    HitCount::Enable( stage.allow_hits && sp.allow_hits ); 
+    if( stage.allow_reps && sp.allow_reps )
+        VNSequence::SetMaxReps( ReadArgs::repetitions, ReadArgs::rep_error );
+    else
+        VNSequence::SetMaxReps( 100, true );
+    if( stage.allow_stop && sp.allow_stop )
+        vn_sequence->SetStopAfter(sp.step_index, ReadArgs::quitafter_counts, 0);
+}
+
     
 void Inferno::PatternDispatcher(PatternAction action, int pattern_index, string pattern_name, bool prepend_step_number)
 {
@@ -650,6 +732,71 @@ void Inferno::Run()
 }
 
 
+void Inferno::RunBatch()
+{
+    // Directories supply all the files in them, in name order
+    vector<string> input_paths;
+    for( string path : ReadArgs::batch_paths )
+    {
+        if( filesystem::is_directory(path) )
+        {
+            vector<string> dir_paths;
+            for( const filesystem::directory_entry &entry : filesystem::directory_iterator(path) )
+                if( entry.is_regular_file() )
+                    dir_paths.push_back( entry.path().string() );
+            sort( dir_paths.begin(), dir_paths.end() );
+            input_paths.insert( input_paths.end(), dir_paths.begin(), dir_paths.end() );
+        }
+        else
+        {
+            input_paths.push_back( path );
+        }
+    }
+    
+    // Outputs go into the -o directory under the input's path, so inputs 
+    // with the same file name in different directories stay apart. Leading 
+    // ..s are dropped, which would otherwise take us out of the directory.
+    vector<filesystem::path> output_rel_paths;
+    set<filesystem::path> seen_rel_paths;
+    for( string input_path : input_paths )
+    {
+        filesystem::path rel_path;
+        for( const filesystem::path &part : filesystem::path(input_path).lexically_normal().relative_path() )
+            if( part != ".." )
+                rel_path /= part;
+        if( !seen_rel_paths.insert( rel_path ).second )
+        {
+            fprintf(stderr, "Batch inputs would overwrite each other's output at %s\n", rel_path.c_str());
+            exit(EXIT_FAILURE);
+        }
+        output_rel_paths.push_back( rel_path );
+    }
+
+    // Without -o, all outputs go to stdout, each after a separator comment 
+    // naming its input. Per-input stages get their paths from ReadArgs.
+    string output_dir = ReadArgs::output_x_path;
+    for( vector<string>::size_type i=0; i<input_paths.size(); i++ )
+    {
+        if( !ReadArgs::trace_quiet )
+            fprintf(stderr, "Input %d of %d: %s\n", (int)i+1, (int)(input_paths.size()), input_paths[i].c_str());     
+        ReadArgs::input_x_path = input_paths[i];
+        if( output_dir.empty() )
+        {
+            printf("// ---------------- %s ----------------\n", input_paths[i].c_str());
+        }
+        else
+        {
+            filesystem::path output_path = filesystem::path(output_dir) / output_rel_paths[i];
+            filesystem::create_directories( output_path.parent_path() );
+            ReadArgs::output_x_path = output_path.string();
+        }
+        for( Stage stage : plan.input_stages )    
+            RunStage(stage);  
+    }
+    ReadArgs::output_x_path = output_dir;
+}
+
+
 bool Inferno::ShouldIQuitAfter(Progress::Stage stage)
 {
     return ReadArgs::quitafter && 
@@ -665,6 +812,8 @@ int main( int argc, char *argv[] )
     HitCount::instance.Check();
     Tracer::Enable( ReadArgs::trace );
     HitCount::Enable( ReadArgs::trace_hits );
+    if( !ReadArgs::profile_path.empty() )
+        Profiler::Enable( ReadArgs::profile_path, ReadArgs::profile_chrome_trace );
 
     // Do self-tests (unit tests) if requested
     if( ReadArgs::test_units )
@@ -676,6 +825,7 @@ int main( int argc, char *argv[] )
     // Build a sequence of steps 
     Progress(Progress::BUILDING_STEPS).SetAsCurrent();    
     vector< shared_ptr<VN::VNStep> > sequence;
+    list<VN::VNSequence::FixpointGroup> fixpoint_groups;
     if( ReadArgs::documentation_graphs )
     {
         BuildDocSequence( &sequence );
@@ -691,7 +841,7 @@ int main( int argc, char *argv[] )
 	{
 	    if( !ReadArgs::trace_quiet )
 			fprintf(stderr, "Building patterns\n"); 
-        BuildDefaultSequence( &sequence );    
+        BuildDefaultSequence( &sequence, &fixpoint_groups );    
 	}
         
     // Maybe we want to stop after building the steps
@@ -702,7 +852,7 @@ int main( int argc, char *argv[] )
     // VNSequence contains the algrithms.
     // Inferno is just a harness that supports various execution 
     // scenarios based on command line args.
-    auto vn_sequence = make_shared<VN::VNSequence>( sequence );
+    auto vn_sequence = make_shared<VN::VNSequence>( sequence, fixpoint_groups );
     Inferno inferno( vn_sequence );
     inferno.Run();
     //CSP::ReferenceSolver::DumpGSV();
@@ -35,6 +35,7 @@ public:
         bool allow_hits;
         bool allow_reps;
         bool allow_stop;
+        bool allow_jobs; // steps may be run concurrently under -j
         string text;
         function<void(const Step &)> step_function;
         function<void()> stage_function;
@@ -51,12 +52,15 @@ private:
         Inferno *algo;
         vector<Step> steps;              
         list<Stage> stages;  
+        list<Stage> input_stages; // parse through to render, for one input
     } plan;
     
     typedef function<void(const Step &sp, string output_x_path, bool add_file_extension, string title)> PatternAction;
     
 public:    
     void RunStage( Stage stage );
+    void RunStepsConcurrently( const Stage &stage );
+    void SetUpStep( const Stage &stage, const Step &sp );
                          
     void GeneratePatternGraphs();
     void GeneratePatternRenders();
@@ -66,6 +70,7 @@ public:
     
     void RunTransformationStep(const Step &sp);
     void Run();
+    void RunBatch();
     
     static bool ShouldIQuitAfter(Progress::Stage stage);
     
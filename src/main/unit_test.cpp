@@ -3,6 +3,7 @@
 #include "node/node.hpp"
 #include "common/standard.hpp"
 #include "vn/sym/truth_table.hpp"
+#include "vn/sym/bdd.hpp"
 
 #include <cstdlib>
 
@@ -11,6 +12,7 @@ void SelfTest()
 {
     GenericsTest();
     SYM::TestTruthTable();
+    SYM::TestBDD();
 }
 
 // TODO Consider multi-terminus Stuff and multi-root (StarStuff)
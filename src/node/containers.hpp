@@ -114,11 +114,15 @@ public:
 
 struct SequenceInterface : virtual ContainerInterface
 {
+    Itemiser::ElementKind GetItemiseKind() const override { return Itemiser::ElementKind::SEQUENCE; }
+    const void *GetItemiseInterface() const override { return this; }
 };
 
 
 struct CollectionInterface : virtual ContainerInterface
 {
+    Itemiser::ElementKind GetItemiseKind() const override { return Itemiser::ElementKind::COLLECTION; }
+    const void *GetItemiseInterface() const override { return this; }
 };
 
 //
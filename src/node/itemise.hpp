@@ -15,10 +15,21 @@ using namespace std;
 // *even if* virtual inheritance is used. This may be a compiler bug in which case the above
 // is true only for GCC4.3. Anyway, if we see it twice it will have the same address,
 // so we de-duplicate during itemise algorithm.
+class SequenceInterface;
+class CollectionInterface;
+class TreePtrInterface;
+
 /// Support class allowing the child-pointing members of a node to be extracted in a vector
 class Itemiser : public virtual Traceable
 {
 public:
+    enum class ElementKind
+    {
+        SINGULAR,
+        SEQUENCE,
+        COLLECTION
+    };
+
     class Element : public virtual Traceable
     {
     public:
@@ -40,6 +51,76 @@ public:
             }
             return *this;
         }        
+        
+        // Overridden by TreePtrInterface, SequenceInterface and CollectionInterface.
+        // Only used when building descriptors, so that the walks don't need
+        // to dynamic_cast to find out.
+        virtual ElementKind GetItemiseKind() const
+        {
+            ASSERTFAILS("got something from itemise that isnt a Sequence, Collection or a singular TreePtr");
+        }
+        
+        // Address of the interface object for our kind
+        virtual const void *GetItemiseInterface() const
+        {
+            ASSERTFAILS("got something from itemise that isnt a Sequence, Collection or a singular TreePtr");
+        }
+    };
+    
+    // What we know about one child-pointing member of a node type. Offsets
+    // are from the start of the node type. The interface offset leads to
+    // the TreePtrInterface, SequenceInterface or CollectionInterface as 
+    // given by kind, which cannot be reached from Element by static_cast 
+    // because Element is a virtual base.
+    struct ElementDescriptor
+    {
+        uintptr_t offset;
+        uintptr_t interface_offset;
+        ElementKind kind;
+    };
+    typedef vector<ElementDescriptor> Descriptors;
+    
+    // The elements of one object, without allocating anything
+    class ElementTable
+    {
+    public:
+        ElementTable( const char *base_, const Descriptors *descriptors_ ) :
+            base( base_ ),
+            descriptors( descriptors_ )
+        {
+        }
+        
+        size_t size() const
+        {
+            return descriptors->size();
+        }
+        
+        ElementKind GetKind( size_t i ) const
+        {
+            return (*descriptors)[i].kind;
+        }
+        
+        SequenceInterface *GetSequence( size_t i ) const
+        {
+            ASSERTS( GetKind(i)==ElementKind::SEQUENCE );
+            return (SequenceInterface *)(base + (*descriptors)[i].interface_offset);
+        }
+        
+        CollectionInterface *GetCollection( size_t i ) const
+        {
+            ASSERTS( GetKind(i)==ElementKind::COLLECTION );
+            return (CollectionInterface *)(base + (*descriptors)[i].interface_offset);
+        }
+        
+        TreePtrInterface *GetSingular( size_t i ) const
+        {
+            ASSERTS( GetKind(i)==ElementKind::SINGULAR );
+            return (TreePtrInterface *)(base + (*descriptors)[i].interface_offset);
+        }
+        
+    private:
+        const char *base;
+        const Descriptors *descriptors;
     };
     
     template< class ITEMISE_TYPE >
@@ -63,24 +144,46 @@ public:
     }
 
     template< class ITEMISE_TYPE >
-    inline static const vector< uintptr_t > &BasicItemiseStatic( const ITEMISE_TYPE *itemise_archetype )
+    inline static const Descriptors &DescriptorsStatic( const ITEMISE_TYPE *itemise_archetype )
     {
-        // Just a cache on ItemiseImpl()
-        static thread_local vector< uintptr_t > v;
-        static thread_local bool done=false;
-        if(!done)
-        {
-            //TRACES("Not cached *arch=")(*itemise_archetype)(", caching at %p\n", &v);
-            v = ItemiseImpl( itemise_archetype );
-            done = true;
-        }
-        else
+        // Built on first use for each type, then never changes. The offsets 
+        // within the member objects are fixed because members are complete 
+        // objects of their declared type.
+        static const Descriptors descriptors = [&]()
         {
-            //TRACES("Using cached *arch=")(*itemise_archetype)(" at %p\n", &v);
-        }
-
+            Descriptors ds;
+            const char *base = (const char *)itemise_archetype;
+            for( uintptr_t ofs : ItemiseImpl( itemise_archetype ) )
+            {
+                const Element *e = (const Element *)(base + ofs);
+                uintptr_t interface_ofs = (const char *)e->GetItemiseInterface() - base;
+                ds.push_back( { ofs, interface_ofs, e->GetItemiseKind() } );
+            }
+            return ds;
+        }();
+        return descriptors;
+    }
 
-        return v;
+    template< class ITEMISE_TYPE >
+    inline static ElementTable ItemiseTableStatic( const ITEMISE_TYPE *itemise_archetype,
+                                                   const Itemiser *itemise_object )
+    {
+        ASSERTS( itemise_archetype )("Itemiser got itemise_archetype=nullptr\n");
+        ASSERTS( itemise_object )("Itemiser got itemise_object=nullptr\n");
+        
+        // Do a safety check: itemise_object we're itemising must be same as or derived
+        // from the archetype, so that all the archetype's members are also in itemise_object.        
+        // No need to cast if we're itemising ourself.
+        const ITEMISE_TYPE *target_object = itemise_object == itemise_archetype ? 
+                                            itemise_archetype : 
+                                            dynamic_cast<const ITEMISE_TYPE *>(itemise_object);
+        ASSERTS( target_object )
+               ( "Cannot itemise because itemise_object=")(*itemise_object)
+               ( " is not a nonstrict subclass of itemise_archetype=")(*itemise_archetype);
+        
+        // Do the pointer math to get "elements of A in B" type behaviour
+        // This must be done in bounce because we need the archetype's type for the dynamic_cast
+        return ElementTable( (const char *)target_object, &DescriptorsStatic( itemise_archetype ) );
     }
 
     template< class ITEMISE_TYPE >
@@ -100,12 +203,10 @@ public:
         
         // Do the pointer math to get "elements of A in B" type behaviour
         // This must be done in bounce because we need the archetype's type for the dynamic_cast
-        const vector< uintptr_t > &vofs = BasicItemiseStatic( itemise_archetype );
-
         const ITEMISE_TYPE *target_object = dynamic_cast<const ITEMISE_TYPE *>(itemise_object);
         vector< Itemiser::Element * > vout;
-        for( uintptr_t ofs : vofs )
-            vout.push_back( (Element *)((const char *)target_object + ofs) );
+        for( const ElementDescriptor &d : DescriptorsStatic( itemise_archetype ) )
+            vout.push_back( (Element *)((const char *)target_object + d.offset) );
 
         return vout;
     }
@@ -115,10 +216,9 @@ public:
                                                          vector< uintptr_t >::size_type i )
     {
         //TRACE("ItemiseIndex() index=%d obj=%p *obj=", i, itemise_object)(*itemise_object)(" size=%d\n", sizeof(*itemise_object));
-        const vector< uintptr_t > &v = BasicItemiseStatic( itemise_object );
-        ASSERTS( i<v.size() )("i=%d size=%d", i, v.size());
-        uintptr_t ofs = v[i];
-        Element *res = (Element *)((const char *)itemise_object + ofs);
+        const Descriptors &ds = DescriptorsStatic( itemise_object );
+        ASSERTS( i<ds.size() )("i=%d size=%d", i, ds.size());
+        Element *res = (Element *)((const char *)itemise_object + ds[i].offset);
         //TRACE("ofs=%d result=%p\n", ofs, res);
         return res;
     }
@@ -127,9 +227,7 @@ public:
     inline static int ItemiseSizeStatic( const ITEMISE_TYPE *itemise_object )
     {
         //TRACES("ItemiseSize() obj=")(*itemise_object)("\n");
-        const vector< uintptr_t > &v = BasicItemiseStatic( itemise_object );
-        //TRACES("size result=%d\n", v.size());
-        return v.size();
+        return DescriptorsStatic( itemise_object ).size();
     }
 
     static thread_local const char *dstart;
@@ -137,6 +235,9 @@ public:
     static thread_local vector<uintptr_t> v;
     
     virtual vector< Itemiser::Element * > Itemise(const Itemiser *itemise_object) const = 0;
+    
+    // Like Itemise() but nothing is allocated: use this in walks
+    virtual ElementTable GetItemiseTable(const Itemiser *itemise_object) const = 0;
 };
 
 #define ITEMISE_FUNCTION \
@@ -144,6 +245,10 @@ public:
     { \
         return Itemiser::ItemiseStatic( this, itemise_object ? itemise_object : this ); \
     } \
+    virtual Itemiser::ElementTable GetItemiseTable( const Itemiser *itemise_object = 0 ) const  \
+    { \
+        return Itemiser::ItemiseTableStatic( this, itemise_object ? itemise_object : this ); \
+    } \
     virtual Itemiser::Element *ItemiseIndex( vector< uintptr_t >::size_type i ) const  \
     { \
         return Itemiser::ItemiseIndexStatic( this, i ); \
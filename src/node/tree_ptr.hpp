@@ -19,6 +19,10 @@ class Node;
 //#define TREE_POINTER_REF_COUNTS
 //#define TREE_POINTER_REF_TRACKING
 
+// Define to dynamic_cast and check the pointed-to type on every 
+// dereference instead of once per assignment
+//#define TREE_POINTER_CHECK_DEREF
+
 template<typename VALUE_TYPE>
 struct Sequence;
 
@@ -65,6 +69,9 @@ struct TreePtrInterface : virtual Itemiser::Element
     virtual string GetSerialString() const = 0;
     virtual string GetName() const = 0;
     virtual string GetShortName() const = 0;
+    
+    Itemiser::ElementKind GetItemiseKind() const override { return Itemiser::ElementKind::SINGULAR; }
+    const void *GetItemiseInterface() const override { return this; }
 };
 
 // -------------------------- TreePtrCommon ----------------------------    
@@ -124,11 +131,34 @@ template<typename VALUE_TYPE>
 struct TreePtr : virtual TreePtrCommon, 
                  shared_ptr<Node>               
 {
+	template<typename OTHER> friend struct TreePtr;
 	using TreePtrInterface::operator=;
 	
     typedef VALUE_TYPE value_type;
     
     TreePtr() = default;
+    TreePtr( const TreePtr &o ) = default;
+    TreePtr &operator=( const TreePtr &o ) = default;
+
+    // Moved-from TreePtrs are NULL, including value_ptr
+    TreePtr( TreePtr &&o ) :
+        TreePtrCommon( static_cast<const TreePtrCommon &>(o) ),
+        shared_ptr<Node>( move(o) ),
+        value_ptr( o.value_ptr )
+    {
+        o.value_ptr = nullptr;
+    }
+
+    TreePtr &operator=( TreePtr &&o )
+    {
+        if( &o == this )
+            return *this;
+        (void)TreePtrCommon::operator=( static_cast<const TreePtrCommon &>(o) );
+        (void)shared_ptr<Node>::operator=( move(o) );
+        value_ptr = o.value_ptr;
+        o.value_ptr = nullptr;
+        return *this;
+    }
 
 #ifdef TREE_POINTER_REF_COUNTS
 	~TreePtr() final
@@ -139,7 +169,8 @@ struct TreePtr : virtual TreePtrCommon,
 
     explicit TreePtr( VALUE_TYPE *o ) : 
         TreePtrCommon( o ),
-        shared_ptr<Node>( o )
+        shared_ptr<Node>( o ),
+        value_ptr( o )
     {
     }
 
@@ -152,14 +183,16 @@ struct TreePtr : virtual TreePtrCommon,
     template< typename OTHER >
     explicit TreePtr( const shared_ptr<OTHER> &o ) :
         TreePtrCommon( o ),
-        shared_ptr<Node>( o )
+        shared_ptr<Node>( o ),
+        value_ptr( GetValuePtr( o.get() ) )
     {
     }
 
     template< typename OTHER >
     TreePtr( const TreePtr<OTHER> &o ) :
         TreePtrCommon( o ),
-        shared_ptr<Node>( (shared_ptr<Node>)(o) )        
+        shared_ptr<Node>( (shared_ptr<Node>)(o) ),
+        value_ptr( GetValuePtr( o ) )
     {
     }
 
@@ -172,12 +205,22 @@ struct TreePtr : virtual TreePtrCommon,
 	inline VALUE_TYPE *GetValueTypePointer() const
 	{
 		auto pt = shared_ptr<Node>::get();
-		auto pv = dynamic_cast<VALUE_TYPE *>(pt);
-		ASSERT(!pt || pv)
-		  	  ("Attempt to access degenerate object. ")
-		  	  ("TreePtr<")(TYPE_ID_NAME(VALUE_TYPE))("> ")
-		  	  ("really points to ")(get()->GetTrace());
-        return pv;
+		if constexpr( is_same_v<VALUE_TYPE, Node> )
+		{
+			return pt;
+		}
+		else
+		{
+#ifdef TREE_POINTER_CHECK_DEREF
+			auto pv = dynamic_cast<VALUE_TYPE *>(pt);
+			ASSERT( value_ptr == pv )("Stale value pointer in TreePtr");
+#endif
+			ASSERT(!pt || value_ptr)
+				  ("Attempt to access degenerate object. ")
+				  ("TreePtr<")(TYPE_ID_NAME(VALUE_TYPE))("> ")
+				  ("really points to ")(get()->GetTrace());
+			return value_ptr;
+		}
 	}
 	
 	VALUE_TYPE *operator->() const
@@ -198,6 +241,7 @@ struct TreePtr : virtual TreePtrCommon,
     TreePtr &operator=( const shared_ptr<Node> &n )
     {   
         (void)shared_ptr<Node>::operator=( n );
+        value_ptr = GetValuePtr( n.get() );
         (void)SatelliteSerial::operator=( SatelliteSerial( n.get(), this ) );
         return *this;
     }
@@ -218,6 +262,7 @@ struct TreePtr : virtual TreePtrCommon,
     TreePtrInterface &operator=( nullptr_t n ) final
     {
         (void)shared_ptr<Node>::operator=( n );
+        value_ptr = nullptr;
         return *this;    
     }
    
@@ -248,6 +293,13 @@ struct TreePtr : virtual TreePtrCommon,
         return !!*(const shared_ptr<Node> *)this;
     }
 
+    // Hides shared_ptr's, which would leave value_ptr behind
+    void swap( TreePtr &other )
+    {
+        shared_ptr<Node>::swap( other );
+        std::swap( value_ptr, other.value_ptr );
+    }
+
     static TreePtr<VALUE_TYPE>
         DynamicCast( const TreePtrInterface &g )
     {
@@ -300,6 +352,34 @@ struct TreePtr : virtual TreePtrCommon,
 		s += get()->GetTrace();
 		return s;
 	} 
+	
+private:
+	// Work out value_ptr for a new target. Upcasts are free, and the
+	// dynamic_cast is only needed otherwise.
+	template< typename OTHER >
+	static VALUE_TYPE *GetValuePtr( OTHER *p )
+	{
+		if constexpr( is_convertible_v<OTHER *, VALUE_TYPE *> )
+			return p;
+		else
+			return dynamic_cast<VALUE_TYPE *>(p);
+	}
+
+	template< typename OTHER >
+	static VALUE_TYPE *GetValuePtr( const TreePtr<OTHER> &o )
+	{
+		// A degenerate o could still point to a VALUE_TYPE
+		if constexpr( is_convertible_v<OTHER *, VALUE_TYPE *> )
+			if( o.value_ptr || !o.get() )
+				return o.value_ptr;
+		return GetValuePtr( o.get() );
+	}
+
+	// Pointed-to object as VALUE_TYPE, or NULL if the TreePtr is NULL or
+	// degenerate (points to something that isn't a VALUE_TYPE). Set by
+	// every construction and assignment, so const access never writes it
+	// and TreePtrs may be read from several threads.
+	VALUE_TYPE *value_ptr = nullptr;
 };
 
 // -------------------------- Extra bits ----------------------------    
@@ -56,3 +56,62 @@ TreePtr<Scope> GetScope( TreePtr<Node> context, TreePtr<Identifier> id )
     // Every identifier should have a scope - if this fails, we've missed out a kind of scope
     return nullptr;
 }
+
+
+ScopeIndex::ScopeIndex( TreePtr<Node> context )
+{
+    // Look through the members of all scopes (CodeUnit, Records, CallableParams, Compounds)
+    Walk walkr(context, nullptr, nullptr);
+    for( const TreePtrInterface &n : walkr )
+    {
+        if( auto ds = DynamicTreePtrCast<DeclScope>((TreePtr<Node>)n) )
+        {
+            for( TreePtr<Declaration> d : ds->members )
+                TryInsert( member_scopes, d, ds );
+        }
+        else if( auto cp = DynamicTreePtrCast<CallableParams>((TreePtr<Node>)n) )
+        {		
+            for( TreePtr<Declaration> p : cp->params )
+                TryInsert( member_scopes, p, cp );
+   		} 
+
+        // Special additional processing for Compounds - look for statements that are really Instance Declarations
+        if( auto c = DynamicTreePtrCast<Compound>((TreePtr<Node>)n) )
+        {
+            for( TreePtr<Statement> s : c->statements )
+            {
+                if( auto d = DynamicTreePtrCast<Instance>(s) )
+                    TryInsert( compound_scopes, d, c );
+            }
+        }
+    }
+}
+
+
+TreePtr<Scope> ScopeIndex::GetScope( TreePtr<Identifier> id ) const
+{
+    auto it = member_scopes.find( id );
+    if( it != member_scopes.end() )
+        return it->second;
+        
+    it = compound_scopes.find( id );
+    if( it != compound_scopes.end() )
+        return it->second;
+    
+    if( TreePtr<SpecificIdentifier> sid = DynamicTreePtrCast<SpecificIdentifier>( id ) )
+        throw ScopeNotFoundMismatch();
+    else
+        throw ScopeOnNonSpecificMismatch();
+    // Every identifier should have a scope - if this fails, we've missed out a kind of scope
+    return nullptr;
+}
+
+
+void ScopeIndex::TryInsert( unordered_map<TreePtr<Node>, TreePtr<Scope>> &scopes,
+                            TreePtr<Declaration> d, 
+                            TreePtr<Scope> scope )
+{
+    TreePtr<Identifier> id = GetIdentifierOfDeclaration( d ).GetTreePtr();
+    if( id ) // Not base classes
+        scopes.insert( make_pair(id, scope) ); // First one found wins, as with a search
+}
@@ -3,6 +3,8 @@
 
 #include "tree/cpptree.hpp"
 
+#include <unordered_map>
+
 //
 // Handy helper to get the node that is the "scope" of the supplied node - ie basically the
 // parent in the tree. We have to do searches for this, since the tree does not contain 
@@ -13,4 +15,26 @@ class ScopeOnNonSpecificMismatch : public Mismatch {};
 
 TreePtr<CPPTree::Scope> GetScope( TreePtr<Node> context, TreePtr<CPPTree::Identifier> id );
 
+//
+// For many lookups in the same tree: walks the tree once on construction, after
+// which GetScope() is a hash lookup. The tree must not be changed while the
+// index is in use.
+//
+class ScopeIndex
+{
+public:
+    explicit ScopeIndex( TreePtr<Node> context );
+    TreePtr<CPPTree::Scope> GetScope( TreePtr<CPPTree::Identifier> id ) const;
+
+private:
+    void TryInsert( unordered_map<TreePtr<Node>, TreePtr<CPPTree::Scope>> &scopes,
+                    TreePtr<CPPTree::Declaration> d, 
+                    TreePtr<CPPTree::Scope> scope );
+
+    // Identifiers declared as members or params, and those declared by 
+    // statements in Compounds. Kept apart because GetScope() prefers the former.
+    unordered_map<TreePtr<Node>, TreePtr<CPPTree::Scope>> member_scopes;
+    unordered_map<TreePtr<Node>, TreePtr<CPPTree::Scope>> compound_scopes;
+};
+
 #endif
@@ -31,6 +31,7 @@ public:
     // really just to reduce the amount of typing if I change it
     typedef shared_ptr<Patch> ReplacePatchPtr;
     typedef Graphable::Phase Phase;
+    // Returns nullptr when there are no more queries
     typedef function<shared_ptr<DecidedQuery>()> QueryLambda;
     
     enum Path
@@ -187,15 +187,16 @@ bool AgentCommon::IsPreRestrictionMatch( XLink x ) const
 }
 
 
-void AgentCommon::RunRegenerationQueryImpl( DecidedQueryAgentInterface &,
+bool AgentCommon::RunRegenerationQueryImpl( DecidedQueryAgentInterface &,
                                             const SolutionMap *,
                                             PatternLink,
                                             const XTreeDatabase * ) const
 {
+    return true;
 }
     
     
-void AgentCommon::RunRegenerationQuery( DecidedQueryAgentInterface &query,
+bool AgentCommon::RunRegenerationQuery( DecidedQueryAgentInterface &query,
                                         const SolutionMap *hypothesis_links,
                                         PatternLink keyer_plink,
                                         const XTreeDatabase *x_tree_db ) const
@@ -206,8 +207,9 @@ void AgentCommon::RunRegenerationQuery( DecidedQueryAgentInterface &query,
     query.Reset(); 
 
     XLink keyer_xlink = hypothesis_links->at(keyer_plink);
-    if( keyer_xlink != XLink::MMAX )
-        this->RunRegenerationQueryImpl( query, hypothesis_links, keyer_plink, x_tree_db );
+    if( keyer_xlink == XLink::MMAX )
+        return true;
+    return this->RunRegenerationQueryImpl( query, hypothesis_links, keyer_plink, x_tree_db );
 }                             
                       
                       
@@ -234,41 +236,37 @@ AgentCommon::QueryLambda AgentCommon::StartRegenerationQuery( const AndRuleEngin
             if( !nlq_conjecture->Increment() )
             {
 				nlq_conjecture->Reset();
-                throw NLQConjOutAfterHitMismatch(); // Conjecture has run out of choices to try.            
+                TRACE("Mismatch: ")(NLQConjOutAfterHitMismatch())("\n");
+                return nullptr; // Conjecture has run out of choices to try.            
 			}
         }
 
         while(1)
         {
-            try
+            // Query the agent: our conj will be used for the iteration and
+            // therefore our query will hold the result.
+            query = nlq_conjecture->GetQuery(this);
+
+            // which is held by nlq_conjecture. It is imperitive to call
+            // nlq_conjecture->Reset() to destruct them before completing
+            // the search so that final teardown doesn't orphan them. Note
+            // this lambda is called repeatedley, see the `first` flag.
+            // Related: #815
+            if( RunRegenerationQuery( *query, hypothesis_links, keyer_plink, x_tree_db ) )
             {
-                // Query the agent: our conj will be used for the iteration and
-                // therefore our query will hold the result.
-                query = nlq_conjecture->GetQuery(this);
-
-                // which is held by nlq_conjecture. It is imperitive to call
-                // nlq_conjecture->Reset() to destruct them before completing
-                // the search so that final teardown doesn't orphan them. Note
-                // this lambda is called repeatedley, see the `first` flag.
-                // Related: #815
-                RunRegenerationQuery( *query, hypothesis_links, keyer_plink, x_tree_db );       
-                    
-                TRACE("Got query from DNLQ ")(query->GetDecisions())("\n");
-                    
+                TRACE("Got query from DNLQ ")(query->GetDecisions())("\n");                    
                 break; // Great, the normal links matched
             }
-            catch( ::Mismatch &e ) 
+            
+            // We will get here on a mismatch detected by the agent. Permit 
+            // the conjecture to move to a new set of choices.
+            if( !nlq_conjecture->Increment() )
             {
-                // We will get here on a mismatch, whether detected by DQ or our
-                // own comparison of the normal links. Permit the conjecture
-                // to move to a new set of choices.
-                if( !nlq_conjecture->Increment() )
-                {
-                    nlq_conjecture->Reset();
-                    throw; // Conjecture has run out of choices to try.
-                }
-                // Conjecture would like us to try again with new choices
+                nlq_conjecture->Reset();
+                TRACE("Mismatch: ")(NLQConjOutAfterMissMismatch())("\n");
+                return nullptr; // Conjecture has run out of choices to try.
             }
+            // Conjecture would like us to try again with new choices
         }     
         first = false;
         
@@ -284,104 +282,45 @@ AgentCommon::QueryLambda AgentCommon::TestStartRegenerationQuery( const AndRuleE
                                                                   const XTreeDatabase *x_tree_db ) const
 {
 	shared_ptr<PatternQuery> pq = GetPatternQuery();
-    QueryLambda mut_lambda;
+    QueryLambda mut_lambda = StartRegenerationQuery( acting_engine, hypothesis_links, keyer_plink, x_tree_db );
     QueryLambda ref_lambda;
-    auto mut_hits = make_shared<int>(0);
-    auto ref_hits = make_shared<int>(0);
-    try
-    {
-        mut_lambda = StartRegenerationQuery( acting_engine, hypothesis_links, keyer_plink, x_tree_db );
-    }
-    catch( ::Mismatch &e ) 
-    {
-        try
-        {
-            Tracer::RAIIDisable silencer; // make ref algo be quiet            
-            (void)StartRegenerationQuery( acting_engine, hypothesis_links, keyer_plink, x_tree_db );
-            ASSERT(false)("MUT start threw ")(e)(" but ref didn't\n")
-                         (*this)("\n")
-                         ("Normal: ")(MapForPattern(pq->GetNormalLinks(), *hypothesis_links))("\n")
-                         ("Abormal: ")(MapForPattern(pq->GetAbnormalLinks(), *hypothesis_links))("\n")
-                         ("Multiplicity: ")(MapForPattern(pq->GetMultiplicityLinks(), *hypothesis_links))("\n");
-        }
-        catch( ::Mismatch &e ) 
-        {
-            // Passed test: both threw Mismatch
-            throw;
-        }        
-    }
-    // FastStartNormalLinkedQuery() didn't throw
-    try
     {
         Tracer::RAIIDisable silencer; // make ref algo be quiet             
         ref_lambda = StartRegenerationQuery( acting_engine, hypothesis_links, keyer_plink, x_tree_db );        
     }
-    catch( ::Mismatch &e ) 
-    {
-        ASSERT(false)("Ref start threw ")(e)(" but MUT didn't\n")
-                     (*this)("\n")
-                     ("Normal: ")(MapForPattern(pq->GetNormalLinks(), *hypothesis_links))("\n")
-                     ("Abormal: ")(MapForPattern(pq->GetAbnormalLinks(), *hypothesis_links))("\n")
-                     ("Multiplicity: ")(MapForPattern(pq->GetMultiplicityLinks(), *hypothesis_links))("\n");
-    }
+    auto mut_hits = make_shared<int>(0);
+    auto ref_hits = make_shared<int>(0);
 
     QueryLambda test_lambda = [=, this]()mutable->shared_ptr<DecidedQuery>
     {
-        shared_ptr<VN::DecidedQuery> mut_query;
+        shared_ptr<VN::DecidedQuery> mut_query = mut_lambda(); 
         shared_ptr<VN::DecidedQuery> ref_query;
-        try 
-        { 
-            mut_query = mut_lambda(); 
+        {
+            Tracer::RAIIDisable silencer; // make ref algo be quiet            
+            ref_query = ref_lambda(); 
+        }
+        if( mut_query )
+        {
             TRACE("MUT lambda hit #%d\n", (*mut_hits))
                  (*mut_query)("\n");
-
             (*mut_hits)++;
         }
-        catch( ::Mismatch &e ) 
-        {
-            try 
-            { 
-                {
-                    Tracer::RAIIDisable silencer; // make ref algo be quiet            
-                    ref_query = ref_lambda(); 
-                }
-                TRACE("Ref lambda hit #%d\n", (*ref_hits))
-                     (*ref_query)("\n");
-                (*ref_hits)++;                
-                ASSERT(false)("MUT lambda threw ")(e)(" but ref didn't\n")
-                             ("MUT hits %d, ref hits %d\n", *mut_hits, *ref_hits)
-                             (*this)("\n")
-                             ("Normal: ")(MapForPattern(pq->GetNormalLinks(), *hypothesis_links))("\n")
-                             ("Abormal: ")(MapForPattern(pq->GetAbnormalLinks(), *hypothesis_links))("\n")
-                             ("Multiplicity: ")(MapForPattern(pq->GetMultiplicityLinks(), *hypothesis_links))("\n");
-            }
-            catch( ::Mismatch &e ) 
-            {
-                throw;
-            }                
-        }
-        // Didn't throw
-        try
+        if( ref_query )
         {
-            {
-                Tracer::RAIIDisable silencer; // make ref algo be quiet             
-                ref_query = ref_lambda(); 
-            }
             TRACE("Ref lambda hit #%d\n", (*ref_hits))
                  (*ref_query)("\n");
-
             (*ref_hits)++;                
         }
-        catch( ::Mismatch &e ) 
-        {
-            ASSERT(false)("Ref lambda threw ")(e)(" but MUT didn't\n")
-                         ("MUT hits %d, ref hits %d\n", *mut_hits, *ref_hits)
-                         (*this)("\n")
-                         ("Normal: ")(MapForPattern(pq->GetNormalLinks(), *hypothesis_links))("\n")
-                         ("Abormal: ")(MapForPattern(pq->GetAbnormalLinks(), *hypothesis_links))("\n")
-                         ("Multiplicity: ")(MapForPattern(pq->GetMultiplicityLinks(), *hypothesis_links))("\n");
-        }
-            
+        
+        ASSERT( !mut_query == !ref_query )
+              (mut_query ? "Ref" : "MUT")(" lambda mismatched but ")(mut_query ? "MUT" : "ref")(" didn't\n")
+              ("MUT hits %d, ref hits %d\n", *mut_hits, *ref_hits)
+              (*this)("\n")
+              ("Normal: ")(MapForPattern(pq->GetNormalLinks(), *hypothesis_links))("\n")
+              ("Abormal: ")(MapForPattern(pq->GetAbnormalLinks(), *hypothesis_links))("\n")
+              ("Multiplicity: ")(MapForPattern(pq->GetMultiplicityLinks(), *hypothesis_links))("\n");
+        if( !mut_query )
+            return nullptr; // Passed test: both mismatched
         
         // Don't check normal links - NLQ implementations are not required to register them
         //DecidedQueryCommon::AssertMatchingLinks( mut_query->GetNormalLinks(), ref_query->GetNormalLinks() );
@@ -32,11 +32,12 @@ public:
     bool IsPreRestrictionMatch( TreePtr<Node> x ) const; // return true if matches
     bool IsPreRestrictionMatch( XLink x ) const; // return true if matches
     
-    virtual void RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+    // Regeneration queries return false on mismatch
+    virtual bool RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const;
-    void RunRegenerationQuery( DecidedQueryAgentInterface &query,
+    bool RunRegenerationQuery( DecidedQueryAgentInterface &query,
                                const SolutionMap *hypothesis_links,
                                PatternLink keyer_plink,
                                const XTreeDatabase *x_tree_db ) const;
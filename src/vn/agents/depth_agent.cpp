@@ -129,7 +129,7 @@ SYM::Lazy<SYM::BooleanExpression> StuffAgent::SymbolicNormalLinkedQueryPRed(Patt
 }
 
 
-void StuffAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+bool StuffAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const
@@ -139,7 +139,7 @@ void StuffAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
     ASSERT( terminus )("Stuff node without terminus, seems pointless, if there's a reason for it remove this assert");
 
     if( !recurse_restriction )
-        return;
+        return true;
 
     XLink keyer_xlink = hypothesis_links->at(keyer_plink);
     TRACE("SearchContainer agent ")(*this)(" terminus pattern is ")(*(terminus))(" at ")(keyer_xlink)("\n");
@@ -159,6 +159,7 @@ void StuffAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
     }
     
     query.RegisterMultiplicityNode( PatternLink(&recurse_restriction), xpr_ss ); // Links into X    
+    return true;
 }
     
     
@@ -87,7 +87,7 @@ public:
 
     virtual void PatternQueryRestrictions( shared_ptr<PatternQuery> pq ) const;
     virtual SYM::Lazy<SYM::BooleanExpression> SymbolicNormalLinkedQueryPRed(PatternLink keyer_plink) const;                                       
-    virtual void RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+    virtual bool RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const;                                              
@@ -82,19 +82,15 @@ list<shared_ptr<SymbolExpression> *> GreenGrassAgent::IsGreenGrassOperator::GetS
 }
 
 
-unique_ptr<BooleanResult> GreenGrassAgent::IsGreenGrassOperator::Evaluate( const EvalKit &kit,
-                                                                           list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool GreenGrassAgent::IsGreenGrassOperator::EvaluateFromValues( const EvalKit &kit,
+                                                                const XValue *op_values ) const 
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
-    unique_ptr<SymbolicResult> ra = SoloElementOf(move(op_results));
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<BooleanResult>( false );    
-    TreePtr<Node> tp = ra->GetOnlyXLink().GetChildTreePtr();
+    if( !op_values[0] )
+        return false;    
+    TreePtr<Node> tp = op_values[0].GetChildTreePtr();
     
-    bool green = !tp->WasInventedDuringCurrentStep();
-        
-    return make_unique<BooleanResult>( green );         
+    return !tp->WasInventedDuringCurrentStep();
 }
 
 
@@ -51,8 +51,7 @@ public:
         shared_ptr<SYM::PredicateOperator> Clone() const override;
                                        
         list<shared_ptr<SYM::SymbolExpression> *> GetSymbolOperandPointers() override;
-        virtual unique_ptr<SYM::BooleanResult> Evaluate( const EvalKit &kit,
-                                                         list<unique_ptr<SYM::SymbolicResult>> &&op_results ) const override;
+        bool EvaluateFromValues( const EvalKit &kit, const SYM::XValue *op_values ) const override;
 
         Orderable::Diff OrderCompare3WayCovariant( const Orderable &right, 
                                                OrderProperty order_property ) const override;
@@ -46,27 +46,25 @@ list<shared_ptr<SYM::SymbolExpression> *> IdentifierByNameAgent::IsIdentifierNam
 }
 
 
-unique_ptr<SYM::BooleanResult> IdentifierByNameAgent::IsIdentifierNamedOperator::Evaluate( const EvalKit &kit,
-                                                                                           list<unique_ptr<SYM::SymbolicResult>> &&op_results ) const 
+bool IdentifierByNameAgent::IsIdentifierNamedOperator::EvaluateFromValues( const EvalKit &kit,
+                                                                          const SYM::XValue *op_values ) const 
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
-    unique_ptr<SYM::SymbolicResult> ra = SoloElementOf(move(op_results));
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<SYM::BooleanResult>( false );
+    if( !op_values[0] )
+        return false;
     
-    TreePtr<Node> base_x = ra->GetOnlyXLink().GetChildTreePtr(); // TODO dynamic_pointer_cast support for TreePtrInterface #27
+    TreePtr<Node> base_x = op_values[0].GetChildTreePtr(); // TODO dynamic_pointer_cast support for TreePtrInterface #27
     if( auto si_x = DynamicTreePtrCast<CPPTree::SpecificIdentifier>(base_x) )
     {
         TRACE("Comparing ")(si_x->GetIdentifierName())(" with ")(name);
         if( si_x->GetIdentifierName() == name )
         {
             TRACE(" : same\n");
-            return make_unique<SYM::BooleanResult>( true );
+            return true;
         }
         TRACE(" : different\n");
     }
-    return make_unique<SYM::BooleanResult>( false );
+    return false;
 }
 
 
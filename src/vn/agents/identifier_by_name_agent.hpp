@@ -42,8 +42,7 @@ struct IdentifierByNameAgent : public virtual NonlocatingAgent
         shared_ptr<PredicateOperator> Clone() const override;
                                                    
         list<shared_ptr<SYM::SymbolExpression> *> GetSymbolOperandPointers() override;
-        virtual unique_ptr<SYM::BooleanResult> Evaluate( const EvalKit &kit,
-                                                         list<unique_ptr<SYM::SymbolicResult>> &&op_results ) const override;
+        bool EvaluateFromValues( const EvalKit &kit, const SYM::XValue *op_values ) const override;
 
         shared_ptr<SYM::SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SYM::SymbolVariable> target ) const override;
 
@@ -26,7 +26,7 @@ shared_ptr<PatternQuery> NegationAgent::GetPatternQuery() const
 }
 
 
-void NegationAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+bool NegationAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                               const SolutionMap *hypothesis_links,
                                               PatternLink keyer_plink,
                                               const XTreeDatabase *x_tree_db ) const
@@ -39,6 +39,7 @@ void NegationAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
     
     // Context is abnormal because patterns must not match
     query.RegisterAbnormalNode( PatternLink(GetNegand()), nullptr, keyer_xlink ); // Link into X, abnormal
+    return true;
 }
 
 
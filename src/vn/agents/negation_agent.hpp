@@ -26,7 +26,7 @@ public:
 
     virtual shared_ptr<PatternQuery> GetPatternQuery() const;              
 
-    virtual void RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+    virtual bool RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const;                                              
@@ -26,7 +26,7 @@ RelocatingAgent::RelocatingQueryResult PointerIsAgent::RunRelocatingQuery( const
     {    
         // If no parent node, there's no dep to declare, assuming root xlink
         // pointer type cannot change. Might be better to refuse the query, TBD.
-        set<XLink> parent_xlinks = db->GetNodeRow(parent_node).incoming_xlinks;
+        const NodeTable::Row::XLinkSet &parent_xlinks = db->GetNodeRow(parent_node).incoming_xlinks;
         ASSERT( parent_xlinks.size() == 1 ); // parent_node has children so it should be the sole parent (rule #217)
         
         deps.AddDep( SoloElementOf(parent_xlinks) );            
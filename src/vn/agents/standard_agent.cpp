@@ -374,7 +374,7 @@ SYM::Lazy<SYM::BooleanExpression> StandardAgent::SymbolicNormalLinkedQuerySingul
 
 // ---------------------------- Regeneration Queries ----------------------------------                                               
                                                
-void StandardAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+bool StandardAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                               const SolutionMap *hypothesis_links,
                                               PatternLink keyer_plink,
                                               const XTreeDatabase *x_tree_db ) const
@@ -384,18 +384,19 @@ void StandardAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
     // Get the members of x corresponding to pattern's class
     XLink keyer_xlink = hypothesis_links->at(keyer_plink);
     ASSERT( keyer_xlink != XLink::MMAX );
-    vector< Itemiser::Element * > x_items = Itemise( keyer_xlink.GetChildTreePtr().get() );   
+    Itemiser::ElementTable x_items = GetItemiseTable( keyer_xlink.GetChildTreePtr().get() );   
 
     for( const Plan::Collection &plan_col : plan.collections )
     {
-        auto p_x_col = dynamic_cast<CollectionInterface *>(x_items[plan_col.itemise_index]);
+        CollectionInterface *p_x_col = x_items.GetCollection(plan_col.itemise_index);
         RegenerationQueryCollection( query, p_x_col, plan_col, hypothesis_links, keyer_plink, x_tree_db );
     }
     for( const Plan::Sequence &plan_seq : plan.sequences )
     {
-        auto p_x_seq = dynamic_cast<SequenceInterface *>(x_items[plan_seq.itemise_index]);
+        SequenceInterface *p_x_seq = x_items.GetSequence(plan_seq.itemise_index);
         RegenerationQuerySequence( query, p_x_seq, plan_seq, hypothesis_links, keyer_plink, x_tree_db );
     }
+    return true;
 }
 
 
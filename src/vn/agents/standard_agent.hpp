@@ -115,7 +115,7 @@ private:
     SYM::Lazy<SYM::BooleanExpression> SymbolicNormalLinkedQueryCollection(const Plan::Collection &plan_col, PatternLink keyer_plink) const;                                       
     SYM::Lazy<SYM::BooleanExpression> SymbolicNormalLinkedQuerySingular(const Plan::Singular &plan_sing, PatternLink keyer_plink) const;                                       
                                     
-    virtual void RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+    virtual bool RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const;                                              
@@ -37,7 +37,7 @@ SYM::Lazy<SYM::BooleanExpression> StarAgent::SymbolicNormalLinkedQuery(PatternLi
 }
 
 
-void StarAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+bool StarAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                           const SolutionMap *hypothesis_links,
                                           PatternLink keyer_plink,
                                           const XTreeDatabase *x_tree_db ) const
@@ -54,14 +54,20 @@ void StarAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
 
     // Nodes must be a SubContainer, since * matches multiple things
     if( !( x_sc && x_ci ) )
-        throw NotASubcontainerMismatch();
+    {
+        TRACE("Mismatch: ")(NotASubcontainerMismatch())("\n");
+        return false;
+    }
     
     // Check pre-restriction
     TRACE("StarAgent pre-res\n");
     for( const TreePtrInterface &xe : *x_ci )
     {
         if( !IsPreRestrictionMatch( (TreePtr<Node>)xe ) )
-            throw PreRestrictionMismatch();
+        {
+            TRACE("Mismatch: ")(PreRestrictionMismatch())("\n");
+            return false;
+        }
     }
      
     if( *GetRestriction() )
@@ -70,6 +76,7 @@ void StarAgent::RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
         // Apply pattern restriction - will be at least as strict as pre-restriction
         query.RegisterMultiplicityNode( PatternLink(GetRestriction()), keyer_xlink.GetChildTreePtr() ); // Links into X
     }
+    return true;
 }
 
 
@@ -180,29 +187,26 @@ bool StarAgent::IsSubContainer() const
 }
 
 
-unique_ptr<BooleanResult> StarAgent::IsSubcontainerInCategoryOperator::Evaluate( const EvalKit &kit,
-                                                                                 list<unique_ptr<SymbolicResult>> &&op_results ) const
+bool StarAgent::IsSubcontainerInCategoryOperator::EvaluateFromValues( const EvalKit &kit,
+                                                                      const XValue *op_values ) const
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
-    unique_ptr<SymbolicResult> ra = SoloElementOf(move(op_results));
-
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<BooleanResult>( false );
+    if( !op_values[0] )
+        return false;
 
-    auto x_ci = dynamic_cast<ContainerInterface *>(ra->GetOnlyXLink().GetChildTreePtr().get());
-    auto x_sc = TreePtr<SubContainer>::DynamicCast(ra->GetOnlyXLink().GetChildTreePtr());
+    auto x_ci = dynamic_cast<ContainerInterface *>(op_values[0].GetChildTreePtr().get());
+    auto x_sc = TreePtr<SubContainer>::DynamicCast(op_values[0].GetChildTreePtr());
 
     // Nodes must be a SubContainer, since * matches multiple things
     if( !( x_sc && x_ci ) )
-        return make_unique<BooleanResult>( false );
+        return false;
     
     // Check pre-restriction
     bool matches = true;
     for( const TreePtrInterface &xe : *x_ci )
         matches = matches & archetype_node->IsSubcategory( *(TreePtr<Node>)xe );            
 
-    return make_unique<BooleanResult>( matches );
+    return matches;
 }                                   
 
          
@@ -40,7 +40,7 @@ public:
 
     virtual shared_ptr<PatternQuery> GetPatternQuery() const;                
     SYM::Lazy<SYM::BooleanExpression> SymbolicNormalLinkedQuery(PatternLink keyer_plink) const override;                                       
-    virtual void RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
+    virtual bool RunRegenerationQueryImpl( DecidedQueryAgentInterface &query,
                                            const SolutionMap *hypothesis_links,
                                            PatternLink keyer_plink,
                                            const XTreeDatabase *x_tree_db ) const;                                                                                          
@@ -69,8 +69,7 @@ private:
     class IsSubcontainerInCategoryOperator : public SYM::IsInCategoryOperator
     {
         using IsInCategoryOperator::IsInCategoryOperator; 
-        virtual unique_ptr<SYM::BooleanResult> Evaluate( const EvalKit &kit,
-                                                         list<unique_ptr<SYM::SymbolicResult>> &&op_results ) const override;
+        bool EvaluateFromValues( const EvalKit &kit, const SYM::XValue *op_values ) const override;
         virtual string RenderNF() const override;
     };
 };
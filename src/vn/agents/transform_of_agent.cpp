@@ -226,7 +226,7 @@ set<AugTreePtr<Node>> TransformOfAgent::TransUtils::GetDeclarers( AugTreePtr<Nod
     if( !db->HasNodeRow(be->GetXLink().GetChildTreePtr()) ) // not found
         throw TransUtilsInterface::UnknownNode();
 
-    NodeTable::Row node_row = db->GetNodeRow( be->GetXLink().GetChildTreePtr() );  
+    const NodeTable::Row &node_row = db->GetNodeRow( be->GetXLink().GetChildTreePtr() );  
     
     // Generate ATPs from declarers
     set<AugTreePtr<Node>> atp_declarers;    
@@ -8,6 +8,7 @@
 #include "search_replace.hpp"
 #include "conjecture.hpp"
 #include "common/hit_count.hpp"
+#include "common/profiler.hpp"
 #include "agents/embedded_scr_agent.hpp"
 #include "agents/standard_agent.hpp"
 #include "agents/delta_agent.hpp"
@@ -21,6 +22,7 @@
 #include "sym/boolean_operators.hpp"
 #include "sym/rewriters.hpp"
 #include "sym/expression_analysis.hpp"
+#include "sym/sym_solver.hpp"
 
 #include <list>
   
@@ -35,18 +37,6 @@
 
 using namespace VN;
 
-AndRuleEngine::SuccessfulMatch::SuccessfulMatch( SolutionMap solution_ ) :
-	solution(solution_)
-{
-}
-
-
-const SolutionMap &AndRuleEngine::SuccessfulMatch::GetSolution() const
-{
-	return solution;
-}
-
-
 AndRuleEngine::AndRuleEngine( PatternLink base_plink, 
                               const set<PatternLink> &surrounding_plinks,
                               const set<PatternLink> &surrounding_keyer_plinks,
@@ -86,6 +76,13 @@ AndRuleEngine::Plan::Plan( AndRuleEngine *algo_,
     TRACE(algo->GetTrace())(" planning\n");
     //FTRACE("agents_to_keyers: ")(agents_to_keyers)("\n");
     // ------------------ Fill in the plan ---------------------
+    if( ReadArgs::use.contains("bdd") )
+        solver_backend = SYM::SolverBackend::BDD;
+    else if( ReadArgs::use.contains("truthtable") )
+        solver_backend = SYM::SolverBackend::TRUTH_TABLE;
+    else
+        solver_backend = SYM::SolverBackend::AUTO;
+
     surrounding_agents.clear();
     for( PatternLink plink : surrounding_plinks )
         surrounding_agents.insert( plink.GetChildAgent() );
@@ -170,6 +167,9 @@ AndRuleEngine::Plan::Plan( AndRuleEngine *algo_,
 void AndRuleEngine::Plan::PlanningStageFive( shared_ptr<const Lacing> lacing )
 {   
     // ------------------ Set up CSP solver ---------------------   
+    // Every variable the solver or our constraints can see gets an index
+    csp_plink_indices = make_shared<PatternLinkIndices>( UnionOf( current_solve_plinks, 
+                                                                  my_fixed_keyer_links ) );
     list< shared_ptr<CSP::Constraint> > constraints_list;
     CreateMyConstraints(constraints_list, lacing);
     
@@ -177,6 +177,7 @@ void AndRuleEngine::Plan::PlanningStageFive( shared_ptr<const Lacing> lacing )
     // deleted by the enclosing replace. So base_plink is the only one that
     // we can guarantee will be in the domain.
     csp_solver = CreateSolverAndHolder( constraints_list, 
+                                        csp_plink_indices,
                                         ToVector(free_normal_links_ordered), 
                                         my_fixed_keyer_links,
                                         boundary_keyer_links );    
@@ -557,7 +558,7 @@ void AndRuleEngine::Plan::CreateMyConstraints( list< shared_ptr<CSP::Constraint>
 
         SYM::PredicateAnalysis::CheckRegularPredicateForm( bexpr );
 
-        auto c = make_shared<CSP::SymbolicConstraint>(bexpr, lacing);
+        auto c = make_shared<CSP::SymbolicConstraint>(bexpr, lacing, csp_plink_indices, solver_backend);
         constraints_list.push_back(c);    
     }        
 }
@@ -633,7 +634,7 @@ void AndRuleEngine::PlanningStageFive( shared_ptr<const Lacing> lacing )
 }
 
 
-void AndRuleEngine::CompareEvaluatorLinks( Agent *agent, 
+bool AndRuleEngine::CompareEvaluatorLinks( Agent *agent, 
                                            const SolutionMap *solution_for_subordinates, 
                                            const SolutionMap *solution_for_evaluators,
                                            set<TreePtr<Node>> *keep_alive_nodes ) 
@@ -653,17 +654,8 @@ void AndRuleEngine::CompareEvaluatorLinks( Agent *agent,
         // Get x for linked node
         XLink xlink = solution_for_evaluators->at(link);
                                 
-        try 
-        {
-            shared_ptr<AndRuleEngine> e = plan.my_evaluator_abnormal_engines.at(link);
-            (void)e->Compare( xlink, solution_for_subordinates, keep_alive_nodes );
-            compare_results.push_back( true );
-        }
-        catch( const ::Mismatch &e )
-        {
-            TRACE("Caught ")(e)("\n");
-            compare_results.push_back( false );
-        }
+        shared_ptr<AndRuleEngine> e = plan.my_evaluator_abnormal_engines.at(link);
+        compare_results.push_back( e->Compare( xlink, solution_for_subordinates, keep_alive_nodes ) );
 
         i++;
     }
@@ -673,11 +665,15 @@ void AndRuleEngine::CompareEvaluatorLinks( Agent *agent,
         TRACEC(b)(" ");
     TRACEC("\n");
     if( !(*evaluator)( compare_results ) )
-        throw EvaluatorFalse();
+    {
+        TRACE("Mismatch: ")(EvaluatorFalse())("\n");
+        return false;
+    }
+    return true;
 }
 
 
-void AndRuleEngine::CompareMultiplicityNode( PatternLink plink, TreePtr<Node> node, 
+bool AndRuleEngine::CompareMultiplicityNode( PatternLink plink, TreePtr<Node> node, 
                                              const SolutionMap *solution_for_subordinates,
                                              set<TreePtr<Node>> *keep_alive_nodes ) 
 {
@@ -698,7 +694,8 @@ void AndRuleEngine::CompareMultiplicityNode( PatternLink plink, TreePtr<Node> no
         {
             TRACE("Comparing ")(xe_node)("\n");
             XLink xe_link(&xe_node);
-            (void)e->Compare( xe_link, solution_for_subordinates, keep_alive_nodes );
+            if( !e->Compare( xe_link, solution_for_subordinates, keep_alive_nodes ) )
+                return false;
         }
     }
     else if( auto xssl = dynamic_cast<SubSequence *>(xsc) )
@@ -706,17 +703,66 @@ void AndRuleEngine::CompareMultiplicityNode( PatternLink plink, TreePtr<Node> no
         for( XLink xe_link : xssl->elts )
         {
             TRACE("Comparing ")(xe_link)("\n");
-            (void)e->Compare( xe_link, solution_for_subordinates, keep_alive_nodes );
+            if( !e->Compare( xe_link, solution_for_subordinates, keep_alive_nodes ) )
+                return false;
         }
     }    
     else
     {
         ASSERT(false)("unrecognised SubContainer ")(xsc);
     }
+    return true;
 }
 
 
-void AndRuleEngine::AgentRegeneration( Agent *agent,
+bool AndRuleEngine::CompareLinks( Agent *agent,
+                                  shared_ptr<const DecidedQuery> query,
+                                  const SolutionMap &solution_for_subordinates,
+                                  set<TreePtr<Node>> *keep_alive_nodes )
+{
+    Tracer::RAIIDisable silencer;   // Shush, I'm trying to debug the NLQs
+    SolutionMap solution_for_evaluators;
+    
+    // Try matching the abnormal links (free and evaluator).
+    for( const auto &p : query->GetAbnormalNodes() )
+    {                
+        XLink xlink = p.second.first ? XLink::CreateFrom(&p.second.first) : p.second.second;
+        ASSERT( xlink );
+        
+        // Actions if evaluator link
+        if( plan.my_evaluator_abnormal_engines.count( p.first ) )                
+            InsertSolo( solution_for_evaluators, make_pair(p.first, xlink) );                
+        
+        // Actions if free link
+        if( plan.my_free_abnormal_engines.count( p.first ) )
+        {
+            shared_ptr<AndRuleEngine> e = plan.my_free_abnormal_engines.at( p.first );
+            if( !e->Compare( xlink, &solution_for_subordinates, keep_alive_nodes ) )
+                return false;
+        }
+    }                    
+    
+    // Try matching the multiplicity links.
+    for( const auto &p : query->GetMultiplicityNodes() )
+    {
+        ASSERT( p.second );
+        if( plan.my_evaluator_abnormal_engines.count( p.first ) )
+            InsertSolo( solution_for_evaluators, make_pair(p.first, XLink::CreateFrom(&p.second)) );                
+
+        if( plan.my_multiplicity_engines.count( p.first ) )
+            if( !CompareMultiplicityNode( p.first, p.second, &solution_for_subordinates, keep_alive_nodes ) )
+                return false;
+    }
+
+    // Try matching the evaluator agents.
+    if( plan.my_evaluators.count( agent ) )
+        return CompareEvaluatorLinks( agent, &solution_for_subordinates, &solution_for_evaluators, keep_alive_nodes );                    
+        
+    return true;
+}
+
+
+bool AndRuleEngine::AgentRegeneration( Agent *agent,
                                        SolutionMap &basic_solution,
                                        const SolutionMap &solution_for_subordinates,
                                        set<TreePtr<Node>> *keep_alive_nodes )
@@ -743,52 +789,16 @@ void AndRuleEngine::AgentRegeneration( Agent *agent,
     while(1)
     {
         shared_ptr<VN::DecidedQuery> query = nlq_lambda();
+        if( !query )
+            return false; // Agent has run out of queries
         i++;
                 
         TRACE("Try out query, attempt %d (1-based)\n", i);    
 
-        try // in here, only have the stuff that could throw a mismatch
-        {
-            Tracer::RAIIDisable silencer;   // Shush, I'm trying to debug the NLQs
-            SolutionMap solution_for_evaluators;
-            
-            // Try matching the abnormal links (free and evaluator).
-            for( const auto &p : query->GetAbnormalNodes() )
-            {                
-                XLink xlink = p.second.first ? XLink::CreateFrom(&p.second.first) : p.second.second;
-                ASSERT( xlink );
-                
-                // Actions if evaluator link
-                if( plan.my_evaluator_abnormal_engines.count( p.first ) )                
-                    InsertSolo( solution_for_evaluators, make_pair(p.first, xlink) );                
-                
-                // Actions if free link
-                if( plan.my_free_abnormal_engines.count( p.first ) )
-                {
-                    shared_ptr<AndRuleEngine> e = plan.my_free_abnormal_engines.at( p.first );
-                    (void)e->Compare( xlink, &solution_for_subordinates, keep_alive_nodes );
-                }
-            }                    
-            
-            // Try matching the multiplicity links.
-            for( const auto &p : query->GetMultiplicityNodes() )
-            {
-				ASSERT( p.second );
-                if( plan.my_evaluator_abnormal_engines.count( p.first ) )
-                    InsertSolo( solution_for_evaluators, make_pair(p.first, XLink::CreateFrom(&p.second)) );                
-
-                if( plan.my_multiplicity_engines.count( p.first ) )
-                    CompareMultiplicityNode( p.first, p.second, &solution_for_subordinates, keep_alive_nodes );  
-            }
-
-            // Try matching the evaluator agents.
-            if( plan.my_evaluators.count( agent ) )
-                CompareEvaluatorLinks( agent, &solution_for_subordinates, &solution_for_evaluators, keep_alive_nodes );                    
-        }
-        catch( const ::Mismatch &e )
+        if( !CompareLinks( agent, query, solution_for_subordinates, keep_alive_nodes ) )
         {
-            TRACE("Caught ")(e)(", retrying the lambda\n");    
-            continue; // deal with exception by iterating the loop 
+            TRACE("Mismatch, retrying the lambda\n");    
+            continue; 
         }     
                                         
         // Replace needs these keys 
@@ -816,13 +826,15 @@ void AndRuleEngine::AgentRegeneration( Agent *agent,
     } 
     // Memory safety: clear out the conjecture once done.
     plan.agents_to_nlq_conjectures.at(agent)->Reset(); 
+    return true;
 }      
 
 
-void AndRuleEngine::OnSolution(SolutionMap basic_solution, 
+bool AndRuleEngine::OnSolution(SolutionMap basic_solution, 
                                const SolutionMap &my_fixed_assignments, 
                                const SolutionMap *universal_assignments,
-                               set<TreePtr<Node>> *keep_alive_nodes)
+                               set<TreePtr<Node>> *keep_alive_nodes,
+                               SolutionMap *solution)
 {
     INDENT("S");
     // Merge my fixes into the solution (but we're not expected to merge
@@ -834,35 +846,31 @@ void AndRuleEngine::OnSolution(SolutionMap basic_solution,
 	for( auto plink : plan.my_normal_links )
 		ASSERT( basic_solution.count(plink) > 0 )("Cannot find normal link ")(plink)("\nIn ")(basic_solution)("\n");
 	
-	try
-	{
-		SolutionMap solution_for_subordinates = *universal_assignments;
-		for( auto p : basic_solution )
-			solution_for_subordinates[p.first] = p.second;
-			
-		TRACE("---------------- Regeneration ----------------\n");      
-		TRACEC("Basic solution ")(basic_solution)("\n");    
+	SolutionMap solution_for_subordinates = *universal_assignments;
+	for( auto p : basic_solution )
+		solution_for_subordinates[p.first] = p.second;
+		
+	TRACE("---------------- Regeneration ----------------\n");      
+	TRACEC("Basic solution ")(basic_solution)("\n");    
 
-		for( Agent *agent : plan.my_normal_agents )
+	for( Agent *agent : plan.my_normal_agents )
+	{
+		if( !AgentRegeneration( agent, 
+							    basic_solution,
+							    solution_for_subordinates,
+							    keep_alive_nodes ) )
 		{
-			AgentRegeneration( agent, 
-							   basic_solution,
-							   solution_for_subordinates,
-							   keep_alive_nodes );
+			TRACE("Regeneration mismatched, trying next solution\n");
+			return false; 
 		}
-
-		TRACE("Regeneration successful, we have a match\n");
-	}
-	catch( const ::Mismatch &e )
-	{                
-		TRACE("Caught ")(e)(" after recursion, trying next solution\n");
-		return; 
 	}
-	
-	// We succeeded and basic_solution is the right set of keys. Throw the solution
-	// in an exception though the CSP algo, in order to abort the solve process.
+
+	// We succeeded and basic_solution is the right set of keys. Accepting 
+	// it will stop the CSP algo.
 	TRACE("AndRuleEngine hit\n");
-	throw SuccessfulMatch(basic_solution);
+	if( solution )
+		*solution = basic_solution;
+	return true;
 }
 
 
@@ -880,9 +888,13 @@ void AndRuleEngine::SetXTreeDb( shared_ptr<const XTreeDatabase> x_tree_db_ )
 }
 
 
-SolutionMap AndRuleEngine::Compare( XLink base_xlink,
-                                    const SolutionMap *universal_assignments,
-                                    set<TreePtr<Node>> *keep_alive_nodes )
+bool AndRuleEngine::Compare( XLink base_xlink,
+                             const SolutionMap *universal_assignments,
+                             set<TreePtr<Node>> *keep_alive_nodes,
+                             SolutionMap *solution,
+                             const set<XLink> *first_var_candidates,
+                             list<set<XLink>> *further_regions,
+                             size_t max_further_regions )
 {
     INDENT("C");
     ASSERT( base_xlink );            
@@ -913,28 +925,60 @@ SolutionMap AndRuleEngine::Compare( XLink base_xlink,
 		surrounding_and_base_links[plink] = xlink;
 	}
         
-    plan.csp_solver->Start( surrounding_and_base_links, x_tree_db.get() );    
+    plan.csp_solver->Start( surrounding_and_base_links, x_tree_db.get(), first_var_candidates );    
     
 	// Bind our OnSolution function as the solution handler for the solver
-    CSP::Solver::SolutionReportFunction on_solution_function = std::bind( &AndRuleEngine::OnSolution, 
-																		  this, 
-																		  placeholders::_1, 
-																		  my_fixed_assignments, 
-																		  universal_assignments,
-																		  keep_alive_nodes );      	
+	bool matched = false;
+	set<XLink> gathered_xlinks;
+	size_t num_further_regions = 0;
+	auto get_region = [](const CSP::Solution &basic_solution)
+	{
+		set<XLink> region;
+		for( auto p : basic_solution )
+			if( p.second != XLink::MMAX && p.second != XLink::OffEnd ) // shared by all solutions
+				region.insert( p.second );
+		return region;
+	};
+    CSP::Solver::SolutionReportFunction on_solution_function = [&](const CSP::Solution &basic_solution)
+    {
+		if( matched )
+		{
+			// Gathering regions after a match. Not regenerated, so the 
+			// caller must Compare() again to be sure of a hit. We stop at the 
+			// first overlapping solution, because eg a Star can give any number 
+			// of solutions that differ only in one small part.
+			set<XLink> region = get_region( basic_solution );
+			for( XLink xlink : region )
+				if( gathered_xlinks.count(xlink) > 0 )
+					return true;
+			gathered_xlinks.insert( region.begin(), region.end() );
+			further_regions->push_back( move(region) );
+			num_further_regions++;
+			return num_further_regions >= max_further_regions;
+		}
+		
+		matched = OnSolution( basic_solution, 
+		                      my_fixed_assignments, 
+		                      universal_assignments,
+		                      keep_alive_nodes,
+		                      solution );
+		if( !matched || !further_regions || max_further_regions==0 )
+			return matched;
+			
+		// Keep going, treating the match's region as already taken
+		gathered_xlinks = get_region( basic_solution );
+		return false; 
+	};
     
-	try
-	{    
-		plan.csp_solver->Run( on_solution_function );  	
-		// CSP solver returns when there are no further solutions.
-		plan.csp_solver->Stop();
-		throw AndRuleMismatch();
-	}
-	catch( const SuccessfulMatch &sm )
-	{ 
-		plan.csp_solver->Stop();
-		return sm.GetSolution();   // We got a match so we're done. 
-	}	
+    // CSP solver returns when a solution is accepted or there are no further solutions.
+    {
+        Profiler::Span span( Profiler::Kind::SOLVER_RUN );
+        plan.csp_solver->Run( on_solution_function );  	
+    }
+	plan.csp_solver->Stop();
+	if( !matched )
+		TRACE("Mismatch: ")(AndRuleMismatch())("\n");
+	return matched; 
 }
 
 
@@ -1003,6 +1047,14 @@ list<const AndRuleEngine *> AndRuleEngine::GetAndRuleEnginesInclThis() const
 }
 
 
+bool AndRuleEngine::HasAbnormalEngines() const
+{
+    return !plan.my_free_abnormal_engines.empty() ||
+           !plan.my_evaluator_abnormal_engines.empty() ||
+           !plan.my_multiplicity_engines.empty();
+}
+
+
 shared_ptr<Conjecture> AndRuleEngine::GetNLQConjecture(const Agent *agent) const
 {
 	return plan.agents_to_nlq_conjectures.at(agent);
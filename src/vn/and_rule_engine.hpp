@@ -18,6 +18,11 @@
 #include <map>
 
 class Graph;
+
+namespace SYM
+{
+enum class SolverBackend;
+}
     
 namespace VN 
 {
@@ -33,7 +38,8 @@ class AndRuleEngine : public virtual GraphIdable,
                       public SerialNumber
 {
 public:
-    // Any mismatch this class throws
+    // Any mismatch this class reports. Mismatches are returned, not 
+    // thrown; these are for trace.
     class Mismatch : public ::Mismatch
     {
     };
@@ -47,16 +53,6 @@ public:
     class EvaluatorFalse : public Mismatch
     {
     };
-    
-    // A solution was discovered to be a match
-    class SuccessfulMatch : public Exception
-    {
-	public:
-		SuccessfulMatch( SolutionMap solution_ );
-		const SolutionMap &GetSolution() const;
-	private:
-		SolutionMap solution;
-    };
 
     AndRuleEngine( PatternLink base_plink, 
                    const set<PatternLink> &surrounding_plinks,
@@ -119,6 +115,7 @@ public:
         map< PatternLink, shared_ptr<AndRuleEngine> > my_evaluator_abnormal_engines;
         map< PatternLink, shared_ptr<AndRuleEngine> > my_multiplicity_engines;
         shared_ptr<CSP::Solver> csp_solver;
+        shared_ptr<const PatternLinkIndices> csp_plink_indices; // for CSP::Assignments
         
         const PatternLink base_plink;
         Agent * const base_agent;
@@ -143,6 +140,7 @@ public:
         set<PatternLink> current_solve_plinks;
         list<PatternLink> normal_and_boundary_links_preorder;
         map<const Agent *, shared_ptr<Conjecture>> agents_to_nlq_conjectures;
+        SYM::SolverBackend solver_backend; // for our symbolic constraints
 
     private: // working variables in plan construction
         set<Agent *> reached_agents;
@@ -152,30 +150,42 @@ public:
     void PlanningStageFive( shared_ptr<const Lacing> lacing );      
     
 private:        
-    void CompareLinks( Agent *agent,
-                       shared_ptr<const DecidedQuery> query );
-    void DecidedCompare( LocatedLink link );
-    void CompareEvaluatorLinks( Agent *agent, 
+    // These return false on mismatch
+    bool CompareLinks( Agent *agent,
+                       shared_ptr<const DecidedQuery> query,
+                       const SolutionMap &solution_for_subordinates,
+                       set<TreePtr<Node>> *keep_alive_nodes );
+    bool CompareEvaluatorLinks( Agent *agent, 
                                 const SolutionMap *solution_for_subordinates, 
                                 const SolutionMap *solution_for_evaluators,
                                 set<TreePtr<Node>> *keep_alive_nodes );
-    void CompareMultiplicityNode( PatternLink plink, TreePtr<Node> node, 
+    bool CompareMultiplicityNode( PatternLink plink, TreePtr<Node> node, 
                                   const SolutionMap *solution_for_subordinates,
                                   set<TreePtr<Node>> *keep_alive_nodes ); 
-    void AgentRegeneration( Agent *agent,
+    bool AgentRegeneration( Agent *agent,
                             SolutionMap &basic_solution,
                             const SolutionMap &solution_for_subordinates,
                             set<TreePtr<Node>> *keep_alive_nodes );
-    void OnSolution(SolutionMap basic_solution, 
+    bool OnSolution(SolutionMap basic_solution, 
                     const SolutionMap &my_fixed_assignments, 
                     const SolutionMap *universal_assignments,
-                    set<TreePtr<Node>> *keep_alive_nodes);
+                    set<TreePtr<Node>> *keep_alive_nodes,
+                    SolutionMap *solution);
     
 public:
     void SetXTreeDb( shared_ptr<const XTreeDatabase> x_tree_db );
-    SolutionMap Compare( XLink base_xlink,
-                         const SolutionMap *universal_assignments,
-                         set<TreePtr<Node>> *keep_alive_nodes );
+    // Returns false on mismatch. On a match, solution (if non-null) gets the keys.
+    // If further_regions is non-null, the solver carries on after the match and the
+    // xlinks of up to max_further_regions more solutions are put into it. It stops at
+    // the first one that overlaps the match or an earlier one. These are unverified: 
+    // only candidates.
+    bool Compare( XLink base_xlink,
+                  const SolutionMap *universal_assignments,
+                  set<TreePtr<Node>> *keep_alive_nodes,
+                  SolutionMap *solution = nullptr,
+                  const set<XLink> *first_var_candidates = nullptr,
+                  list<set<XLink>> *further_regions = nullptr,
+                  size_t max_further_regions = 0 );
 
     const set<Agent *> &GetKeyedAgents() const;
     set<PatternLink> GetKeyerPatternLinks() const;
@@ -185,6 +195,10 @@ public:
     
     set< shared_ptr<SYM::BooleanExpression> > GetExpressions() const;
     list<const AndRuleEngine *> GetAndRuleEnginesInclThis() const;
+    
+    // Abnormal and multiplicity engines can succeed because something is 
+    // absent (eg negation), so deleting nodes can make us match
+    bool HasAbnormalEngines() const;
 
     shared_ptr<Conjecture> GetNLQConjecture(const Agent *agent) const;
 
@@ -7,6 +7,7 @@
 #include "common/common.hpp"
 #include "../sym/value.hpp"
 #include "../sym/expression.hpp"
+#include "../dense_solution.hpp"
 
 #include <memory>
 #include <list>
@@ -20,7 +21,7 @@ class Agent;
 
 namespace SYM
 {
-class SubsetResult;
+class SymbolicResult;
 };
 
 namespace CSP
@@ -28,8 +29,8 @@ namespace CSP
 typedef SYM::XValue Value;
 typedef VN::PatternLink VariableId;
 typedef VN::LocatedLink Assignment;
-typedef map<VariableId, Value> Assignments;
-typedef Assignments Solution;
+typedef VN::DenseSolution Assignments; // indexed by the engine's VN::PatternLinkIndices
+typedef VN::SolutionMap Solution;
 typedef pair<VariableId, set<Value>> Hint;
 
 
@@ -89,8 +90,8 @@ public:
      * 
      * @note the returned set is allowed to contain inconsistent values. 
      */
-    virtual unique_ptr<SYM::SubsetResult> GetSuggestedValues( const Assignments &assignments,
-                                                              const VariableId &var ) const = 0;        
+    virtual unique_ptr<SYM::SymbolicResult> GetSuggestedValues( const Assignments &assignments,
+                                                                const VariableId &var ) const = 0;        
     
     string GetTrace() const;
 
@@ -18,11 +18,13 @@ using namespace CSP;
 
 ReferenceSolver::Plan::Plan( ReferenceSolver *algo_,
                              const list< shared_ptr<Constraint> > &constraints_, 
+                             shared_ptr<const VN::PatternLinkIndices> plink_indices_,
                              const vector<VariableId> &free_variables_, 
                              const set<VariableId> &domain_forced_variables_, 
                              const set<VariableId> &arbitrary_forced_variables_ ) :
     algo( algo_ ), 
     constraints(constraints_),
+    plink_indices(plink_indices_),
     free_variables(free_variables_),
     domain_forced_variables(domain_forced_variables_),
     arbitrary_forced_variables(arbitrary_forced_variables_)
@@ -40,11 +42,13 @@ void ReferenceSolver::Plan::DeduceVariables()
 {   
     set<VariableId> free_variables_set;
     free_variables_to_indices.clear();
+    free_variable_plink_indices.clear();
     for( set<VariableId>::size_type i=0; i<free_variables.size(); i++ )   
     {    
         const VariableId &v = free_variables.at(i);
         InsertSolo(free_variables_set, v); // Checks free vars are unique
         free_variables_to_indices[v] = i;
+        free_variable_plink_indices.push_back( plink_indices->GetIndex(v) );
     }
     
     // Checks that forced vars are unique and disjoint
@@ -133,23 +137,28 @@ string ReferenceSolver::Plan::GetTrace() const
 
 
 ReferenceSolver::ReferenceSolver( const list< shared_ptr<Constraint> > &constraints, 
+                                  shared_ptr<const VN::PatternLinkIndices> plink_indices,
                                   const vector<VariableId> &free_variables, 
                                   const set<VariableId> &domain_forced_variables, 
                                   const set<VariableId> &arbitrary_forced_variables ) :
-    plan( this, constraints, free_variables, domain_forced_variables, arbitrary_forced_variables ),
+    plan( this, constraints, plink_indices, free_variables, domain_forced_variables, arbitrary_forced_variables ),
     solution_report_function(),
-    rejection_report_function()
+    rejection_report_function(),
+    first_var_candidates( nullptr ),
+    solution_accepted( false ),
+    assignments( plink_indices )
 {
 }
                         
 
-void ReferenceSolver::Start( const Assignments &forces,
-                             const VN::XTreeDatabase *x_tree_db_ )
+void ReferenceSolver::Start( const Solution &forces,
+                             const VN::XTreeDatabase *x_tree_db_,
+                             const set<Value> *first_var_candidates_ )
 {
     TRACE("Reference solver begins\n");
     INDENT("S");
-    forced_assignments = forces;
     x_tree_db = x_tree_db_;
+    first_var_candidates = first_var_candidates_;
 
     // Check that the forces passed to us here match the plan
     for( VariableId v : plan.domain_forced_variables )           
@@ -163,16 +172,18 @@ void ReferenceSolver::Start( const Assignments &forces,
     for( shared_ptr<CSP::Constraint> c : plan.constraints )
         c->Start(x_tree_db);
 
-    assignments = forced_assignments;    
+    assignments.Clear();
+    for( const pair<const VariableId, Value> &p : forces )
+        assignments.Set( p.first, p.second );
 }
 
 
 void ReferenceSolver::Stop()
 {
-	forced_assignments.clear();
-	assignments.clear();
+	assignments.Clear();
 	value_selectors.clear();
 	success_count.clear();
+	first_var_candidates = nullptr;
 }
 
     
@@ -185,6 +196,7 @@ void ReferenceSolver::Run( const SolutionReportFunction &solution_report_functio
     ScopedAssign<RejectionReportFunction> sa2(rejection_report_function, rejection_report_function_);
     ASSERT( solution_report_function );
     // Don't assert on rejection_report_function - it's optional
+    solution_accepted = false;
 
     // Do a test with the fully forced constraints (i.e. all vars are forced) with no assignments 
     // (=free variables), so fully forced constraints will be tested. From here on we can test only 
@@ -199,7 +211,7 @@ void ReferenceSolver::Run( const SolutionReportFunction &solution_report_functio
         // Current assignments are believed to be a no-good set so reject
         // them (for a test harness to check).
         if( rejection_report_function )
-            rejection_report_function( Assignments{} );
+            rejection_report_function( Assignments(plan.plink_indices) );
         return; // We failed with no assignments, so we cannot match - no solutions will be reported
     }
     
@@ -207,7 +219,7 @@ void ReferenceSolver::Run( const SolutionReportFunction &solution_report_functio
     {
         TRACE("Reference solver matched on forced variables and no frees\n");  
         // No free vars, so we've got a solution
-        solution_report_function( Assignments{} );
+        solution_accepted = solution_report_function( Solution{} );
     }
     else
     {                
@@ -230,7 +242,8 @@ void ReferenceSolver::Solve()
         make_shared<ValueSelector>( plan.affected_constraints.at(current_var_index), 
                                     x_tree_db, 
                                     assignments, 
-                                    plan.free_variables.at(current_var_index) );
+                                    plan.free_variables.at(current_var_index),
+                                    first_var_candidates );
     success_count[current_var_index] = 0; 
     TRACEC("Starting at and made selector for X")(current_var_index)("\n");
 
@@ -242,7 +255,7 @@ void ReferenceSolver::Solve()
 
         if( !value ) // no consistent value
         {
-            TRACEC("No-good set size %d:\n", assignments.size())(assignments)("\n");
+            TRACEC("No-good set size %d:\n", assignments.GetNumAssigned())(assignments)("\n");
             bool cease = AssignUnsuccessful();
           
             // Current assignments are believed to be a no-good set so reject
@@ -256,6 +269,8 @@ void ReferenceSolver::Solve()
         else
         {
             AssignSuccessful();
+            if( solution_accepted )
+                break;
         }
     }        
     TRACEC("Finished solving\n");
@@ -280,9 +295,10 @@ void ReferenceSolver::AssignSuccessful()
     {
         TRACEC("Success: Reporting solution\n");
         // Engine wants free assignments only, don't annoy it.
-        Assignments free_assignments = DifferenceOfSolo( assignments, 
-                                                         forced_assignments );
-        solution_report_function( free_assignments );
+        Solution free_assignments;
+        for( vector<VariableId>::size_type i=0; i<plan.free_variables.size(); i++ )
+            free_assignments[plan.free_variables[i]] = assignments.Get( plan.free_variable_plink_indices[i] );
+        solution_accepted = solution_report_function( free_assignments );
         current_var_index--;
         TRACEC("Back to X")(current_var_index)("\n");                
     }                    
@@ -295,7 +311,7 @@ bool ReferenceSolver::AssignUnsuccessful()
     
     // We may or may not have managed to put a value into assignments 
     // before giving up so no EraseSolo()
-    assignments.erase( plan.free_variables.at(current_var_index) );         
+    assignments.Erase( plan.free_variable_plink_indices.at(current_var_index) );         
     TRACE("Killed selector for X")(current_var_index)("\n");
     
     if( current_var_index == 0 )
@@ -314,13 +330,14 @@ ReferenceSolver::SelectNextValueRV ReferenceSolver::TryFindNextConsistentValue(
     TRACE("Finding value for variable X")(my_var_index)("\n");
     
     const ConstraintSet &constraints_to_test = plan.completed_constraints.at(my_var_index);
+    const int my_plink_index = plan.free_variable_plink_indices.at(my_var_index);
 
     ConstraintSet all_unsatisfied;     
     int values_tried_count = 0;
 
     while( Value value = value_selectors.at(my_var_index)->GetNextValue() )
     {       
-        assignments[plan.free_variables.at(my_var_index)] = value;
+        assignments.Set( my_plink_index, value );
               
         bool consistent;
         ConstraintSet unsatisfied;     
@@ -337,7 +354,7 @@ ReferenceSolver::SelectNextValueRV ReferenceSolver::TryFindNextConsistentValue(
         else
         {
             TRACEC("Value ")(value)(" for X")(my_var_index)(" is inconsistent with constraints (")(unsatisfied)("\n");
-            EraseSolo( assignments, plan.free_variables.at(my_var_index) );
+            assignments.Erase( my_plink_index );
         }
     }
     TRACEC("No consistent values found for X")(my_var_index)("\n");
@@ -374,24 +391,24 @@ void ReferenceSolver::ShowBestAssignment()
 {
     Assignments &assignments_to_show = assignments;
     INDENT("B");
-    if( assignments_to_show.empty() )
+    if( assignments_to_show.IsEmpty() )
         return; // didn't get around to updating it yet
-    TRACE("FREE VARIABLES: assigned %d of %d:\n", assignments_to_show.size(), plan.free_variables.size());
+    TRACE("FREE VARIABLES: assigned %d of %d:\n", assignments_to_show.GetNumAssigned(), plan.free_variables.size());
     for( VariableId var : plan.free_variables )
     {
         TRACEC(var);
-        if( assignments_to_show.count(var) > 0 )
+        if( assignments_to_show.IsAssigned(var) )
         {
-            TRACE(" assigned ")(assignments_to_show.at(var));
-            if( var.GetChildAgent()->IsLocalMatch(*(assignments_to_show.at(var).GetChildTreePtr())) || 
-                assignments_to_show.at(var) == SYM::XValue::MMAX )
+            TRACE(" assigned ")(assignments_to_show.Get(var));
+            if( var.GetChildAgent()->IsLocalMatch(*(assignments_to_show.Get(var).GetChildTreePtr())) || 
+                assignments_to_show.Get(var) == SYM::XValue::MMAX )
             {
                 TRACEC(" is a local match\n");
             }
             else
             {
                 TRACEC(" is not a local match (two reasons this might be OK)\n");            
-                ASSERT(assignments_to_show.size() <= plan.free_variables.size())("local mismatch in passing complete assignment");
+                ASSERT(assignments_to_show.GetNumAssigned() <= (int)plan.free_variables.size())("local mismatch in passing complete assignment");
             }
             // Reason 1: At the point we gave up, no constraint containing this 
             // variable had all of its required variables assigned.
@@ -37,16 +37,20 @@ public:
      * 
      * @param [input] constraints the list of constraints that the solver will try to satisfy
      * 
+     * @param [input] plink_indices indices for all the variables, shared with the constraints
+     * 
      * @param [input] if non-null, the variables to use. Must be the same set that we would deduce from querying the constraints, but in any order.
      */
     ReferenceSolver( const list< shared_ptr<Constraint> > &constraints, 
+                     shared_ptr<const VN::PatternLinkIndices> plink_indices,
                      const vector<VariableId> &free_variables, 
                      const set<VariableId> &domain_forced_variables, 
                      const set<VariableId> &arbitrary_forced_variables );
     ~ReferenceSolver();
 
-    void Start( const Assignments &forces,
-                const VN::XTreeDatabase *x_tree_db ) override;
+    void Start( const Solution &forces,
+                const VN::XTreeDatabase *x_tree_db,
+                const set<Value> *first_var_candidates ) override;
                 
     void Stop() override;
 				
@@ -58,6 +62,7 @@ protected:
     {
         Plan( ReferenceSolver *algo,
               const list< shared_ptr<Constraint> > &constraints, 
+              shared_ptr<const VN::PatternLinkIndices> plink_indices,
               const vector<VariableId> &free_variables, 
               const set<VariableId> &domain_forced_variables, 
               const set<VariableId> &arbitrary_forced_variables );
@@ -66,11 +71,13 @@ protected:
     
         ReferenceSolver * const algo;
         const list< shared_ptr<Constraint> > constraints;
+        const shared_ptr<const VN::PatternLinkIndices> plink_indices;
         const vector<VariableId> free_variables;
         const set<VariableId> domain_forced_variables;
         const set<VariableId> arbitrary_forced_variables;
         
         map<VariableId, int> free_variables_to_indices;
+        vector<int> free_variable_plink_indices; // into Assignments
         ConstraintSet constraint_set;
         ConstraintSet fully_forced_constraint_set;
         map< shared_ptr<Constraint>, set<int> > free_var_indices_for_constraint;
@@ -98,9 +105,10 @@ protected:
     
     // Used during solve - depends on pattern and x
     const VN::XTreeDatabase *x_tree_db;
-    Assignments forced_assignments;
+    const set<Value> *first_var_candidates;
         
     vector<VariableId>::size_type current_var_index;
+    bool solution_accepted;
     Assignments assignments;
     map< int, shared_ptr<ValueSelector> > value_selectors;
     map< int, int > success_count;
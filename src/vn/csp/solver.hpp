@@ -23,8 +23,8 @@ namespace CSP
  * simplify unwind, since it's likely to produce multiple solutions and we 
  * may not be able to use the first (eg a sub-engine mismatches). So we 
  * provide an observer interface and leave it to that class's implementation 
- * to "just deal with it". This class has no idea how that will happen
- * but hopes it will be both fun and safe.
+ * to "just deal with it". The observer's return value tells us whether
+ * to keep going.
  */
 class Solver : public Traceable,
                public SerialNumber
@@ -33,8 +33,9 @@ public:
 
     /**
      * Function supplied to Solver objects for discovered solution reportage.
+     * Returns true if the solution was accepted, which ends the solve.
      */    
-    typedef function<void(const Solution &solution)> SolutionReportFunction;
+    typedef function<bool(const Solution &solution)> SolutionReportFunction;
     
     /**
      * Function supplied to Solver objects for rejected partial assignment reportage.
@@ -59,12 +60,15 @@ public:
     /**
      * Prepare to solve.
      * 
-     * @param forces [in] partial assignment with values for all forced variables.
+     * @param forces [in] values for all the forced variables.
      * 
      * @param x_tree_db [in] database of information about the current values.
+     * 
+     * @param first_var_candidates [in] if non-null, only these values will be tried for the first free variable.
      */
-    virtual void Start( const Assignments &forces,
-                        const VN::XTreeDatabase *x_tree_db ) = 0;
+    virtual void Start( const Solution &forces,
+                        const VN::XTreeDatabase *x_tree_db,
+                        const set<Value> *first_var_candidates = nullptr ) = 0;
                       
 	/**
 	 * Clear down member data structures after solving is done
@@ -78,9 +82,9 @@ public:
 
 
     /**
-     * Run the solver to exhaustion (i.e. it will discover all the
-     * solutions). Solutions will be reported using the supplied function. If that
-     * function wants to abort the solve, it should throw an exception.    
+     * Run the solver until a solution is accepted or to exhaustion (i.e. it 
+     * will discover all the solutions). Solutions will be reported using the 
+     * supplied function, which accepts a solution by returning true.
      * 
      * @param solution_report_function [inout] solutions reported by calling this (required).
      * 
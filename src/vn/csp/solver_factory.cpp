@@ -11,17 +11,20 @@ using namespace CSP;
 //#define USE_REF_SOLVER_ONLY
 
 shared_ptr<CSP::Solver> CSP::CreateSolverAndHolder( const list< shared_ptr<Constraint> > &constraints, 
+                                                    shared_ptr<const VN::PatternLinkIndices> plink_indices,
                                                     const vector<VariableId> &free_variables, 
                                                     const set<VariableId> &domain_forced_variables, 
                                                     const set<VariableId> &arbitrary_forced_variables )
 {
 #ifdef USE_REF_SOLVER_ONLY
     auto salg = make_shared<CSP::ReferenceSolver>( constraints, 
+                                                   plink_indices,
                                                    free_variables, 
                                                    domain_forced_variables, 
                                                    arbitrary_forced_variables );
 #else                                                   
     auto salg = make_shared<CSP::BackjumpingSolver>( constraints, 
+                                                     plink_indices,
                                                      free_variables, 
                                                      domain_forced_variables, 
                                                      arbitrary_forced_variables );
@@ -30,6 +33,7 @@ shared_ptr<CSP::Solver> CSP::CreateSolverAndHolder( const list< shared_ptr<Const
     if( ReadArgs::test_csp )
     {
         auto refalg = make_shared<CSP::ReferenceSolver>( constraints, 
+                                                         plink_indices,
                                                          free_variables, 
                                                          domain_forced_variables, 
                                                          arbitrary_forced_variables );
@@ -7,6 +7,7 @@
 namespace CSP
 {     
 shared_ptr<CSP::Solver> CreateSolverAndHolder( const list< shared_ptr<Constraint> > &constraints, 
+                                               shared_ptr<const VN::PatternLinkIndices> plink_indices,
                                                const vector<VariableId> &free_variables, 
                                                const set<VariableId> &domain_forced_variables, 
                                                const set<VariableId> &arbitrary_forced_variables );
@@ -9,11 +9,12 @@ SolverTest::SolverTest( shared_ptr<Solver> reference_solver_,
 {
 }
 
-void SolverTest::Start( const Assignments &forces,
-                        const VN::XTreeDatabase *x_tree_db )
+void SolverTest::Start( const Solution &forces,
+                        const VN::XTreeDatabase *x_tree_db,
+                        const set<Value> *first_var_candidates )
 {
-    reference_solver->Start(forces, x_tree_db);
-    solver_under_test->Start(forces, x_tree_db);
+    reference_solver->Start(forces, x_tree_db, first_var_candidates);
+    solver_under_test->Start(forces, x_tree_db, first_var_candidates);
 }
 
 
@@ -35,6 +36,7 @@ void SolverTest::Run( const SolutionReportFunction &solution_report_function,
     auto reference_srl = [&](const Solution &solution)
     {         
         reference_solutions.insert( solution );
+        return false; // keep going so we get them all
     };
     reference_solver->Run( reference_srl, RejectionReportFunction() );
     
@@ -44,12 +46,14 @@ void SolverTest::Run( const SolutionReportFunction &solution_report_function,
     { 
         ASSERT( reference_solutions.count( solution ) > 0 );
         under_test_solutions.insert( solution );
+        return false; 
     };
     auto under_test_rrl = [&](const Assignments &assigns)
     { 
+        Solution assigns_map = assigns.GetMap();
         for( const Solution &s : reference_solutions )
         {
-            ASSERT( !IsIncludes( s, assigns ) )
+            ASSERT( !IsIncludes( s, assigns_map ) )
                   ("Reference assignment was rejected by solver under test");
         }
     };
@@ -67,7 +71,8 @@ void SolverTest::Run( const SolutionReportFunction &solution_report_function,
     // Wait till we've passed before reporting solutions, because it generates logging
     for( const Solution &s : reference_solutions )
     {
-        solution_report_function( s );
+        if( solution_report_function( s ) )
+            break;
     }
 }
 
@@ -12,8 +12,9 @@ public:
     SolverTest( shared_ptr<Solver> reference_solver,
                 shared_ptr<Solver> solver_under_test );    
 
-    void Start( const Assignments &forces,
-                const VN::XTreeDatabase *x_tree_db ) override;
+    void Start( const Solution &forces,
+                const VN::XTreeDatabase *x_tree_db,
+                const set<Value> *first_var_candidates ) override;
     void Stop() override;
     void Run( const SolutionReportFunction &solution_report_function,
               const RejectionReportFunction &rejection_report_function ) override;
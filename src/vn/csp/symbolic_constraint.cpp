@@ -7,32 +7,41 @@
 #include "../sym/symbol_operators.hpp"
 #include "../sym/sym_solver.hpp"
 #include "../sym/result.hpp"
+#include "../sym/compiled_expression.hpp"
 #include "common/lambda_loops.hpp"
 
 #include <inttypes.h> 
 
 //#define CHECK_ASSIGNMENTS_INLCUDES_REQUIRED_VARS
+//#define CHECK_COMPILED_EXPRESSION
 #define COMPARE_HINTS
 
 using namespace CSP;
 
 SymbolicConstraint::SymbolicConstraint( shared_ptr<SYM::BooleanExpression> expression,
-                                        shared_ptr<const VN::Lacing> lacing ) :
-    plan( this, expression, lacing )
+                                        shared_ptr<const VN::Lacing> lacing,
+                                        shared_ptr<const VN::PatternLinkIndices> plink_indices,
+                                        SYM::SolverBackend solver_backend ) :
+    plan( this, expression, lacing, plink_indices, solver_backend )
 {
 }
 
 
 SymbolicConstraint::Plan::Plan( SymbolicConstraint *algo_,
                                 shared_ptr<SYM::BooleanExpression> expression_,
-                                shared_ptr<const VN::Lacing> lacing_ ) :
+                                shared_ptr<const VN::Lacing> lacing_,
+                                shared_ptr<const VN::PatternLinkIndices> plink_indices_,
+                                SYM::SolverBackend solver_backend_ ) :
     algo( algo_ ),
     consistency_expression( expression_ ),
-    lacing( lacing_ )
+    lacing( lacing_ ),
+    plink_indices( plink_indices_ ),
+    solver_backend( solver_backend_ )
 {
     DetermineVariables();   
     DetermineHintExpressions();   
     DetermineVariablesRequiringDB(); 
+    DetermineCompiledExpression();
 }
 
 
@@ -49,7 +58,7 @@ void SymbolicConstraint::Plan::DetermineHintExpressions()
    
     // Truth-table solver
     SYM::Expression::SolveKit kit { lacing.get() };    
-    SYM::TruthTableSolver my_solver(kit, consistency_expression);
+    SYM::TruthTableSolver my_solver(kit, consistency_expression, solver_backend);
     my_solver.PreSolve();    
         
     for( VariableId v : variables )
@@ -82,6 +91,14 @@ void SymbolicConstraint::Plan::DetermineVariablesRequiringDB()
 }   
 
 
+void SymbolicConstraint::Plan::DetermineCompiledExpression()
+{
+    // IsSatisfied() is the innermost check of the solver, so don't allocate
+    // results for every node of the expression on every call
+    compiled_expression = make_shared<SYM::CompiledExpression>( consistency_expression, plink_indices );
+}
+
+
 string SymbolicConstraint::Plan::GetTrace() const 
 {
     return algo->GetTrace() + ".plan";
@@ -113,33 +130,37 @@ bool SymbolicConstraint::IsSatisfied( const Assignments &assignments ) const
 
 #ifdef CHECK_ASSIGNMENTS_INLCUDES_REQUIRED_VARS
     for( VariableId v : plan.variables )
-        ASSERT( assignments.count(v)==1 );
+        ASSERT( assignments.IsAssigned(v) );
 #endif        
     SYM::Expression::EvalKit kit { &assignments, x_tree_db };    
+    bool satisfied = plan.compiled_expression->Evaluate( kit );
+#ifdef CHECK_COMPILED_EXPRESSION
     unique_ptr<SYM::BooleanResult> result = plan.consistency_expression->Evaluate( kit );
     ASSERT( result );
+    ASSERT( result->IsDefinedAndTrue() == satisfied )(*result)(" but compiled gives ")(satisfied);
+#endif    
     if( plan.alt_expression_for_testing )
     {
         // Test that the truth table solver's version of the consistency expression
         // agrees with the original one
         unique_ptr<SYM::BooleanResult> alt_result = plan.alt_expression_for_testing->Evaluate( kit );
         ASSERT( alt_result );
-        ASSERT( *alt_result == *result )(*alt_result)(" != ")(*result);
+        ASSERT( alt_result->IsDefinedAndTrue() == satisfied )(*alt_result)(" but expected ")(satisfied);
     }
     
-    return result->IsDefinedAndTrue(); 
+    return satisfied; 
 }
 
 
-unique_ptr<SYM::SubsetResult> SymbolicConstraint::GetSuggestedValues( const Assignments &assignments,
-                                                                   const VariableId &target_var ) const
+unique_ptr<SYM::SymbolicResult> SymbolicConstraint::GetSuggestedValues( const Assignments &assignments,
+                                                                     const VariableId &target_var ) const
 {                                 
     ASSERT( target_var );
     SYM::Expression::EvalKit kit { &assignments, x_tree_db };    
 
     SYM::TruthTableSolver::GivenSymbolSet givens;
     for( VariableId v : plan.variables )            
-        if( v != target_var && assignments.count(v) > 0 )
+        if( v != target_var && assignments.IsAssigned(v) )
             givens.insert( v );
 
     if( plan.suggestion_expressions.count(target_var)==0 ||
@@ -147,9 +168,7 @@ unique_ptr<SYM::SubsetResult> SymbolicConstraint::GetSuggestedValues( const Assi
         return nullptr;
         
     shared_ptr<SYM::SymbolExpression> hint_expression = plan.suggestion_expressions.at(target_var).at(givens);
-    unique_ptr<SYM::SymbolicResult> hr = hint_expression->Evaluate( kit );
-    ASSERT( hr );
-    unique_ptr<SYM::SubsetResult> hint_result = dynamic_pointer_cast<SYM::SubsetResult>(move(hr));
+    unique_ptr<SYM::SymbolicResult> hint_result = hint_expression->Evaluate( kit );
     ASSERT( hint_result );
     return hint_result;
 }
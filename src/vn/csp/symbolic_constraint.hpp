@@ -11,6 +11,12 @@
 #include <memory>
 #include <list>
 
+namespace SYM
+{
+enum class SolverBackend;
+class CompiledExpression;
+}
+
 namespace VN
 {
 class Conjecture;    
@@ -32,37 +38,47 @@ public:
      * boolean operator.
      * 
      * @param op a shared pointer to the boolean operator
+     * @param plink_indices indices of the variables in the Assignments we will be given
+     * @param solver_backend how the symbolic solver should hold its truth table
      */
     explicit SymbolicConstraint( shared_ptr<SYM::BooleanExpression> op,
-                                 shared_ptr<const VN::Lacing> lacing );
+                                 shared_ptr<const VN::Lacing> lacing,
+                                 shared_ptr<const VN::PatternLinkIndices> plink_indices,
+                                 SYM::SolverBackend solver_backend );
     
 private:
     const struct Plan : public virtual Traceable
     {
         explicit Plan( SymbolicConstraint *algo,  
                        shared_ptr<SYM::BooleanExpression> expression,
-                       shared_ptr<const VN::Lacing> lacing );
+                       shared_ptr<const VN::Lacing> lacing,
+                       shared_ptr<const VN::PatternLinkIndices> plink_indices,
+                       SYM::SolverBackend solver_backend );
         void DetermineVariables();
         void DetermineHintExpressions();
         void DetermineVariablesRequiringDB();
+        void DetermineCompiledExpression();
         string GetTrace() const; // used for debug
 
         SymbolicConstraint * const algo;
         shared_ptr<SYM::BooleanExpression> consistency_expression;        
+        shared_ptr<SYM::CompiledExpression> compiled_expression; // for IsSatisfied()
         set<VariableId> variables;
         typedef map< set<VariableId>, shared_ptr<SYM::SymbolExpression>> GivensToExpression;
         map<VariableId, GivensToExpression> suggestion_expressions;
         shared_ptr<SYM::BooleanExpression> alt_expression_for_testing;       
         SYM::Expression::VariablesRequiringDB variables_requiring_db; 
         shared_ptr<const VN::Lacing> lacing;
+        shared_ptr<const VN::PatternLinkIndices> plink_indices;
+        const SYM::SolverBackend solver_backend;
     } plan;
 
     const set<VariableId> &GetVariables() const override;
     SYM::Expression::VariablesRequiringDB GetVariablesRequiringDB() const override;
     virtual void Start( const VN::XTreeDatabase *x_tree_db );    
     bool IsSatisfied( const Assignments &assignments ) const override;
-    unique_ptr<SYM::SubsetResult> GetSuggestedValues( const Assignments &assignments,
-                                                   const VariableId &var ) const override;               
+    unique_ptr<SYM::SymbolicResult> GetSuggestedValues( const Assignments &assignments,
+                                                     const VariableId &var ) const override;               
     string GetTrace() const override;
     void Dump() const;
 
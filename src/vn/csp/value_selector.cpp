@@ -21,7 +21,8 @@ using namespace CSP;
 ValueSelector::ValueSelector( const ConstraintSet &constraints_to_query_, 
                               const VN::XTreeDatabase *x_tree_db_,
                               Assignments &assignments_,
-                              VariableId var ) :
+                              VariableId var,
+                              const set<Value> *restriction ) :
     x_tree_db( x_tree_db_ ),
     assignments( assignments_ ),
     my_var( var ),
@@ -32,39 +33,41 @@ ValueSelector::ValueSelector( const ConstraintSet &constraints_to_query_,
 #ifdef LOG_INDIVIDUAL_SUGGESTION_SETS
     TRACEC("given assignments:\n")(assignments)("\n");
 #endif    
-    list<unique_ptr<SYM::SubsetResult>> rl; 
+    list<unique_ptr<SYM::SymbolicResult>> rl; 
     for( shared_ptr<Constraint> c : constraints_to_query )
     {                        
         TRACEC("Querying ")(c)(" for suggestion set\n");       
-        unique_ptr<SYM::SubsetResult> r = c->GetSuggestedValues( assignments, my_var );
+        unique_ptr<SYM::SymbolicResult> r = c->GetSuggestedValues( assignments, my_var );
         ASSERT( r );
 #ifdef LOG_INDIVIDUAL_SUGGESTION_SETS
         TRACEC("got suggestion ")(r)("\n");
-        auto s = make_shared<set<Value>>(); // could be unique_ptr in C++14 when we can move-capture
-        bool sok = r->TryExtensionalise(*s);
 #endif    
         rl.push_back(move(r));
     }
+    
+    if( restriction )
+    {
+        TRACEC("Restricting to ")(*restriction)("\n");         
+        rl.push_back( make_unique<SYM::SubsetResult>( *restriction ) );
+    }
 
-    unique_ptr<SYM::SubsetResult> result = SYM::SubsetResult::GetIntersection(move(rl));
-    ASSERT( result );
-    auto s = make_shared<set<Value>>(); // could be unique_ptr in C++14 when we can move-capture
-    bool sok = result->TryExtensionalise(*s);
+    // Don't extensionalise: the intersection streams values from its
+    // smallest operand and filters them through the others, so we only 
+    // pay for the values we actually try.
+    suggestions = make_unique<SYM::IntersectionResult>( move(rl) );
+    SYM::SymbolicResult::Generator g = suggestions->TryGetGenerator();
        
 #ifdef GATHER_GSV
     gsv_n++;
-    if( !sok )
+    if( !g )
         gsv_nfail++;
-    else if( s->empty() )
-        gsv_nempty++;
-    else
-        gsv_tot += s->size();
+    gsv_suggesting = (bool)g;
 #endif       
               
-    if( sok )
+    if( g )
     {
-        TRACEC("Intersection of suggestions is ")(*s)(" - make queue from this\n");         
-        SetupSuggestionGenerator( s );
+        TRACEC("Suggestions are ")(*suggestions)(" - make generator from this\n");         
+        SetupSuggestionGenerator( g );
     }
     else
     {
@@ -76,6 +79,15 @@ ValueSelector::ValueSelector( const ConstraintSet &constraints_to_query_,
        
 ValueSelector::~ValueSelector()
 {
+#ifdef GATHER_GSV
+    if( gsv_suggesting )
+    {
+        if( gsv_drawn == 0 )
+            gsv_nempty++;
+        else
+            gsv_tot += gsv_drawn;
+    }
+#endif       
 }
 
 
@@ -94,46 +106,47 @@ void ValueSelector::SetupDefaultGenerator()
 }
 
 
-void ValueSelector::SetupSuggestionGenerator( shared_ptr<set<Value>> suggested )
+void ValueSelector::SetupSuggestionGenerator( function<Value()> suggestion_generator )
 {
 #ifdef CHECK_NONEMPTY_RESIDUAL
-    ASSERT( !suggested->empty() );
-#endif
-    // Use of shared_ptr here allows the lambda to keep suggested
-    // alive without copying it. Even if we could deal with the slowness of a copy, 
-    // we'd still get a crash because the initial suggestion_iterator would be
-    // invalid for the copy. Could be unique_ptr in C++14 when we can move-capture
-    // Taking hint means new generator that only reveals the hint
-    set<Value>::iterator suggestion_iterator = suggested->begin();
+    // Peek at the first value, then put it back
+    Value first = suggestion_generator();
+    ASSERT( first );
     values_generator = [=]() mutable -> Value
     {
-        if( suggestion_iterator != suggested->end() )
-        {                     
-            Value v = *suggestion_iterator;
-            suggestion_iterator++;
-            return v;
-        }
-        else
+        if( first )
         {
-            return Value();
+            Value v = first;
+            first = Value();
+            return v;
         }
+        return suggestion_generator();
     };
+#else
+    // The generator refers into suggestions, which we keep alive
+    values_generator = suggestion_generator;
+#endif
 }
 
 
 Value ValueSelector::GetNextValue()
 {
     // Use the lambda
-    return values_generator();
+    Value v = values_generator();
+#ifdef GATHER_GSV
+    if( v )
+        gsv_drawn++;
+#endif       
+    return v;
 }
 
 
 void ValueSelector::DumpGSV()
 {
     FTRACES("Suggestions dump\n");
-    FTRACEC("Failure to extensionalise: %f%%\n", 100.0*gsv_nfail/gsv_n);
-    FTRACEC("Empty set: %f%%\n", 100.0*gsv_nempty/gsv_n);
-    FTRACEC("Average size of successful, non-empty: %f\n", 1.0*gsv_tot/(gsv_n-gsv_nfail-gsv_nempty));
+    FTRACEC("Failure to make a generator: %f%%\n", 100.0*gsv_nfail/gsv_n);
+    FTRACEC("Nothing drawn from generator: %f%%\n", 100.0*gsv_nempty/gsv_n);
+    FTRACEC("Average values drawn from successful, non-empty: %f\n", 1.0*gsv_tot/(gsv_n-gsv_nfail-gsv_nempty));
 }
 
 
@@ -14,6 +14,11 @@ namespace VN
     class XTreeDatabase;
 };
 
+namespace SYM
+{
+    class SymbolicResult;
+};
+
 namespace CSP
 { 
     
@@ -27,10 +32,11 @@ public:
     ValueSelector( const ConstraintSet &constraints_to_query,
                    const VN::XTreeDatabase *x_tree_db_,
                    Assignments &assignments_,
-                   VariableId var );
+                   VariableId var,
+                   const set<Value> *restriction = nullptr );
     ~ValueSelector();
     void SetupDefaultGenerator();
-    void SetupSuggestionGenerator( shared_ptr<set<Value>> s );
+    void SetupSuggestionGenerator( function<Value()> suggestion_generator );
     Value GetNextValue();
     
 private:
@@ -39,7 +45,11 @@ private:
     const VariableId my_var;
     const ConstraintSet &constraints_to_query;
     
+    // Keeps alive whatever values_generator is streaming from
+    unique_ptr<SYM::SymbolicResult> suggestions;
     function<Value()> values_generator;  
+    bool gsv_suggesting = false;
+    uint64_t gsv_drawn = 0;
 
 public:
     static void DumpGSV();
@@ -200,18 +200,21 @@ void DBWalk::VisitItemise( const WalkKit &kit,
                            TreePtr<Node> node ) 
 {
     ASSERT(node);
-    vector< Itemiser::Element * > x_items = node->Itemise();
-    for( vector< Itemiser::Element * >::size_type item_ordinal=0; item_ordinal<x_items.size(); item_ordinal++ )
+    Itemiser::ElementTable x_items = node->GetItemiseTable();
+    for( size_t item_ordinal=0; item_ordinal<x_items.size(); item_ordinal++ )
     {
-        Itemiser::Element *xe = x_items[item_ordinal];
-        if( auto x_seq = dynamic_cast<SequenceInterface *>(xe) )
-            VisitSequence( kit, x_seq, node, item_ordinal );
-        else if( auto x_col = dynamic_cast<CollectionInterface *>(xe) )
-            VisitCollection( kit, x_col, node, item_ordinal );
-        else if( auto p_x_singular = dynamic_cast<TreePtrInterface *>(xe) )
-            VisitSingular( kit, p_x_singular, node, item_ordinal );
-        else
-            ASSERTFAIL("got something from itemise that isnt a Sequence, Collection or a singular TreePtr");
+        switch( x_items.GetKind(item_ordinal) )
+        {
+        case Itemiser::ElementKind::SEQUENCE:
+            VisitSequence( kit, x_items.GetSequence(item_ordinal), node, item_ordinal );
+            break;
+        case Itemiser::ElementKind::COLLECTION:
+            VisitCollection( kit, x_items.GetCollection(item_ordinal), node, item_ordinal );
+            break;
+        case Itemiser::ElementKind::SINGULAR:
+            VisitSingular( kit, x_items.GetSingular(item_ordinal), node, item_ordinal );
+            break;
+        }
     }
 }
 
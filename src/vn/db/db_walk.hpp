@@ -38,6 +38,18 @@ public:
                        Wind wind,
                        const DBCommon::CoreInfo *base_info = DBCommon::GetUnknownCoreInfo() );
 
+    // One action that calls each of the supplied ones in turn, so that a
+    // single walk can update several assets. Composed at compile time, so
+    // there's only one indirect call per XLink.
+    template<typename ... ACTIONS>
+    static Action Fuse( ACTIONS ... actions )
+    {
+        return [=](const WalkInfo &walk_info)
+        {
+            (actions(walk_info), ...);
+        };
+    }
+
 
 private:
     struct WalkKit
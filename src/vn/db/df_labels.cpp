@@ -0,0 +1,157 @@
+#include "df_labels.hpp"
+
+#include <cmath>
+
+using namespace VN;
+
+// Tags live in (0, END_TAG). Zero and END_TAG act as sentinels at
+// the front and back of every tree's sequence.
+#define TAG_BITS 62
+static const DepthFirstLabels::Tag END_TAG = DepthFirstLabels::Tag(1) << TAG_BITS;
+
+// Building a tree appends in depth-first order, so when appending we
+// leave a fixed stride rather than halving the remaining space each time.
+static const DepthFirstLabels::Tag APPEND_STRIDE = DepthFirstLabels::Tag(1) << 32;
+
+// A tag range of width 2^k may be relabelled if it holds fewer than
+// (2/DENSITY_BASE)^k entries. Must be between 1 and 2; smaller values
+// relabel less often but run out of tags sooner.
+#define DENSITY_BASE 1.4
+
+DepthFirstLabels::DepthFirstLabels()
+{
+}
+
+
+void DepthFirstLabels::InsertAtFront( XLink xlink, DBCommon::TreeOrdinal tree_ordinal )
+{
+    Sequence &seq = sequences_by_tree[tree_ordinal];
+    InsertBetween( xlink, tree_ordinal, seq, seq.begin() );
+}
+
+
+void DepthFirstLabels::InsertAfter( XLink xlink, XLink predecessor )
+{
+    ASSERT( entries.count(predecessor) > 0 )("No depth-first label for predecessor ")(predecessor);
+    Sequence::iterator it_pred = entries.at(predecessor);
+    DBCommon::TreeOrdinal tree_ordinal = it_pred->label.tree_ordinal;
+    InsertBetween( xlink, tree_ordinal, sequences_by_tree.at(tree_ordinal), next(it_pred) );
+}
+
+
+void DepthFirstLabels::Erase( XLink xlink )
+{
+    Sequence::iterator it = entries.at(xlink);
+    DBCommon::TreeOrdinal tree_ordinal = it->label.tree_ordinal;
+    Sequence &seq = sequences_by_tree.at(tree_ordinal);
+    seq.erase(it);
+    if( seq.empty() )
+        sequences_by_tree.erase( tree_ordinal );
+    entries.erase( xlink );
+}
+
+
+const DepthFirstLabels::Label *DepthFirstLabels::TryGetLabel( XLink xlink ) const
+{
+    auto it = entries.find(xlink);
+    if( it == entries.end() )
+        return nullptr;
+    return &(it->second->label);
+}
+
+
+Orderable::Diff DepthFirstLabels::Compare3Way( const Label &l, const Label &r )
+{
+    // Tree ordinal is primary, as with root siblings in DepthFirstRelation
+    if( l.tree_ordinal != r.tree_ordinal )
+        return static_cast<int>(l.tree_ordinal) - static_cast<int>(r.tree_ordinal);
+    if( l.tag < r.tag )
+        return -1;
+    if( l.tag > r.tag )
+        return 1;
+    return 0;
+}
+
+
+void DepthFirstLabels::CheckSizeIs( size_t s ) const
+{
+    ASSERT( entries.size() == s )("%u labels but expected %u", entries.size(), s);
+}
+
+
+string DepthFirstLabels::GetTrace() const
+{
+    return SSPrintf("(depth-first labels: %u xlinks in %u trees)", entries.size(), sequences_by_tree.size());
+}
+
+
+void DepthFirstLabels::InsertBetween( XLink xlink,
+                                      DBCommon::TreeOrdinal tree_ordinal,
+                                      Sequence &seq,
+                                      Sequence::iterator it_succ )
+{
+    ASSERT( xlink );
+    Tag lo = (it_succ == seq.begin()) ? 0 : prev(it_succ)->label.tag;
+    Tag hi = (it_succ == seq.end()) ? END_TAG : it_succ->label.tag;
+    ASSERT( lo <= hi );
+
+    Sequence::iterator it;
+    if( hi - lo >= 2 )
+    {
+        Tag gap = (hi - lo) / 2;
+        if( it_succ == seq.end() )
+            gap = min( gap, APPEND_STRIDE );
+        it = seq.insert( it_succ, { xlink, { tree_ordinal, lo + gap } } );
+    }
+    else
+    {
+        // No room: take the predecessor's tag for now and spread out
+        it = seq.insert( it_succ, { xlink, { tree_ordinal, lo } } );
+        Relabel( seq, it );
+    }
+
+    bool inserted = entries.insert( make_pair(xlink, it) ).second;
+    ASSERT( inserted )("Already have a depth-first label for ")(xlink);
+}
+
+
+void DepthFirstLabels::Relabel( Sequence &seq, Sequence::iterator it )
+{
+    Tag tag = it->label.tag;
+    Sequence::iterator it_first = it, it_last = it; // inclusive
+    size_t count = 1;
+
+    // Grow an aligned tag range around the new entry until it is sparse
+    // enough, then spread its entries out evenly within it.
+    for( int k=1; k<=TAG_BITS; k++ )
+    {
+        Tag width = Tag(1) << k;
+        Tag base = tag & ~(width-1);
+
+        while( it_first != seq.begin() && prev(it_first)->label.tag >= base )
+        {
+            --it_first;
+            count++;
+        }
+        while( next(it_last) != seq.end() && next(it_last)->label.tag < base + width )
+        {
+            ++it_last;
+            count++;
+        }
+
+        if( (double)count * pow(DENSITY_BASE, k) < (double)width )
+        {
+            Tag spacing = width / (count+1);
+            ASSERT( spacing >= 1 );
+            Tag t = base;
+            for( Sequence::iterator rit = it_first; rit != next(it_last); ++rit )
+            {
+                t += spacing;
+                rit->label.tag = t;
+            }
+            return;
+        }
+    }
+
+    ASSERTFAIL("Ran out of depth-first tags");
+}
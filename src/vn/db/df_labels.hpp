@@ -0,0 +1,69 @@
+#ifndef DF_LABELS_HPP
+#define DF_LABELS_HPP
+
+#include "../link.hpp"
+#include "common/standard.hpp"
+#include "common/orderable.hpp"
+#include "db_common.hpp"
+
+#include <unordered_map>
+
+namespace VN
+{
+
+// Order-maintenance labels for the depth-first ordering of XLinks. Each
+// tree holds a list of XLinks in depth-first order, each tagged with an
+// integer that increases along the list. New XLinks are tagged between
+// their neighbours and, when there's no gap, a range of tags around the
+// insertion point is spread out evenly (tag-range relabelling after
+// Dietz-Sleator and Bender et al). Relabelling never changes the relative
+// order of tags, so depth-first comparison becomes an integer compare.
+class DepthFirstLabels : public Traceable
+{
+public:
+    typedef uint64_t Tag;
+
+    struct Label
+    {
+        DBCommon::TreeOrdinal tree_ordinal;
+        Tag tag;
+    };
+
+    DepthFirstLabels();
+
+    // Insert as the first XLink of the given tree, eg a root
+    void InsertAtFront( XLink xlink, DBCommon::TreeOrdinal tree_ordinal );
+
+    // Insert immediately after predecessor, which must be labelled
+    void InsertAfter( XLink xlink, XLink predecessor );
+
+    void Erase( XLink xlink );
+
+    const Label *TryGetLabel( XLink xlink ) const;
+    static Orderable::Diff Compare3Way( const Label &l, const Label &r );
+
+    void CheckSizeIs( size_t s ) const;
+    string GetTrace() const;
+
+private:
+    struct Entry
+    {
+        XLink xlink;
+        Label label;
+    };
+    typedef list<Entry> Sequence;
+
+    void InsertBetween( XLink xlink,
+                        DBCommon::TreeOrdinal tree_ordinal,
+                        Sequence &seq,
+                        Sequence::iterator it_succ );
+    void Relabel( Sequence &seq, Sequence::iterator it );
+
+    // One list per tree, so roots need no predecessor
+    map<DBCommon::TreeOrdinal, Sequence> sequences_by_tree;
+    unordered_map<XLink, Sequence::iterator> entries;
+};
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #include "relation_test.hpp"
 #include "x_tree_database.hpp"
+#include "df_labels.hpp"
 
 #include "helpers/simple_compare.hpp"
 #include "helpers/simple_duplicate.hpp"
@@ -11,7 +12,15 @@
 using namespace VN;
 
 DepthFirstRelation::DepthFirstRelation(const XTreeDatabase *db_) :
-    db( db_ )
+    db( db_ ),
+    labels( db_ ? &db_->GetOrderings().GetDepthFirstLabels() : nullptr )
+{
+}
+
+
+DepthFirstRelation::DepthFirstRelation(const XTreeDatabase *db_, const DepthFirstLabels *labels_) :
+    db( db_ ),
+    labels( labels_ )
 {
 }
 
@@ -24,6 +33,14 @@ bool DepthFirstRelation::operator()( KeyType l_key, KeyType r_key ) const
 
 Orderable::Diff DepthFirstRelation::Compare3Way( KeyType l_key, KeyType r_key ) const
 {
+    if( labels )
+    {
+        const DepthFirstLabels::Label *l_label = labels->TryGetLabel(l_key);
+        const DepthFirstLabels::Label *r_label = labels->TryGetLabel(r_key);
+        if( l_label && r_label )
+            return DepthFirstLabels::Compare3Way( *l_label, *r_label );
+    }
+    
     return CompareHierarchical( l_key, r_key ).first;
 }
 
@@ -149,5 +166,22 @@ void DepthFirstRelation::Test( const vector<KeyType> &keys )
     { 
         return l==r; 
     } );
+    
+    if( !labels || keys.empty() )
+        return;
+        
+    // Labels must agree with a walk of the X tree
+    std::mt19937 random_gen;
+    std::uniform_int_distribution<int> random_index(0, keys.size()-1);
+    for( vector<KeyType>::size_type i=0; i<keys.size()*10; i++ )
+    {
+        KeyType l_key = keys[random_index(random_gen)];
+        KeyType r_key = keys[random_index(random_gen)];
+        Orderable::Diff dl = Compare3Way(l_key, r_key);
+        Orderable::Diff dh = CompareHierarchical(l_key, r_key).first;
+        ASSERT( (dl<0) == (dh<0) && (dl>0) == (dh>0) )
+              ("Depth-first labels disagree with X tree for ")(l_key)(" vs ")(r_key)
+              (": labels gave %d, hierarchy gave %d", dl, dh);
+    }
 }
 
@@ -14,6 +14,7 @@ namespace VN
 {
 
 class XTreeDatabase;
+class DepthFirstLabels;
 
 class DepthFirstRelation
 {
@@ -32,10 +33,15 @@ public:
         ROOT_SIBLINGS       // depends on child ptr order
     };
         
+    // Uses the database's own depth-first labels when it has them
     DepthFirstRelation(const XTreeDatabase *db);
+    DepthFirstRelation(const XTreeDatabase *db, const DepthFirstLabels *labels);
 
     /// Less operator: for use with set, map etc
     bool operator()( KeyType l_key, KeyType r_key ) const;
+    
+    // Integer compare of labels when both keys are labelled, otherwise 
+    // walks the X tree using CompareHierarchical()
     Orderable::Diff Compare3Way( KeyType l_key, KeyType r_key ) const;
     pair<Orderable::Diff, RelType> CompareHierarchical( KeyType l_key, KeyType r_key ) const;
 
@@ -43,6 +49,7 @@ public:
     
 private:
     const XTreeDatabase * const db;
+    const DepthFirstLabels *labels;
 }; 
 
 };
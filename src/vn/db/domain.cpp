@@ -21,13 +21,6 @@ void Domain::InsertTree(TreeZone &zone)
 }
 
 
-void Domain::DeleteTree(TreeZone &zone)
-{
-	db_walker.WalkTreeZone( bind(&Domain::DeleteAction, this, placeholders::_1), 
-	                        zone, DBWalk::WIND_OUT );
-}
-
-
 void Domain::InsertAction(const DBWalk::WalkInfo &walk_info)
 {
     //TRACE("INSERT ")(walk_info.xlink)(" is_terminus=")(walk_info.at_terminus)("\n");
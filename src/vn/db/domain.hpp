@@ -22,7 +22,6 @@ public:
     Domain();
 
 	void InsertTree(TreeZone &zone);
-	void DeleteTree(TreeZone &zone);
 
 	void DeleteAction(const DBWalk::WalkInfo &walk_info);
 	void InsertAction(const DBWalk::WalkInfo &walk_info);
@@ -6,12 +6,15 @@
 #include "../agents/agent.hpp"
 #include "../agents/relocating_agent.hpp"
 #include "helpers/simple_duplicate.hpp"
+#include "common/consistency_check.hpp"
 
 #define NO_ACTION_ON_SCAFFOLD
 #define LEAK_EXTRA_TREES
 
 using namespace VN;    
 
+static ConsistencyCheck validate_check("DomainExtensionChannel::Validate");
+
 // ------------------------- DomainExtension --------------------------
 
 bool DomainExtension::ExtenderChannelRelation::operator()( const Extender *l, const Extender *r ) const
@@ -323,11 +326,9 @@ void DomainExtensionChannel::DropStimulusXLink( XLink stimulus_xlink )
 	if( new_rc > 0 )
 		return;
 	
-	//FTRACE("Dropping induced ")(induced_root)("\n");
-	DBCommon::TreeOrdinal ord = induced_root_to_tree_ordinal_and_ref_count.at(induced_root).tree_ordinal;
-	EraseSolo( induced_root_to_tree_ordinal_and_ref_count, induced_root );
-	
-	ordinals_to_tear_down.insert( ord );     
+	// Don't drop the extension class yet: a recheck later in this update 
+	// might induce an equivalent subtree.
+	induced_roots_to_maybe_drop.insert( induced_root );
     
 	//Validate();    
 }
@@ -335,15 +336,31 @@ void DomainExtensionChannel::DropStimulusXLink( XLink stimulus_xlink )
 
 void DomainExtensionChannel::DeferredActionsEndOfUpdate()
 {
-    // TODO only do what's left over as invalid from previous deletes 
-    // and not restored by inserts
+    // Only stimulii that were inserted, or that lost a dependency (found via 
+    // dep_to_all_stimulii), are rechecked here.
 	//Validate();    
     for( XLink stimulus_xlink : stimulii_to_recheck )
         CheckStimulusXLink( stimulus_xlink );
         
     stimulii_to_recheck.clear();   
 
-    Validate();
+    // Now drop the extension classes that nothing induced again
+    for( TreePtr<Node> induced_root : induced_roots_to_maybe_drop )
+    {
+        auto it = induced_root_to_tree_ordinal_and_ref_count.find(induced_root);
+        ASSERT( it != induced_root_to_tree_ordinal_and_ref_count.end() );
+        if( it->second.ref_count > 0 )
+            continue; // re-used
+            
+        //FTRACE("Dropping induced ")(induced_root)("\n");
+        ordinals_to_tear_down.insert( it->second.tree_ordinal );
+        induced_root_to_tree_ordinal_and_ref_count.erase( it );
+    }
+    induced_roots_to_maybe_drop.clear();
+
+    // Validation is O(domain)
+    if( validate_check.ShouldRun() )
+        Validate();
 }
 
 
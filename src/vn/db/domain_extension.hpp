@@ -153,6 +153,11 @@ private:
     // SimpleCompare equivalence classes over the domain, with refcount = size of the class.
     map<TreePtr<Node>, ExtensionClass, SimpleCompare> induced_root_to_tree_ordinal_and_ref_count;
     
+    // Classes whose refcount fell to zero during the update. We keep them until 
+    // DeferredActionsEndOfUpdate() so that a recheck that induces an equivalent 
+    // subtree can re-use the extra tree instead of building a new one.
+    set<TreePtr<Node>> induced_roots_to_maybe_drop;
+    
     set<DBCommon::TreeOrdinal> ordinals_to_tear_down;
 };
         
@@ -62,22 +62,32 @@ TreePtr<Node> Duplicate::DuplicateSubtreeWorker( TreePtr<Node> source,
     // Itemise the members. Note that the itemiser internally does a
     // dynamic_cast onto the type of source, and itemises over that type. dest must
     // be dynamic_castable to source's type.
-    vector< Itemiser::Element * > source_items = source->Itemise();
-    vector< Itemiser::Element * > dest_items = dest->Itemise(); 
+    Itemiser::ElementTable source_items = source->GetItemiseTable();
+    Itemiser::ElementTable dest_items = dest->GetItemiseTable(); 
 
     TRACES("Duplicating %d members source=", dest_items.size())(source)(" dest=")(*dest)("\n");
     // Loop over all the members of source (which can be a subset of dest)
     // and for non-nullptr members, duplicate them by recursing and write the
     // duplicates to the destination.
-    for( vector< Itemiser::Element * >::size_type i=0; i<dest_items.size(); i++ )
+    for( size_t i=0; i<dest_items.size(); i++ )
     {
         //TRACES("Duplicating member %d\n", i );
-        ASSERTS( source_items[i] )( "itemise returned null element" );
-        ASSERTS( dest_items[i] )( "itemise returned null element" );
+        Itemiser::ElementKind kind = source_items.GetKind(i);
+        ASSERTS( dest_items.GetKind(i) == kind );
         
-        if( ContainerInterface *source_container = dynamic_cast<ContainerInterface *>(source_items[i]) )                
+        if( kind == Itemiser::ElementKind::SEQUENCE || kind == Itemiser::ElementKind::COLLECTION )                
         {
-            ContainerInterface *dest_container = dynamic_cast<ContainerInterface *>(dest_items[i]);
+            ContainerInterface *source_container, *dest_container;
+            if( kind == Itemiser::ElementKind::SEQUENCE )
+            {
+                source_container = source_items.GetSequence(i);
+                dest_container = dest_items.GetSequence(i);
+            }
+            else
+            {
+                source_container = source_items.GetCollection(i);
+                dest_container = dest_items.GetCollection(i);
+            }
 
             dest_container->clear();
 
@@ -109,10 +119,11 @@ TreePtr<Node> Duplicate::DuplicateSubtreeWorker( TreePtr<Node> source,
                 }
             }
         }            
-        else if( TreePtrInterface *source_singular = dynamic_cast<TreePtrInterface *>(source_items[i]) )
+        else
         {
             //TRACE("Duplicating node ")(*keynode_singular)("\n");
-            TreePtrInterface *dest_singular = dynamic_cast<TreePtrInterface *>(dest_items[i]);
+            TreePtrInterface *source_singular = source_items.GetSingular(i);
+            TreePtrInterface *dest_singular = dest_items.GetSingular(i);
             ASSERTS( *source_singular )("source should be non-nullptr");
             XLink source_child_xlink = XLink(source_singular);
             
@@ -136,10 +147,6 @@ TreePtr<Node> Duplicate::DuplicateSubtreeWorker( TreePtr<Node> source,
                 ASSERTS( TreePtr<Node>(*dest_singular)->IsFinal() );            
             }
         }
-        else
-        {
-            ASSERTFAILS("got something from itemise that isn't a sequence or a shared pointer");
-        }
     }
     
     return dest;
@@ -0,0 +1,115 @@
+#include "hash_consing.hpp"
+
+using namespace VN;    
+
+HashConsing::HashConsing() :
+    next_class_id( 1 ) // Zero means no class
+{
+}
+
+
+HashConsing::ClassId HashConsing::TryGetClass( const Node &node ) const
+{
+    auto it = class_of_node.find( &node );
+    if( it == class_of_node.end() )
+        return 0;
+    return it->second->second.class_id;
+}
+
+
+HashConsing::ClassId HashConsing::InsertNode( TreePtr<Node> node )
+{
+    ASSERT( node );
+    auto nit = class_of_node.find( node.get() );
+    if( nit != class_of_node.end() )
+        return nit->second->second.class_id; // eg multiple parents
+        
+    Key key { node, {} };
+    Itemiser::ElementTable items = node->GetItemiseTable();
+    for( size_t i=0; i<items.size(); i++ )
+    {
+        switch( items.GetKind(i) )
+        {
+        case Itemiser::ElementKind::SEQUENCE:
+        {
+            SequenceInterface *x_seq = items.GetSequence(i);
+            key.child_classes.push_back( x_seq->size() );
+            for( const TreePtrInterface &child : *x_seq )
+                key.child_classes.push_back( GetOrInsertChildClass(child) );
+            break;
+        }
+        case Itemiser::ElementKind::COLLECTION:
+        {
+            // Collections are equivalent if their classes are the same 
+            // as multisets, regardless of the order of the elements
+            CollectionInterface *x_col = items.GetCollection(i);
+            key.child_classes.push_back( x_col->size() );
+            size_t first = key.child_classes.size();
+            for( const TreePtrInterface &child : *x_col )
+                key.child_classes.push_back( GetOrInsertChildClass(child) );
+            sort( key.child_classes.begin() + first, key.child_classes.end() );
+            break;
+        }
+        case Itemiser::ElementKind::SINGULAR:
+        {
+            key.child_classes.push_back( GetOrInsertChildClass(*items.GetSingular(i)) );
+            break;
+        }
+        }
+    }
+    
+    ClassMap::iterator cit = classes.find( key );
+    if( cit == classes.end() )
+        cit = classes.insert( make_pair( move(key), Entry{ next_class_id++, 0 } ) ).first;
+    cit->second.num_nodes++;
+    class_of_node.insert( make_pair( node.get(), cit ) );
+    return cit->second.class_id;
+}
+
+
+void HashConsing::DeleteNode( TreePtr<Node> node )
+{
+    auto nit = class_of_node.find( node.get() );
+    ASSERT( nit != class_of_node.end() )("No class for ")(node);
+    ClassMap::iterator cit = nit->second;
+    class_of_node.erase( nit );
+    
+    // Erasing the class drops the exemplar
+    if( --(cit->second.num_nodes) == 0 )
+        classes.erase( cit );
+}
+
+
+size_t HashConsing::GetNumNodes() const
+{
+    return class_of_node.size();
+}
+
+
+size_t HashConsing::GetNumClasses() const
+{
+    return classes.size();
+}
+
+
+string HashConsing::GetTrace() const
+{
+    return SSPrintf("(hash consing: %u nodes in %u classes)", class_of_node.size(), classes.size());
+}
+
+
+bool HashConsing::KeyRelation::operator()( const Key &l, const Key &r ) const
+{
+    if( Orderable::Diff d = Node::OrderCompare3Way( *l.exemplar, *r.exemplar, Orderable::TOTAL ) )
+        return d < 0;
+    return l.child_classes < r.child_classes;
+}
+
+
+HashConsing::ClassId HashConsing::GetOrInsertChildClass( const TreePtrInterface &child )
+{
+    // NULL can only be equivalent to NULL, see SimpleCompare
+    if( !child )
+        return 0;
+    return InsertNode( (TreePtr<Node>)child );
+}
@@ -0,0 +1,71 @@
+#ifndef HASH_CONSING_HPP
+#define HASH_CONSING_HPP
+
+#include "../link.hpp"
+#include "common/standard.hpp"
+#include "helpers/simple_compare.hpp"
+
+#include <unordered_map>
+
+namespace VN 
+{    
+
+// Hash-consed structural classes for nodes in the X tree database. A 
+// node's class is interned from its local value (as per Node::OrderCompare3Way())
+// and the classes of its children, so two nodes have the same class 
+// exactly when SimpleCompare (with TOTAL) would find them equivalent. 
+// Classes are never reused, so a stale class can't be confused with a 
+// new one.
+//
+// Classes must be removed before a node's subtree changes and put back 
+// after. Orderings does this alongside the SC ordering, which has the 
+// same requirement.
+class HashConsing : public SimpleCompare::ClassSource,
+                    public Traceable
+{
+public:
+    HashConsing();
+    
+    ClassId TryGetClass( const Node &node ) const final;
+    
+    // Class the node, first classing any descendants that need it
+    ClassId InsertNode( TreePtr<Node> node );
+    
+    // Only the node itself is declassed
+    void DeleteNode( TreePtr<Node> node );
+    
+    size_t GetNumNodes() const;
+    size_t GetNumClasses() const;
+    string GetTrace() const;
+    
+private:
+    struct Key
+    {
+        // Only the local value is used; children are in child_classes
+        TreePtr<Node> exemplar;
+        vector<ClassId> child_classes;
+    };
+    
+    struct KeyRelation
+    {
+        bool operator()( const Key &l, const Key &r ) const;
+    };
+    
+    struct Entry
+    {
+        ClassId class_id;
+        size_t num_nodes;
+    };
+    
+    typedef map<Key, Entry, KeyRelation> ClassMap;
+    
+    ClassId GetOrInsertChildClass( const TreePtrInterface &child );
+    
+    ClassMap classes;
+    unordered_map<const Node *, ClassMap::iterator> class_of_node;
+    ClassId next_class_id;
+};    
+    
+};
+
+#endif
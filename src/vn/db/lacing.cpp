@@ -9,6 +9,8 @@
 
 #define BF
 
+//#define CHECK_ORDINAL_CACHE
+
 using namespace VN;    
 
 Lacing::Lacing() :
@@ -265,6 +267,9 @@ void Lacing::BuildDecisionTree()
     }    
     TRACE(cats_to_lacing_sets)("\n");
     
+    // Ordinals from any previous build are no longer valid
+    ordinal_cache.clear();
+    
     // Generate a decision tree that determines lacing ordinal using just
     // IsSubcategory() on some X node (not necessarily seen here)
     set<int> possible_lacing_ordinals;
@@ -284,7 +289,7 @@ void Lacing::TestDecisionTree()
     for( int i=0; i<ncats; i++ ) 
     {
         TreePtr<Node> cat = cats_in_lacing_order.at(i);
-        ASSERT( GetOrdinalForNode( cat ) == i );
+        ASSERT( GetOrdinalForNodeUsingDecisionTree( cat ) == i );
     }
     TRACE("Lacing decision tree self-check OK\n");
 }
@@ -482,14 +487,63 @@ const list<pair<int, int>> &Lacing::GetRangeListForCategory( TreePtr<Node> arche
 }
 
 
+list<list<pair<int, int>>> Lacing::GetRangeListsForCategoryClauses( const set<shared_ptr<SYM::BooleanExpression>> &clauses,
+                                                                    bool top_level_only ) const
+{
+    list<list<pair<int, int>>> range_lists;
+    auto try_add = [&](const SYM::Expression *expr)
+    {
+        if( auto cat_op = dynamic_cast<const SYM::IsInCategoryOperator *>(expr) )
+            range_lists.push_back( GetRangeListForCategory( cat_op->GetArchetypeNode() ) );
+    };
+    for( shared_ptr<SYM::BooleanExpression> clause : clauses )
+    {
+        if( top_level_only )
+            try_add( clause.get() );
+        else
+            clause->ForTreeDepthFirstWalk( try_add );
+    }
+    return range_lists;
+}
+
+
+int Lacing::GetNumOrdinals() const
+{
+    return ncats;
+}
+
+
 int Lacing::GetOrdinalForNode( TreePtr<Node> target_node ) const
+{
+    if( !target_node )
+        return GetOrdinalForNodeUsingDecisionTree( target_node ); // no type to cache against
+        
+    type_index ti( typeid(*target_node) );
+    OrdinalCache::const_iterator it = ordinal_cache.find( ti );
+    if( it != ordinal_cache.end() ) // Found
+    {
+#ifdef CHECK_ORDINAL_CACHE
+        ASSERT( it->second == GetOrdinalForNodeUsingDecisionTree( target_node ) )
+              ("Lacing ordinal cache mismatch for ")(target_node);
+#endif
+        return it->second;
+    }
+    else // Not found
+    {
+        int ordinal = GetOrdinalForNodeUsingDecisionTree( target_node );
+        InsertSolo( ordinal_cache, make_pair(ti, ordinal) );
+        return ordinal;
+    }
+}
+
+
+int Lacing::GetOrdinalForNodeUsingDecisionTree( TreePtr<Node> target_node ) const
 {
     const Lacing::DecisionNode *decision_node = decision_tree_root.get();
     while(true) 
     {
         if( auto dn_local_match = dynamic_cast<const DecisionNodeLocalMatch *>(decision_node) )
         {
-            //dn_local_match->GetLacingRange();
             decision_node = dn_local_match->GetNextDecisionNode( target_node );
         }
         else if( auto dn_leaf = dynamic_cast<const DecisionNodeLeaf *>(decision_node) )
@@ -506,70 +560,7 @@ int Lacing::GetOrdinalForNode( TreePtr<Node> target_node ) const
 
 Orderable::Diff Lacing::OrdinalCompare( TreePtr<Node> lnode, TreePtr<Node> rnode ) const 
 {
-    const Lacing::DecisionNode *decision_node_l = decision_tree_root.get();
-    const Lacing::DecisionNode *decision_node_r = decision_tree_root.get();
-    int lmin=0, lmax=numeric_limits<int>::max(), 
-        rmin=0, rmax=numeric_limits<int>::max();
-    while(true) 
-    {
-        // Advance left
-        if( !decision_node_l )
-        {
-			// min and max are equal, nothing more to do on the left
-		}
-        else if( auto dn_local_match_l = dynamic_cast<const DecisionNodeLocalMatch *>(decision_node_l) )
-        {
-            decision_node_l = dn_local_match_l->GetNextDecisionNode( lnode );
-            tie(lmin, lmax) = dn_local_match_l->GetLacingRange();
-        }
-        else if( auto dn_leaf_l = dynamic_cast<const DecisionNodeLeaf *>(decision_node_l) )
-        {
-            lmin = lmax = dn_leaf_l->GetLacingOrdinal();               
-        }
-        else 
-        {
-            ASSERTFAIL();            
-        }
-        
-        if( lmin == lmax )
-			decision_node_l = nullptr;   
-       
-        // Do we have a result yet?
-        if( lmax < rmin )
-            return lmax-rmin;
-        if( lmin > rmax )
-            return lmin-rmax;
-        if( lmin == lmax && rmin == rmax && lmin==rmin )
-            return 0;
-
-        // Advance right
-        if( !decision_node_r )
-        {
-			// min and max are equal, nothing more to do on the right
-		}
-        else if( auto dn_local_match_r = dynamic_cast<const DecisionNodeLocalMatch *>(decision_node_r) )
-        {
-            decision_node_r = dn_local_match_r->GetNextDecisionNode( rnode );
-            tie(rmin, rmax) = dn_local_match_r->GetLacingRange();
-        }
-        else if( auto dn_leaf_r = dynamic_cast<const DecisionNodeLeaf *>(decision_node_r) )
-        {
-            rmin = rmax = dn_leaf_r->GetLacingOrdinal();
-        }
-        else 
-        {
-            ASSERTFAIL();            
-        }       
-
-        if( rmin == rmax )
-			decision_node_r = nullptr;   
-			
-		// Do we have a result yet?
-        if( lmax < rmin )
-            return lmax-rmin;
-        if( lmin > rmax )
-            return lmin-rmax;
-        if( lmin == lmax && rmin == rmax && lmin==rmin )
-            return 0;
-    }
+    // Once the types have been seen, this is two hash lookups, which is 
+    // cheaper than walking the decision tree for both nodes in step.
+    return GetOrdinalForNode( lnode ) - GetOrdinalForNode( rnode );
 }
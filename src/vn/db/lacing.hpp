@@ -12,6 +12,7 @@ class SimpleCompare;
 namespace SYM
 {
     class Expression;
+    class BooleanExpression;
 };
     
 namespace VN 
@@ -33,6 +34,7 @@ class Lacing
 public:    
     typedef set<TreePtr<Node>> CategorySet;   
     typedef unordered_map<pair<type_index, type_index>, bool, PairHash> SubCategoryCache;
+    typedef unordered_map<type_index, int> OrdinalCache;
 
     Lacing();
 
@@ -54,6 +56,7 @@ private:
     void BuildDecisionTree();
     void TestDecisionTree();
     shared_ptr<DecisionNode> MakeDecisionSubtree( const set<int> &possible_lacing_ordinals );
+    int GetOrdinalForNodeUsingDecisionTree( TreePtr<Node> node ) const;
     bool LocalMatchWithNULL( TreePtr<Node> l, TreePtr<Node> r );
 
     class DecisionNode
@@ -106,11 +109,21 @@ public:
     const list<pair<int, int>> &TryGetRangeListForCategory( TreePtr<Node> archetype ) const;
     const list<pair<int, int>> &GetRangeListForCategory( TreePtr<Node> archetype ) const;
     
-    // Returns the lacing ordinal value for the candidate.
+    // Range lists as above for the category tests in the supplied clauses. With 
+    // top_level_only, just the clauses that are category tests, each of which 
+    // must hold for any match. Otherwise, category tests anywhere in a clause.
+    list<list<pair<int, int>>> GetRangeListsForCategoryClauses( const set<shared_ptr<SYM::BooleanExpression>> &clauses,
+                                                                bool top_level_only ) const;
+    
+    // Returns the lacing ordinal value for the candidate. The ordinal only 
+    // depends on the node's type, so we only use the decision tree on the 
+    // first encounter of each type.
     int GetOrdinalForNode( TreePtr<Node> node ) const;
+    
+    // Ordinals run from zero to one less than this
+    int GetNumOrdinals() const;
 
-    // Approximately GetOrdinalForNode(lnode) - GetOrdinalForNode(rnode)
-    // but close enough for comparisons
+    // GetOrdinalForNode(lnode) - GetOrdinalForNode(rnode)
     Orderable::Diff OrdinalCompare( TreePtr<Node> lnode, TreePtr<Node> rnode ) const;
 
 private:    
@@ -129,6 +142,8 @@ private:
     map<TreePtr<Node>, set<int>> cats_to_lacing_sets;
     shared_ptr<DecisionNode> decision_tree_root;
     SubCategoryCache subcategory_cache;
+    // Ordinals of node types we have seen, filled in lazily
+    mutable OrdinalCache ordinal_cache;
 };
     
 };
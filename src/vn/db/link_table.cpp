@@ -33,20 +33,6 @@ const DBCommon::CoreInfo &LinkTable::GetCoreInfo(XLink xlink) const
 }
  
  
-void LinkTable::InsertTree(TreeZone &zone)
-{     
-	db_walker.WalkTreeZone( bind(&LinkTable::InsertAction, this, placeholders::_1), 
-	                        zone, DBWalk::WIND_IN, DBCommon::GetRootCoreInfo() );
-}
-
-
-void LinkTable::DeleteTree(TreeZone &zone)
-{
-	db_walker.WalkTreeZone( bind(&LinkTable::DeleteAction, this, placeholders::_1), 
-					        zone, DBWalk::WIND_OUT, DBCommon::GetRootCoreInfo() );
-}
- 
- 
 LinkTable::SwapTransaction::SwapTransaction(LinkTable *link_table_, TreeZone &zone1_, TreeZone &zone2_ ) :
 	DBCommon::SwapTransaction( zone1_, zone2_ ),
 	link_table( *link_table_ ),
@@ -3,6 +3,7 @@
 
 #include "../link.hpp"
 #include "common/standard.hpp"
+#include "common/slot_map.hpp"
 #include "db_walk.hpp"
 #include "tree_zone.hpp"
 
@@ -43,9 +44,6 @@ public:
     
     const DBCommon::CoreInfo &GetCoreInfo(XLink xlink) const;
     
-	void InsertTree(TreeZone &zone);
-	void DeleteTree(TreeZone &zone);
-    
 	class SwapTransaction : DBCommon::SwapTransaction
 	{
 	public:
@@ -54,7 +52,7 @@ public:
 	private:
 		DBWalk db_walker;     
 		LinkTable &link_table;
-		unordered_map<XLink, Row> &rows; 
+		SlotMap<XLink, Row> &rows; 
 		queue<DBCommon::CoreInfo> terminus_info1;
 		queue<DBCommon::CoreInfo> terminus_info2;
 		DBCommon::CoreInfo mybase_info1;
@@ -74,10 +72,8 @@ public:
     void Dump() const;
     
 //private:
-    DBWalk db_walker;     
-
     // XLink-to-row-of-x_tree_db map
-    unordered_map<XLink, Row> rows; 
+    SlotMap<XLink, Row> rows; 
 };    
     
 };
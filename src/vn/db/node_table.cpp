@@ -51,28 +51,6 @@ bool NodeTable::IsDeclarer(XLink xlink) const
 }
 
 
-void NodeTable::InsertTree(TreeZone &zone)
-{     
-	// For building, we must add every node in the zone
-	auto action = [&](const DBWalk::WalkInfo &walk_info)
-	{
-		 InsertLink(walk_info.xlink);
-	};
-	db_walker.WalkTreeZone( action, zone, DBWalk::WIND_IN );
-}
-
-
-void NodeTable::DeleteTree(TreeZone &zone)
-{
-	// For tear-down, we must remove every node in the zone
-	auto action = [&](const DBWalk::WalkInfo &walk_info)
-	{
-		 DeleteLink(walk_info.xlink);
-	};
-	db_walker.WalkTreeZone( action, zone, DBWalk::WIND_OUT);
-}
-
-
 NodeTable::SwapTransaction::SwapTransaction(NodeTable *node_table_, TreeZone &zone1_, TreeZone &zone2_ ) :
 	DBCommon::SwapTransaction( zone1_, zone2_ ),
 	node_table( *node_table_ )
@@ -3,11 +3,11 @@
 
 #include "../link.hpp"
 #include "common/standard.hpp"
+#include "common/inline_set.hpp"
+#include "common/slot_map.hpp"
 #include "db_walk.hpp"
 #include "tree_zone.hpp"
 
-#include <unordered_map>
-
 namespace VN 
 {    
     
@@ -23,8 +23,12 @@ public:
     class Row : public Traceable
     {
     public:        
+        // Nearly always zero or one of these, but identifiers can have 
+        // many incoming.
+        typedef InlineSet<XLink, 1> XLinkSet;
+        
         // Our node is the child of these links.
-        set<XLink> incoming_xlinks; 
+        XLinkSet incoming_xlinks; 
 
         // Declarative XLinks onto our node. 
         // A subset of incoming_xlinks, so to get the declarer node, you'll need 
@@ -32,7 +36,7 @@ public:
         // this? So that this info is unambiguous across parallel links:
         // We'll uniquely specify the correct one if only one is a 
         // declaring link (precision). Taking parent discards that info.
-        set<XLink> declaring_xlinks;
+        XLinkSet declaring_xlinks;
         
         string GetTrace() const;
     };
@@ -42,9 +46,6 @@ public:
     
     bool IsDeclarer(XLink xlink) const;
     
-	void InsertTree(TreeZone &zone);
-	void DeleteTree(TreeZone &zone);
-
 	class SwapTransaction : DBCommon::SwapTransaction
 	{
 	public:
@@ -68,12 +69,10 @@ public:
     void Dump() const;
     
 private:
-    DBWalk db_walker;  
-    
     const LinkTable *link_table;
 
     // Node-to-row-of-x_tree_db map
-    unordered_map<TreePtr<Node>, Row> rows;
+    SlotMap<TreePtr<Node>, Row> rows;
 };    
     
 };
@@ -5,13 +5,17 @@
 #include "lacing.hpp"
 #include "relation_test.hpp"
 
+#include <numeric>
+
 using namespace VN;   
 
 Orderings::Orderings( shared_ptr<Lacing> lacing, const XTreeDatabase *db_ ) :
     plan( lacing ),
-    depth_first_ordering( db_ ),
+    depth_first_ordering( DepthFirstRelation(db_, &df_labels) ),
     category_ordering( plan.lacing ),
-    db( db_ )
+    simple_compare_ordering( SimpleCompareRelation(&hash_consing) ),
+    db( db_ ),
+    lacing_histogram( plan.lacing->GetNumOrdinals(), 0 )
 { 
 }
 
@@ -27,47 +31,82 @@ const Lacing *Orderings::GetLacing() const
     return plan.lacing.get();
 }
 
+
+const DepthFirstLabels &Orderings::GetDepthFirstLabels() const
+{
+    return df_labels;
+}
+
 	
 void Orderings::InsertTree(TreeZone &zone)
 {     
+	PreInsertTree(zone);
+	db_walker.WalkTreeZone( bind(&Orderings::InsertAction, this, placeholders::_1), 
+	                        zone, DBWalk::WIND_IN );
+	PostInsertTree(zone);
+}
+
+
+void Orderings::PreInsertTree(const TreeZone &)
+{
+	geometric_prev_xlink = XLink();
+	geometric_prev_at_terminus = false;
+}
+
+
+void Orderings::InsertAction(const DBWalk::WalkInfo &walk_info)
+{
 	// -------------------- depth-first -----------------------
-    InsertGeometric(zone);
+	InsertActionGeometric(walk_info);
 	
 	// -------------------- simple compare and category -----------------------
 	// SC and CAT are node-keyed. CAT is pure intrinsic, but SC has additionals
+	InsertActionSCAndCAT(walk_info);
+}
 
-	// Use a walk to insert all the SC and CAT when intrinsic
-	db_walker.WalkTreeZone( bind(&Orderings::InsertActionSCAndCAT, this, placeholders::_1), 
-	                        zone, DBWalk::WIND_IN );
 
+void Orderings::PostInsertTree(const TreeZone &zone)
+{
 	// SC still needs ancestors of root
 	auto subtree = TreeZone::CreateSubtree(zone.GetBaseXLink());
 
 	// GetTerminusAndBaseAncestors() never gives us a leaf node, so no need to check for other parents
 	for( TreePtr<Node> x : GetTerminusAndBaseAncestors(subtree) )                        
+	{
+		hash_consing.InsertNode( x );
 		InsertSolo( simple_compare_ordering, x );   			
+	}
 }
 
 
-void Orderings::DeleteTree(TreeZone &zone)
+void Orderings::PreDeleteTree(const TreeZone &zone)
+{
+	// SC still needs ancestors of root. Find them now, while the base 
+	// still has a row.
+	auto subtree = TreeZone::CreateSubtree(zone.GetBaseXLink());
+	ancestors_to_delete = GetTerminusAndBaseAncestors(subtree);
+}
+
+
+void Orderings::DeleteAction(const DBWalk::WalkInfo &walk_info)
 {
 	// -------------------- depth-first -----------------------
-    DeleteGeometric(zone);
+	DeleteActionGeometric(walk_info);
 
 	// -------------------- simple compare and category -----------------------
-	// SC and CAT are node-keyed. CAT is pure intrinsic, but SC has additionals.
-	
-	// Use a walk to insert all the SC and CAT when intrinsic
-	node_reached_count.clear();
-	db_walker.WalkTreeZone( bind(&Orderings::DeleteActionSCAndCAT, this, placeholders::_1),
-	                        zone, DBWalk::WIND_OUT );
+	DeleteActionSCAndCAT(walk_info);
+}
 
-	// SC still needs ancestors of root
-	auto subtree = TreeZone::CreateSubtree(zone.GetBaseXLink());
-	
+
+void Orderings::PostDeleteTree(const TreeZone &)
+{
 	// GetTerminusAndBaseAncestors() never gives us a leaf node, so no need to check for other parents
-	for( TreePtr<Node> x : GetTerminusAndBaseAncestors(subtree) )    
+	for( TreePtr<Node> x : ancestors_to_delete )    
+	{
 		EraseSolo( simple_compare_ordering, x );                              
+		hash_consing.DeleteNode( x );
+	}
+	ancestors_to_delete.clear();
 }
 
 
@@ -80,10 +119,17 @@ Orderings::SwapTransaction::SwapTransaction(Orderings *orderings_, TreeZone &zon
     orderings.DeleteGeometric(zone2);
 
 	// -------------------- simple compare -----------------------
+	// Ancestors' subtrees are about to change, so declass them too
 	for( TreePtr<Node> x : orderings.GetTerminusAndBaseAncestors(zone1) )    
+	{
 		EraseSolo( orderings.simple_compare_ordering, x );                              
+		orderings.hash_consing.DeleteNode( x );
+	}
 	for( TreePtr<Node> x : orderings.GetTerminusAndBaseAncestors(zone2) )    
+	{
 		EraseSolo( orderings.simple_compare_ordering, x );                              
+		orderings.hash_consing.DeleteNode( x );
+	}
 }
 
 
@@ -95,33 +141,73 @@ Orderings::SwapTransaction::~SwapTransaction()
 
 	// -------------------- simple compare -----------------------
 	for( TreePtr<Node> x : orderings.GetTerminusAndBaseAncestors(zone1) )                        
+	{
+		orderings.hash_consing.InsertNode( x );
 		InsertSolo( orderings.simple_compare_ordering, x );   			
+	}
 	for( TreePtr<Node> x : orderings.GetTerminusAndBaseAncestors(zone2) )                        
+	{
+		orderings.hash_consing.InsertNode( x );
 		InsertSolo( orderings.simple_compare_ordering, x );   			
+	}
 }
 
         
 void Orderings::InsertGeometric(const TreeZone &zone)
 {     
-	// Take care of the DFO, which is an XLink-keyed ordering and must be updated fully in geom case
-    auto action = [&](const DBWalk::WalkInfo &walk_info)
-    {
-	 	InsertSolo( depth_first_ordering, walk_info.xlink );
-	};
-	
-    db_walker.WalkTreeZone( action, zone, DBWalk::WIND_IN );
+	PreInsertTree(zone);
+    db_walker.WalkTreeZone( bind(&Orderings::InsertActionGeometric, this, placeholders::_1), 
+                            zone, DBWalk::WIND_IN );
 }
 
 
 void Orderings::DeleteGeometric(const TreeZone &zone)
+{
+    db_walker.WalkTreeZone( bind(&Orderings::DeleteActionGeometric, this, placeholders::_1), 
+                            zone, DBWalk::WIND_IN );
+}
+
+
+void Orderings::InsertActionGeometric(const DBWalk::WalkInfo &walk_info)
+{
+	// Take care of the DFO, which is an XLink-keyed ordering and must be updated fully in geom case.
+	// Labels first, because the DFO compares them. We walk in depth-first order, so each 
+	// XLink comes straight after the previous one, unless that was a terminus, in which 
+	// case it comes after the terminus's subtree, which is still in place.
+	if( walk_info.at_base )
+		InsertBaseLabel( walk_info.xlink );
+	else if( geometric_prev_at_terminus )
+		df_labels.InsertAfter( walk_info.xlink, XTreeDatabase::GetLastDescendantXLink(geometric_prev_xlink) );
+	else
+		df_labels.InsertAfter( walk_info.xlink, geometric_prev_xlink );
+	geometric_prev_xlink = walk_info.xlink;
+	geometric_prev_at_terminus = walk_info.at_terminus;
+		
+	InsertSolo( depth_first_ordering, walk_info.xlink );
+}
+
+
+void Orderings::DeleteActionGeometric(const DBWalk::WalkInfo &walk_info)
 {
 	// Take care of the DFO, which is an XLink-keyed ordering and must be updated fully in geom case
-    auto action = [&](const DBWalk::WalkInfo &walk_info)
-    {
-	 	EraseSolo( depth_first_ordering, walk_info.xlink );
-	};
-	
-    db_walker.WalkTreeZone( action, zone, DBWalk::WIND_IN );
+	EraseSolo( depth_first_ordering, walk_info.xlink );
+	df_labels.Erase( walk_info.xlink );
+}
+
+
+void Orderings::InsertBaseLabel(XLink base_xlink)
+{
+	// Base of zone can be anywhere, so we must find its predecessor from the X tree
+	if( XLink pred_xlink = db->TryGetDepthFirstPredecessorXLink(base_xlink) )
+	{
+		df_labels.InsertAfter( base_xlink, pred_xlink );
+	}
+	else
+	{
+		DBCommon::TreeOrdinal tree_ordinal = db->GetRow(base_xlink).tree_ordinal;
+		ASSERT( tree_ordinal != DBCommon::UnknownTree );
+		df_labels.InsertAtFront( base_xlink, tree_ordinal );
+	}
 }
 
 
@@ -132,14 +218,19 @@ void Orderings::InsertActionSCAndCAT(const DBWalk::WalkInfo &walk_info)
 		return;
 
 	// Multiple parents: only if not already
+	// Classing the first node also classes the rest of the zone
 	if( simple_compare_ordering.count(walk_info.node)==0 )
+	{
+		hash_consing.InsertNode( walk_info.node );
 		InsertSolo( simple_compare_ordering, walk_info.node );               
+	}
 
 	// Multiple parents: only if not already
 	if( category_ordering.count(walk_info.node) == 0 )
 	{
 		TRACE("CAT inserts: ")(walk_info.node)("\n");
 		InsertSolo( category_ordering, walk_info.node );            	
+		lacing_histogram.at( plan.lacing->GetOrdinalForNode(walk_info.node) )++;
 	}
 }
 
@@ -150,19 +241,19 @@ void Orderings::DeleteActionSCAndCAT(const DBWalk::WalkInfo &walk_info)
 	if( walk_info.at_terminus )
 		return;
 
-	// Multiple parents: only remove if this was the last incoming XLink to the node
-	// If we reached all the incomers so there are none outside the zone, skip		
-	if( db->GetNodeRow(walk_info.node).incoming_xlinks.size() == node_reached_count[walk_info.node]+1 ) 
+	// Multiple parents: only remove if this was the last incoming XLink to the node.
+	// The node table drops each incomer after we've seen it, so this is the 
+	// last one if it's the only one left.
+	if( db->GetNodeRow(walk_info.node).incoming_xlinks.size() == 1 ) 
 	{		
 		EraseSolo( simple_compare_ordering, walk_info.node );               
+		hash_consing.DeleteNode( walk_info.node );
 	
 		TRACE("CAT deletes: ")(walk_info.node)("\n");
 		EraseSolo( category_ordering, walk_info.node );   
+		lacing_histogram.at( plan.lacing->GetOrdinalForNode(walk_info.node) )--;
 		TRACE("CAT at %p size=%u\n", this, category_ordering.size());	
     }
-
-	// Track the number of times we've reached each node in current zone
-	node_reached_count[walk_info.node]++;     
 }
        
 
@@ -198,8 +289,21 @@ set<TreePtr<Node>> Orderings::GetTerminusAndBaseAncestors( const TreeZone &tz )
 void Orderings::CheckSizeIs( size_t tot_num_xlinks, size_t tot_num_nodes ) const
 {
 	ASSERT( depth_first_ordering.size() == tot_num_xlinks );
+	df_labels.CheckSizeIs( tot_num_xlinks );
 	ASSERT( category_ordering.size() == tot_num_nodes );
+	ASSERT( accumulate(lacing_histogram.begin(), lacing_histogram.end(), (size_t)0) == tot_num_nodes );
 	ASSERT( simple_compare_ordering.size() == tot_num_nodes );
+	ASSERT( hash_consing.GetNumNodes() == tot_num_nodes );
+}
+
+
+size_t Orderings::CountInLacingRanges( const list<pair<int, int>> &int_range_list ) const
+{
+	size_t count = 0;
+	for( pair<int, int> int_range : int_range_list )
+		for( int i=int_range.first; i<int_range.second; i++ )
+			count += lacing_histogram.at(i);
+	return count;
 }
 
 
@@ -226,7 +330,7 @@ void Orderings::CheckRelations( const vector<XLink> &xlink_domain,
                         true,
                         "category_ordering" );
 
-    DepthFirstRelation dfr( db );
+    DepthFirstRelation dfr( db, &df_labels );
     dfr.Test( xlink_domain );    
 
     TestOrderingIntact( depth_first_ordering,
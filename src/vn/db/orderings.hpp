@@ -6,6 +6,8 @@
 #include "sc_relation.hpp"
 #include "cat_relation.hpp"
 #include "df_relation.hpp"
+#include "df_labels.hpp"
+#include "hash_consing.hpp"
 #include "db_walk.hpp"
 #include "node_table.hpp"
 #include "tree_zone.hpp"
@@ -37,9 +39,20 @@ private:
     
 public:
     const Lacing *GetLacing() const;
+    const DepthFirstLabels &GetDepthFirstLabels() const;
 
     void InsertTree(TreeZone &zone);
-    void DeleteTree(TreeZone &zone);
+
+    // For fusing into the database's single walk over a zone being built 
+    // or torn down. Per-XLink actions expect the link table row to be in 
+    // place when inserting, and the node table to not yet have dropped the 
+    // XLink when deleting. There's no DeleteTree() since it depends on that.
+    void PreInsertTree(const TreeZone &zone);
+    void InsertAction(const DBWalk::WalkInfo &walk_info);
+    void PostInsertTree(const TreeZone &zone);
+    void PreDeleteTree(const TreeZone &zone);
+    void DeleteAction(const DBWalk::WalkInfo &walk_info);
+    void PostDeleteTree(const TreeZone &zone);
 
 	class SwapTransaction : DBCommon::SwapTransaction
 	{
@@ -55,14 +68,21 @@ public:
     void DeleteGeometric(const TreeZone &zone);
 
 private:
+	void InsertActionGeometric(const DBWalk::WalkInfo &walk_info);
+	void DeleteActionGeometric(const DBWalk::WalkInfo &walk_info);
 	void InsertActionSCAndCAT(const DBWalk::WalkInfo &walk_info);
     void DeleteActionSCAndCAT(const DBWalk::WalkInfo &walk_info);
+	void InsertBaseLabel(XLink base_xlink);
 
 	set<TreePtr<Node>> GetTerminusAndBaseAncestors( const TreeZone &tz ) const; 
     
 public:
    	void CheckSizeIs( size_t tot_num_xlinks, size_t tot_num_nodes ) const;
 
+    // Number of nodes in the domain with lacing ordinals in the supplied 
+    // half-open ranges, as got from eg Lacing::GetRangeListForCategory()
+    size_t CountInLacingRanges( const list<pair<int, int>> &int_range_list ) const;
+
     void Dump() const;
     void CheckRelations( const vector<XLink> &xlink_domain,  
                          const vector<TreePtr<Node>> &node_domain );
@@ -84,12 +104,19 @@ public:
     typedef set<DepthFirstRelation::KeyType, 
                 DepthFirstRelation> DepthFirstOrdering;
 
+    // Order-maintenance labels used by depth_first_ordering, so declare first
+    DepthFirstLabels df_labels;
+
     // Global domain of possible xlink values - new version
     DepthFirstOrdering depth_first_ordering;            
     
     // Domain ordered by category
     CategoryOrdering category_ordering;
     
+    // Structural classes used by simple_compare_ordering, so declare first.
+    // Holds exactly the nodes in simple_compare_ordering.
+    HashConsing hash_consing;
+    
     // Whole domain in here, grouped by simple compare, findable using eg lower_bound()
     // Should be the other way around, as an indication of policy
     SimpleCompareOrdering simple_compare_ordering;   
@@ -98,9 +125,15 @@ private:
     const XTreeDatabase *db;
     DBWalk db_walker;
         
+    // Note: live across inserting walks
+    XLink geometric_prev_xlink;
+    bool geometric_prev_at_terminus = false;
+    
     // Note: live across deleting walks
-    map<TreePtr<Node>, size_t> node_reached_count;    
-    set<TreePtr<Node>> debt;
+    set<TreePtr<Node>> ancestors_to_delete;
+    
+    // Number of nodes in category_ordering at each lacing ordinal
+    vector<size_t> lacing_histogram;
 };    
     
 }
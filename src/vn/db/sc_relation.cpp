@@ -16,6 +16,12 @@ SimpleCompareRelation::SimpleCompareRelation() :
 }
 
 
+SimpleCompareRelation::SimpleCompareRelation( const SimpleCompare::ClassSource *class_source ) :
+    simple_compare( make_shared<SimpleCompare>( Orderable::TOTAL, class_source ) )
+{
+}
+
+
 bool SimpleCompareRelation::operator()( KeyType l_key, KeyType r_key ) const
 {
     return Compare3Way(l_key, r_key) < 0;
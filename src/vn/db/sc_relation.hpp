@@ -6,12 +6,11 @@
 #include "helpers/transformation.hpp"
 #include "helpers/walk.hpp"
 #include "helpers/flatten.hpp"
+#include "helpers/simple_compare.hpp"
 #include "../link.hpp"
 
 #include <memory>
 
-class SimpleCompare;
-
 namespace VN
 {
 class SimpleCompareRelation
@@ -20,6 +19,9 @@ public:
     typedef TreePtr<Node> KeyType;
 
     SimpleCompareRelation();
+    
+    // Equivalent subtrees are found without walking if they are classed
+    explicit SimpleCompareRelation( const SimpleCompare::ClassSource *class_source );
 
     /// Less operator: for use with set, map etc
     bool operator()( KeyType l_key, KeyType r_key ) const;
@@ -3,6 +3,7 @@
 #include "lacing.hpp"
 
 #include "common/read_args.hpp"
+#include "common/consistency_check.hpp"
 #include "tree_zone.hpp"
 #include "free_zone.hpp"
 #include "mutable_zone.hpp"
@@ -18,6 +19,8 @@ using namespace VN;
 //   when testing the test
 //#define DB_TEST_THE_TEST
 
+static ConsistencyCheck check_assets_check("XTreeDatabase::CheckAssets");
+
 XTreeDatabase::XTreeDatabase( shared_ptr<Lacing> lacing_, DomainExtension::ExtenderSet domain_extenders ) :
     lacing( lacing_ ),
     domain( make_shared<Domain>() ),
@@ -60,10 +63,18 @@ DBCommon::TreeOrdinal XTreeDatabase::BuildTree( DBCommon::TreeType tree_type, co
 	auto zone = TreeZone::CreateSubtree(root_xlink, tree_ordinal);
     TRACE("Tree ordinal: %d subtree zone: ", tree_ordinal)(zone)("\n");
 
-	domain->InsertTree(zone);   
-	link_table->InsertTree(zone);   
-	node_table->InsertTree(zone);   
-	orderings->InsertTree(zone);   
+    // One walk for the intrinsic assets. Node table needs the link table
+    // row for the same XLink, and orderings need the base's row.
+    orderings->PreInsertTree(zone);
+	db_walker.WalkTreeZone( DBWalk::Fuse( 
+		[this](const DBWalk::WalkInfo &walk_info) { domain->InsertAction(walk_info); },
+		[this](const DBWalk::WalkInfo &walk_info) { link_table->InsertAction(walk_info); },
+		[this](const DBWalk::WalkInfo &walk_info) { node_table->InsertLink(walk_info.xlink); },
+		[this](const DBWalk::WalkInfo &walk_info) { orderings->InsertAction(walk_info); } ),
+	                        zone, DBWalk::WIND_IN, DBCommon::GetRootCoreInfo() );
+    orderings->PostInsertTree(zone);
+    
+    // Domain extension queries the new tree as a whole, so needs it complete
     domain_extension->InsertTree(zone);   
     
     if( tree_type == DBCommon::TreeType::MAIN )
@@ -84,15 +95,28 @@ void XTreeDatabase::TeardownTree(DBCommon::TreeOrdinal tree_ordinal, bool defer_
 		TRACE("Tree ordinal: %d root: ", tree_ordinal)(zone)("\n");
 
 		domain_extension->DeleteTree(zone);   
-		orderings->DeleteTree(zone);
-		node_table->DeleteTree(zone);   
-		link_table->DeleteTree(zone);   
-		domain->DeleteTree(zone);   
+		
+		// One walk for the intrinsic assets, in the reverse order to 
+		// building. Orderings need to see the node table before it drops 
+		// the XLink, and the node table needs the link table row.
+		orderings->PreDeleteTree(zone);
+		db_walker.WalkTreeZone( DBWalk::Fuse( 
+			[this](const DBWalk::WalkInfo &walk_info) { orderings->DeleteAction(walk_info); },
+			[this](const DBWalk::WalkInfo &walk_info) { node_table->DeleteLink(walk_info.xlink); },
+			[this](const DBWalk::WalkInfo &walk_info) { link_table->DeleteAction(walk_info); },
+			[this](const DBWalk::WalkInfo &walk_info) { domain->DeleteAction(walk_info); } ),
+		                        zone, DBWalk::WIND_OUT, DBCommon::GetRootCoreInfo() );
+		orderings->PostDeleteTree(zone);
 		
 		// XLink memory safety: let zone and root_xlink drop out of scope 
 		// before freeing tree, which will delete the underlying TreePtr<>	
 	} 
 
+	// XLink memory safety: drop logged touches that were in the tree
+	touch_log.erase( remove_if( touch_log.begin(), touch_log.end(), 
+	                            [this](XLink xlink){ return !HasRow(xlink); } ), 
+	                 touch_log.end() );
+
 	if( defer_freeing_nodes )
 		deferred_tree_ordinals.push( tree_ordinal );
 	else
@@ -123,6 +147,16 @@ void XTreeDatabase::SwapTreeToTree( TreeZone &zone1, vector<TreeZone *> fixups1,
 	MutableZone lmzone1 = CreateMutableZone(zone1);
 	MutableZone lmzone2 = CreateMutableZone(zone2);
 
+	// The main tree zone's nodes are about to leave the main tree. Once 
+	// they're out, the touch log can't tell us about them.
+	for( const TreeZone *zone : {&zone1, &zone2} )
+		if( zone->GetTreeOrdinal() == main_tree_ordinal )
+			db_walker.WalkTreeZone( [this](const DBWalk::WalkInfo &walk_info)
+			{
+				if( !walk_info.at_terminus )
+					swapped_out_lacing_ordinals.insert( lacing->GetOrdinalForNode( walk_info.node ) );
+			}, *zone, DBWalk::WIND_IN );
+
 	{
 		// Scope contains suspension objects on stack
 		DomainExtension::SwapTransaction de_sus(domain_extension.get(), zone1, zone2);  
@@ -142,6 +176,10 @@ void XTreeDatabase::SwapTreeToTree( TreeZone &zone1, vector<TreeZone *> fixups1,
 			 
 		// Suspensions expire in reverse order.     
 	} 
+
+	for( const TreeZone *zone : {&zone1, &zone2} )
+		if( zone->GetTreeOrdinal() == main_tree_ordinal )
+			touch_log.push_back( zone->GetBaseXLink() );
         
     CheckAssets();       
 }
@@ -167,10 +205,60 @@ void XTreeDatabase::DeferredActionsEndOfStep()
 	}
 	
 	domain_extension->DeferredActionsEndOfStep();
+	touch_log.clear();
+	swapped_out_lacing_ordinals.clear();
     CheckAssets();           
 }
 
 
+size_t XTreeDatabase::GetTouchLogPosition() const
+{
+	return touch_log.size();
+}
+
+
+set<XLink> XTreeDatabase::GetTouchedRegion( size_t since ) const
+{
+	ASSERT( since <= touch_log.size() );
+	set<XLink> region;
+	for( size_t i=since; i<touch_log.size(); i++ )
+	{
+		XLink base = touch_log[i];
+		if( GetRow(base).tree_ordinal != main_tree_ordinal )
+			continue; // has since been moved out of the main tree
+			
+		// Ancestors, stopping when we reach ones we already have
+		for( XLink xlink = base; xlink && region.insert(xlink).second; xlink = TryGetParentXLink(xlink) )
+		{
+		}
+		
+		// Descendants are contiguous in depth-first order
+		XLink last = GetLastDescendantXLink(base);
+		auto it = orderings->depth_first_ordering.find(base);
+		ASSERT( it != orderings->depth_first_ordering.end() );
+		while( true )
+		{
+			region.insert(*it);
+			if( *it == last )
+				break;
+			++it;
+			ASSERT( it != orderings->depth_first_ordering.end() );
+		}
+	}
+	return region;
+}
+
+
+set<int> XTreeDatabase::GetTouchedLacingOrdinals() const
+{
+	const Lacing *lacing = orderings->GetLacing();
+	set<int> ordinals = swapped_out_lacing_ordinals;
+	for( XLink xlink : GetTouchedRegion(0) )
+		ordinals.insert( lacing->GetOrdinalForNode( xlink.GetChildTreePtr() ) );
+	return ordinals;
+}
+
+
 XLink XTreeDatabase::GetRootXLink(DBCommon::TreeOrdinal tree_ordinal) const
 {
     const DBCommon::TreeRecord &tree_rec = trees_by_ordinal.at(tree_ordinal);
@@ -226,7 +314,7 @@ XLink XTreeDatabase::TryGetParentXLink(XLink xlink) const
     if( !parent_node )
         return XLink();
         
-    const set<XLink> &ps = GetNodeRow(parent_node).incoming_xlinks;
+    const NodeTable::Row::XLinkSet &ps = GetNodeRow(parent_node).incoming_xlinks;
 
     // Note that the parent is unique because:
     // - row is relative to a link, not a node,
@@ -241,6 +329,70 @@ XLink XTreeDatabase::TryGetParentXLink(XLink xlink) const
 }
 
 
+XLink XTreeDatabase::TryGetDepthFirstPredecessorXLink(XLink xlink) const
+{
+    const LinkTable::Row &row = GetRow(xlink);
+    
+    // Try for an earlier sibling in the same container
+    switch( row.context_type )
+    {
+        case DBCommon::ROOT:
+            return XLink(); 
+        case DBCommon::SINGULAR:
+            break;
+        case DBCommon::IN_SEQUENCE:
+        {
+            if( row.sequence_predecessor != XLink::OffEnd )
+                return GetLastDescendantXLink( row.sequence_predecessor );
+            break;
+        }
+        case DBCommon::IN_COLLECTION:
+        {
+            // No predecessor in the row for collections, so look from the front
+            XLink prev_xlink;
+            for( ContainerInterface::iterator xit = row.p_container->begin();
+                 xit != row.container_it;
+                 ++xit )
+                prev_xlink = XLink( &*xit );
+            if( prev_xlink )
+                return GetLastDescendantXLink( prev_xlink );
+            break;
+        }
+        default:
+            ASSERTFAIL();
+    }
+    
+    // Try for an earlier item of the parent
+    Itemiser::ElementTable x_items = row.parent_node->GetItemiseTable();
+    for( int item_ordinal=row.item_ordinal-1; item_ordinal>=0; item_ordinal-- )
+    {
+        switch( x_items.GetKind(item_ordinal) )
+        {
+        case Itemiser::ElementKind::SEQUENCE:
+        case Itemiser::ElementKind::COLLECTION:
+        {
+            ContainerInterface *x_con = x_items.GetKind(item_ordinal)==Itemiser::ElementKind::SEQUENCE ?
+                                        (ContainerInterface *)x_items.GetSequence(item_ordinal) :
+                                        (ContainerInterface *)x_items.GetCollection(item_ordinal);
+            if( !x_con->empty() )
+                return GetLastDescendantXLink( XLink( &x_con->back() ) );
+            break;
+        }
+        case Itemiser::ElementKind::SINGULAR:
+        {
+            TreePtrInterface *p_x_singular = x_items.GetSingular(item_ordinal);
+            if( *p_x_singular ) // tolerate NULL singlar child pointers
+                return GetLastDescendantXLink( XLink( p_x_singular ) );
+            break;
+        }
+        }
+    }
+    
+    // First child, so parent comes before us
+    return TryGetParentXLink(xlink);
+}
+
+
 XLink XTreeDatabase::GetXLink( const TreePtrInterface *px ) const
 {
     XLink xlink = TryGetXLink(px);
@@ -256,7 +408,7 @@ XLink XTreeDatabase::TryGetXLink( const TreePtrInterface *px ) const
     if( !HasNodeRow(child_node) )
         return XLink(); // fail
     
-    NodeTable::Row row = GetNodeRow(child_node);
+    const NodeTable::Row &row = GetNodeRow(child_node);
 
     for( XLink xlink : row.incoming_xlinks )
         if( xlink.GetTreePtrInterface() == px )
@@ -270,24 +422,31 @@ XLink XTreeDatabase::GetLastDescendantXLink(XLink base)
 {
     TreePtr<Node> x = base.GetChildTreePtr();
     ASSERTS(x)("This probably means we're walking an incomplete tree");
-    vector< Itemiser::Element * > x_items = x->Itemise();
+    Itemiser::ElementTable x_items = x->GetItemiseTable();
 
     // Loop backward over the items
     for( int item_ordinal=x_items.size()-1; item_ordinal>=0; item_ordinal-- )
     {
-        Itemiser::Element *xe = x_items[item_ordinal];
-        if( auto x_con = dynamic_cast<ContainerInterface *>(xe) )
+        switch( x_items.GetKind(item_ordinal) )
         {
+        case Itemiser::ElementKind::SEQUENCE:
+        case Itemiser::ElementKind::COLLECTION:
+        {
+            ContainerInterface *x_con = x_items.GetKind(item_ordinal)==Itemiser::ElementKind::SEQUENCE ?
+                                        (ContainerInterface *)x_items.GetSequence(item_ordinal) :
+                                        (ContainerInterface *)x_items.GetCollection(item_ordinal);
             if( !x_con->empty() )
                 return GetLastDescendantXLink( XLink( &x_con->back() ) );
+            break;
         }
-        else if( auto p_x_singular = dynamic_cast<TreePtrInterface *>(xe) )
+        case Itemiser::ElementKind::SINGULAR:
         {
+            TreePtrInterface *p_x_singular = x_items.GetSingular(item_ordinal);
             if( *p_x_singular ) // tolerate NULL singlar child pointers
-                return GetLastDescendantXLink( XLink( &*p_x_singular ) );
+                return GetLastDescendantXLink( XLink( p_x_singular ) );
+            break;
+        }
         }
-        else
-            ASSERTFAILS("got something strange from itemise");
     }
 
     // No children so we are our our own last descendant
@@ -346,6 +505,9 @@ void XTreeDatabase::DumpTables() const
 void XTreeDatabase::CheckAssets()
 {
     INDENT("?");
+    // -sd asks for every check, every time, regardless of -check
+    if( !check_assets_check.ShouldRun() && !ReadArgs::test_db )
+		return;
 
 	size_t tot_num_xlinks = domain->GetTotNumXLinks();
 	size_t tot_num_nodes = node_table->GetTotNumNodes();
@@ -413,10 +575,9 @@ Mutator XTreeDatabase::CreateTreeMutator(XLink xlink)
         }    
         case DBCommon::SINGULAR:
         {
-            const vector< Itemiser::Element * > x_items = row.parent_node->Itemise();
-            Itemiser::Element *xe = x_items.at(row.item_ordinal);        
-            auto p_x_singular = dynamic_cast<TreePtrInterface *>(xe);
-            ASSERT( p_x_singular );
+            Itemiser::ElementTable x_items = row.parent_node->GetItemiseTable();
+            ASSERT( row.item_ordinal < (int)x_items.size() );
+            TreePtrInterface *p_x_singular = x_items.GetSingular(row.item_ordinal);
             m = Mutator::CreateTreeSingular( row.parent_node, p_x_singular );
             break;
         }
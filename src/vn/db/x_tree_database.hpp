@@ -43,6 +43,18 @@ public:
     void DeferredActionsEndOfUpdate();
     void DeferredActionsEndOfStep();
 
+	// ---------------- touched regions ------------------
+	// Main tree XLinks at which zones were swapped are logged so that a
+	// search may be resumed near recent changes. Log is cleared at end of step.
+	size_t GetTouchLogPosition() const;
+	
+	// Ancestors and descendants of main tree XLinks logged since position
+	set<XLink> GetTouchedRegion( size_t since ) const;
+
+	// Lacing ordinals of the nodes in the region touched during this step,
+	// and of the nodes that were swapped out of the main tree
+	set<int> GetTouchedLacingOrdinals() const;
+
 	// ---------------- const and static methods ------------------
     XLink GetRootXLink(DBCommon::TreeOrdinal tree_ordinal) const;
     DBCommon::TreeType GetTreeType(DBCommon::TreeOrdinal tree_ordinal) const;
@@ -58,6 +70,9 @@ public:
     // Parent X link if not a root
     XLink TryGetParentXLink(XLink xlink) const;
     
+    // Previous XLink in depth-first order (same tree) if not a root
+    XLink TryGetDepthFirstPredecessorXLink(XLink xlink) const;
+    
     // XLink from TPI ptr
     XLink TryGetXLink( const TreePtrInterface *ptp ) const;
     XLink GetXLink( const TreePtrInterface *ptp ) const;
@@ -98,6 +113,10 @@ private:
 
     queue<DBCommon::TreeOrdinal> deferred_tree_ordinals;
     queue<DBCommon::TreeOrdinal> free_tree_ordinals;
+    
+    // XLink memory safety: only holds XLinks that have rows, see TeardownTree()
+    vector<XLink> touch_log;
+    set<int> swapped_out_lacing_ordinals;
 
     DBWalk db_walker;
     DBCommon::TreeOrdinal next_tree_ordinal;  
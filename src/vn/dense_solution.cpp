@@ -0,0 +1,160 @@
+#include "dense_solution.hpp"
+
+using namespace VN;
+
+// ------------------------- PatternLinkIndices --------------------------
+
+PatternLinkIndices::PatternLinkIndices( const set<PatternLink> &plinks_ ) :
+    plinks( plinks_.begin(), plinks_.end() )
+{
+    for( int i=0; i<(int)plinks.size(); i++ )
+        indices[plinks[i]] = i;
+}
+
+
+bool PatternLinkIndices::Contains( const PatternLink &plink ) const
+{
+    return indices.count(plink) > 0;
+}
+
+
+int PatternLinkIndices::GetIndex( const PatternLink &plink ) const
+{
+    auto it = indices.find(plink);
+    ASSERT( it != indices.end() )(plink)(" has no index in ")(*this);
+    return it->second;
+}
+
+
+const PatternLink &PatternLinkIndices::GetPatternLink( int index ) const
+{
+    return plinks.at(index);
+}
+
+
+int PatternLinkIndices::GetSize() const
+{
+    return plinks.size();
+}
+
+
+string PatternLinkIndices::GetTrace() const
+{
+    return Trace(plinks);
+}
+
+// ------------------------- DenseSolution --------------------------
+
+DenseSolution::DenseSolution() :
+    num_assigned( 0 )
+{
+}
+
+
+DenseSolution::DenseSolution( shared_ptr<const PatternLinkIndices> indices_ ) :
+    indices( indices_ ),
+    values( indices->GetSize() ),
+    present( indices->GetSize(), false ),
+    num_assigned( 0 )
+{
+}
+
+
+bool DenseSolution::IsAssigned( int index ) const
+{
+    return present[index];
+}
+
+
+const XLink &DenseSolution::Get( int index ) const
+{
+    ASSERT( present[index] )(indices->GetPatternLink(index))(" is not assigned");
+    return values[index];
+}
+
+
+void DenseSolution::Set( int index, const XLink &xlink )
+{
+    if( !present[index] )
+    {
+        present[index] = true;
+        num_assigned++;
+    }
+    values[index] = xlink;
+}
+
+
+void DenseSolution::Erase( int index )
+{
+    if( present[index] )
+    {
+        present[index] = false;
+        num_assigned--;
+    }
+    values[index] = XLink(); // don't keep the XLink alive
+}
+
+
+bool DenseSolution::IsAssigned( const PatternLink &plink ) const
+{
+    return indices->Contains(plink) && IsAssigned( indices->GetIndex(plink) );
+}
+
+
+const XLink &DenseSolution::Get( const PatternLink &plink ) const
+{
+    return Get( indices->GetIndex(plink) );
+}
+
+
+void DenseSolution::Set( const PatternLink &plink, const XLink &xlink )
+{
+    Set( indices->GetIndex(plink), xlink );
+}
+
+
+void DenseSolution::Erase( const PatternLink &plink )
+{
+    Erase( indices->GetIndex(plink) );
+}
+
+
+int DenseSolution::GetNumAssigned() const
+{
+    return num_assigned;
+}
+
+
+bool DenseSolution::IsEmpty() const
+{
+    return num_assigned == 0;
+}
+
+
+void DenseSolution::Clear()
+{
+    for( int i=0; i<(int)values.size(); i++ )
+        Erase(i);
+}
+
+
+shared_ptr<const PatternLinkIndices> DenseSolution::GetIndices() const
+{
+    return indices;
+}
+
+
+SolutionMap DenseSolution::GetMap() const
+{
+    SolutionMap m;
+    for( int i=0; i<(int)values.size(); i++ )
+        if( present[i] )
+            m[indices->GetPatternLink(i)] = values[i];
+    return m;
+}
+
+
+string DenseSolution::GetTrace() const
+{
+    return Trace(GetMap());
+}
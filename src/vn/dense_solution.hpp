@@ -0,0 +1,75 @@
+#ifndef DENSE_SOLUTION_HPP
+#define DENSE_SOLUTION_HPP
+
+#include "common/common.hpp"
+#include "link.hpp"
+
+#include <vector>
+#include <unordered_map>
+
+namespace VN
+{
+
+// Gives each pattern link in a fixed set a small integer index, so that
+// values for them can be kept in arrays. Decided at planning time and
+// then shared by everything that needs to agree on the indices.
+class PatternLinkIndices : public Traceable
+{
+public:
+    explicit PatternLinkIndices( const set<PatternLink> &plinks );
+
+    bool Contains( const PatternLink &plink ) const;
+    int GetIndex( const PatternLink &plink ) const;
+    const PatternLink &GetPatternLink( int index ) const;
+    int GetSize() const;
+
+    string GetTrace() const;
+
+private:
+    vector<PatternLink> plinks;
+    unordered_map<PatternLink, int> indices;
+};
+
+
+// Same information as a SolutionMap restricted to the pattern links of a
+// PatternLinkIndices, but held as an array of values with a mask saying
+// which are present. Setting and erasing are O(1) and don't allocate.
+class DenseSolution : public Traceable
+{
+public:
+    DenseSolution();
+    explicit DenseSolution( shared_ptr<const PatternLinkIndices> indices );
+
+    // By index: use in inner loops
+    bool IsAssigned( int index ) const;
+    const XLink &Get( int index ) const;
+    void Set( int index, const XLink &xlink );
+    void Erase( int index );
+
+    // By pattern link: costs a hash lookup
+    bool IsAssigned( const PatternLink &plink ) const;
+    const XLink &Get( const PatternLink &plink ) const;
+    void Set( const PatternLink &plink, const XLink &xlink );
+    void Erase( const PatternLink &plink );
+
+    int GetNumAssigned() const;
+    bool IsEmpty() const;
+    void Clear();
+
+    shared_ptr<const PatternLinkIndices> GetIndices() const;
+
+    // For compatibility with code that wants a SolutionMap. Allocates.
+    SolutionMap GetMap() const;
+
+    string GetTrace() const;
+
+private:
+    shared_ptr<const PatternLinkIndices> indices;
+    vector<XLink> values;
+    vector<bool> present;
+    int num_assigned;
+};
+
+};
+
+#endif
@@ -41,6 +41,7 @@ string Render::RenderToString( shared_ptr<CompareReplace> pattern, bool lowering
     // Context is used for various lookups but does not need
     // to be a Scope.
     context = pattern->GetSearchComparePattern(); 
+    scope_index.reset();
         
     utils = make_unique<DefaultTransUtils>(context);
     using namespace placeholders;
@@ -661,7 +662,9 @@ TreePtr<Node> Render::TryGetScope( TreePtr<Node> node ) const
 		
     try
     {
-        return GetScope( context, id );
+        if( !scope_index )
+            scope_index = make_unique<ScopeIndex>( context );
+        return scope_index->GetScope( id );
     }
     catch( ScopeNotFoundMismatch & )
     {
@@ -7,6 +7,7 @@
 #include "uniquify_identifiers.hpp"
 #include "helpers/simple_compare.hpp"
 #include "tree/misc.hpp"
+#include "tree/scope.hpp"
 #include "indenter.hpp"
 
 namespace VN 
@@ -74,6 +75,7 @@ public:
 
     const Syntax::Policy default_policy;
     TreePtr<Node> context;
+    mutable unique_ptr<ScopeIndex> scope_index; // of context, made on demand
     UniquifyNames::NodeToNameMap unique_coupling_names;
     UniquifyNames::LinkSetByNode incoming_links_map;
     const string output_x_path;                                     
@@ -2,6 +2,7 @@
 #include "search_replace.hpp"
 #include "conjecture.hpp"
 #include "common/hit_count.hpp"
+#include "common/profiler.hpp"
 #include "agents/standard_agent.hpp"
 #include "agents/delta_agent.hpp"
 #include "agents/depth_agent.hpp"
@@ -11,16 +12,21 @@
 #include "link.hpp"
 #include "vn_sequence.hpp"
 #include "up/tree_update.hpp"
+#include "common/read_args.hpp"
+#include "db/lacing.hpp"
 
 #include <list>
 
 //#define TRACE_KEEP_ALIVES
 
+// Most further match regions to gather in one full search with -ubatch
+#define MAX_GATHERED_REGIONS 32
+
 using namespace VN;
 using namespace std;
 
-int SCREngine::repetitions;
-bool SCREngine::rep_error;
+thread_local int SCREngine::repetitions;
+thread_local bool SCREngine::rep_error;
 
 
 // The enclosing_plinks argument is a set of plinks to agents that we should not
@@ -305,6 +311,10 @@ void SCREngine::Plan::PlanningStageFive( shared_ptr<const Lacing> lacing )
 
     and_rule_engine->PlanningStageFive(lacing);
     
+    // Expressions are already split at the top-level ands, so a category 
+    // clause here must hold for any match at all
+    required_lacing_ranges = lacing->GetRangeListsForCategoryClauses( and_rule_engine->GetExpressions(), true );
+    
     for( pair< Agent *, shared_ptr<SCREngine> > p : my_engines )
         p.second->PlanningStageFive(lacing);    
             
@@ -391,9 +401,12 @@ Agent::ReplacePatchPtr SCREngine::CreateReplaceLayout()
 }
 
 
-void SCREngine::SingleCompareReplace( XLink origin_xlink ) 
+bool SCREngine::SingleCompareReplace( XLink origin_xlink,
+                                      const set<XLink> *resume_region,
+                                      list<set<XLink>> *further_regions ) 
 {
     INDENT(">");
+    Profiler::Span span( Profiler::Kind::SCR_MISS ); // until we get a match
     
     size_t initial_num_assignments = universal_assignments->size();
     
@@ -405,16 +418,25 @@ void SCREngine::SingleCompareReplace( XLink origin_xlink )
 
     TRACE("Begin search\n");
     // Note: comparing doesn't require double pointer any more, but
-    // replace does so it can change the origin node. Throws on mismatch.
+    // replace does so it can change the origin node.
     {
-		SolutionMap compare_solution = plan.and_rule_engine->Compare( origin_xlink, 
-                                                                      universal_assignments,
-                                                                      &keep_alive_nodes );
-		TRACE("Search got a match (otherwise throws)\n");
+		SolutionMap compare_solution;
+		if( !plan.and_rule_engine->Compare( origin_xlink, 
+                                            universal_assignments,
+                                            &keep_alive_nodes,
+                                            &compare_solution,
+                                            resume_region,
+                                            further_regions,
+                                            further_regions ? MAX_GATHERED_REGIONS : 0 ) )
+			return false;
+		TRACE("Search got a match\n");
+		span.SetKind( Profiler::Kind::SCR_HIT );
 			   
-		for( auto p : compare_solution )
-			(*universal_assignments)[p.first] = p.second;
 		TRACE("Compare solution copied to universal_assignments:\n")(compare_solution)("\n");
+		// Splice the nodes across rather than copying entry by entry; 
+		// compare_solution's values win.
+		compare_solution.merge( *universal_assignments );
+		universal_assignments->swap( compare_solution );
 	}
 		    
     // Now replace according to the couplings
@@ -422,11 +444,11 @@ void SCREngine::SingleCompareReplace( XLink origin_xlink )
 	TreeUpdater *updater = plan.vn_sequence->GetTreeUpdater();
     ReplaceAssignments replace_assignments = updater->UpdateMainTree( origin_xlink, move(layout) );  
 
-    // replace_assignments overrides
-	for( auto p : replace_assignments )
-		(*universal_assignments)[p.first] = p.second;
-
 	TRACE("Replace_assignments copied to universal_assignments solution:\n")(replace_assignments)("\n");
+
+    // replace_assignments overrides, as above
+	replace_assignments.merge( *universal_assignments );
+	universal_assignments->swap( replace_assignments );
 	//TRACE("universal_assignments: ")(*universal_assignments)("\n");
 
     // Now run the embedded SCR engines (LATER model)
@@ -453,6 +475,69 @@ void SCREngine::SingleCompareReplace( XLink origin_xlink )
 	      ("universal_assignments: ")(*universal_assignments)("\n")
 	      ("initial_num_assignments: ")(initial_num_assignments)("\n");
 	//FTRACE("universal_assignments: ")(*universal_assignments)("\n");
+	return true;
+}
+
+
+bool SCREngine::ResumingCompareReplace( XLink origin_xlink, size_t touch_position ) 
+{
+    // The previous hit is likely to have created new matches near the 
+    // regions it changed, so restrict the search to those first. Only 
+    // a full search can tell us there are no more matches.
+    set<XLink> region = x_tree_db->GetTouchedRegion( touch_position );
+    if( !region.empty() && region.size()*2 < x_tree_db->GetDomain().unordered_domain.size() )
+    {
+        if( SingleCompareReplace( origin_xlink, &region ) )
+            return true;
+        TRACE("No match in touched region of %u xlinks; trying full search\n", region.size());
+    }
+    
+    return SingleCompareReplace( origin_xlink );
+}
+
+
+bool SCREngine::GatheredRegionsCompareReplace( XLink origin_xlink, list<set<XLink>> &pending_regions ) 
+{
+    // Regions of other matches seen during the last full search. Earlier 
+    // hits may have changed or removed them, so each needs a fresh search,
+    // but one restricted to the region. Each hit is still its own update.
+    while( !pending_regions.empty() )
+    {
+        set<XLink> region;
+        for( XLink xlink : pending_regions.front() )
+        {
+            // XLink memory safety: only compares the pointer. If it was 
+            // re-used for a new xlink, we just get a different candidate.
+            if( x_tree_db->HasRow(xlink) && 
+                x_tree_db->GetRow(xlink).tree_ordinal == x_tree_db->GetMainTreeOrdinal() )
+                region.insert( xlink );
+        }
+        pending_regions.pop_front();
+        
+        if( !region.empty() && SingleCompareReplace( origin_xlink, &region ) )
+            return true;
+    }
+    
+    // Only a full search can tell us there are no more matches
+    return SingleCompareReplace( origin_xlink, nullptr, &pending_regions );
+}
+
+
+bool SCREngine::IsRequiredCategoryAbsent() const
+{
+    // The category histogram is maintained by the database, so this is 
+    // cheap compared to a search that would only fail
+    const Orderings &orderings = x_tree_db->GetOrderings();
+    for( const list<pair<int, int>> &int_range_list : plan.required_lacing_ranges )
+    {
+        if( orderings.CountInLacingRanges( int_range_list ) == 0 )
+        {
+            HIT;
+            TRACE("Required category absent from domain; skipping search\n");
+            return true;
+        }
+    }
+    return false;
 }
 
 
@@ -480,20 +565,36 @@ int SCREngine::RepeatingCompareReplace( XLink origin_xlink,
         return 0;
     }    
     
+    // With -uresume, searches after a hit begin near the changes made by the hit
+    bool resume = ReadArgs::use.contains("resume");
+    size_t touch_position = 0;
+    
+    // With -ubatch, a full search also finds the regions of more matches, 
+    // and these are tried before the next full search
+    bool batch = ReadArgs::use.contains("batch");
+    list<set<XLink>> pending_regions;
+    
     for(int i=0; i<repetitions; i++) 
     {
         bool stop = depth < stop_after.size() && stop_after[depth]==i+1;
         if( stop )
             for( const pair< Agent * const, shared_ptr<SCREngine> > &p : plan.my_engines )
                 p.second->SetStopAfter(stop_after, depth+1); // and propagate the remaining ones
-        try
-        {
-            // Cannonicalise could change origin
-            SingleCompareReplace( origin_xlink );
-        }
-        catch( const ::Mismatch &e )
+        size_t previous_touch_position = touch_position;
+        touch_position = x_tree_db->GetTouchLogPosition();
+        // Cannonicalise could change origin
+        bool hit;
+        if( IsRequiredCategoryAbsent() )
+            hit = false;
+        else if( batch )
+            hit = GatheredRegionsCompareReplace( origin_xlink, pending_regions );
+        else if( resume && i>0 )
+            hit = ResumingCompareReplace( origin_xlink, previous_touch_position );
+        else
+            hit = SingleCompareReplace( origin_xlink );
+        if( !hit )
         {
-            TRACE("Caught ")(e)("; stopping\n");
+            TRACE("Mismatch; stopping\n");
             if( depth < stop_after.size() )
                 ASSERT(stop_after[depth]<i)("Stop requested after hit that doesn't happen, there are only %d", i);            
             return i+1; // when the compare fails, we're done
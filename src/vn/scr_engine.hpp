@@ -123,11 +123,21 @@ private:
         set<PatternLink> keyed_before_replace_plinks;
         list<PatternLink> my_replace_only_plinks_postorder;
         list<PatternLink> my_embedded_plinks_postorder;
+        
+        // For each category that a match requires to be present in the 
+        // domain, the lacing ordinal ranges of that category
+        list<list<pair<int, int>>> required_lacing_ranges;
     } plan;
 
     void RunEmbedded( PatternLink plink_to_embedded );
 	Agent::ReplacePatchPtr CreateReplaceLayout();
-    void SingleCompareReplace( XLink origin_xlink );                                                                                              
+    // These return false on mismatch
+    bool SingleCompareReplace( XLink origin_xlink,
+                               const set<XLink> *resume_region = nullptr,
+                               list<set<XLink>> *further_regions = nullptr );
+    bool ResumingCompareReplace( XLink origin_xlink, size_t touch_position );
+    bool GatheredRegionsCompareReplace( XLink origin_xlink, list<set<XLink>> &pending_regions );
+    bool IsRequiredCategoryAbsent() const;                                                                                              
 
 public: // For top level engine/VN trans
     int RepeatingCompareReplace( XLink origin_xlink,
@@ -160,8 +170,8 @@ public: // Trace stuff for anyone
     virtual string GetGraphId() const;    
 
 private:    
-    static int repetitions;
-    static bool rep_error;
+    static thread_local int repetitions; // per thread for concurrent steps
+    static thread_local bool rep_error;
     
     vector<int> stop_after;
     vector<int>::size_type depth;    
@@ -0,0 +1,546 @@
+#include "bdd.hpp"
+
+#include "common/common.hpp"
+
+#include <algorithm>
+#include <random>
+
+using namespace SYM;
+
+// ------------------------- BDD --------------------------
+
+BDD::BDD()
+{
+    // Terminals are at the bottom of every path, so give them a var
+    // that comes after all the real ones
+    nodes.push_back( { TERMINAL_VAR, FALSE_NODE, FALSE_NODE } );
+    nodes.push_back( { TERMINAL_VAR, TRUE_NODE, TRUE_NODE } );
+}
+
+
+BDD::Node BDD::GetConstant( bool value ) const
+{
+    return value ? TRUE_NODE : FALSE_NODE;
+}
+
+
+BDD::Node BDD::GetVar( unsigned var )
+{
+    return MakeNode( var, FALSE_NODE, TRUE_NODE );
+}
+
+
+BDD::Node BDD::GetCube( const Cube &cube )
+{
+    // Build from the bottom up so that every node is reduced as we go
+    Node f = TRUE_NODE;
+    for( auto it = cube.rbegin(); it != cube.rend(); ++it )
+    {
+        ASSERT( it->first >= 0 );
+        f = it->second ? MakeNode( it->first, FALSE_NODE, f )
+                       : MakeNode( it->first, f, FALSE_NODE );
+    }
+    return f;
+}
+
+
+BDD::Node BDD::Not( Node f )
+{
+    return Ite( f, FALSE_NODE, TRUE_NODE );
+}
+
+
+BDD::Node BDD::And( Node f, Node g )
+{
+    return Ite( f, g, FALSE_NODE );
+}
+
+
+BDD::Node BDD::Or( Node f, Node g )
+{
+    return Ite( f, TRUE_NODE, g );
+}
+
+
+BDD::Node BDD::Ite( Node f, Node g, Node h )
+{
+    // Terminal cases
+    if( f == TRUE_NODE )
+        return g;
+    if( f == FALSE_NODE )
+        return h;
+    if( g == h )
+        return g;
+    if( g == TRUE_NODE && h == FALSE_NODE )
+        return f;
+
+    Triple key { f, g, h };
+    auto it = ite_cache.find( key );
+    if( it != ite_cache.end() )
+        return it->second;
+
+    // Shannon expansion on whichever variable comes first
+    unsigned var = min( { GetTopVar(f), GetTopVar(g), GetTopVar(h) } );
+    Node high = Ite( GetCofactor(f, var, true),
+                     GetCofactor(g, var, true),
+                     GetCofactor(h, var, true) );
+    Node low = Ite( GetCofactor(f, var, false),
+                    GetCofactor(g, var, false),
+                    GetCofactor(h, var, false) );
+    Node result = MakeNode( var, low, high );
+
+    ite_cache[key] = result;
+    return result;
+}
+
+
+BDD::Node BDD::Restrict( Node f, const Cube &cube )
+{
+    if( cube.empty() )
+        return f;
+    unsigned last_var = cube.rbegin()->first;
+
+    map<Node, Node> memo;
+    function<Node(Node)> restrict = [&](Node g) -> Node
+    {
+        unsigned var = GetTopVar(g);
+        if( var == TERMINAL_VAR || var > last_var )
+            return g;
+        auto mit = memo.find(g);
+        if( mit != memo.end() )
+            return mit->second;
+
+        NodeData nd = nodes[g]; // copy: nodes may be reallocated
+        Node result;
+        auto cit = cube.find(var);
+        if( cit != cube.end() )
+            result = restrict( cit->second ? nd.high : nd.low );
+        else
+            result = MakeNode( var, restrict(nd.low), restrict(nd.high) );
+        memo[g] = result;
+        return result;
+    };
+    return restrict(f);
+}
+
+
+BDD::Node BDD::Exists( Node f, const set<unsigned> &vars )
+{
+    if( vars.empty() )
+        return f;
+    unsigned last_var = *vars.rbegin();
+
+    map<Node, Node> memo;
+    function<Node(Node)> exists = [&](Node g) -> Node
+    {
+        unsigned var = GetTopVar(g);
+        if( var == TERMINAL_VAR || var > last_var )
+            return g;
+        auto mit = memo.find(g);
+        if( mit != memo.end() )
+            return mit->second;
+
+        NodeData nd = nodes[g];
+        Node low = exists(nd.low);
+        Node high = exists(nd.high);
+        Node result = vars.count(var) ? Or( low, high ) : MakeNode( var, low, high );
+        memo[g] = result;
+        return result;
+    };
+    return exists(f);
+}
+
+
+BDD::Node BDD::CloseUpVars( Node f, const set<unsigned> &removed_vars )
+{
+    if( removed_vars.empty() )
+        return f;
+
+    // Relative order of the remaining variables does not change, so
+    // nodes can be rebuilt directly.
+    map<Node, Node> memo;
+    function<Node(Node)> close_up = [&](Node g) -> Node
+    {
+        unsigned var = GetTopVar(g);
+        if( var == TERMINAL_VAR )
+            return g;
+        auto mit = memo.find(g);
+        if( mit != memo.end() )
+            return mit->second;
+
+        ASSERT( removed_vars.count(var)==0 )("Function depends on removed variable %u", var);
+        NodeData nd = nodes[g];
+        unsigned shift = distance( removed_vars.begin(), removed_vars.lower_bound(var) );
+        Node result = MakeNode( var - shift, close_up(nd.low), close_up(nd.high) );
+        memo[g] = result;
+        return result;
+    };
+    return close_up(f);
+}
+
+
+bool BDD::Evaluate( Node f, const vector<bool> &values ) const
+{
+    while( GetTopVar(f) != TERMINAL_VAR )
+    {
+        const NodeData &nd = nodes[f];
+        ASSERT( nd.var < values.size() );
+        f = values[nd.var] ? nd.high : nd.low;
+    }
+    return f == TRUE_NODE;
+}
+
+
+list<BDD::Cube> BDD::GetIrredundantCover( Node lower, Node upper )
+{
+    ASSERT( And( lower, Not(upper) ) == FALSE_NODE )("Lower bound must imply upper bound");
+    map<pair<Node, Node>, pair<Node, list<Cube>>> memo;
+    pair<Node, list<Cube>> result = GetIrredundantCover( lower, upper, memo );
+
+    // Check that the cover is within the bounds
+    ASSERT( And( lower, Not(result.first) ) == FALSE_NODE );
+    ASSERT( And( result.first, Not(upper) ) == FALSE_NODE );
+    return result.second;
+}
+
+
+size_t BDD::GetNumNodes() const
+{
+    return nodes.size();
+}
+
+
+size_t BDD::TripleHash::operator()( const Triple &t ) const
+{
+    size_t h = t.a;
+    h = h * 0x9E3779B97F4A7C15ULL + t.b;
+    h = h * 0x9E3779B97F4A7C15ULL + t.c;
+    return h ^ (h >> 29);
+}
+
+
+unsigned BDD::GetTopVar( Node f ) const
+{
+    return nodes[f].var;
+}
+
+
+BDD::Node BDD::GetCofactor( Node f, unsigned var, bool value ) const
+{
+    // Only valid when var is at or above f's top variable
+    const NodeData &nd = nodes[f];
+    ASSERT( nd.var >= var );
+    if( nd.var != var )
+        return f;
+    return value ? nd.high : nd.low;
+}
+
+
+BDD::Node BDD::MakeNode( unsigned var, Node low, Node high )
+{
+    ASSERT( var != TERMINAL_VAR );
+    ASSERT( var < GetTopVar(low) && var < GetTopVar(high) )("Variable order violated");
+    if( low == high )
+        return low; // Reduction: node would be redundant
+
+    Triple key { var, low, high };
+    auto it = unique_table.find( key );
+    if( it != unique_table.end() )
+        return it->second;
+
+    Node n = nodes.size();
+    nodes.push_back( { var, low, high } );
+    unique_table[key] = n;
+    return n;
+}
+
+
+pair<BDD::Node, list<BDD::Cube>> BDD::GetIrredundantCover( Node lower, Node upper,
+                                                           map<pair<Node, Node>, pair<Node, list<Cube>>> &memo )
+{
+    if( lower == FALSE_NODE )
+        return make_pair( FALSE_NODE, list<Cube>() );
+    if( upper == TRUE_NODE )
+        return make_pair( TRUE_NODE, list<Cube>{ Cube() } );
+
+    auto mit = memo.find( make_pair(lower, upper) );
+    if( mit != memo.end() )
+        return mit->second;
+
+    unsigned var = min( GetTopVar(lower), GetTopVar(upper) );
+    Node l0 = GetCofactor(lower, var, false), l1 = GetCofactor(lower, var, true);
+    Node u0 = GetCofactor(upper, var, false), u1 = GetCofactor(upper, var, true);
+
+    // Cubes that need var to be false, then ones that need it true
+    pair<Node, list<Cube>> r0 = GetIrredundantCover( And(l0, Not(u1)), u0, memo );
+    pair<Node, list<Cube>> r1 = GetIrredundantCover( And(l1, Not(u0)), u1, memo );
+
+    // Cubes that don't care about var, for whatever is left
+    Node ld = Or( And(l0, Not(r0.first)), And(l1, Not(r1.first)) );
+    pair<Node, list<Cube>> rd = GetIrredundantCover( ld, And(u0, u1), memo );
+
+    pair<Node, list<Cube>> result;
+    result.first = Or( MakeNode( var, r0.first, r1.first ), rd.first );
+    for( Cube c : r0.second )
+    {
+        c[var] = false;
+        result.second.push_back( c );
+    }
+    for( Cube c : r1.second )
+    {
+        c[var] = true;
+        result.second.push_back( c );
+    }
+    result.second.splice( result.second.end(), rd.second );
+
+    memo[make_pair(lower, upper)] = result;
+    return result;
+}
+
+// ------------------------- BDDTruthTable --------------------------
+
+BDDTruthTable::BDDTruthTable( shared_ptr<BDD> bdd_, unsigned degree_, CellType initval ) :
+    bdd( bdd_ ),
+    degree( degree_ ),
+    care( bdd->GetConstant( initval != CellType::DONT_CARE ) ),
+    truth( bdd->GetConstant( initval == CellType::TRUE ) )
+{
+}
+
+
+void BDDTruthTable::SetSlice( SliceSpec slice, CellType new_value )
+{
+    for( auto p : slice )
+        ASSERT( p.first >= 0 && (unsigned)p.first < degree );
+    BDD::Node cube = bdd->GetCube( slice );
+    if( new_value == CellType::DONT_CARE )
+        care = bdd->And( care, bdd->Not(cube) );
+    else
+        care = bdd->Or( care, cube );
+    if( new_value == CellType::TRUE )
+        truth = bdd->Or( truth, cube );
+    else
+        truth = bdd->And( truth, bdd->Not(cube) );
+}
+
+
+void BDDTruthTable::Constrain( BDD::Node constraint )
+{
+    // DONT_CARE cells are already false in truth, so they stay DONT_CARE
+    truth = bdd->And( truth, constraint );
+}
+
+
+void BDDTruthTable::Extend( unsigned new_degree )
+{
+    // The new axes don't appear in either BDD, so cells are replicated
+    ASSERT( new_degree >= degree );
+    degree = new_degree;
+}
+
+
+unsigned BDDTruthTable::GetDegree() const
+{
+    return degree;
+}
+
+
+BDDTruthTable::CellType BDDTruthTable::Get( vector<bool> full_indices ) const
+{
+    ASSERT( full_indices.size() == degree );
+    if( !bdd->Evaluate( care, full_indices ) )
+        return CellType::DONT_CARE;
+    return bdd->Evaluate( truth, full_indices ) ? CellType::TRUE : CellType::FALSE;
+}
+
+
+BDDTruthTable BDDTruthTable::GetSlice( SliceSpec slice ) const
+{
+    ASSERT( slice.size() <= degree );
+    set<unsigned> removed_axes;
+    for( auto p : slice )
+    {
+        ASSERT( p.first >= 0 && (unsigned)p.first < degree );
+        removed_axes.insert( p.first );
+    }
+
+    BDDTruthTable dest( bdd, degree - slice.size(), CellType::DONT_CARE );
+    dest.care = bdd->CloseUpVars( bdd->Restrict( care, slice ), removed_axes );
+    dest.truth = bdd->CloseUpVars( bdd->Restrict( truth, slice ), removed_axes );
+    return dest;
+}
+
+
+BDDTruthTable BDDTruthTable::GetFolded( set<int> fold_axes ) const
+{
+    ASSERT( fold_axes.size() <= degree );
+    set<unsigned> removed_axes;
+    for( int axis : fold_axes )
+    {
+        ASSERT( axis >= 0 && (unsigned)axis < degree );
+        removed_axes.insert( axis );
+    }
+
+    // Higher values take priority: TRUE if any are TRUE, and DONT_CARE
+    // only if all are DONT_CARE.
+    BDDTruthTable dest( bdd, degree - fold_axes.size(), CellType::DONT_CARE );
+    dest.care = bdd->CloseUpVars( bdd->Exists( care, removed_axes ), removed_axes );
+    dest.truth = bdd->CloseUpVars( bdd->Exists( truth, removed_axes ), removed_axes );
+    return dest;
+}
+
+
+list<BDDTruthTable::SliceSpec> BDDTruthTable::GetCover( CellType target_value, bool allow_dont_care ) const
+{
+    BDD::Node lower, upper;
+    switch( target_value )
+    {
+    case CellType::TRUE:
+        lower = truth;
+        upper = allow_dont_care ? bdd->Or( truth, bdd->Not(care) ) : truth;
+        break;
+    case CellType::FALSE:
+        lower = bdd->And( care, bdd->Not(truth) );
+        upper = allow_dont_care ? bdd->Not(truth) : lower;
+        break;
+    default:
+        ASSERTFAIL("Cover of DONT_CARE cells not supported");
+    }
+    return bdd->GetIrredundantCover( lower, upper );
+}
+
+
+shared_ptr<BDD> BDDTruthTable::GetBDD() const
+{
+    return bdd;
+}
+
+
+string BDDTruthTable::Render( vector<string> pred_labels ) const
+{
+    ASSERT( pred_labels.size() == degree );
+    auto render_cover = [&](BDD::Node f) -> string
+    {
+        list<string> terms;
+        for( const SliceSpec &slice : bdd->GetIrredundantCover( f, f ) )
+        {
+            list<string> clauses;
+            for( auto p : slice )
+                clauses.push_back( (p.second ? "" : "¬") + pred_labels.at(p.first) );
+            terms.push_back( clauses.empty() ? "always" : Join(clauses, " ∧ ") );
+        }
+        return terms.empty() ? "never" : Join(terms, " ∨ ");
+    };
+
+    string s;
+    s += "TRUE: " + render_cover( truth ) + "\n";
+    s += "FALSE: " + render_cover( bdd->And( care, bdd->Not(truth) ) ) + "\n";
+    s += "DONT_CARE: " + render_cover( bdd->Not(care) ) + "\n";
+    s += SSPrintf("(degree %u, %zu BDD nodes)\n", degree, bdd->GetNumNodes());
+    return s;
+}
+
+// ------------------------- unit tests --------------------------
+
+static vector<bool> GetIndices( unsigned degree, unsigned cindex )
+{
+    vector<bool> indices(degree);
+    for( unsigned axis=0; axis<degree; axis++ )
+        indices[axis] = (cindex >> axis) & 1;
+    return indices;
+}
+
+
+static void CheckSame( const BDDTruthTable &bt, const TruthTable &t )
+{
+    ASSERT( bt.GetDegree() == t.GetDegree() );
+    for( unsigned cindex=0; cindex < (1U << t.GetDegree()); cindex++ )
+    {
+        vector<bool> indices = GetIndices( t.GetDegree(), cindex );
+        ASSERT( bt.Get(indices) == t.Get(indices) )
+              ("Mismatch at cell %u of degree %u table\n", cindex, t.GetDegree());
+    }
+}
+
+
+static void CheckCover( const list<TruthTable::SliceSpec> &cover, const TruthTable &t, 
+                        TruthTable::CellType target_value, bool allow_dont_care )
+{
+    for( unsigned cindex=0; cindex < (1U << t.GetDegree()); cindex++ )
+    {
+        vector<bool> indices = GetIndices( t.GetDegree(), cindex );
+        bool covered = false;
+        for( const TruthTable::SliceSpec &slice : cover )
+            covered = covered || all_of( slice.begin(), slice.end(), [&](pair<int, bool> p){ return indices[p.first]==p.second; } );
+        TruthTable::CellType value = t.Get(indices);
+        if( value == target_value )
+            ASSERT( covered )("Cell %u not covered\n", cindex);
+        else if( value != TruthTable::CellType::DONT_CARE || !allow_dont_care )
+            ASSERT( !covered )("Cell %u wrongly covered\n", cindex);
+    }
+}
+
+
+static TruthTable::SliceSpec RandomSlice( mt19937 &random, unsigned degree )
+{
+    TruthTable::SliceSpec slice;
+    for( unsigned axis=0; axis<degree; axis++ )
+        if( unsigned r = random() % 3 )
+            slice[axis] = (r == 2);
+    return slice;
+}
+
+
+void SYM::TestBDD()
+{
+    // Build the same random tables both ways and check that every
+    // operation gives the same cells.
+    mt19937 random(10);
+    for( unsigned degree=0; degree<=12; degree++ )
+    {
+        for( int iteration=0; iteration<20; iteration++ )
+        {
+            auto bdd = make_shared<BDD>();
+            TruthTable t( degree, TruthTable::CellType::TRUE );
+            BDDTruthTable bt( bdd, degree, TruthTable::CellType::TRUE );
+            for( int i=0; i<8; i++ )
+            {
+                TruthTable::SliceSpec slice = RandomSlice( random, degree );
+                auto value = (TruthTable::CellType)((int)(random() % 3) - 1);
+                t.SetSlice( slice, value );
+                bt.SetSlice( slice, value );
+            }
+            CheckSame( bt, t );
+
+            TruthTable::SliceSpec slice = RandomSlice( random, degree );
+            CheckSame( bt.GetSlice(slice), t.GetSlice(slice) );
+
+            set<int> fold_axes;
+            for( unsigned axis=0; axis<degree; axis++ )
+                if( random() % 2 )
+                    fold_axes.insert( axis );
+            CheckSame( bt.GetFolded(fold_axes), t.GetFolded(fold_axes) );
+
+            for( auto target_value : {TruthTable::CellType::TRUE, TruthTable::CellType::FALSE} )
+                for( bool allow_dont_care : {false, true} )
+                    CheckCover( bt.GetCover(target_value, allow_dont_care), t, target_value, allow_dont_care );
+
+            // Constrain() with the complement of a slice
+            slice = RandomSlice( random, degree );
+            bt.Constrain( bdd->Not( bdd->GetCube(slice) ) );
+            TruthTable in_slice = t.GetSlice( slice );
+            in_slice.SetSlice( {}, TruthTable::CellType::FALSE );
+            for( auto indices : t.GetSlice(slice).GetIndicesOfValue(TruthTable::CellType::DONT_CARE) )
+                in_slice.Set( indices, TruthTable::CellType::DONT_CARE );
+            t.SetSlice( slice, in_slice );
+            CheckSame( bt, t );
+
+            if( degree < 12 )
+            {
+                t.Extend( degree+1 );
+                bt.Extend( degree+1 );
+                CheckSame( bt, t );
+            }
+        }
+    }
+}
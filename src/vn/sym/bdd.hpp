@@ -0,0 +1,149 @@
+#ifndef BDD_HPP
+#define BDD_HPP
+
+#include "common/common.hpp"
+#include "truth_table.hpp"
+
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+using namespace std;
+
+namespace SYM
+{
+
+// ------------------------- BDD --------------------------
+
+// Reduced ordered binary decision diagrams. All the diagrams made by one
+// BDD object share its nodes, and a node is identified by its index, so
+// equal functions have equal Nodes. Variable i is tested before variable
+// j if i<j. Nodes are never freed: the intention is to use one BDD for
+// one solve, then throw it away.
+class BDD
+{
+public:
+    typedef unsigned Node;
+
+    // Gives a value to some of the variables; same as TruthTable::SliceSpec
+    typedef map<int, bool> Cube;
+
+    static constexpr Node FALSE_NODE = 0;
+    static constexpr Node TRUE_NODE = 1;
+
+    BDD();
+
+    Node GetConstant( bool value ) const;
+    Node GetVar( unsigned var );
+
+    // The conjunction of the variables in the cube, inverted where false
+    Node GetCube( const Cube &cube );
+
+    Node Not( Node f );
+    Node And( Node f, Node g );
+    Node Or( Node f, Node g );
+
+    // If f then g else h. The other operators are all done using this.
+    Node Ite( Node f, Node g, Node h );
+
+    // Fix the values of some variables
+    Node Restrict( Node f, const Cube &cube );
+
+    // Existentially quantify away the given variables
+    Node Exists( Node f, const set<unsigned> &vars );
+
+    // Renumber variables so as to close up the gaps left by removed_vars.
+    // f must not depend on any of the removed_vars.
+    Node CloseUpVars( Node f, const set<unsigned> &removed_vars );
+
+    bool Evaluate( Node f, const vector<bool> &values ) const;
+
+    // Get a list of cubes whose disjunction is true wherever lower is
+    // true and false wherever upper is false, using Minato-Morreale.
+    // No cube in the list is contained in another.
+    list<Cube> GetIrredundantCover( Node lower, Node upper );
+
+    size_t GetNumNodes() const;
+
+private:
+    struct NodeData
+    {
+        unsigned var;
+        Node low;
+        Node high;
+    };
+
+    struct Triple
+    {
+        Node a, b, c;
+        bool operator==( const Triple &other ) const = default;
+    };
+
+    struct TripleHash
+    {
+        size_t operator()( const Triple &t ) const;
+    };
+
+    unsigned GetTopVar( Node f ) const;
+    Node GetCofactor( Node f, unsigned var, bool value ) const;
+    Node MakeNode( unsigned var, Node low, Node high );
+    pair<Node, list<Cube>> GetIrredundantCover( Node lower, Node upper,
+                                                map<pair<Node, Node>, pair<Node, list<Cube>>> &memo );
+
+    static constexpr unsigned TERMINAL_VAR = ~0U;
+
+    vector<NodeData> nodes;
+    unordered_map<Triple, Node, TripleHash> unique_table; // var, low, high
+    unordered_map<Triple, Node, TripleHash> ite_cache; // f, g, h
+};
+
+// ------------------------- BDDTruthTable --------------------------
+
+// Same idea as TruthTable, with the same meaning for axes, cells and
+// operations, but held as a pair of BDDs so that size is not exponential
+// in degree. Axis i is variable i of the BDD. Copies share the BDD.
+class BDDTruthTable
+{
+public:
+    typedef TruthTable::CellType CellType;
+    typedef TruthTable::SliceSpec SliceSpec;
+
+    explicit BDDTruthTable( shared_ptr<BDD> bdd, unsigned degree, CellType initval );
+
+    void SetSlice( SliceSpec slice, CellType new_value );
+
+    // Set to FALSE all the cells for which constraint is false, other
+    // than DONT_CARE ones.
+    void Constrain( BDD::Node constraint );
+
+    void Extend( unsigned new_degree );
+    unsigned GetDegree() const;
+    CellType Get( vector<bool> full_indices ) const;
+    BDDTruthTable GetSlice( SliceSpec slice ) const;
+    BDDTruthTable GetFolded( set<int> fold_axes ) const;
+
+    // Get slices that cover all the cells of target_value, and no cells of
+    // other values, apart from DONT_CARE ones if allowed. This takes the
+    // place of repeated TruthTable::TryFindBestKarnaughSlice().
+    list<SliceSpec> GetCover( CellType target_value, bool allow_dont_care ) const;
+
+    shared_ptr<BDD> GetBDD() const;
+
+    // Lists the slices that cover each value, since we can't draw a map
+    string Render( vector<string> pred_labels ) const;
+
+private:
+    shared_ptr<BDD> bdd;
+    unsigned degree;
+    BDD::Node care; // True for cells that are not DONT_CARE
+    BDD::Node truth; // True for cells that are TRUE
+};
+
+// ------------------------- unit tests --------------------------
+
+void TestBDD();
+
+};
+
+#endif
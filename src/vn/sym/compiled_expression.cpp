@@ -0,0 +1,228 @@
+#include "compiled_expression.hpp"
+
+#include "boolean_operators.hpp"
+#include "predicate_operators.hpp"
+#include "symbol_operators.hpp"
+#include "result.hpp"
+#include "../dense_solution.hpp"
+
+using namespace SYM;
+
+// ------------------------- CompiledExpression --------------------------
+
+CompiledExpression::CompiledExpression( shared_ptr<BooleanExpression> expression_,
+                                        shared_ptr<const VN::PatternLinkIndices> plink_indices_ ) :
+    expression( expression_ ),
+    plink_indices( plink_indices_ )
+{
+    if( auto and_op = dynamic_pointer_cast<AndOperator>(expression) )
+    {
+        for( shared_ptr<BooleanExpression> op : and_op->GetBooleanOperands() )
+        {
+            CompileBoolean( op );
+            conjunct_ends.push_back( program.size() );
+            boolean_depth = 0; // Each conjunct starts with empty stacks
+        }
+    }
+    else
+    {
+        CompileBoolean( expression );
+        conjunct_ends.push_back( program.size() );
+    }
+    TRACE("Compiled to %d instructions, %d not compiled\n", program.size(), num_others);
+}
+
+
+bool CompiledExpression::Evaluate( const Expression::EvalKit &kit ) const
+{
+    ASSERT( kit.hypothesis_links->GetIndices() == plink_indices );
+    size_t begin = 0;
+    for( size_t end : conjunct_ends )
+    {
+        if( !Run( kit, begin, end ) )
+            return false;
+        begin = end;
+    }
+    return true;
+}
+
+
+string CompiledExpression::GetTrace() const
+{
+    return "CompiledExpression(" + expression->Render() + ")";
+}
+
+
+void CompiledExpression::CompileBoolean( shared_ptr<BooleanExpression> expr )
+{
+    Instruction instruction;
+    if( auto pred = dynamic_pointer_cast<PredicateOperator>(expr) )
+    {
+        list<shared_ptr<SymbolExpression>> ops = pred->GetSymbolOperands();
+        for( shared_ptr<SymbolExpression> op : ops )
+            CompileSymbol( op );
+        instruction.opcode = OpCode::PREDICATE;
+        instruction.num_operands = ops.size();
+        instruction.predicate = pred.get();
+        Emit( instruction, 1, -(int)ops.size() );
+    }
+    else if( auto bc = dynamic_pointer_cast<BooleanConstant>(expr) )
+    {
+        instruction.opcode = OpCode::BOOLEAN_CONSTANT;
+        instruction.boolean_value = bc->GetAsBool();
+        Emit( instruction, 1, 0 );
+    }
+    else if( dynamic_pointer_cast<NotOperator>(expr) ||
+             dynamic_pointer_cast<AndOperator>(expr) ||
+             dynamic_pointer_cast<OrOperator>(expr) )
+    {
+        auto connective = dynamic_pointer_cast<BooleanToBooleanExpression>(expr);
+        list<shared_ptr<BooleanExpression>> ops = connective->GetBooleanOperands();
+        for( shared_ptr<BooleanExpression> op : ops )
+            CompileBoolean( op );
+        if( dynamic_pointer_cast<NotOperator>(expr) )
+            instruction.opcode = OpCode::NOT;
+        else if( dynamic_pointer_cast<AndOperator>(expr) )
+            instruction.opcode = OpCode::AND;
+        else
+            instruction.opcode = OpCode::OR;
+        instruction.num_operands = ops.size();
+        Emit( instruction, 1-(int)ops.size(), 0 );
+    }
+    else
+    {
+        instruction.opcode = OpCode::BOOLEAN_OTHER;
+        instruction.boolean_other = expr.get();
+        num_others++;
+        Emit( instruction, 1, 0 );
+    }
+}
+
+
+void CompiledExpression::CompileSymbol( shared_ptr<SymbolExpression> expr )
+{
+    Instruction instruction;
+    if( auto var = dynamic_pointer_cast<SymbolVariable>(expr) )
+    {
+        instruction.opcode = OpCode::SYMBOL_VARIABLE;
+        instruction.variable_index = plink_indices->GetIndex( var->GetPatternLink() );
+        Emit( instruction, 0, 1 );
+    }
+    else if( auto sc = dynamic_pointer_cast<SymbolConstant>(expr) )
+    {
+        instruction.opcode = OpCode::SYMBOL_CONSTANT;
+        instruction.symbol_value = sc->GetOnlyXLink();
+        Emit( instruction, 0, 1 );
+    }
+    else if( auto op = dynamic_pointer_cast<SymbolToSymbolExpression>(expr);
+             op && op->IsEvaluateUniqueSupported() )
+    {
+        list<shared_ptr<SymbolExpression>> ops = op->GetSymbolOperands();
+        for( shared_ptr<SymbolExpression> sub_op : ops )
+            CompileSymbol( sub_op );
+        instruction.opcode = OpCode::SYMBOL_OPERATOR;
+        instruction.num_operands = ops.size();
+        instruction.symbol_operator = op.get();
+        Emit( instruction, 0, 1-(int)ops.size() );
+    }
+    else
+    {
+        instruction.opcode = OpCode::SYMBOL_OTHER;
+        instruction.symbol_other = expr.get();
+        num_others++;
+        Emit( instruction, 0, 1 );
+    }
+}
+
+
+void CompiledExpression::Emit( const Instruction &instruction, int boolean_pushes, int symbol_pushes )
+{
+    program.push_back( instruction );
+
+    // Track depths so the stacks never need to grow during evaluation
+    boolean_depth += boolean_pushes;
+    symbol_depth += symbol_pushes;
+    ASSERT( boolean_depth >= 0 && symbol_depth >= 0 );
+    if( (size_t)boolean_depth > boolean_stack.size() )
+        boolean_stack.resize( boolean_depth );
+    if( (size_t)symbol_depth > symbol_stack.size() )
+        symbol_stack.resize( symbol_depth );
+}
+
+
+bool CompiledExpression::Run( const Expression::EvalKit &kit, size_t begin, size_t end ) const
+{
+    size_t bsp = 0, ssp = 0; // Stack pointers: index of next free element
+    for( size_t pc = begin; pc < end; pc++ )
+    {
+        const Instruction &ins = program[pc];
+        switch( ins.opcode )
+        {
+        case OpCode::BOOLEAN_CONSTANT:
+            boolean_stack[bsp++] = ins.boolean_value;
+            break;
+
+        case OpCode::NOT:
+            boolean_stack[bsp-1] = !boolean_stack[bsp-1];
+            break;
+
+        case OpCode::AND:
+        {
+            bool result = true; // identity element
+            for( unsigned i=0; i<ins.num_operands; i++ )
+                result = result && boolean_stack[--bsp];
+            boolean_stack[bsp++] = result;
+            break;
+        }
+
+        case OpCode::OR:
+        {
+            bool result = false; // identity element
+            for( unsigned i=0; i<ins.num_operands; i++ )
+                result = result || boolean_stack[--bsp];
+            boolean_stack[bsp++] = result;
+            break;
+        }
+
+        case OpCode::PREDICATE:
+        {
+            ssp -= ins.num_operands;
+            boolean_stack[bsp++] = ins.predicate->EvaluateFromValues( kit, symbol_stack.data() + ssp );
+            break;
+        }
+
+        case OpCode::BOOLEAN_OTHER:
+            boolean_stack[bsp++] = ins.boolean_other->Evaluate( kit )->IsDefinedAndTrue();
+            break;
+
+        case OpCode::SYMBOL_VARIABLE:
+        {
+            // As for SymbolVariable::Evaluate(), we must have a value
+            ASSERT( kit.hypothesis_links->IsAssigned( ins.variable_index ) );
+            symbol_stack[ssp++] = kit.hypothesis_links->Get( ins.variable_index );
+            break;
+        }
+
+        case OpCode::SYMBOL_CONSTANT:
+            symbol_stack[ssp++] = ins.symbol_value;
+            break;
+
+        case OpCode::SYMBOL_OPERATOR:
+        {
+            ssp -= ins.num_operands;
+            symbol_stack[ssp] = ins.symbol_operator->EvaluateUnique( kit, symbol_stack.data() + ssp );
+            ssp++;
+            break;
+        }
+
+        case OpCode::SYMBOL_OTHER:
+        {
+            unique_ptr<SymbolicResult> result = ins.symbol_other->Evaluate( kit );
+            symbol_stack[ssp++] = result->IsDefinedAndUnique() ? result->GetOnlyXLink() : XValue();
+            break;
+        }
+        }
+    }
+    ASSERT( bsp == 1 && ssp == 0 );
+    return boolean_stack[0];
+}
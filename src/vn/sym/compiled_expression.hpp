@@ -0,0 +1,93 @@
+#ifndef COMPILED_EXPRESSION_HPP
+#define COMPILED_EXPRESSION_HPP
+
+#include "expression.hpp"
+#include "common/common.hpp"
+
+#include <vector>
+
+namespace VN
+{
+    class PatternLinkIndices;
+}
+
+namespace SYM
+{
+
+class PredicateOperator;
+
+// ------------------------- CompiledExpression --------------------------
+
+// A boolean expression lowered into a flat postfix program, so that it can
+// be evaluated over stacks of plain values, without the heap-allocated
+// results and list of operand results that Evaluate() uses at every node.
+// Predicates, boolean connectives, variables, constants and operators that
+// support EvaluateUnique() are compiled; any other sub-expression is still
+// evaluated using Evaluate(). Compile after planning is done: forces on
+// predicates are not applied. Evaluation is not re-entrant. Variables are
+// looked up by their index in plink_indices, which must be the indices of
+// the hypothesis links in the EvalKit.
+class CompiledExpression : public Traceable
+{
+public:
+    explicit CompiledExpression( shared_ptr<BooleanExpression> expression,
+                                 shared_ptr<const VN::PatternLinkIndices> plink_indices );
+
+    // Same as expression->Evaluate(kit)->IsDefinedAndTrue()
+    bool Evaluate( const Expression::EvalKit &kit ) const;
+
+    string GetTrace() const;
+
+private:
+    enum class OpCode
+    {
+        BOOLEAN_CONSTANT,
+        NOT,
+        AND,
+        OR,
+        PREDICATE,
+        BOOLEAN_OTHER, // Evaluate() the expression
+        SYMBOL_VARIABLE,
+        SYMBOL_CONSTANT,
+        SYMBOL_OPERATOR,
+        SYMBOL_OTHER // Evaluate() the expression
+    };
+
+    struct Instruction
+    {
+        OpCode opcode;
+        unsigned num_operands = 0;
+        bool boolean_value = false;
+        XValue symbol_value;
+        int variable_index = -1;
+        const PredicateOperator *predicate = nullptr;
+        const SymbolToSymbolExpression *symbol_operator = nullptr;
+        const BooleanExpression *boolean_other = nullptr;
+        const SymbolExpression *symbol_other = nullptr;
+    };
+
+    void CompileBoolean( shared_ptr<BooleanExpression> expr );
+    void CompileSymbol( shared_ptr<SymbolExpression> expr );
+    void Emit( const Instruction &instruction, int boolean_pushes, int symbol_pushes );
+    bool Run( const Expression::EvalKit &kit, size_t begin, size_t end ) const;
+
+    // Keeps alive everything the program points to
+    const shared_ptr<BooleanExpression> expression;
+    const shared_ptr<const VN::PatternLinkIndices> plink_indices;
+    vector<Instruction> program;
+
+    // A top-level AND is run one operand at a time so that we can stop at
+    // the first false one. These are the ends of the operands' programs.
+    vector<size_t> conjunct_ends;
+
+    int boolean_depth = 0, symbol_depth = 0;
+    int num_others = 0;
+
+    // Sized when compiling, so that evaluation does not allocate
+    mutable vector<bool> boolean_stack;
+    mutable vector<XValue> symbol_stack;
+};
+
+};
+
+#endif
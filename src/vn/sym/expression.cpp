@@ -216,6 +216,18 @@ unique_ptr<SymbolicResult> SymbolToSymbolExpression::Evaluate( const EvalKit &,
     ASSERTFAIL("Need to override one of the Evaluate() methods\n");
 }
 
+
+bool SymbolToSymbolExpression::IsEvaluateUniqueSupported() const
+{
+    return false;
+}
+
+
+XValue SymbolToSymbolExpression::EvaluateUnique( const EvalKit &, const XValue * ) const
+{
+    ASSERTFAIL("EvaluateUnique() not supported; check IsEvaluateUniqueSupported()\n");
+}
+
 // ------------------------- SymbolToBooleanExpression --------------------------
 
 list<shared_ptr<Expression>> SymbolToBooleanExpression::GetOperands() const
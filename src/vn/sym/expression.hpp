@@ -11,6 +11,7 @@ namespace VN
 {
     class XTreeDatabase;
     class Lacing;
+    class DenseSolution;
 }
 
 namespace SYM
@@ -40,7 +41,7 @@ public:
      */
     struct EvalKit
     {
-        const VN::SolutionMap *hypothesis_links;
+        const VN::DenseSolution *hypothesis_links;
         const VN::XTreeDatabase *x_tree_db;
     };
     
@@ -170,6 +171,13 @@ public:
     virtual unique_ptr<SymbolicResult> Evaluate( const EvalKit &kit ) const override;
     virtual unique_ptr<SymbolicResult> Evaluate( const EvalKit &kit, 
                                                list<unique_ptr<SymbolicResult>> &&op_results ) const;
+
+    // Allocation-free evaluation for operators whose result is always a single 
+    // value or empty, used by CompiledExpression. Operand values are NULL where 
+    // the operand's result was not defined and unique, and a NULL return means
+    // the same.
+    virtual bool IsEvaluateUniqueSupported() const;
+    virtual XValue EvaluateUnique( const EvalKit &kit, const XValue *op_values ) const;
 };
 
 };
@@ -4,6 +4,7 @@
 #include "set_operators.hpp"
 #include "result.hpp"
 #include "../db/lacing.hpp"
+#include "../db/x_tree_database.hpp"
 #include "common/lambda_loops.hpp"
 
 using namespace SYM;
@@ -44,6 +45,16 @@ unique_ptr<BooleanResult> PredicateOperator::Evaluate( const EvalKit &kit ) cons
 }
 
 
+unique_ptr<BooleanResult> PredicateOperator::Evaluate( const EvalKit &kit,
+                                                       list<unique_ptr<SymbolicResult>> &&op_results ) const
+{
+    vector<XValue> op_values;
+    for( const unique_ptr<SymbolicResult> &ra : op_results )
+        op_values.push_back( ra->IsDefinedAndUnique() ? ra->GetOnlyXLink() : XValue() );
+    return make_unique<BooleanResult>( EvaluateFromValues( kit, op_values.data() ) );
+}
+
+
 shared_ptr<PredicateOperator> PredicateOperator::TrySubstitute( shared_ptr<SymbolExpression> over,
                                                                 shared_ptr<SymbolExpression> with ) const
 {
@@ -123,26 +134,19 @@ list<shared_ptr<SymbolExpression>*> IsEqualOperator::GetSymbolOperandPointers()
 }
 
 
-unique_ptr<BooleanResult> IsEqualOperator::Evaluate( const EvalKit &kit,
-                                                     list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool IsEqualOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const 
 {
 	(void)kit;
-    ASSERT( op_results.size()==2 );
     // IEEE 754 Equals results in false if an operand is NaS. Not-equals has 
     // no operator class of it's own and is implemented as ¬(==) so will 
     // return true as required.
-    for( const unique_ptr<SymbolicResult> &ra : op_results )
-        if( !ra->IsDefinedAndUnique() )
-            return make_unique<BooleanResult>( false );
-
-    unique_ptr<SymbolicResult> ra = move( op_results.front() );
-    unique_ptr<SymbolicResult> rb = move( op_results.back() );
+    if( !op_values[0] || !op_values[1] )
+        return false;
 
     // For equality, it is sufficient to compare the x links
     // themselves, which have the required uniqueness properties
     // within the full arrowhead model (cf DepthFirstComparisonOperator) .
-    bool res = ( ra->GetOnlyXLink() == rb->GetOnlyXLink() );
-    return make_unique<BooleanResult>( res );   
+    return op_values[0] == op_values[1];
 }
 
 
@@ -235,25 +239,17 @@ list<shared_ptr<SymbolExpression> *> DepthFirstComparisonOperator::GetSymbolOper
 }
 
 
-unique_ptr<BooleanResult> DepthFirstComparisonOperator::Evaluate( const EvalKit &kit,
-                                                             list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool DepthFirstComparisonOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const 
 {    
-    ASSERT( op_results.size()==2 );
     // IEEE 754 All inequalities result in false if an operand is NaS
-    for( const unique_ptr<SymbolicResult> &ra : op_results )
-        if( !ra->IsDefinedAndUnique() )
-            return make_unique<BooleanResult>( false );
-
-    unique_ptr<SymbolicResult> ra = move( op_results.front() );
-    unique_ptr<SymbolicResult> rb = move( op_results.back() );
+    if( !op_values[0] || !op_values[1] )
+        return false;
 
     // For greater/less, we need to consult the x_tree_db. We use the 
     // depth-first relation.
     VN::DepthFirstRelation dfr( kit.x_tree_db ); 
-    Orderable::Diff diff = dfr.Compare3Way(ra->GetOnlyXLink(), rb->GetOnlyXLink() );
-    bool res = EvalBoolFromDiff( diff );
-    
-    return make_unique<BooleanResult>( res );  
+    Orderable::Diff diff = dfr.Compare3Way( op_values[0], op_values[1] );
+    return EvalBoolFromDiff( diff );
 }
 
 
@@ -524,29 +520,23 @@ list<shared_ptr<SymbolExpression> *> IsAllDiffOperator::GetSymbolOperandPointers
 }
 
 
-unique_ptr<BooleanResult> IsAllDiffOperator::Evaluate( const EvalKit &kit,
-                                                       list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool IsAllDiffOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const 
 {
     (void)kit;
-    for( const unique_ptr<SymbolicResult> &ra : op_results )
-        if( !ra->IsDefinedAndUnique() )
-            return make_unique<BooleanResult>( false );
+    size_t n = sa.size();
+    for( size_t i=0; i<n; i++ )
+        if( !op_values[i] )
+            return false;
     
     // Note: could be done faster using a set<XLink>
-    bool m = true;
-    ForAllUnorderedPairs( op_results, [&](const unique_ptr<SymbolicResult> &ra,
-                                                    const unique_ptr<SymbolicResult> &rb) 
-    {    
-        // For equality, it is sufficient to compare the x links
-        // themselves, which have the required uniqueness properties
-        // within the full arrowhead model (cf DepthFirstComparisonOperator).
-        if( ra->GetOnlyXLink() == rb->GetOnlyXLink() )
-        {
-            m = false;
-            LLBreak();
-        }
-    } );
-    return make_unique<BooleanResult>( m );   
+    for( size_t i=0; i<n; i++ )
+        for( size_t j=i+1; j<n; j++ )
+            // For equality, it is sufficient to compare the x links
+            // themselves, which have the required uniqueness properties
+            // within the full arrowhead model (cf DepthFirstComparisonOperator).
+            if( op_values[i] == op_values[j] )
+                return false;
+    return true;   
 }
 
 
@@ -622,19 +612,15 @@ list<shared_ptr<SymbolExpression> *> IsInCategoryOperator::GetSymbolOperandPoint
 }
 
 
-unique_ptr<BooleanResult> IsInCategoryOperator::Evaluate( const EvalKit &kit,
-                                                          list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool IsInCategoryOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const 
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
     // IEEE 754 Kind-of can be said to be C(a) ∈ C(arch) where C propogates 
     // NaS. Possibly like a < ?
-    unique_ptr<SymbolicResult> ra = SoloElementOf(move(op_results));
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<BooleanResult>( false );
+    if( !op_values[0] )
+        return false;
     
-    bool matches = archetype_node->IsSubcategory( *(ra->GetOnlyXLink().GetChildTreePtr()) );
-    return make_unique<BooleanResult>( matches );
+    return archetype_node->IsSubcategory( *(op_values[0].GetChildTreePtr()) );
 }
 
 
@@ -732,37 +718,30 @@ list<shared_ptr<SymbolExpression> *> IsChildCollectionSizedOperator::GetSymbolOp
 }
 
 
-unique_ptr<BooleanResult> IsChildCollectionSizedOperator::Evaluate( const EvalKit &kit,
-                                                                    list<unique_ptr<SymbolicResult>> &&op_results ) const
+bool IsChildCollectionSizedOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
-
-    // Evaluate operand and ensure we got an XLink
-    unique_ptr<SymbolicResult> ra = SoloElementOf(move(op_results));
-
     // IEEE 754 Kind-of can be said to be S(a) == S0 where S propogates 
     // NaS. So like ==
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<BooleanResult>( false );
+    if( !op_values[0] )
+        return false;
 
     // XLink must match our referee (i.e. be non-strict subtype)
     // If not, we will say that the size was wrong
-    if( !archetype_node->IsSubcategory( *(ra->GetOnlyXLink().GetChildTreePtr()) ) )
-        return make_unique<BooleanResult>( false ); 
+    if( !archetype_node->IsSubcategory( *(op_values[0].GetChildTreePtr()) ) )
+        return false; 
     
     // Itemise the child node of the XLink we got, according to the "schema"
     // of the referee node (note: link number is only valid wrt referee)
-    vector< Itemiser::Element * > keyer_items = archetype_node->Itemise( ra->GetOnlyXLink().GetChildTreePtr().get() );   
+    Itemiser::ElementTable keyer_items = archetype_node->GetItemiseTable( op_values[0].GetChildTreePtr().get() );   
     ASSERT( item_index < keyer_items.size() );     
     
-    // Cast based on assumption that we'll be looking at a collection
-    auto p_x_col = dynamic_cast<CollectionInterface *>(keyer_items[item_index]);    
-    ASSERT( p_x_col )("item_index didn't lead to a collection");
+    // Assumption is that we'll be looking at a collection
+    ASSERT( keyer_items.GetKind(item_index)==Itemiser::ElementKind::COLLECTION )("item_index didn't lead to a collection");
+    CollectionInterface *p_x_col = keyer_items.GetCollection(item_index);
     
     // Check that the size is as required
-    bool res = ( p_x_col->size() == size );
-    return make_unique<BooleanResult>( res );
+    return p_x_col->size() == size;
 }
 
 
@@ -826,23 +805,19 @@ list<shared_ptr<SymbolExpression> *> IsSimpleCompareEquivalentOperator::GetSymbo
 }
 
 
-unique_ptr<BooleanResult> IsSimpleCompareEquivalentOperator::Evaluate( const EvalKit &kit,
-                                                                       list<unique_ptr<SymbolicResult>> &&op_results ) const 
+bool IsSimpleCompareEquivalentOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const 
 {
-	(void)kit;
-
     // IEEE 754 Kind-of can be said to be E(a) == E(b) where E propagates 
     // NaS. So like ==
-    for( const unique_ptr<SymbolicResult> &ra : op_results )
-        if( !ra->IsDefinedAndUnique() )
-            return make_unique<BooleanResult>( false );
+    if( !op_values[0] || !op_values[1] )
+        return false;
 
-    unique_ptr<SymbolicResult> ra = move( op_results.front() );
-    unique_ptr<SymbolicResult> rb = move( op_results.back() );
-
-    Orderable::Diff res = equivalence_relation.Compare3Way( ra->GetOnlyXLink().GetChildTreePtr(), 
-                                                            rb->GetOnlyXLink().GetChildTreePtr() );
-    return make_unique<BooleanResult>( res == 0 );    
+    // Structural classes in the database let us skip walking equivalent subtrees
+    SimpleCompare classed_relation( Orderable::TOTAL, 
+                                    kit.x_tree_db ? &kit.x_tree_db->GetOrderings().hash_consing : nullptr );
+    Orderable::Diff res = classed_relation.Compare3Way( op_values[0].GetChildTreePtr(), 
+                                                        op_values[1].GetChildTreePtr() );
+    return res == 0;    
 }
 
 
@@ -917,23 +892,16 @@ list<shared_ptr<SymbolExpression> *> IsLocalMatchOperator::GetSymbolOperandPoint
 }
 
 
-unique_ptr<BooleanResult> IsLocalMatchOperator::Evaluate( const EvalKit &kit,
-                                                          list<unique_ptr<SymbolicResult>> &&op_results ) const
+bool IsLocalMatchOperator::EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const
 {
 	(void)kit;
-    ASSERT( op_results.size()==1 );        
-
-    // Evaluate operand and ensure we got an XLink
-    unique_ptr<SymbolicResult> ra = SoloElementOf(move(op_results));
-
     // IEEE 754 Kind-of can be said to be S(a) == S0 where S propogates 
     // NaS. So like ==
-    if( !ra->IsDefinedAndUnique() )
-        return make_unique<BooleanResult>( false );
+    if( !op_values[0] )
+        return false;
 
     // Use IsLocalMatch on the pattern node 
-    bool match = pattern_node->IsLocalMatch( *(ra->GetOnlyXLink().GetChildTreePtr()) );
-    return make_unique<BooleanResult>( match );
+    return pattern_node->IsLocalMatch( *(op_values[0].GetChildTreePtr()) );
 }
 
 
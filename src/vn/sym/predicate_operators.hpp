@@ -50,6 +50,13 @@ public:
     list<shared_ptr<SymbolExpression>> GetSymbolOperands() const final;
     virtual list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() = 0;
     virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit ) const override;
+    unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
+                                        list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
+
+    // Evaluate given the values of the operands, which are NULL where the 
+    // operand's result was not defined and unique. This is the allocation-free
+    // route used by CompiledExpression. Does not apply forces.
+    virtual bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const = 0;
     
     shared_ptr<PredicateOperator> TrySubstitute( shared_ptr<SymbolExpression> over,
                                                  shared_ptr<SymbolExpression> with ) const;
@@ -81,8 +88,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                        list<unique_ptr<SymbolicResult>> &&op_results ) const override;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override;
     bool IsCommutative() const override;
 
     shared_ptr<SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SymbolVariable> target ) const override;
@@ -116,8 +122,7 @@ public:
                                       shared_ptr<SymbolExpression> b_ );
     VariablesRequiringDB GetVariablesRequiringDB() const override;
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override final;
     shared_ptr<SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SymbolVariable> target ) const override;
     virtual list<shared_ptr<SymbolExpression>> GetRanges() const = 0;
     virtual bool EvalBoolFromDiff( Orderable::Diff diff ) const = 0;
@@ -210,8 +215,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override;
 
     shared_ptr<SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SymbolVariable> target ) const override;
     bool IsCommutative() const override;
@@ -238,8 +242,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override;
     shared_ptr<SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SymbolVariable> target ) const override;
     Relationship GetRelationshipWith( shared_ptr<PredicateOperator> other ) const override;
 
@@ -271,8 +274,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override final;
 
     Orderable::Diff OrderCompare3WayCovariant( const Orderable &right, 
                                            OrderProperty order_property ) const override;                                                
@@ -301,8 +303,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override;
     
     shared_ptr<SymbolExpression> TrySolveFor( const SolveKit &kit, shared_ptr<SymbolVariable> target ) const override;
     bool IsCommutative() const override;
@@ -314,7 +315,6 @@ public:
 private:
     shared_ptr<SymbolExpression> a;
     shared_ptr<SymbolExpression> b;
-    SimpleCompare equivalence_relation;
 };
 
 // ------------------------- IsLocalMatchOperator --------------------------
@@ -328,8 +328,7 @@ public:
     shared_ptr<PredicateOperator> Clone() const override;
 
     list<shared_ptr<SymbolExpression> *> GetSymbolOperandPointers() override;
-    virtual unique_ptr<BooleanResult> Evaluate( const EvalKit &kit,
-                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
+    bool EvaluateFromValues( const EvalKit &kit, const XValue *op_values ) const override final;
 
     Orderable::Diff OrderCompare3WayCovariant( const Orderable &right, 
                                            OrderProperty order_property ) const override;                                                
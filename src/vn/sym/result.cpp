@@ -2,6 +2,11 @@
 
 #include "common/orderable.hpp"
 #include "db/x_tree_database.hpp"
+#include "db/lacing.hpp"
+
+// Range results count their values for GetSizeHint() by walking at most this
+// many elements of the ordering, and fall back to a bound beyond that
+#define SIZE_HINT_WALK_LIMIT 64
 
 using namespace SYM;
 
@@ -69,6 +74,37 @@ SymbolicResult::~SymbolicResult()
 }
 
 
+SymbolicResult::Generator SymbolicResult::TryGetGenerator() const
+{
+    // Fall back to extensionalising
+    auto links = make_shared<set<XValue>>();
+    if( !TryExtensionalise(*links) )
+        return Generator();
+    set<XValue>::const_iterator it = links->begin();
+    return [links, it]() mutable -> XValue
+    {
+        if( it == links->end() )
+            return XValue();
+        return *it++;
+    };
+}
+
+
+bool SymbolicResult::Contains( XValue xlink ) const
+{
+    set<XValue> links;
+    bool ok = TryExtensionalise(links);
+    ASSERT( ok )("Cannot test membership of ")(*this);
+    return links.count(xlink) > 0;
+}
+
+
+size_t SymbolicResult::GetSizeHint() const
+{
+    return SIZE_MAX;
+}
+
+
 string SymbolicResult::GetTrace() const
 {
     return SSPrintf("@%p ", this) + Render();
@@ -118,6 +154,30 @@ bool UniqueResult::operator==( const SymbolicResult &other ) const
 }
 
 
+SymbolicResult::Generator UniqueResult::TryGetGenerator() const
+{
+    XValue next = xlink;
+    return [next]() mutable -> XValue
+    {
+        XValue v = next;
+        next = XValue();
+        return v;
+    };
+}
+
+
+bool UniqueResult::Contains( XValue x ) const
+{
+    return x == xlink;
+}
+
+
+size_t UniqueResult::GetSizeHint() const
+{
+    return 1;
+}
+
+
 string UniqueResult::Render() const
 {
     return Trace(xlink);
@@ -150,6 +210,24 @@ bool EmptyResult::operator==( const SymbolicResult &other ) const
 }
 
 
+SymbolicResult::Generator EmptyResult::TryGetGenerator() const
+{
+    return []() -> XValue { return XValue(); };
+}
+
+
+bool EmptyResult::Contains( XValue ) const
+{
+    return false;
+}
+
+
+size_t EmptyResult::GetSizeHint() const
+{
+    return 0;
+}
+
+
 string EmptyResult::Render() const
 {
     return "{}";
@@ -210,6 +288,38 @@ bool SubsetResult::operator==( const SymbolicResult &other ) const
 }
 
 
+SymbolicResult::Generator SubsetResult::TryGetGenerator() const
+{
+    if( complement_flag ) // Refusing to enumerate a complement set
+        return Generator();
+    set<XValue>::const_iterator it = xlinks.begin();
+    return [this, it]() mutable -> XValue
+    {
+        if( it == xlinks.end() )
+            return XValue();
+        return *it++;
+    };
+}
+
+
+bool SubsetResult::Contains( XValue x ) const
+{
+    return (xlinks.count(x) > 0) != complement_flag;
+}
+
+
+size_t SubsetResult::GetSizeHint() const
+{
+    return complement_flag ? SIZE_MAX : xlinks.size();
+}
+
+
+bool SubsetResult::IsComplement() const
+{
+    return complement_flag;
+}
+
+
 unique_ptr<SubsetResult> SubsetResult::GetComplement() const
 {
     return make_unique<SubsetResult>(xlinks, !complement_flag);
@@ -327,8 +437,47 @@ XValue DepthFirstRangeResult::GetOnlyXLink() const
 
 bool DepthFirstRangeResult::TryExtensionalise( set<XValue> &links ) const
 { 
+    links.clear();
+    Generator g = TryGetGenerator();
+    while( XValue x = g() )
+        links.insert(x);
+    return true;
+}
+
+
+SymbolicResult::Generator DepthFirstRangeResult::TryGetGenerator() const
+{ 
+    XLinkIterator it_lower, it_upper;
+    tie(it_lower, it_upper) = GetIterators();
+    
+    return [it_lower, it_upper]() mutable -> XValue
+    {
+        if( it_lower == it_upper )
+            return XValue();
+        return *it_lower++;
+    };
+}
+
+
+size_t DepthFirstRangeResult::GetSizeHint() const
+{
+    // Ranges bounded on one side are typical, so we can't do better than the whole
+    // ordering unless the range turns out to be short
+    XLinkIterator it_lower, it_upper;
+    tie(it_lower, it_upper) = GetIterators();
+    size_t count = 0;
+    for( ; it_lower != it_upper; ++it_lower )
+        if( ++count > SIZE_HINT_WALK_LIMIT )
+            return x_tree_db->GetOrderings().depth_first_ordering.size();
+    return count;
+}
+
+
+pair<DepthFirstRangeResult::XLinkIterator, 
+     DepthFirstRangeResult::XLinkIterator> DepthFirstRangeResult::GetIterators() const
+{
     const VN::Orderings::DepthFirstOrdering &ordering = x_tree_db->GetOrderings().depth_first_ordering;
-    VN::Orderings::DepthFirstOrdering::iterator it_lower, it_upper;
+    VN::Orderings::DepthFirstOrdering::const_iterator it_lower, it_upper;
     
     if( lower )
     {
@@ -347,7 +496,7 @@ bool DepthFirstRangeResult::TryExtensionalise( set<XValue> &links ) const
     if( upper )
     {
         it_upper = ordering.find(upper);
-        ASSERT( it_lower != ordering.end() );
+        ASSERT( it_upper != ordering.end() );
         if( upper_incl )
             ++it_upper;
     }
@@ -356,7 +505,27 @@ bool DepthFirstRangeResult::TryExtensionalise( set<XValue> &links ) const
         it_upper = ordering.end();
     }
     
-    links = set<XValue>( it_lower, it_upper );
+    return make_pair(it_lower, it_upper);
+}
+
+
+bool DepthFirstRangeResult::Contains( XValue x ) const
+{
+    if( !x_tree_db->HasRow(x) )
+        return false; // not in the ordering
+    VN::DepthFirstRelation dfr = x_tree_db->GetOrderings().depth_first_ordering.key_comp();
+    if( lower )
+    {
+        Orderable::Diff d = dfr.Compare3Way(x, lower);
+        if( lower_incl ? d < 0 : d <= 0 )
+            return false;
+    }
+    if( upper )
+    {
+        Orderable::Diff d = dfr.Compare3Way(x, upper);
+        if( upper_incl ? d > 0 : d >= 0 )
+            return false;
+    }
     return true;
 }
 
@@ -406,6 +575,57 @@ XValue SimpleCompareRangeResult::GetOnlyXLink() const
 bool SimpleCompareRangeResult::TryExtensionalise( set<XValue> &links ) const
 {        
     links.clear();
+    Generator g = TryGetGenerator();
+    while( XValue x = g() )
+        links.insert(x);
+	return true;
+}
+
+
+SymbolicResult::Generator SimpleCompareRangeResult::TryGetGenerator() const
+{        
+    NodeIterator it_lower, it_upper;
+    tie(it_lower, it_upper) = GetIterators();
+    
+    // Walk the nodes, and the incoming XLinks of each node
+    static const VN::NodeTable::Row::XLinkSet no_links;
+    VN::NodeTable::Row::XLinkSet::const_iterator xit = no_links.begin(), xit_end = no_links.end();
+    return [this, it_lower, it_upper, xit, xit_end]() mutable -> XValue
+    {
+        while( xit == xit_end )
+        {
+            if( it_lower == it_upper )
+                return XValue();
+            const VN::NodeTable::Row::XLinkSet &new_links = x_tree_db->GetNodeRow(*it_lower).incoming_xlinks;
+            xit = new_links.begin();
+            xit_end = new_links.end();
+            ++it_lower;
+        }
+        return *xit++;
+    };
+}
+
+
+size_t SimpleCompareRangeResult::GetSizeHint() const
+{
+    // Ranges are often a single equivalence class, so usually short. If 
+    // not, every XLink might be in it.
+    NodeIterator it_lower, it_upper;
+    tie(it_lower, it_upper) = GetIterators();
+    size_t num_nodes = 0, num_xlinks = 0;
+    for( ; it_lower != it_upper; ++it_lower )
+    {
+        if( ++num_nodes > SIZE_HINT_WALK_LIMIT )
+            return x_tree_db->GetOrderings().depth_first_ordering.size();
+        num_xlinks += x_tree_db->GetNodeRow(*it_lower).incoming_xlinks.size();
+    }
+    return num_xlinks;
+}
+
+
+pair<SimpleCompareRangeResult::NodeIterator, 
+     SimpleCompareRangeResult::NodeIterator> SimpleCompareRangeResult::GetIterators() const
+{        
     VN::Orderings::SimpleCompareOrdering::const_iterator it_lower, it_upper;
 
     if( lower )
@@ -432,15 +652,29 @@ bool SimpleCompareRangeResult::TryExtensionalise( set<XValue> &links ) const
         it_upper = x_tree_db->GetOrderings().simple_compare_ordering.end();
     }
     
-    for( VN::Orderings::SimpleCompareOrdering::const_iterator it = it_lower;
-         it != it_upper;
-         ++it )
-	{
-		const set<XValue> &new_links = x_tree_db->GetNodeRow(*it).incoming_xlinks;
-		for( XValue l : new_links )
-			links.insert(l);
-	}	    
-	return true;
+    return make_pair(it_lower, it_upper);
+}
+
+
+bool SimpleCompareRangeResult::Contains( XValue x ) const
+{
+    if( !x_tree_db->HasRow(x) )
+        return false; // not in the ordering
+    TreePtr<Node> node = x.GetChildTreePtr();
+    VN::SimpleCompareRelation scr = x_tree_db->GetOrderings().simple_compare_ordering.key_comp();
+    if( lower )
+    {
+        Orderable::Diff d = scr.Compare3Way(node, lower);
+        if( lower_incl ? d < 0 : d <= 0 )
+            return false;
+    }
+    if( upper )
+    {
+        Orderable::Diff d = scr.Compare3Way(node, upper);
+        if( upper_incl ? d > 0 : d >= 0 )
+            return false;
+    }
+    return true;
 }
 
 
@@ -489,33 +723,108 @@ XValue CategoryRangeResult::GetOnlyXLink() const
 bool CategoryRangeResult::TryExtensionalise( set<XValue> &links ) const
 {        
     links.clear();
+    Generator g = TryGetGenerator();
+    while( XValue x = g() )
+        links.insert(x);
+    return true;
+}
+
+
+SymbolicResult::Generator CategoryRangeResult::TryGetGenerator() const
+{        
+    // Walk the bounds, the nodes within each, and the incoming XLinks of each node
+    static const VN::NodeTable::Row::XLinkSet no_links;
+    CatBoundsList::const_iterator bit = bounds_list.begin();
+    VN::Orderings::CategoryOrdering::const_iterator it, it_upper;
+    it = it_upper = x_tree_db->GetOrderings().category_ordering.end();
+    VN::NodeTable::Row::XLinkSet::const_iterator xit = no_links.begin(), xit_end = no_links.end();
+    return [this, bit, it, it_upper, xit, xit_end]() mutable -> XValue
+    {
+        while( xit == xit_end )
+        {
+            if( it != it_upper )
+            {
+                const VN::NodeTable::Row::XLinkSet &new_links = x_tree_db->GetNodeRow(*it).incoming_xlinks;
+                xit = new_links.begin();
+                xit_end = new_links.end();
+                ++it;
+            }
+            else if( bit != bounds_list.end() )
+            {
+                tie(it, it_upper) = GetIterators(*bit);
+                ++bit;
+            }
+            else
+            {
+                return XValue();
+            }
+        }
+        return *xit++;
+    };
+}
+
+
+bool CategoryRangeResult::Contains( XValue x ) const
+{
+    if( !x_tree_db->HasRow(x) )
+        return false; // not in the ordering
+    TreePtr<Node> node = x.GetChildTreePtr();
+    VN::CategoryRelation cr = x_tree_db->GetOrderings().category_ordering.key_comp();
     for( const CatBounds &bounds : bounds_list )
     {
-        VN::Orderings::CategoryOrdering::const_iterator it_lower, it_upper; 
-
-        ASSERT( &bounds );
-        ASSERT( bounds.first );
-        if( lower_incl )
-            it_lower = x_tree_db->GetOrderings().category_ordering.lower_bound(*bounds.first);
-        else
-            it_lower = x_tree_db->GetOrderings().category_ordering.upper_bound(*bounds.first);
+        Orderable::Diff dl = cr.Compare3Way(node, *bounds.first);
+        Orderable::Diff du = cr.Compare3Way(node, *bounds.second);
+        if( (lower_incl ? dl >= 0 : dl > 0) && (upper_incl ? du <= 0 : du < 0) )
+            return true;
+    }
+    return false;
+}
 
-        ASSERT( bounds.second );
-        if( upper_incl )
-            it_upper = x_tree_db->GetOrderings().category_ordering.upper_bound(*bounds.second);
-        else
-            it_upper = x_tree_db->GetOrderings().category_ordering.lower_bound(*bounds.second);
 
-        for( VN::Orderings::CategoryOrdering::const_iterator it = it_lower;
-             it != it_upper;
-             ++it )
-        {
-            const set<XValue> &new_links = x_tree_db->GetNodeRow(*it).incoming_xlinks;
-            for( XValue l : new_links )
-				links.insert(l);
-		}		
+size_t CategoryRangeResult::GetSizeHint() const
+{
+    // Count from the lacing histogram, which is per node not per XLink, but
+    // nodes with more than one incoming XLink are rare enough
+    const VN::Orderings &orderings = x_tree_db->GetOrderings();
+    auto get_ordinal = [&](const KeyType &bound, bool is_upper) -> int
+    {
+        // Minimus bounds go before all the nodes at their ordinal; 
+        // node bounds are included conservatively
+        if( auto minimus = TreePtr<VN::CategoryRelation::MinimusNode>::DynamicCast(bound) )
+            return minimus->GetMinimusOrdinal();
+        return orderings.GetLacing()->GetOrdinalForNode(bound) + (is_upper ? 1 : 0);
+    };
+    
+    list<pair<int, int>> int_range_list;
+    for( const CatBounds &bounds : bounds_list )
+    {
+        int lo = get_ordinal(*bounds.first, false);
+        int hi = get_ordinal(*bounds.second, true);
+        if( lo < hi )
+            int_range_list.push_back( make_pair(lo, hi) );
     }
-    return true;
+    return orderings.CountInLacingRanges( int_range_list );
+}
+
+
+pair<CategoryRangeResult::NodeIterator, 
+     CategoryRangeResult::NodeIterator> CategoryRangeResult::GetIterators( const CatBounds &bounds ) const
+{
+    VN::Orderings::CategoryOrdering::const_iterator it_lower, it_upper; 
+
+    ASSERT( bounds.first );
+    if( lower_incl )
+        it_lower = x_tree_db->GetOrderings().category_ordering.lower_bound(*bounds.first);
+    else
+        it_lower = x_tree_db->GetOrderings().category_ordering.upper_bound(*bounds.first);
+
+    ASSERT( bounds.second );
+    if( upper_incl )
+        it_upper = x_tree_db->GetOrderings().category_ordering.upper_bound(*bounds.second);
+    else
+        it_upper = x_tree_db->GetOrderings().category_ordering.lower_bound(*bounds.second);
+        
+    return make_pair(it_lower, it_upper);
 }
 
 
@@ -539,3 +848,117 @@ string CategoryRangeResult::Render() const
     return Join(terms, " ∪ ", "{CAT ", "}");
 }
 
+
+// ------------------------- IntersectionResult --------------------------
+
+IntersectionResult::IntersectionResult( list<unique_ptr<SymbolicResult>> &&ops_ ) :
+    ops( move(ops_) )
+{
+}
+
+
+bool IntersectionResult::IsDefinedAndUnique() const
+{
+    set<XValue> links;
+    return TryExtensionalise(links) && links.size() == 1;
+}
+
+
+XValue IntersectionResult::GetOnlyXLink() const
+{
+    set<XValue> links;
+    bool ok = TryExtensionalise(links);
+    ASSERT( ok );
+    return SoloElementOf(links);
+}
+
+
+bool IntersectionResult::TryExtensionalise( set<XValue> &links ) const
+{
+    Generator g = TryGetGenerator();
+    if( !g )
+        return false;
+    links.clear();
+    while( XValue x = g() )
+        links.insert(x);
+    return true;
+}
+
+
+bool IntersectionResult::operator==( const SymbolicResult &other ) const
+{
+    set<XValue> links, other_links;
+    return TryExtensionalise(links) && 
+           other.TryExtensionalise(other_links) && 
+           links == other_links;
+}
+
+
+SymbolicResult::Generator IntersectionResult::TryGetGenerator() const
+{
+    // Enumerate the smallest operand that can be enumerated
+    const SymbolicResult *driver = nullptr;
+    Generator driver_generator;
+    size_t driver_size = SIZE_MAX;
+    for( const unique_ptr<SymbolicResult> &op : ops )
+    {
+        size_t size = op->GetSizeHint();
+        if( driver && size >= driver_size )
+            continue;
+        if( Generator g = op->TryGetGenerator() )
+        {
+            driver = op.get();
+            driver_generator = g;
+            driver_size = size;
+        }
+    }
+    if( !driver )
+        return Generator();
+        
+    // Filter through the others
+    return [this, driver, driver_generator]() mutable -> XValue
+    {
+        while( XValue x = driver_generator() )
+        {
+            bool in_all = true;
+            for( const unique_ptr<SymbolicResult> &op : ops )
+            {
+                if( op.get() != driver && !op->Contains(x) )
+                {
+                    in_all = false;
+                    break;
+                }
+            }
+            if( in_all )
+                return x;
+        }
+        return XValue();
+    };
+}
+
+
+bool IntersectionResult::Contains( XValue x ) const
+{
+    for( const unique_ptr<SymbolicResult> &op : ops )
+        if( !op->Contains(x) )
+            return false;
+    return true;
+}
+
+
+size_t IntersectionResult::GetSizeHint() const
+{
+    size_t size = SIZE_MAX;
+    for( const unique_ptr<SymbolicResult> &op : ops )
+        size = min( size, op->GetSizeHint() );
+    return size;
+}
+
+
+string IntersectionResult::Render() const
+{
+    list<string> ls;
+    for( const unique_ptr<SymbolicResult> &op : ops )
+        ls.push_back( op->Render() );
+    return Join( ls, " ∩ ", "{", "}" );
+}
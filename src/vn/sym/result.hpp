@@ -53,12 +53,25 @@ private:
 class SymbolicResult : public Traceable
 {
 public:
+    // Yields values one at a time, then a NULL XValue
+    typedef function<XValue()> Generator;
+
 	virtual ~SymbolicResult();
     virtual bool IsDefinedAndUnique() const = 0;
     virtual XValue GetOnlyXLink() const = 0;   
     virtual bool TryExtensionalise( set<XValue> &links ) const = 0;     
     virtual bool operator==( const SymbolicResult &other ) const = 0;    
 
+    // Lazy alternatives to TryExtensionalise(). Generators must not outlive
+    // the result or survive changes to the X tree. Returns empty function 
+    // if the result cannot be enumerated (eg complement).
+    virtual Generator TryGetGenerator() const;
+    virtual bool Contains( XValue xlink ) const;
+    
+    // Estimate of the number of values, used to choose which operand of an 
+    // intersection to enumerate. SIZE_MAX if not known cheaply.
+    virtual size_t GetSizeHint() const;
+
     virtual string Render() const = 0;
     string GetTrace() const final;
 };
@@ -75,6 +88,9 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;    
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
     
     string Render() const override;
 
@@ -91,6 +107,9 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;    
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
     
     string Render() const override;
 };
@@ -109,7 +128,11 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
 
+    bool IsComplement() const;
     unique_ptr<SubsetResult> GetComplement() const;
     static unique_ptr<SubsetResult> GetUnion( list<unique_ptr<SubsetResult>> ops );
     static unique_ptr<SubsetResult> GetIntersection( list<unique_ptr<SubsetResult>> ops );
@@ -139,6 +162,9 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
 
     //unique_ptr<SubsetResult> GetComplement() const;
     //static unique_ptr<SubsetResult> GetUnion( list<unique_ptr<SubsetResult>> ops );
@@ -147,6 +173,10 @@ public:
     string Render() const override;
 
 private:    
+    // Same as Orderings::DepthFirstOrdering::const_iterator
+    typedef set<KeyType, VN::DepthFirstRelation>::const_iterator XLinkIterator;
+    pair<XLinkIterator, XLinkIterator> GetIterators() const;
+
     const VN::XTreeDatabase *x_tree_db;
     const XValue lower, upper;
     const bool lower_incl, upper_incl;
@@ -164,6 +194,9 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
 
     //unique_ptr<SubsetResult> GetComplement() const;
     //static unique_ptr<SubsetResult> GetUnion( list<unique_ptr<SubsetResult>> ops );
@@ -172,6 +205,10 @@ public:
     string Render() const override;
 
 private:    
+    // Same as Orderings::SimpleCompareOrdering::const_iterator
+    typedef set<KeyType, VN::SimpleCompareRelation>::const_iterator NodeIterator;
+    pair<NodeIterator, NodeIterator> GetIterators() const;
+
     const VN::XTreeDatabase *x_tree_db;
     const KeyType lower, upper;
     const bool lower_incl, upper_incl;
@@ -195,6 +232,9 @@ public:
     XValue GetOnlyXLink() const override;    
     bool TryExtensionalise( set<XValue> &links ) const override;
     bool operator==( const SymbolicResult &other ) const override;
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
 
     //unique_ptr<SubsetResult> GetComplement() const;
     //static unique_ptr<SubsetResult> GetUnion( list<unique_ptr<SubsetResult>> ops );
@@ -203,11 +243,37 @@ public:
     string Render() const override;
 
 private:    
+    // Same as Orderings::CategoryOrdering::const_iterator
+    typedef set<KeyType, VN::CategoryRelation>::const_iterator NodeIterator;
+    pair<NodeIterator, NodeIterator> GetIterators( const CatBounds &bounds ) const;
+
     const VN::XTreeDatabase *x_tree_db;
     const CatBoundsList bounds_list;
     const bool lower_incl, upper_incl;
 };
 
+// ------------------------- IntersectionResult --------------------------
+
+// Intersection that is not extensionalised: we enumerate the operand
+// that looks smallest and filter its values through the others. 
+class IntersectionResult : public SymbolicResult
+{
+public:
+    explicit IntersectionResult( list<unique_ptr<SymbolicResult>> &&ops );
+    
+    bool IsDefinedAndUnique() const override;    
+    XValue GetOnlyXLink() const override;    
+    bool TryExtensionalise( set<XValue> &links ) const override;
+    bool operator==( const SymbolicResult &other ) const override;
+    Generator TryGetGenerator() const override;
+    bool Contains( XValue x ) const override;
+    size_t GetSizeHint() const override;
+
+    string Render() const override;
+
+private:    
+    const list<unique_ptr<SymbolicResult>> ops;
+};
 
 };
 
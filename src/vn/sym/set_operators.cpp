@@ -58,6 +58,10 @@ unique_ptr<SymbolicResult> UnionOperator::Evaluate( const EvalKit &kit,
                                                            list<unique_ptr<SymbolicResult>> &&op_results ) const
 {
 	(void)kit;
+    // Don't extensionalise a lone operand, it might be lazy
+    if( op_results.size() == 1 )
+        return move(op_results.front());
+        
     list<unique_ptr<SubsetResult>> ssrs;
     for( unique_ptr<SymbolicResult> &ar : op_results )       
         ssrs.push_back( make_unique<SubsetResult>( move(ar) ) );
@@ -99,6 +103,18 @@ unique_ptr<SymbolicResult> IntersectionOperator::Evaluate( const EvalKit &kit,
                                                                   list<unique_ptr<SymbolicResult>> &&op_results ) const
 {
 	(void)kit;
+    // If any operand can be enumerated, stay lazy so the values can be 
+    // streamed. Complements can't, so intersect those extensionally.
+    bool all_complements = true;
+    for( const unique_ptr<SymbolicResult> &ar : op_results )       
+    {
+        auto sr = dynamic_cast<const SubsetResult *>(ar.get());
+        if( !(sr && sr->IsComplement()) )
+            all_complements = false;
+    }
+    if( !all_complements )
+        return make_unique<IntersectionResult>( move(op_results) );
+        
     list<unique_ptr<SubsetResult>> ssrs;
     for( unique_ptr<SymbolicResult> &ar : op_results )       
         ssrs.push_back( make_unique<SubsetResult>( move(ar) ) );
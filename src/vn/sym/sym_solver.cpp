@@ -10,15 +10,26 @@
 #include "set_operators.hpp"
 #include "common/lambda_loops.hpp"
 #include "rewriters.hpp"
+#include "bdd.hpp"
 
 using namespace SYM;
 
+// With SolverBackend::AUTO, use a BDD when there are more predicates than
+// this. Full truth tables have 2^degree cells, and Karnaugh maps take 3^degree 
+// tries at a slice.
+#define BDD_DEGREE_THRESHOLD 10
+
+// Full truth tables don't get extended beyond this degree. BDDs are not limited.
+#define MAX_EXTENDED_TRUTH_TABLE_DEGREE 10
+
 // -------------------------- TruthTableSolver ----------------------------    
 
 TruthTableSolver::TruthTableSolver( const Expression::SolveKit &kit_,
-                                    shared_ptr<BooleanExpression> initial_expression_ ) :
+                                    shared_ptr<BooleanExpression> initial_expression_,
+                                    SolverBackend backend_ ) :
     initial_expression( initial_expression_ ),
-    kit( kit_ )
+    kit( kit_ ),
+    backend( backend_ )
 {
 }
 
@@ -35,7 +46,11 @@ void TruthTableSolver::PreSolve()
     
     // Find the predicates and create a truth table of them
     auto predicates = PredicateAnalysis::GetPredicates( initial_expression );
-    ttwp = make_unique<TruthTableWithPredicates>( predicates, STARTING_VALUE, label_var_name, counting_based );
+    bool use_bdd = backend==SolverBackend::BDD ||
+                   (backend==SolverBackend::AUTO && predicates.size() > BDD_DEGREE_THRESHOLD);
+    if( use_bdd )
+        TRACEC("Using BDD for %d predicates\n", predicates.size());
+    ttwp = make_unique<TruthTableWithPredicates>( predicates, STARTING_VALUE, label_var_name, counting_based, use_bdd );
     TRACEC(RenderInitialExpressionInTermsOfPredNames())("\n");
     
     // Constrain by searching for derivations of the predicates using rules like
@@ -170,30 +185,39 @@ shared_ptr<SymbolExpression> TruthTableSolver::TrySolveForGiven( shared_ptr<Symb
 
 shared_ptr<BooleanExpression> TruthTableSolver::GetExpressionViaKarnaughMap( TruthTableWithPredicates initial_ttwp ) const
 {
-    // Derive a Karnaugh map using TryFindBestKarnaughSlice()
-    TruthTableWithPredicates so_far_ttwp = initial_ttwp;
-    set<shared_ptr<TruthTable::SliceSpec>> karnaugh_map;
-    while( 1 )
+    list<TruthTable::SliceSpec> karnaugh_map;
+    if( initial_ttwp.IsBDD() )
     {
-        shared_ptr<TruthTable::SliceSpec> slice = 
-            initial_ttwp.GetTruthTable().TryFindBestKarnaughSlice( TruthTable::CellType::TRUE, true, so_far_ttwp.GetTruthTable() );
-        if( !slice )
-            break; // must have got them all
-            
-        TRACEC("Got Karnaugh slice: ")(*slice)("\n");
-        karnaugh_map.insert( slice );
-               
-        so_far_ttwp.GetTruthTable().SetSlice(*slice, TruthTable::CellType::FALSE); // Update the TT that indicates progress so far
+        // An irredundant cover from the BDD does the same job as a Karnaugh map
+        karnaugh_map = initial_ttwp.GetBDDTruthTable().GetCover( TruthTable::CellType::TRUE, true );
+        for( const TruthTable::SliceSpec &slice : karnaugh_map )
+            TRACEC("Got slice from BDD: ")(slice)("\n");
+    }
+    else
+    {
+        // Derive a Karnaugh map using TryFindBestKarnaughSlice()
+        TruthTableWithPredicates so_far_ttwp = initial_ttwp;
+        while( 1 )
+        {
+            shared_ptr<TruthTable::SliceSpec> slice = 
+                initial_ttwp.GetTruthTable().TryFindBestKarnaughSlice( TruthTable::CellType::TRUE, true, so_far_ttwp.GetTruthTable() );
+            if( !slice )
+                break; // must have got them all
+                
+            TRACEC("Got Karnaugh slice: ")(*slice)("\n");
+            karnaugh_map.push_back( *slice );
+                   
+            so_far_ttwp.GetTruthTable().SetSlice(*slice, TruthTable::CellType::FALSE); // Update the TT that indicates progress so far
+        }
     }
     
     // Build a union of expressions for the Karnaugh slices
     list< shared_ptr<BooleanExpression> > terms;
-    for( shared_ptr<TruthTable::SliceSpec> slice : karnaugh_map )
+    for( const TruthTable::SliceSpec &slice : karnaugh_map )
     {
-        ASSERT( slice );
         // Build an intersection of clauses corresponding to solveables
         list< shared_ptr<BooleanExpression> > clauses;
-        for( pair<int, bool> p : *slice )
+        for( pair<int, bool> p : slice )
         {
             int axis = p.first;
             int index = p.second;
@@ -218,6 +242,28 @@ shared_ptr<BooleanExpression> TruthTableSolver::GetAltExpressionForTesting() con
     // We can create an expression after pre-solve using the truth table 
     // which should evaluate the same as the initial expression, for use as a test.
     
+    if( ttwp->IsBDD() )
+    {
+        // Too many cells for a multiplexor, so make a sum of products. Don't 
+        // use DONT_CARE cells, to match the multiplexor version.
+        list<shared_ptr<BooleanExpression>> terms;
+        for( const TruthTable::SliceSpec &slice : ttwp->GetBDDTruthTable().GetCover( TruthTable::CellType::TRUE, false ) )
+        {
+            list<shared_ptr<BooleanExpression>> clauses;
+            for( pair<int, bool> p : slice )
+            {
+                shared_ptr<BooleanExpression> clause = ttwp->GetFrontPredicate(p.first);
+                if( !p.second )
+                    clause = make_shared<NotOperator>(clause);
+                clauses.push_back( clause );
+            }
+            terms.push_back( make_shared<AndOperator>( clauses ) );
+        }
+        auto solution = make_shared<OrOperator>( terms );
+        TRACEC("alternative expression is ")(solution)("\n");
+        return solution;
+    }
+
     // We'll make a big consitional. Controls are the predicates.
     vector<shared_ptr<BooleanExpression>> controls;
     for( unsigned ia=0; ia<ttwp->GetDegree(); ia++ )
@@ -245,6 +291,12 @@ void TruthTableSolver::ConstrainByEvaluating()
     const TruthTable::CellType SHOULD_EVAL = TruthTable::CellType::TRUE;
     const TruthTable::CellType EVAL_EXCLUDE = TruthTable::CellType::FALSE;
     
+    if( ttwp->IsBDD() )
+    {
+        ConstrainByEvaluatingBDD();
+        return;
+    }
+
     Expression::EvalKit kit { nullptr, nullptr }; 
     
     // Walk the truth table
@@ -276,6 +328,98 @@ void TruthTableSolver::ConstrainByEvaluating()
 }
 
 
+void TruthTableSolver::ConstrainByEvaluatingBDD()
+{
+    // Rather than evaluating once per cell, build a BDD that is true where
+    // the initial expression would evaluate true.
+    BDDTruthTable &table = ttwp->GetBDDTruthTable();
+    BDD::Node constraint = GetBDDForExpression( *table.GetBDD(), initial_expression );
+    table.Constrain( constraint );
+    TRACEC("BDD has %d nodes\n", table.GetBDD()->GetNumNodes());
+}
+
+
+BDD::Node TruthTableSolver::GetBDDForExpression( BDD &bdd, shared_ptr<BooleanExpression> expr ) const
+{
+    // The BDD is true where evaluating expr gives a defined true result, 
+    // with predicates forced as for ConstrainByEvaluating().
+    if( auto pred = dynamic_pointer_cast<PredicateOperator>(expr) )
+        return bdd.GetVar( ttwp->PredToIndex(pred) );
+        
+    if( auto bc = dynamic_pointer_cast<BooleanConstant>(expr) )
+        return bdd.GetConstant( bc->GetAsBool() );
+
+    // Defined-and-true for AND and OR is just AND and OR of the same for 
+    // the operands, even if they may be undefined. Not so for NOT.
+    if( auto and_op = dynamic_pointer_cast<AndOperator>(expr) )
+    {
+        BDD::Node result = bdd.GetConstant(true);
+        for( shared_ptr<BooleanExpression> op : and_op->GetBooleanOperands() )
+            result = bdd.And( result, GetBDDForExpression( bdd, op ) );
+        return result;
+    }
+    
+    if( auto or_op = dynamic_pointer_cast<OrOperator>(expr) )
+    {
+        BDD::Node result = bdd.GetConstant(false);
+        for( shared_ptr<BooleanExpression> op : or_op->GetBooleanOperands() )
+            result = bdd.Or( result, GetBDDForExpression( bdd, op ) );
+        return result;
+    }
+
+    auto not_op = dynamic_pointer_cast<NotOperator>(expr);
+    if( not_op && IsAlwaysDefined(expr) )
+        return bdd.Not( GetBDDForExpression( bdd, SoloElementOf(not_op->GetBooleanOperands()) ) );
+
+    // Anything else: evaluate for every combination of just the predicates 
+    // found in expr. Exponential, but only in the predicates of expr.
+    auto local_preds = PredicateAnalysis::GetPredicates( expr );
+    TRACEC("Evaluating over %d predicates for BDD: ", local_preds.size())(expr->Render())("\n");
+    Expression::EvalKit kit { nullptr, nullptr }; 
+    BDD::Node result = bdd.GetConstant(false);
+    ForPower<bool>( local_preds.size(), index_range_bool, [&](vector<bool> indices)
+    {
+        vector<shared_ptr<BooleanExpression>> vbe; // must stay in scope across the Evaluate
+        BDD::Cube cube;
+        for( unsigned j=0; j<local_preds.size(); j++ )
+        {
+            vbe.push_back( make_shared<BooleanConstant>(indices[j]) );
+            for( shared_ptr<PredicateOperator> pred : local_preds[j] )
+                pred->SetForceExpression( vbe[j] );   
+            cube[ttwp->PredToIndex(FrontOf(local_preds[j]))] = indices[j];
+        }
+                
+        unique_ptr<BooleanResult> eval_result = expr->Evaluate(kit);
+        if( eval_result->IsDefinedAndTrue() )
+            result = bdd.Or( result, bdd.GetCube( cube ) );
+    } );
+    return result;
+}
+
+
+bool TruthTableSolver::IsAlwaysDefined( shared_ptr<BooleanExpression> expr ) const
+{
+    // Forced predicates and constants are always defined, and the boolean 
+    // connectives are defined when their operands are.
+    if( dynamic_pointer_cast<PredicateOperator>(expr) || 
+        dynamic_pointer_cast<BooleanConstant>(expr) )
+        return true;
+        
+    if( dynamic_pointer_cast<AndOperator>(expr) || 
+        dynamic_pointer_cast<OrOperator>(expr) || 
+        dynamic_pointer_cast<NotOperator>(expr) )
+    {
+        auto connective = dynamic_pointer_cast<BooleanToBooleanExpression>(expr);
+        for( shared_ptr<BooleanExpression> op : connective->GetBooleanOperands() )
+            if( !IsAlwaysDefined(op) )
+                return false;
+        return true;
+    }
+    
+    return false;
+}
+
+
 void TruthTableSolver::ConstrainUsingDerived()
 {
     const TruthTable::CellType DERIVE_EXCLUDE = TruthTable::CellType::DONT_CARE;
@@ -320,11 +464,12 @@ void TruthTableSolver::ConstrainUsingDerived()
             derived_preds.push_back( derived_pred_to_derived_equal_pred_set.at(p.first) );
     }
     
-    // Policy for extending the truth table. Don't make one with degree more than 10
-    // also obviously don't bother if there are no extensions.
+    // Policy for extending the truth table. Don't make a full one with degree more 
+    // than MAX_EXTENDED_TRUTH_TABLE_DEGREE also obviously don't bother if there are 
+    // no extensions.
     int original_degree = ttwp->GetDegree();
     bool should_extend = derived_preds.size() > 0 &&
-                         (original_degree+derived_preds.size() <= 10);
+                         (ttwp->IsBDD() || original_degree+derived_preds.size() <= MAX_EXTENDED_TRUTH_TABLE_DEGREE);
     
     // Maybe expand the truth table to include extrapolations
     if( should_extend )    
@@ -354,13 +499,13 @@ void TruthTableSolver::ConstrainUsingDerived()
                 TRACEC("Enforcing interpolation: %s ∧ %s => FALSE\n", 
                        PredicateName(i).c_str(), 
                        PredicateName(j).c_str() );  
-                ttwp->GetTruthTable().SetSlice( {{i, true}, {j, true}}, DERIVE_EXCLUDE );
+                ttwp->SetSlice( {{i, true}, {j, true}}, DERIVE_EXCLUDE );
                 break;
             case Relationship::IMPLIES:
                 TRACEC("Enforcing interpolation: %s => %s\n", 
                        PredicateName(i).c_str(), 
                        PredicateName(j).c_str() );  
-                ttwp->GetTruthTable().SetSlice( {{i, true}, {j, false}}, DERIVE_EXCLUDE );
+                ttwp->SetSlice( {{i, true}, {j, false}}, DERIVE_EXCLUDE );
                 break;
             }
 
@@ -374,7 +519,7 @@ void TruthTableSolver::ConstrainUsingDerived()
                        PredicateName(i).c_str(), 
                        PredicateName(j).c_str(), 
                        PredicateName(k).c_str() );  
-                ttwp->GetTruthTable().SetSlice( {{i, true}, {j, true}, {k, false}}, DERIVE_EXCLUDE );
+                ttwp->SetSlice( {{i, true}, {j, true}, {k, false}}, DERIVE_EXCLUDE );
             }
         }
     }
@@ -11,6 +11,15 @@ namespace SYM
 class SymbolVariable;
 class PredicateOperator;
 
+// How TruthTableSolver should hold its truth table. AUTO chooses a BDD
+// when there are too many predicates for a full truth table.
+enum class SolverBackend
+{
+    AUTO,
+    TRUTH_TABLE,
+    BDD
+};
+
 // -------------------------- TruthTableSolver ----------------------------    
 
 class TruthTableSolver
@@ -19,7 +28,8 @@ public:
     typedef set<VN::PatternLink> GivenSymbolSet;
 
     TruthTableSolver( const Expression::SolveKit &kit,
-                      shared_ptr<BooleanExpression> initial_expression );
+                      shared_ptr<BooleanExpression> initial_expression,
+                      SolverBackend backend = SolverBackend::AUTO );
     
     /** 
      * Perform analysis on the initial expression that will assist with
@@ -47,6 +57,9 @@ public:
     
 private:
     void ConstrainByEvaluating();
+    void ConstrainByEvaluatingBDD();
+    BDD::Node GetBDDForExpression( BDD &bdd, shared_ptr<BooleanExpression> expr ) const;
+    bool IsAlwaysDefined( shared_ptr<BooleanExpression> expr ) const;
     void ConstrainUsingDerived();
 
     Relationship TryDeriveRelationship( shared_ptr<PredicateOperator> pi, 
@@ -63,7 +76,8 @@ private:
     const string label_var_name = "p";
     const int counting_based = 0;
     const shared_ptr<BooleanExpression> initial_expression;
-    const Expression::SolveKit &kit;                                            
+    const Expression::SolveKit &kit;
+    const SolverBackend backend;
     unique_ptr<TruthTableWithPredicates> ttwp;
 };
 
@@ -5,6 +5,7 @@
 #include "helpers/flatten.hpp"
 #include "node/node.hpp"
 #include "../db/x_tree_database.hpp"
+#include "../dense_solution.hpp"
 
 using namespace SYM;
 
@@ -92,8 +93,8 @@ unique_ptr<SymbolicResult> SymbolVariable::Evaluate( const EvalKit &kit ) const
 {
     // This is an ERROR. You could perfectly easily have called GetRequiredVariables(),
     // done a quick set difference and KNOWN that it would come to this.
-    ASSERT( kit.hypothesis_links->count(plink) > 0 );
-    return make_unique<UniqueResult>( kit.hypothesis_links->at(plink) );
+    ASSERT( kit.hypothesis_links->IsAssigned(plink) );
+    return make_unique<UniqueResult>( kit.hypothesis_links->Get(plink) );
 }
 
 
@@ -173,24 +174,45 @@ list<shared_ptr<SymbolExpression>> ChildToSymbolOperator::GetSymbolOperands() co
 unique_ptr<SymbolicResult> ChildToSymbolOperator::Evaluate( const EvalKit &kit,
                                                             list<unique_ptr<SymbolicResult>> &&op_results ) const
 {
-	(void)kit;
     ASSERT( op_results.size()==1 );
 
-    // XLink must match our referee (i.e. be non-strict subtype)
     unique_ptr<SymbolicResult> ar = SoloElementOf(move(op_results));
     if( !ar->IsDefinedAndUnique() )
         return ar;
 
-    if( !archetype_node->IsSubcategory( *(ar->GetOnlyXLink().GetChildTreePtr()) ) )
-        return make_unique<EmptyResult>(); // Will not be able to itemise due incompatible type
+    XValue parent_xlink = ar->GetOnlyXLink();
+    XValue result_xlink = EvaluateUnique( kit, &parent_xlink );
+    if( result_xlink )
+        return make_unique<UniqueResult>( result_xlink );
+    else
+        return make_unique<EmptyResult>();
+}
+
+
+bool ChildToSymbolOperator::IsEvaluateUniqueSupported() const
+{
+    return true;
+}
+
+
+XValue ChildToSymbolOperator::EvaluateUnique( const EvalKit &kit, const XValue *op_values ) const
+{
+	(void)kit;
+    XValue parent_xlink = op_values[0];
+    if( !parent_xlink )
+        return XValue();
+
+    // XLink must match our referee (i.e. be non-strict subtype)
+    if( !archetype_node->IsSubcategory( *(parent_xlink.GetChildTreePtr()) ) )
+        return XValue(); // Will not be able to itemise due incompatible type
     
     // Itemise the child node of the XLink we got, according to the "schema"
     // of the referee node (note: link number is only valid wrt referee)
-    vector< Itemiser::Element * > keyer_items = archetype_node->Itemise( ar->GetOnlyXLink().GetChildTreePtr().get() );   
+    Itemiser::ElementTable keyer_items = archetype_node->GetItemiseTable( parent_xlink.GetChildTreePtr().get() );   
     ASSERT( item_index < keyer_items.size() )("Item index %d of ", item_index)(archetype_node)(" is too big (size=%d)", keyer_items.size());
     
     // Extract the item indicated by item_index. 
-    return EvalFromItem( ar->GetOnlyXLink(), keyer_items[item_index] );
+    return EvalFromItem( parent_xlink, keyer_items );
 }
 
 
@@ -241,14 +263,14 @@ shared_ptr<SymbolExpression> ChildOperator::TrySolveForToEqual( const SolveKit &
 
 // ------------------------- ChildSequenceFrontOperator --------------------------
 
-unique_ptr<SymbolicResult> ChildSequenceFrontOperator::EvalFromItem( XValue parent_xlink, 
-                                                                     Itemiser::Element *item ) const
+XValue ChildSequenceFrontOperator::EvalFromItem( XValue parent_xlink, 
+                                                const Itemiser::ElementTable &items ) const
 {
 	(void)parent_xlink;
 	
     // Cast based on assumption that we'll be looking at a sequence
-    auto p_x_seq = dynamic_cast<SequenceInterface *>(item);    
-    ASSERT( p_x_seq )("item_index didn't lead to a sequence");
+    ASSERT( items.GetKind(item_index)==Itemiser::ElementKind::SEQUENCE )("item_index didn't lead to a sequence");
+    SequenceInterface *p_x_seq = items.GetSequence(item_index);
     
     XValue result_xlink;
     // Create the correct XLink (i.e. not just pointing to the correct child Node,
@@ -258,7 +280,7 @@ unique_ptr<SymbolicResult> ChildSequenceFrontOperator::EvalFromItem( XValue pare
     else
         result_xlink = XValue(&(p_x_seq->front()));        
         
-    return make_unique<UniqueResult>( result_xlink );
+    return result_xlink;
 }
 
 
@@ -269,22 +291,21 @@ string ChildSequenceFrontOperator::GetItemTypeName() const
 
 // ------------------------- ChildSequenceBackOperator --------------------------
 
-unique_ptr<SymbolicResult> ChildSequenceBackOperator::EvalFromItem( XValue parent_xlink, 
-                                                                    Itemiser::Element *item ) const
+XValue ChildSequenceBackOperator::EvalFromItem( XValue parent_xlink, 
+                                               const Itemiser::ElementTable &items ) const
 {
     (void)parent_xlink;
     
     // Cast based on assumption that we'll be looking at a sequence
-    auto p_x_seq = dynamic_cast<SequenceInterface *>(item);    
-    ASSERT( p_x_seq )("item_index didn't lead to a sequence");
+    ASSERT( items.GetKind(item_index)==Itemiser::ElementKind::SEQUENCE )("item_index didn't lead to a sequence");
+    SequenceInterface *p_x_seq = items.GetSequence(item_index);
     
     // Create the correct XLink (i.e. not just pointing to the correct child Node,
     // but also coming from the correct TreePtr<Node>).
     if( p_x_seq->empty() )
-        return make_unique<EmptyResult>();
+        return XValue();
     
-    auto result_xlink = XValue(&(p_x_seq->back()));        
-    return make_unique<UniqueResult>( result_xlink );
+    return XValue(&(p_x_seq->back()));
 }
 
 
@@ -295,22 +316,21 @@ string ChildSequenceBackOperator::GetItemTypeName() const
 
 // ------------------------- ChildCollectionFrontOperator --------------------------
 
-unique_ptr<SymbolicResult> ChildCollectionFrontOperator::EvalFromItem( XValue parent_xlink, 
-                                                                       Itemiser::Element *item ) const
+XValue ChildCollectionFrontOperator::EvalFromItem( XValue parent_xlink, 
+                                                  const Itemiser::ElementTable &items ) const
 {
 	(void)parent_xlink;
 	
     // Cast based on assumption that we'll be looking at a collection
-    auto p_x_col = dynamic_cast<CollectionInterface *>(item);    
-    ASSERT( p_x_col )("item_index didn't lead to a collection");
+    ASSERT( items.GetKind(item_index)==Itemiser::ElementKind::COLLECTION )("item_index didn't lead to a collection");
+    CollectionInterface *p_x_col = items.GetCollection(item_index);
     
     // Create the correct XLink (i.e. not just pointing to the correct child Node,
     // but also coming from the correct TreePtr<Node>).
     if( p_x_col->empty() )
-        return make_unique<EmptyResult>();
+        return XValue();
     
-    auto result_xlink = XValue(&*(p_x_col->begin()));        
-    return make_unique<UniqueResult>( result_xlink );
+    return XValue(&*(p_x_col->begin()));
 }
 
 
@@ -321,19 +341,18 @@ string ChildCollectionFrontOperator::GetItemTypeName() const
 
 // ------------------------- SingularChildOperator --------------------------
 
-unique_ptr<SymbolicResult> SingularChildOperator::EvalFromItem( XValue parent_xlink, 
-                                                                Itemiser::Element *item ) const
+XValue SingularChildOperator::EvalFromItem( XValue parent_xlink, 
+                                           const Itemiser::ElementTable &items ) const
 {
 	(void)parent_xlink;
 	
     // Cast based on assumption that we'll be looking at a singular item
-    TreePtrInterface *p_x_singular = dynamic_cast<TreePtrInterface *>(item);
-    ASSERT( p_x_singular )("item_index didn't lead to a singular item");
+    ASSERT( items.GetKind(item_index)==Itemiser::ElementKind::SINGULAR )("item_index didn't lead to a singular item");
+    TreePtrInterface *p_x_singular = items.GetSingular(item_index);
     
     // Create the correct XLink (i.e. not just pointing to the correct child Node,
     // but also coming from the correct TreePtr<Node>)
-    auto result_xlink = XValue(p_x_singular);        
-    return make_unique<UniqueResult>( result_xlink );
+    return XValue(p_x_singular);
 }
 
 
@@ -372,12 +391,8 @@ unique_ptr<SymbolicResult> XTreeDbToSymbolOperator::Evaluate( const EvalKit &kit
     if( !ar->IsDefinedAndUnique() )
         return ar; // TODO what if non-unique?
         
-    // These DB operations only work on XLinks supported by the DB. Does not include eg MMAX.   
-    if( !kit.x_tree_db->HasRow(ar->GetOnlyXLink()) )
-        return make_unique<EmptyResult>();
-        
-    const VN::LinkTable::Row &row( kit.x_tree_db->GetRow(ar->GetOnlyXLink()) );   
-    XValue result_xlink = EvalXLinkFromRow( kit, ar->GetOnlyXLink(), row );
+    XValue xlink = ar->GetOnlyXLink();
+    XValue result_xlink = EvaluateUnique( kit, &xlink );
     if( result_xlink ) 
         return make_unique<UniqueResult>( result_xlink );
     else
@@ -385,6 +400,27 @@ unique_ptr<SymbolicResult> XTreeDbToSymbolOperator::Evaluate( const EvalKit &kit
 }
 
 
+bool XTreeDbToSymbolOperator::IsEvaluateUniqueSupported() const
+{
+    return true;
+}
+
+
+XValue XTreeDbToSymbolOperator::EvaluateUnique( const EvalKit &kit, const XValue *op_values ) const
+{
+    XValue xlink = op_values[0];
+    if( !xlink )
+        return XValue();
+        
+    // These DB operations only work on XLinks supported by the DB. Does not include eg MMAX.   
+    if( !kit.x_tree_db->HasRow(xlink) )
+        return XValue();
+        
+    const VN::LinkTable::Row &row( kit.x_tree_db->GetRow(xlink) );   
+    return EvalXLinkFromRow( kit, xlink, row );
+}
+
+
 string XTreeDbToSymbolOperator::Render() const
 {
     return GetRenderPrefix() + a->RenderWithParentheses(); 
@@ -73,8 +73,12 @@ public:
     virtual list<shared_ptr<SymbolExpression>> GetSymbolOperands() const override;
     virtual unique_ptr<SymbolicResult> Evaluate( const EvalKit &kit,
                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
-    virtual unique_ptr<SymbolicResult> EvalFromItem( XValue parent_xlink, 
-                                                   Itemiser::Element *item ) const = 0;
+    bool IsEvaluateUniqueSupported() const override final;
+    XValue EvaluateUnique( const EvalKit &kit, const XValue *op_values ) const override final;
+
+    // Returns NULL if there's no child
+    virtual XValue EvalFromItem( XValue parent_xlink, 
+                                 const Itemiser::ElementTable &items ) const = 0;
 
     Orderable::Diff OrderCompare3WayCovariant( const Orderable &right, 
                                        OrderProperty order_property ) const override;                                                
@@ -104,8 +108,8 @@ class ChildSequenceFrontOperator : public ChildOperator
 {
 public:    
     using ChildOperator::ChildOperator;
-    virtual unique_ptr<SymbolicResult> EvalFromItem( XValue parent_xlink, 
-                                                   Itemiser::Element *item ) const override;
+    virtual XValue EvalFromItem( XValue parent_xlink, 
+                                 const Itemiser::ElementTable &items ) const override;
     virtual string GetItemTypeName() const override;    
 };
 
@@ -115,8 +119,8 @@ class ChildSequenceBackOperator : public ChildOperator
 {
 public:    
     using ChildOperator::ChildOperator;
-    virtual unique_ptr<SymbolicResult> EvalFromItem( XValue parent_xlink, 
-                                                   Itemiser::Element *item ) const override;
+    virtual XValue EvalFromItem( XValue parent_xlink, 
+                                 const Itemiser::ElementTable &items ) const override;
     virtual string GetItemTypeName() const override;    
 };
 
@@ -126,8 +130,8 @@ class ChildCollectionFrontOperator : public ChildOperator
 {
 public:    
     using ChildOperator::ChildOperator;
-    virtual unique_ptr<SymbolicResult> EvalFromItem( XValue parent_xlink, 
-                                                   Itemiser::Element *item ) const override;
+    virtual XValue EvalFromItem( XValue parent_xlink, 
+                                 const Itemiser::ElementTable &items ) const override;
     virtual string GetItemTypeName() const override;    
 };
 
@@ -137,8 +141,8 @@ class SingularChildOperator : public ChildOperator
 {
 public:    
     using ChildOperator::ChildOperator;
-    virtual unique_ptr<SymbolicResult> EvalFromItem( XValue parent_xlink, 
-                                                   Itemiser::Element *item ) const override;
+    virtual XValue EvalFromItem( XValue parent_xlink, 
+                                 const Itemiser::ElementTable &items ) const override;
     virtual string GetItemTypeName() const override;    
 };
 
@@ -153,6 +157,8 @@ public:
     virtual list<shared_ptr<SymbolExpression>> GetSymbolOperands() const override;
     virtual unique_ptr<SymbolicResult> Evaluate( const EvalKit &kit,
                                                list<unique_ptr<SymbolicResult>> &&op_results ) const override final;
+    bool IsEvaluateUniqueSupported() const override final;
+    XValue EvaluateUnique( const EvalKit &kit, const XValue *op_values ) const override final;
     virtual XValue EvalXLinkFromRow( const EvalKit &kit,
                                         XValue xlink, 
                                         const VN::LinkTable::Row &row ) const = 0;
@@ -5,22 +5,42 @@
 #include "common/lambda_loops.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <random>
 
 using namespace SYM;
 
 // ------------------------- TruthTable --------------------------
 
+// Cells per word is 2^WORD_AXES, so axes below this are within a word
+#define WORD_AXES 6
+#define WORD_CELLS ((SizeType)1 << WORD_AXES)
+
+// For axes within a word, the cells whose index is true on that axis
+static const uint64_t axis_patterns[WORD_AXES] = 
+{
+    0xAAAAAAAAAAAAAAAAULL,
+    0xCCCCCCCCCCCCCCCCULL,
+    0xF0F0F0F0F0F0F0F0ULL,
+    0xFF00FF00FF00FF00ULL,
+    0xFFFF0000FFFF0000ULL,
+    0xFFFFFFFF00000000ULL
+};
+
 TruthTable::TruthTable( unsigned degree_, CellType initval ) :
     degree( degree_ )
 {
-    SizeType ncells = (SizeType)1 << degree;
-    cells.resize(ncells, initval);
+    size_t nwords = (GetNumCells() + WORD_CELLS - 1) / WORD_CELLS;
+    Word valid = GetValidMask();
+    care_plane.resize( nwords, initval==CellType::DONT_CARE ? 0 : valid );
+    true_plane.resize( nwords, initval==CellType::TRUE ? valid : 0 );
 }
 
 
 TruthTable::TruthTable( const TruthTable &other ) :
     degree( other.degree ),
-    cells( other.cells )
+    care_plane( other.care_plane ),
+    true_plane( other.true_plane )
 {
 }
 
@@ -28,85 +48,78 @@ TruthTable::TruthTable( const TruthTable &other ) :
 TruthTable &TruthTable::operator=( const TruthTable &other )
 {
     degree = other.degree;
-    cells = other.cells;
+    care_plane = other.care_plane;
+    true_plane = other.true_plane;
     return *this;
 }
 
 
 void TruthTable::Set( vector<bool> full_indices, CellType new_value )
 {
-    cells.at( GetCellIndex(full_indices) ) = new_value;
-    // TRACE(cells)("\n");
+    SetCell( GetCellIndex(full_indices), new_value );
 }
 
 
 void TruthTable::SetSlice( SliceSpec slice, CellType new_value )
 {
     ASSERT( slice.size() <= degree );
+    SizeType fixed_axes, fixed_values;
+    GetSliceMasks( slice, fixed_axes, fixed_values );
     
-    // Determine what the free axes must be
-    vector<int> free_axes;
-    for( unsigned i=0; i<degree; i++ )
-        if( slice.count(i) == 0 )
-            free_axes.push_back(i);
-    ASSERT( free_axes.size() + slice.size() == degree );
-
-    // Capture the fixed axes and indices into our vector
-    vector<bool> full_indices(degree);
-    ScatterInto( full_indices, slice );
-
-    // For all values of (bool)^(free axis count)
-    ForPower<bool>( free_axes.size(), index_range_bool, [&](vector<bool> free_indices)
+    // Cells in the slice, for the axes within a word
+    Word in_word_mask = GetValidMask();
+    for( unsigned axis=0; axis<WORD_AXES && axis<degree; axis++ )
+        if( fixed_axes & ((SizeType)1 << axis) )
+            in_word_mask &= (fixed_values & ((SizeType)1 << axis)) ? axis_patterns[axis] : ~axis_patterns[axis];
+            
+    for( size_t w=0; w<care_plane.size(); w++ )
     {
-        // Capture the free axes and indices into our vector
-        map<int, bool> free_map = ZipToMap( free_axes, free_indices );
-        ScatterInto( full_indices, free_map );
-
-        // Apply the change
-        Set( full_indices, new_value );
-    } );
+        // Whole words are in or out of the slice for the remaining axes
+        SizeType word_base = (SizeType)w << WORD_AXES;
+        if( (word_base ^ fixed_values) & fixed_axes & ~(WORD_CELLS-1) )
+            continue;
+        care_plane[w] = new_value==CellType::DONT_CARE ? (care_plane[w] & ~in_word_mask) : (care_plane[w] | in_word_mask);
+        true_plane[w] = new_value==CellType::TRUE ? (true_plane[w] | in_word_mask) : (true_plane[w] & ~in_word_mask);
+    }
 }
 
 
 void TruthTable::SetSlice( SliceSpec slice, const TruthTable &new_values )
 {
     ASSERT( slice.size() + new_values.degree == degree );
-    
-    // Determine what the free axes must be
-    vector<int> free_axes;
-    for( unsigned i=0; i<degree; i++ )
-        if( slice.count(i) == 0 )
-            free_axes.push_back(i);
-    ASSERT( free_axes.size() + slice.size() == degree );
+    SizeType fixed_axes, fixed_values;
+    GetSliceMasks( slice, fixed_axes, fixed_values );
+    SizeType free_axes = (GetNumCells()-1) & ~fixed_axes;
 
-    // Capture the fixed axes and indices into our vector
-    vector<bool> full_indices(degree);
-    ScatterInto( full_indices, slice );
-
-    // For all values of (bool)^(free axis count)
-    ForPower<bool>( free_axes.size(), index_range_bool, [&](vector<bool> free_indices)
+    // Visit the cells of the slice in order of their index in new_values
+    SizeType free_index = 0;
+    for( SizeType new_cindex=0; new_cindex<new_values.GetNumCells(); new_cindex++ )
     {
-        // Capture the free axes and indices into our vector
-        map<int, bool> free_map = ZipToMap( free_axes, free_indices );
-        ScatterInto( full_indices, free_map );
-
-        // Apply the change
-        Set( full_indices, new_values.Get( free_indices ) );
-    } );
+        SetCell( free_index | fixed_values, new_values.GetCell(new_cindex) );
+        free_index = (free_index - free_axes) & free_axes; // next subset of free_axes
+    }
 }
 
 
 void TruthTable::Extend( unsigned new_degree )
 {
-    SizeType new_ncells = (SizeType)1 << new_degree;
-    cells.resize(new_ncells);
-
+    ASSERT( new_degree >= degree );
     for( unsigned axis=degree; axis<new_degree; axis++ )
     {
         SizeType ncells = (SizeType)1 << axis;
-        copy( cells.begin(),
-              cells.begin()+ncells,
-              cells.begin()+ncells );
+        if( ncells < WORD_CELLS )
+        {
+            care_plane[0] |= care_plane[0] << ncells;
+            true_plane[0] |= true_plane[0] << ncells;
+        }
+        else
+        {
+            size_t nwords = care_plane.size();
+            care_plane.resize( nwords*2 );
+            true_plane.resize( nwords*2 );
+            copy( care_plane.begin(), care_plane.begin()+nwords, care_plane.begin()+nwords );
+            copy( true_plane.begin(), true_plane.begin()+nwords, true_plane.begin()+nwords );
+        }
     }
     
     degree = new_degree;
@@ -121,7 +134,7 @@ unsigned TruthTable::GetDegree() const
 
 TruthTable::CellType TruthTable::Get( vector<bool> full_indices ) const
 {
-    return cells.at( GetCellIndex(full_indices) );
+    return GetCell( GetCellIndex(full_indices) );
 }
 
 
@@ -129,29 +142,13 @@ TruthTable TruthTable::GetSlice( SliceSpec slice ) const
 {
     ASSERT( slice.size() <= degree );
     
-    // Determine what the free axes must be
-    vector<int> dest_axes;
-    for( unsigned i=0; i<degree; i++ )
-        if( slice.count(i) == 0 )
-            dest_axes.push_back(i);
-    ASSERT( dest_axes.size() + slice.size() == degree );
-    TruthTable dest( dest_axes.size(), CellType::FALSE );
-
-    // Capture the fixed axes and indices into our vector
-    vector<bool> full_indices(degree);
-    ScatterInto( full_indices, slice );
-
-    // For all values of (bool)^(dest axis count)
-    ForPower<bool>( dest_axes.size(), index_range_bool, [&](vector<bool> dest_indices)
+    // Take out the highest axes first, so the lower ones keep their numbers
+    TruthTable dest = *this;
+    for( auto it = slice.rbegin(); it != slice.rend(); ++it )
     {
-        // Capture the free axes and indices into our vector
-        map<int, bool> dest_map = ZipToMap( dest_axes, dest_indices );
-        ScatterInto( full_indices, dest_map );
-
-        // Copy cell to destination
-        dest.Set( dest_indices, Get( full_indices ) );
-    } );
-
+        ASSERT( it->first >= 0 && (unsigned)it->first < degree );
+        dest = dest.GetSliceOfAxis( it->first, it->second );
+    }
     return dest;
 }
 
@@ -160,38 +157,14 @@ TruthTable TruthTable::GetFolded( set<int> fold_axes ) const
 {
     ASSERT( fold_axes.size() <= degree );
 
-    // Determine what the destination axes must be
-    vector<int> dest_axes;
-    for( unsigned i=0; i<degree; i++ )
-        if( fold_axes.count(i) == 0 )
-            dest_axes.push_back(i);
-    ASSERT( dest_axes.size() + fold_axes.size() == degree );
-    TruthTable dest( dest_axes.size(), CellType::FALSE );
-
-    // For all values of (bool)^(dest axis count)
-    ForPower<bool>( dest_axes.size(), index_range_bool, [&](vector<bool> dest_indices)
+    // Fold one axis at a time, highest first as for GetSlice()
+    TruthTable dest = *this;
+    for( auto it = fold_axes.rbegin(); it != fold_axes.rend(); ++it )
     {
-        // Capture the dest axes and indices into our vector
-        map<int, bool> dest_map = ZipToMap( dest_axes, dest_indices );
-        vector<bool> full_indices(degree);
-        ScatterInto( full_indices, dest_map );
-
-        set<CellType> cells_to_fold;
-
-        // For all values of (bool)^(fold axis count)
-        ForPower<bool>( fold_axes.size(), index_range_bool, [&](vector<bool> fold_indices)
-        {
-            // Capture the free axes and indices into our vector
-            map<int, bool> fold_map = ZipToMap( fold_axes, fold_indices );
-            ScatterInto( full_indices, fold_map );
-
-            cells_to_fold.insert( cells.at( GetCellIndex(full_indices) ) );
-        } );
-        
-        CellType folded_cell = *max_element(cells_to_fold.begin(), cells_to_fold.end());
-        dest.Set( dest_indices, folded_cell );
-    } );
-
+        ASSERT( *it >= 0 && (unsigned)*it < degree );
+        dest = GetMaximum( dest.GetSliceOfAxis( *it, false ), 
+                           dest.GetSliceOfAxis( *it, true ) );
+    }
     return dest;
 }
 
@@ -199,12 +172,17 @@ TruthTable TruthTable::GetFolded( set<int> fold_axes ) const
 set<vector<bool>> TruthTable::GetIndicesOfValue( CellType value ) const
 {
     set<vector<bool>> indices_set;
-    
-    ForPower<bool>( degree, index_range_bool, [&](vector<bool> indices)
+    for( size_t w=0; w<care_plane.size(); w++ )
     {
-        if( Get(indices) == value )
+        for( Word bits = GetPlaneWord(w, value); bits; bits &= bits-1 )
+        {
+            SizeType cindex = ((SizeType)w << WORD_AXES) | countr_zero(bits);
+            vector<bool> indices(degree);
+            for( unsigned axis=0; axis<degree; axis++ )
+                indices[axis] = (cindex >> axis) & 1;
             indices_set.insert( indices );
-    } );
+        }
+    }
     return indices_set;
 }
 
@@ -212,32 +190,9 @@ set<vector<bool>> TruthTable::GetIndicesOfValue( CellType value ) const
 int TruthTable::CountInSlice( SliceSpec slice, CellType target_value ) const
 { 
     ASSERT( slice.size() <= degree );
-    
-    // Determine what the free axes must be
-    vector<int> free_axes;
-    for( unsigned i=0; i<degree; i++ )
-        if( slice.count(i) == 0 )
-            free_axes.push_back(i);
-    ASSERT( free_axes.size() + slice.size() == degree );
-
-    // Capture the fixed axes and indices into our vector
-    vector<bool> full_indices(degree);
-    ScatterInto( full_indices, slice );
-
-    // For all values of (bool)^(free axis count)
-    int count = 0;
-    ForPower<bool>( free_axes.size(), index_range_bool, [&](vector<bool> free_indices)
-    {
-        // Capture the free axes and indices into our vector
-        map<int, bool> free_map = ZipToMap( free_axes, free_indices );
-        ScatterInto( full_indices, free_map );
-
-        // Apply the change
-        if( Get(full_indices) == target_value )
-            count++;
-    } );
-
-    return count;
+    SizeType fixed_axes, fixed_values;
+    GetSliceMasks( slice, fixed_axes, fixed_values );
+    return CountInSlice( fixed_axes, fixed_values, target_value );
 }
 
 
@@ -252,64 +207,62 @@ shared_ptr<TruthTable::SliceSpec> TruthTable::TryFindBestKarnaughSlice( CellType
     };
 
     CellType avoid_value = (target_value==CellType::TRUE) ? CellType::FALSE : CellType::TRUE;
-    KarnaughClass preferred_class = preferred_index ? KarnaughClass::TRUE : KarnaughClass::FALSE;
 
     // Put FREE first so that we try the biggest slices first. Next is the preferred index
     const vector<KarnaughClass> index_range_kc = {KarnaughClass::FREE, KarnaughClass::TRUE, KarnaughClass::FALSE};
-    shared_ptr<SliceSpec> best_slice;
-    map<KarnaughClass, int> best_counts;
-    best_counts[KarnaughClass::FREE] = -1;
-    best_counts[KarnaughClass::FALSE] = -1;
-    best_counts[KarnaughClass::TRUE] = -1;
+    SizeType best_fixed_axes = 0, best_fixed_values = 0;
+    int best_num_free = -1;
+    int best_num_preferred = -1;
     int best_new_count = -1;
     
     // We'll try 3^degree possibilities for Karnaugh slices
     ForPower<KarnaughClass>( degree, index_range_kc, [&](vector<KarnaughClass> k_classes )
     {     
-        auto candidate_slice = make_shared<SliceSpec>();
-        map<KarnaughClass, int> candidate_counts;
+        // Make slice across the FREE axes, located by the other ones
+        SizeType fixed_axes = 0, fixed_values = 0;
+        int num_free = 0, num_preferred = 0;
         for( unsigned i=0; i<degree; i++ )
         {
-            // Make slice across the FREE axes, located by the other ones
             KarnaughClass c = k_classes.at(i);
-            switch( c )
+            if( c == KarnaughClass::FREE )
             {
-            case KarnaughClass::FREE:
-                break;
-            case KarnaughClass::FALSE:
-                (*candidate_slice)[i] = false;
-                break;
-            case KarnaughClass::TRUE:
-                (*candidate_slice)[i] = true;
-                break;            
+                num_free++;
+                continue;
             }
-            candidate_counts[c]++;
+            fixed_axes |= (SizeType)1 << i;
+            if( c == KarnaughClass::TRUE )
+                fixed_values |= (SizeType)1 << i;
+            if( (c == KarnaughClass::TRUE) == preferred_index )
+                num_preferred++;
         }
 
-        int candidate_new_count = so_far.CountInSlice( *candidate_slice, target_value );
+        int candidate_new_count = so_far.CountInSlice( fixed_axes, fixed_values, target_value );
 
         // NECCESSARY conditions
-        if( CountInSlice( *candidate_slice, avoid_value ) == 0 && // SliceSpec should not include "crosses" in original truth table
-            candidate_new_count > 0 ) // SliceSpec must improve upon so-far solution by bringing at least one target cell in
+        if( candidate_new_count > 0 && // SliceSpec must improve upon so-far solution by bringing at least one target cell in
+            CountInSlice( fixed_axes, fixed_values, avoid_value ) == 0 ) // SliceSpec should not include "crosses" in original truth table
         {
             // DESIRABLE conditions
             if( candidate_new_count > best_new_count || // 1. biggest improvement on so-far solution by count of "new ticks covered"
-                (candidate_new_count == best_new_count && candidate_counts[KarnaughClass::FREE] > best_counts[KarnaughClass::FREE]) || // higher dimension (fewer clauses)
-                (candidate_new_count == best_new_count && candidate_counts[KarnaughClass::FREE] == best_counts[KarnaughClass::FREE] && candidate_counts[preferred_class] > best_counts[preferred_class]) ) // more ticks (fewer negations)
+                (candidate_new_count == best_new_count && num_free > best_num_free) || // higher dimension (fewer clauses)
+                (candidate_new_count == best_new_count && num_free == best_num_free && num_preferred > best_num_preferred) ) // more ticks (fewer negations)
             {
-                best_slice = candidate_slice;
+                best_fixed_axes = fixed_axes;
+                best_fixed_values = fixed_values;
                 best_new_count = candidate_new_count;
-                best_counts = candidate_counts;
+                best_num_free = num_free;
+                best_num_preferred = num_preferred;
             }
         } 
     } );
     
-    /*TRACE( "Bests: Axis counts: FREE: %d FALSE:%d TRUE:%d new cells count:%d\n", 
-           best_counts[KarnaughClass::FREE], 
-           best_counts[KarnaughClass::FALSE], 
-           best_counts[KarnaughClass::TRUE],
-           best_new_count );*/
+    if( best_new_count < 0 )
+        return nullptr;
         
+    auto best_slice = make_shared<SliceSpec>();
+    for( unsigned i=0; i<degree; i++ )
+        if( best_fixed_axes & ((SizeType)1 << i) )
+            (*best_slice)[i] = (best_fixed_values >> i) & 1;
     return best_slice; 
 }
 
@@ -317,14 +270,29 @@ shared_ptr<TruthTable::SliceSpec> TruthTable::TryFindBestKarnaughSlice( CellType
 bool TruthTable::operator==( const TruthTable &other ) const
 {
     // Equality
-    return cells == other.cells;
+    return degree == other.degree && 
+           care_plane == other.care_plane && 
+           true_plane == other.true_plane;
 }
 
 
 bool TruthTable::operator<( const TruthTable &other ) const
 {
-    // This gets us a lexigographical compare of the underlying data
-    return cells < other.cells;
+    // Lexigographical compare of the cells, as if they were in a vector.
+    // Find the first cell that differs and compare by enum value.
+    SizeType ncells = min( GetNumCells(), other.GetNumCells() );
+    for( size_t w=0; ((SizeType)w << WORD_AXES) < ncells; w++ )
+    {
+        Word diff = (care_plane[w] ^ other.care_plane[w]) | (true_plane[w] ^ other.true_plane[w]);
+        if( ncells < WORD_CELLS )
+            diff &= ((Word)1 << ncells) - 1;
+        if( diff )
+        {
+            SizeType cindex = ((SizeType)w << WORD_AXES) | countr_zero(diff);
+            return (int)GetCell(cindex) < (int)other.GetCell(cindex);
+        }
+    }
+    return GetNumCells() < other.GetNumCells();
 }
 
 
@@ -362,7 +330,7 @@ string TruthTable::Render( set<int> column_axes, vector<string> pred_labels, uns
             map<int, bool> column_map = ZipToMap( column_axes, column_indices );
             ScatterInto( full_indices, column_map );
 
-            CellType cell = cells.at( GetCellIndex(full_indices) );
+            CellType cell = GetCell( GetCellIndex(full_indices) );
             string str_cell = " "; // Align with the "P" in labels
             switch( cell )
             {
@@ -464,6 +432,149 @@ TruthTable::SizeType TruthTable::GetCellIndex( vector<bool> full_indices ) const
     return cindex;
 }
 
+
+TruthTable::SizeType TruthTable::GetNumCells() const
+{
+    return (SizeType)1 << degree;
+}
+
+
+TruthTable::Word TruthTable::GetValidMask() const
+{
+    // Cells past the end of a short table are kept clear in both planes
+    return GetNumCells() < WORD_CELLS ? ((Word)1 << GetNumCells()) - 1 : ~(Word)0;
+}
+
+
+TruthTable::CellType TruthTable::GetCell( SizeType cindex ) const
+{
+    ASSERT( cindex < GetNumCells() );
+    size_t w = cindex >> WORD_AXES;
+    Word bit = (Word)1 << (cindex & (WORD_CELLS-1));
+    if( !(care_plane[w] & bit) )
+        return CellType::DONT_CARE;
+    return (true_plane[w] & bit) ? CellType::TRUE : CellType::FALSE;
+}
+
+
+void TruthTable::SetCell( SizeType cindex, CellType new_value )
+{
+    ASSERT( cindex < GetNumCells() );
+    size_t w = cindex >> WORD_AXES;
+    Word bit = (Word)1 << (cindex & (WORD_CELLS-1));
+    care_plane[w] = new_value==CellType::DONT_CARE ? (care_plane[w] & ~bit) : (care_plane[w] | bit);
+    true_plane[w] = new_value==CellType::TRUE ? (true_plane[w] | bit) : (true_plane[w] & ~bit);
+}
+
+
+TruthTable::Word TruthTable::GetPlaneWord( size_t w, CellType value ) const
+{
+    switch( value )
+    {
+    case CellType::TRUE:
+        return true_plane[w];
+    case CellType::FALSE:
+        return care_plane[w] & ~true_plane[w];
+    case CellType::DONT_CARE:
+        return ~care_plane[w] & GetValidMask();
+    }
+    ASSERTFAIL();
+}
+
+
+void TruthTable::GetSliceMasks( const SliceSpec &slice, SizeType &fixed_axes, SizeType &fixed_values )
+{
+    fixed_axes = 0;
+    fixed_values = 0;
+    for( pair<int, bool> p : slice )
+    {
+        fixed_axes |= (SizeType)1 << p.first;
+        if( p.second )
+            fixed_values |= (SizeType)1 << p.first;
+    }
+}
+
+
+int TruthTable::CountInSlice( SizeType fixed_axes, SizeType fixed_values, CellType target_value ) const
+{
+    // Cells in the slice, for the axes within a word
+    Word in_word_mask = ~(Word)0;
+    for( unsigned axis=0; axis<WORD_AXES && axis<degree; axis++ )
+        if( fixed_axes & ((SizeType)1 << axis) )
+            in_word_mask &= (fixed_values & ((SizeType)1 << axis)) ? axis_patterns[axis] : ~axis_patterns[axis];
+
+    int count = 0;
+    for( size_t w=0; w<care_plane.size(); w++ )
+    {
+        // Whole words are in or out of the slice for the remaining axes
+        SizeType word_base = (SizeType)w << WORD_AXES;
+        if( (word_base ^ fixed_values) & fixed_axes & ~(WORD_CELLS-1) )
+            continue;
+        count += popcount( GetPlaneWord(w, target_value) & in_word_mask );
+    }
+    return count;
+}
+
+
+TruthTable TruthTable::GetSliceOfAxis( unsigned axis, bool index ) const
+{
+    ASSERT( axis < degree );
+    TruthTable dest( degree-1, CellType::DONT_CARE );
+    
+    if( axis >= WORD_AXES )
+    {
+        // Whole words are in or out: copy the ones that are in
+        unsigned word_axis = axis - WORD_AXES;
+        SizeType low_mask = ((SizeType)1 << word_axis) - 1;
+        for( size_t dw=0; dw<dest.care_plane.size(); dw++ )
+        {
+            size_t w = ((dw & ~low_mask) << 1) | ((SizeType)index << word_axis) | (dw & low_mask);
+            dest.care_plane[dw] = care_plane[w];
+            dest.true_plane[dw] = true_plane[w];
+        }
+        return dest;
+    }
+    
+    // Pick out the cells on the requested side of the axis and squeeze 
+    // them together into the low half of the word.
+    auto compress = [&](Word x) -> Word
+    {
+        if( index )
+            x >>= (1U << axis);
+        x &= ~axis_patterns[axis];
+        for( unsigned k=axis; k+1<WORD_AXES; k++ )
+            x = (x | (x >> (1U << k))) & ~axis_patterns[k+1];
+        return x;
+    };
+    
+    // Two source words make one destination word, if there are two
+    for( size_t dw=0; dw<dest.care_plane.size(); dw++ )
+    {
+        dest.care_plane[dw] = compress( care_plane[dw*2] );
+        dest.true_plane[dw] = compress( true_plane[dw*2] );
+        if( dw*2+1 < care_plane.size() )
+        {
+            dest.care_plane[dw] |= compress( care_plane[dw*2+1] ) << (WORD_CELLS/2);
+            dest.true_plane[dw] |= compress( true_plane[dw*2+1] ) << (WORD_CELLS/2);
+        }
+    }
+    return dest;
+}
+
+
+TruthTable TruthTable::GetMaximum( const TruthTable &a, const TruthTable &b )
+{
+    // Cell-wise maximum, with TRUE > FALSE > DONT_CARE
+    ASSERT( a.degree == b.degree );
+    TruthTable dest( a.degree, CellType::DONT_CARE );
+    for( size_t w=0; w<dest.care_plane.size(); w++ )
+    {
+        dest.true_plane[w] = a.true_plane[w] | b.true_plane[w];
+        dest.care_plane[w] = a.care_plane[w] | b.care_plane[w];
+    }
+    return dest;
+}
+
 // ------------------------- unit tests --------------------------
 
 static void TestTruthTableBase()
@@ -870,6 +981,183 @@ static void TestTruthTableDisjunction()
 }
 
 
+// Brute-force model of a truth table: one CellType per cell, in cell
+// index order, as the table was held before it was packed into bit-planes.
+typedef vector<TruthTable::CellType> RefTable;
+
+static vector<bool> RefIndices( unsigned degree, unsigned cindex )
+{
+    vector<bool> indices(degree);
+    for( unsigned axis=0; axis<degree; axis++ )
+        indices[axis] = (cindex >> axis) & 1;
+    return indices;
+}
+
+
+static bool RefInSlice( const TruthTable::SliceSpec &slice, unsigned cindex )
+{
+    for( auto p : slice )
+        if( (bool)((cindex >> p.first) & 1) != p.second )
+            return false;
+    return true;
+}
+
+
+// Index of a cell in the table left after removing the slice's axes
+static unsigned RefFreeIndex( unsigned degree, const set<int> &removed_axes, unsigned cindex )
+{
+    unsigned free_index = 0, free_axis = 0;
+    for( unsigned axis=0; axis<degree; axis++ )
+        if( removed_axes.count(axis) == 0 )
+            free_index |= ((cindex >> axis) & 1) << free_axis++;
+    return free_index;
+}
+
+
+static void RefCheck( const TruthTable &t, const RefTable &ref )
+{
+    ASSERT( ref.size() == ((size_t)1 << t.GetDegree()) );
+    for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+        ASSERT( t.Get( RefIndices(t.GetDegree(), cindex) ) == ref[cindex] )
+              ("Mismatch at cell %u of degree %u table\n", cindex, t.GetDegree());
+}
+
+
+static TruthTable::SliceSpec RandomSlice( mt19937 &random, unsigned degree )
+{
+    // Each axis free, false or true with equal probability
+    TruthTable::SliceSpec slice;
+    for( unsigned axis=0; axis<degree; axis++ )
+        if( unsigned r = random() % 3 )
+            slice[axis] = (r == 2);
+    return slice;
+}
+
+
+static TruthTable::CellType RandomCellType( mt19937 &random )
+{
+    return (TruthTable::CellType)((int)(random() % 3) - 1);
+}
+
+
+static void TestTruthTableRandom()
+{
+    // Differential test of the bit-plane implementation against RefTable.
+    // Degrees go beyond 6 so that tables span several words.
+    mt19937 random(586);
+    for( unsigned degree=0; degree<=8; degree++ )
+    {
+        for( int iteration=0; iteration<50; iteration++ )
+        {
+            TruthTable t( degree, TruthTable::CellType::DONT_CARE );
+            RefTable ref( (size_t)1 << degree, TruthTable::CellType::DONT_CARE );
+            RefCheck( t, ref );
+            for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+            {
+                ref[cindex] = RandomCellType( random );
+                t.Set( RefIndices(degree, cindex), ref[cindex] );
+            }
+            RefCheck( t, ref );
+
+            // SetSlice() with a single value
+            TruthTable::SliceSpec slice = RandomSlice( random, degree );
+            TruthTable::CellType value = RandomCellType( random );
+            t.SetSlice( slice, value );
+            for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+                if( RefInSlice(slice, cindex) )
+                    ref[cindex] = value;
+            RefCheck( t, ref );
+
+            // SetSlice() with a table of values
+            slice = RandomSlice( random, degree );
+            set<int> slice_axes;
+            for( auto p : slice )
+                slice_axes.insert( p.first );
+            unsigned sub_degree = degree - slice.size();
+            TruthTable values( sub_degree, TruthTable::CellType::FALSE );
+            RefTable values_ref( (size_t)1 << sub_degree );
+            for( unsigned cindex=0; cindex<values_ref.size(); cindex++ )
+            {
+                values_ref[cindex] = RandomCellType( random );
+                values.Set( RefIndices(sub_degree, cindex), values_ref[cindex] );
+            }
+            t.SetSlice( slice, values );
+            for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+                if( RefInSlice(slice, cindex) )
+                    ref[cindex] = values_ref[RefFreeIndex(degree, slice_axes, cindex)];
+            RefCheck( t, ref );
+
+            // GetSlice() and CountInSlice()
+            slice = RandomSlice( random, degree );
+            slice_axes.clear();
+            for( auto p : slice )
+                slice_axes.insert( p.first );
+            sub_degree = degree - slice.size();
+            RefTable slice_ref( (size_t)1 << sub_degree );
+            map<TruthTable::CellType, int> counts;
+            for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+            {
+                if( RefInSlice(slice, cindex) )
+                {
+                    slice_ref[RefFreeIndex(degree, slice_axes, cindex)] = ref[cindex];
+                    counts[ref[cindex]]++;
+                }
+            }
+            RefCheck( t.GetSlice(slice), slice_ref );
+            for( TruthTable::CellType v : {TruthTable::CellType::DONT_CARE, TruthTable::CellType::FALSE, TruthTable::CellType::TRUE} )
+                ASSERT( t.CountInSlice(slice, v) == counts[v] );
+
+            // GetFolded(): the fold keeps the highest value
+            set<int> fold_axes;
+            for( unsigned axis=0; axis<degree; axis++ )
+                if( random() % 2 )
+                    fold_axes.insert( axis );
+            sub_degree = degree - fold_axes.size();
+            RefTable fold_ref( (size_t)1 << sub_degree, TruthTable::CellType::DONT_CARE );
+            for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+            {
+                TruthTable::CellType &f = fold_ref[RefFreeIndex(degree, fold_axes, cindex)];
+                if( (int)ref[cindex] > (int)f )
+                    f = ref[cindex];
+            }
+            RefCheck( t.GetFolded(fold_axes), fold_ref );
+
+            // GetIndicesOfValue()
+            for( TruthTable::CellType v : {TruthTable::CellType::DONT_CARE, TruthTable::CellType::FALSE, TruthTable::CellType::TRUE} )
+            {
+                set<vector<bool>> indices_ref;
+                for( unsigned cindex=0; cindex<ref.size(); cindex++ )
+                    if( ref[cindex] == v )
+                        indices_ref.insert( RefIndices(degree, cindex) );
+                ASSERT( t.GetIndicesOfValue(v) == indices_ref );
+            }
+
+            // Comparisons, against a table with one cell changed
+            TruthTable t2 = t;
+            RefTable ref2 = ref;
+            ASSERT( t2 == t && !(t2 < t) && !(t < t2) );
+            unsigned changed = random() % ref.size();
+            ref2[changed] = RandomCellType( random );
+            t2.Set( RefIndices(degree, changed), ref2[changed] );
+            ASSERT( (t2 == t) == (ref2 == ref) );
+            ASSERT( (t < t2) == lexicographical_compare( ref.begin(), ref.end(), ref2.begin(), ref2.end(), 
+                                                         [](TruthTable::CellType a, TruthTable::CellType b){ return (int)a < (int)b; } ) );
+
+            // Extend() replicates the cells onto the new axes
+            if( degree < 8 )
+            {
+                unsigned new_degree = degree + 1 + random() % (8 - degree);
+                t.Extend( new_degree );
+                RefTable extended_ref( (size_t)1 << new_degree );
+                for( unsigned cindex=0; cindex<extended_ref.size(); cindex++ )
+                    extended_ref[cindex] = ref[cindex & (ref.size()-1)];
+                RefCheck( t, extended_ref );
+            }
+        }
+    }
+}
+
+
 void SYM::TestTruthTable()
 {
     TestTruthTableBase();
@@ -877,4 +1165,5 @@ void SYM::TestTruthTable()
     TestTruthTableCoupling();
     TestTruthTableDisjunction();
     TestTruthTableKarnaugh();
+    TestTruthTableRandom();
 }
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <functional>
+#include <cstdint>
 
 using namespace std;
 
@@ -16,6 +17,9 @@ namespace SYM
              
 // ------------------------- TruthTable --------------------------
 
+// Cells are held in two bit-planes, packed into 64-bit words, so that 
+// slicing, folding and counting can work on 64 cells at a time. Axis i
+// of the table is bit i of a cell's index.
 class TruthTable
 {
 public:
@@ -85,10 +89,25 @@ public:
      
 private:
     typedef vector<bool>::size_type SizeType;
+    typedef uint64_t Word;
+    
     SizeType GetCellIndex( vector<bool> full_indices ) const;
+    SizeType GetNumCells() const;
+    Word GetValidMask() const;
+    CellType GetCell( SizeType cindex ) const;
+    void SetCell( SizeType cindex, CellType new_value );
+    Word GetPlaneWord( size_t w, CellType value ) const;
+    
+    // A slice as bitmasks over cell indices: which axes are fixed and 
+    // the values they are fixed to.
+    static void GetSliceMasks( const SliceSpec &slice, SizeType &fixed_axes, SizeType &fixed_values );
+    int CountInSlice( SizeType fixed_axes, SizeType fixed_values, CellType target_value ) const; 
+    TruthTable GetSliceOfAxis( unsigned axis, bool index ) const;
+    static TruthTable GetMaximum( const TruthTable &a, const TruthTable &b );
 
     unsigned degree;
-    vector<CellType> cells;
+    vector<Word> care_plane; // Set for cells that are not DONT_CARE
+    vector<Word> true_plane; // Set for cells that are TRUE
 };
 
 // ------------------------- unit tests --------------------------
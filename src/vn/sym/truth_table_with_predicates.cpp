@@ -4,6 +4,7 @@
 #include "common/orderable.hpp"
 #include "predicate_operators.hpp"
 #include "truth_table.hpp"
+#include "bdd.hpp"
 
 #include <vector>
 #include <map>
@@ -17,14 +18,18 @@ using namespace SYM;
 TruthTableWithPredicates::TruthTableWithPredicates( vector<EqualPredicateSet> predicates_, 
                                                     TruthTable::CellType initval, 
                                                     string label_var_name_, 
-                                                    int counting_based ) :
+                                                    int counting_based,
+                                                    bool use_bdd ) :
     label_var_name( label_var_name_ ),
     render_cell_size( render_index_size+label_var_name.size()+1 ),  // +1 for the ¬ 
     label_fmt( SSPrintf("%s%%0%dd", label_var_name.c_str(), render_cell_size-2) ),
     predicates( predicates_ ),
-    truth_table( make_shared<TruthTable>( predicates.size(), initval ) ),
     next_pred_num( counting_based )
 {    
+    if( use_bdd )
+        bdd_truth_table = make_shared<BDDTruthTable>( make_shared<BDD>(), predicates.size(), initval );
+    else
+        truth_table = make_shared<TruthTable>( predicates.size(), initval );
     UpdatePredToIndex();
 
     for( unsigned i=0; i<GetDegree(); i++ )
@@ -37,7 +42,8 @@ TruthTableWithPredicates::TruthTableWithPredicates( const TruthTableWithPredicat
     render_cell_size( other.render_cell_size ),
     label_fmt( other.label_fmt ),
     predicates( other.predicates ),
-    truth_table( make_shared<TruthTable>(*other.truth_table) ),
+    truth_table( other.truth_table ? make_shared<TruthTable>(*other.truth_table) : nullptr ),
+    bdd_truth_table( other.bdd_truth_table ? make_shared<BDDTruthTable>(*other.bdd_truth_table) : nullptr ),
     pred_to_index( other.pred_to_index ),
     pred_labels( other.pred_labels ),
     next_pred_num( other.next_pred_num )
@@ -48,7 +54,8 @@ TruthTableWithPredicates::TruthTableWithPredicates( const TruthTableWithPredicat
 TruthTableWithPredicates &TruthTableWithPredicates::operator=( const TruthTableWithPredicates &other )
 {
     predicates = other.predicates;
-    truth_table = make_shared<TruthTable>(*other.truth_table);
+    truth_table = other.truth_table ? make_shared<TruthTable>(*other.truth_table) : nullptr;
+    bdd_truth_table = other.bdd_truth_table ? make_shared<BDDTruthTable>(*other.bdd_truth_table) : nullptr;
     pred_to_index = other.pred_to_index;
     pred_labels = other.pred_labels;
     next_pred_num = other.next_pred_num;
@@ -58,8 +65,9 @@ TruthTableWithPredicates &TruthTableWithPredicates::operator=( const TruthTableW
 
 unsigned TruthTableWithPredicates::GetDegree() const
 {
-    ASSERT( truth_table->GetDegree() == predicates.size() );
-    return truth_table->GetDegree();
+    unsigned degree = IsBDD() ? bdd_truth_table->GetDegree() : truth_table->GetDegree();
+    ASSERT( degree == predicates.size() );
+    return degree;
 }
     
     
@@ -78,7 +86,10 @@ TruthTableWithPredicates::EqualPredicateSet TruthTableWithPredicates::GetPredica
 void TruthTableWithPredicates::Extend( vector<EqualPredicateSet> new_predicates )
 {
     TRACE("Extending truth table from %d by %d\n", GetDegree(), new_predicates.size());
-    truth_table->Extend( GetDegree() + new_predicates.size() ); 
+    if( IsBDD() )
+        bdd_truth_table->Extend( GetDegree() + new_predicates.size() ); 
+    else
+        truth_table->Extend( GetDegree() + new_predicates.size() ); 
     predicates = predicates + new_predicates;
     UpdatePredToIndex();
     for( unsigned i=0; i<new_predicates.size(); i++ )
@@ -86,6 +97,15 @@ void TruthTableWithPredicates::Extend( vector<EqualPredicateSet> new_predicates
 }
 
 
+void TruthTableWithPredicates::SetSlice( TruthTable::SliceSpec slice, TruthTable::CellType new_value )
+{
+    if( IsBDD() )
+        bdd_truth_table->SetSlice( slice, new_value );
+    else
+        truth_table->SetSlice( slice, new_value );
+}
+
+
 TruthTableWithPredicates TruthTableWithPredicates::GetSlice( TruthTable::SliceSpec slice ) const
 {
     vector<EqualPredicateSet> new_predicates;
@@ -99,10 +119,15 @@ TruthTableWithPredicates TruthTableWithPredicates::GetSlice( TruthTable::SliceSp
         }
     }
 
-    auto new_tt = make_shared<TruthTable>( truth_table->GetSlice( slice ) );
+    shared_ptr<TruthTable> new_tt;
+    shared_ptr<BDDTruthTable> new_bdd_tt;
+    if( IsBDD() )
+        new_bdd_tt = make_shared<BDDTruthTable>( bdd_truth_table->GetSlice( slice ) );
+    else
+        new_tt = make_shared<TruthTable>( truth_table->GetSlice( slice ) );
 
     return TruthTableWithPredicates( label_var_name, render_cell_size, label_fmt, 
-                                     new_predicates, new_tt, 
+                                     new_predicates, new_tt, new_bdd_tt,
                                      new_pred_labels, next_pred_num );
 }
 
@@ -120,10 +145,15 @@ TruthTableWithPredicates TruthTableWithPredicates::GetFolded( set<int> fold_axes
         }
     }
     
-    auto new_tt = make_shared<TruthTable>( truth_table->GetFolded( fold_axes ) );
+    shared_ptr<TruthTable> new_tt;
+    shared_ptr<BDDTruthTable> new_bdd_tt;
+    if( IsBDD() )
+        new_bdd_tt = make_shared<BDDTruthTable>( bdd_truth_table->GetFolded( fold_axes ) );
+    else
+        new_tt = make_shared<TruthTable>( truth_table->GetFolded( fold_axes ) );
 
     return TruthTableWithPredicates( label_var_name, render_cell_size, label_fmt, 
-                                     new_predicates, new_tt, 
+                                     new_predicates, new_tt, new_bdd_tt,
                                      new_pred_labels, next_pred_num );
 }
 
@@ -147,16 +177,34 @@ string TruthTableWithPredicates::Render( set<int> column_axes, bool give_preds )
     if( give_preds )
         for( unsigned axis=0; axis<GetDegree(); axis++ )
             s += pred_labels.at(axis) + " := " + GetFrontPredicate(axis)->Render() + "\n";
-    s += truth_table->Render( column_axes, pred_labels, render_cell_size );
+    if( IsBDD() )
+        s += bdd_truth_table->Render( pred_labels ); // too big to draw
+    else
+        s += truth_table->Render( column_axes, pred_labels, render_cell_size );
     return s;
 }
 
 
+TruthTable &TruthTableWithPredicates::GetTruthTable()
+{
+    ASSERT( truth_table )("Truth table is a BDD");
+    return *truth_table;
+}
+
+
+BDDTruthTable &TruthTableWithPredicates::GetBDDTruthTable()
+{
+    ASSERT( bdd_truth_table )("Truth table is not a BDD");
+    return *bdd_truth_table;
+}
+
+
 TruthTableWithPredicates::TruthTableWithPredicates( string label_var_name_, 
                                                     int render_cell_size_,
                                                     string label_fmt_,
                                                     const vector<EqualPredicateSet> &predicates_, 
                                                     shared_ptr<TruthTable> truth_table_, 
+                                                    shared_ptr<BDDTruthTable> bdd_truth_table_, 
                                                     vector<string> pred_labels_, 
                                                     int next_pred_num_ ) :
     label_var_name( label_var_name_ ),
@@ -164,6 +212,7 @@ TruthTableWithPredicates::TruthTableWithPredicates( string label_var_name_,
     label_fmt( label_fmt_ ),
     predicates( predicates_ ),
     truth_table( truth_table_ ),
+    bdd_truth_table( bdd_truth_table_ ),
     pred_labels( pred_labels_ ),
     next_pred_num( next_pred_num_ )
 {
@@ -5,6 +5,7 @@
 #include "common/orderable.hpp"
 #include "predicate_operators.hpp"
 #include "truth_table.hpp"
+#include "bdd.hpp"
 
 #include <vector>
 #include <map>
@@ -18,12 +19,16 @@ namespace SYM
                           
 // ------------------------- TruthTableWithPredicates --------------------------
 
+// The truth table is either a TruthTable or, if use_bdd is given, a
+// BDDTruthTable, which is for when the degree is too high for a 
+// TruthTable. GetTruthTable() and GetBDDTruthTable() must be used 
+// accordingly, and the other methods work with either.
 class TruthTableWithPredicates
 {
 public:
     typedef set<shared_ptr<PredicateOperator>> EqualPredicateSet; // all should compare equal
     
-    explicit TruthTableWithPredicates( vector<EqualPredicateSet> predicates, TruthTable::CellType initval, string label_var_name, int counting_based );    
+    explicit TruthTableWithPredicates( vector<EqualPredicateSet> predicates, TruthTable::CellType initval, string label_var_name, int counting_based, bool use_bdd=false );    
     TruthTableWithPredicates( const TruthTableWithPredicates &other );    
     TruthTableWithPredicates &operator=( const TruthTableWithPredicates &other ); 
     
@@ -31,6 +36,7 @@ public:
     shared_ptr<PredicateOperator> GetFrontPredicate( int axis ) const;
     EqualPredicateSet GetPredicateSet( int axis ) const;
     void Extend( vector<EqualPredicateSet> new_predicates );
+    void SetSlice( TruthTable::SliceSpec slice, TruthTable::CellType new_value );
     TruthTableWithPredicates GetSlice( TruthTable::SliceSpec slice ) const; 
     TruthTableWithPredicates GetFolded( set<int> fold_axes ) const;
     bool PredExists( shared_ptr<PredicateOperator> pred ) const;
@@ -38,7 +44,9 @@ public:
     string Render( set<int> column_axes, bool give_preds=true ) const; 
     
     vector<EqualPredicateSet> &GetPredicates() { return predicates; }
-    TruthTable &GetTruthTable() { return *truth_table; }
+    bool IsBDD() const { return !!bdd_truth_table; }
+    TruthTable &GetTruthTable();
+    BDDTruthTable &GetBDDTruthTable();
     
 private:    
     explicit TruthTableWithPredicates( string label_var_name, 
@@ -46,6 +54,7 @@ private:
                                        string label_fmt,
                                        const vector<EqualPredicateSet> &predicates, 
                                        shared_ptr<TruthTable> truth_table, 
+                                       shared_ptr<BDDTruthTable> bdd_truth_table, 
                                        vector<string> pred_labels, 
                                        int next_pred_num );    
     void UpdatePredToIndex();
@@ -55,7 +64,8 @@ private:
     const int render_cell_size;
     const string label_fmt;
     vector<EqualPredicateSet> predicates;
-    shared_ptr<TruthTable> truth_table;
+    shared_ptr<TruthTable> truth_table; // exactly one of these is set
+    shared_ptr<BDDTruthTable> bdd_truth_table;
     map<shared_ptr<PredicateOperator>, int, Expression::Relation> pred_to_index;
     vector<string> pred_labels;
     int next_pred_num;
@@ -3,6 +3,7 @@
 #include "patches.hpp"
 #include "db/x_tree_database.hpp"
 #include "common/read_args.hpp"
+#include "common/consistency_check.hpp"
 #include "tree/validate.hpp"
 #include "common/lambda_loops.hpp"
 #include "tz_relation.hpp"
@@ -11,6 +12,8 @@
 
 using namespace VN;
 
+static ConsistencyCheck validate_tree_zones_check("ValidateTreeZones");
+
 // ------------------------- ProtectDEPass --------------------------
 
 ProtectDEPass::ProtectDEPass(const XTreeDatabase *db_) :
@@ -150,6 +153,9 @@ ValidateTreeZones::ValidateTreeZones(const XTreeDatabase *db_) :
  
 void ValidateTreeZones::Run( shared_ptr<Patch> layout )
 {
+    if( !validate_tree_zones_check.ShouldRun() )
+        return;
+        
     TreePatch::ForTreeDepthFirstWalk( layout, nullptr, [&](shared_ptr<TreePatch> &patch)
     {
 		patch->GetZone()->Validate(db);
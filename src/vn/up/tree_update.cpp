@@ -2,6 +2,7 @@
 
 #include "db/x_tree_database.hpp"
 #include "common/read_args.hpp"
+#include "common/consistency_check.hpp"
 #include "tree/validate.hpp"
 #include "common/lambda_loops.hpp"
 #include "tz_relation.hpp"
@@ -22,6 +23,7 @@
 
 using namespace VN;
 
+static ConsistencyCheck single_free_zone_check("TreeUpdater::TransformToSingleFreeZone");
 
 // ------------------------- Runners --------------------------
 
@@ -52,13 +54,17 @@ unique_ptr<FreeZone> TreeUpdater::TransformToSingleFreeZone( shared_ptr<Patch> l
 	// We just want to make one big free zone from the layout. We don't touch the 
 	// database, so method is static.
 	 	
+    bool check = single_free_zone_check.ShouldRun();
+    
     DuplicateAllPass duplicate_all_pass;
     duplicate_all_pass.Run(layout);  
-    duplicate_all_pass.Check(layout);
+    if( check )
+        duplicate_all_pass.Check(layout);
     
     MergeFreesPass merge_frees_pass;
     merge_frees_pass.Run(layout, nullptr);  
-    merge_frees_pass.Check(layout);
+    if( check )
+        merge_frees_pass.Check(layout);
 
     auto free_patch = dynamic_pointer_cast<FreePatch>(layout);
     ASSERT( free_patch );
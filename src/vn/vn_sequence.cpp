@@ -5,12 +5,25 @@
 #include "db/x_tree_database.hpp"
 #include "up/tree_update.hpp"
 #include "up/up_common.hpp"
+#include "scr_engine.hpp"
+#include "and_rule_engine.hpp"
+#include "common/progress.hpp"
 
 using namespace VN;
 
-VNSequence::VNSequence( const vector< shared_ptr<VNStep> > &sequence ) :
-    steps( sequence )
+// A step that is re-run more often than this within one fixpoint group is
+// probably fighting with another step, so we give up on the group
+#define MAX_FIXPOINT_RUNS_PER_STEP 20
+
+VNSequence::VNSequence( const vector< shared_ptr<VNStep> > &sequence,
+                        const list<FixpointGroup> &fixpoint_groups_ ) :
+    steps( sequence ),
+    fixpoint_groups( fixpoint_groups_ ),
+    step_lacing_ordinals( sequence.size() )
 {
+    for( const FixpointGroup &group : fixpoint_groups )
+        ASSERT( group.first >= 0 && group.first < group.second && group.second <= (int)steps.size() )
+              ("Bad fixpoint group [%d, %d)", group.first, group.second);
 }                                  
 
 
@@ -82,6 +95,24 @@ void VNSequence::PlanningStageFour()
 void VNSequence::PlanningStageFive( int step_index )
 {
     steps[step_index]->PlanningStageFive(lacing);  
+    
+    // Only needed for scheduling fixpoint groups. Writes to this step's 
+    // element only, so OK with -j.
+    const SCREngine *root_scr_engine = steps[step_index]->GetTopLevelEngine()->GetRootEngine();
+    if( !TryGetFixpointGroup(step_index) || !root_scr_engine )
+        return;
+        
+    // A deletion anywhere might let a pattern with eg a negation match, 
+    // so leave the ordinals empty, meaning interested in everything
+    for( const AndRuleEngine *are : root_scr_engine->GetAndRuleEngines() )
+        if( are->HasAbnormalEngines() )
+            return;
+            
+    set<int> &ordinals = step_lacing_ordinals[step_index];
+    for( const list<pair<int, int>> &range_list : lacing->GetRangeListsForCategoryClauses( root_scr_engine->GetExpressions(), false ) )
+        for( pair<int, int> int_range : range_list )
+            for( int i=int_range.first; i<int_range.second; i++ )
+                ordinals.insert(i);
 }
 
 
@@ -99,6 +130,16 @@ void VNSequence::SetStopAfter( int step_index, vector<int> ssa, int d )
 
 void VNSequence::AnalysisStage( TreePtr<Node> main_tree_root )
 {        
+    // Previous input in a batch: tear down as the destructor would
+    if( tree_updater )
+    {
+        tree_updater->TeardownMainTree();
+        tree_updater.reset();
+    }
+    
+    fixpoint_steps_run.clear();
+    fixpoint_steps_pending.clear();
+    
     x_tree_db = make_shared<XTreeDatabase>(lacing, domain_extenders);
     tree_updater = make_unique<TreeUpdater>(x_tree_db.get()); 
     
@@ -113,11 +154,113 @@ TreePtr<Node> VNSequence::TransformStep( int step_index )
 {           
     ASSERT( x_tree_db )("Analysis stage should have created x_tree_db object");         
 
-    steps[step_index]->SetXTreeDb( x_tree_db );
-    steps[step_index]->Transform();
+    if( const FixpointGroup *group = TryGetFixpointGroup(step_index) )
+    {
+        RunStepInFixpointGroup( step_index, *group );
+        if( step_index == group->second-1 )
+            RunFixpointGroupToQuiescence( *group );
+    }
+    else
+    {
+        steps[step_index]->SetXTreeDb( x_tree_db );
+        steps[step_index]->Transform();
+    }
     
     return x_tree_db->GetMainRootNode();   
 }
+
+
+const VNSequence::FixpointGroup *VNSequence::TryGetFixpointGroup( int step_index ) const
+{
+    for( const FixpointGroup &group : fixpoint_groups )
+        if( step_index >= group.first && step_index < group.second )
+            return &group;
+    return nullptr;
+}
+
+
+void VNSequence::RunStepInFixpointGroup( int step_index, const FixpointGroup &group )
+{
+    set<int> touched_lacing_ordinals;
+    steps[step_index]->SetXTreeDb( x_tree_db );
+    steps[step_index]->Transform( &touched_lacing_ordinals );
+    
+    fixpoint_steps_run.insert( step_index );
+    fixpoint_steps_pending.erase( step_index );
+    
+    // A step runs to its own fixpoint, so only the others need to run again 
+    if( touched_lacing_ordinals.empty() )
+        return;
+    for( int i=group.first; i<group.second; i++ )
+        if( i != step_index && IsStepInterested( i, touched_lacing_ordinals ) )
+            fixpoint_steps_pending.insert( i );
+}
+
+
+void VNSequence::RunFixpointGroupToQuiescence( const FixpointGroup &group )
+{
+    // If not every step got a first run (eg due to -s) we're not going to 
+    // get a fixpoint anyway, so don't try
+    for( int i=group.first; i<group.second; i++ )
+    {
+        if( !fixpoint_steps_run.count(i) )
+        {
+            fixpoint_steps_pending.clear();
+            return;
+        }
+    }
+        
+    Progress saved_progress = Progress::GetCurrent();
+    map<int, int> num_runs;
+    bool settled = true;
+    while( !fixpoint_steps_pending.empty() )
+    {
+        // Lowest index first, to stay close to the order of the sequence
+        int step_index = *fixpoint_steps_pending.begin();
+        if( ++num_runs[step_index] > MAX_FIXPOINT_RUNS_PER_STEP )
+        {
+            fprintf(stderr, "Warning: fixpoint group [%d, %d) not settling: T%03d-%s has run again %d times; moving on\n",
+                    group.first, group.second, step_index, GetStepName(step_index).c_str(), MAX_FIXPOINT_RUNS_PER_STEP);
+            fixpoint_steps_pending.clear();
+            settled = false;
+            break;
+        }
+        
+        Progress(Progress::TRANSFORMING, step_index).SetAsCurrent();
+        if( !ReadArgs::trace_quiet )
+            fprintf(stderr, "%s at T%03d-%s (again, for fixpoint)\n", ReadArgs::input_x_path.c_str(), step_index, GetStepName(step_index).c_str() ); 
+        RunStepInFixpointGroup( step_index, group );
+    }
+    
+    // Check that skipping steps that weren't interested didn't leave 
+    // anything undone
+    if( ReadArgs::test_fixpoint && settled )
+    {
+        for( int i=group.first; i<group.second; i++ )
+        {
+            Progress(Progress::TRANSFORMING, i).SetAsCurrent();
+            set<int> touched_lacing_ordinals;
+            steps[i]->SetXTreeDb( x_tree_db );
+            steps[i]->Transform( &touched_lacing_ordinals );
+            ASSERT( touched_lacing_ordinals.empty() )
+                  ("Fixpoint group [%d, %d) had not settled: T%03d-%s still made changes", 
+                   group.first, group.second, i, GetStepName(i).c_str());
+        }
+    }
+    saved_progress.SetAsCurrent();
+}
+
+
+bool VNSequence::IsStepInterested( int step_index, const set<int> &touched_lacing_ordinals ) const
+{
+    const set<int> &ordinals = step_lacing_ordinals[step_index];
+    if( ordinals.empty() )
+        return true;
+    for( int o : touched_lacing_ordinals )
+        if( ordinals.count(o) )
+            return true;
+    return false;
+}
            
                  
 void VNSequence::ForSteps( function<void(int)> body )
@@ -18,11 +18,23 @@ class XTreeDatabase;
 class TreeUpdater;
 /**
  * Vida Nova Sequence
+ * 
+ * A fixpoint group is a half-open range of step indices that are to be 
+ * repeated until none of them can do any more. After the group has run
+ * once in order, a step is run again only if another step has since 
+ * touched (or removed) nodes in categories that its search patterns look 
+ * at, or after any change if its patterns have negations or other abnormal
+ * engines, since a deletion anywhere could let those match. A step in
+ * a group has one index however many times it runs, so step indices (as 
+ * used by -q, -n and -gp) count each group's steps once.
  */
 class VNSequence
 {
 public:    
-    explicit VNSequence( const vector< shared_ptr<VNStep> > &sequence );
+    typedef pair<int, int> FixpointGroup;
+    
+    explicit VNSequence( const vector< shared_ptr<VNStep> > &sequence,
+                         const list<FixpointGroup> &fixpoint_groups = {} );
     ~VNSequence();
     
     void PatternTransformations( int step_index );
@@ -53,7 +65,18 @@ public:
     bool IsLoweringForRenderStep(int step_index) const;
     
 private:
+    const FixpointGroup *TryGetFixpointGroup( int step_index ) const;
+    void RunStepInFixpointGroup( int step_index, const FixpointGroup &group );
+    void RunFixpointGroupToQuiescence( const FixpointGroup &group );
+    bool IsStepInterested( int step_index, const set<int> &touched_lacing_ordinals ) const;
+
     vector< shared_ptr<VNStep> > steps;
+    const list<FixpointGroup> fixpoint_groups;
+    // Per step, the lacing ordinals of categories that its search patterns
+    // look at. Empty if there are none, so we must assume it looks at all.
+    vector< set<int> > step_lacing_ordinals;
+    set<int> fixpoint_steps_run;
+    set<int> fixpoint_steps_pending;
     shared_ptr<Lacing> lacing;
     DomainExtension::ExtenderSet domain_extenders;
     shared_ptr<XTreeDatabase> x_tree_db;  
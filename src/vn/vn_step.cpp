@@ -109,11 +109,15 @@ void VNStep::SetXTreeDb( shared_ptr<XTreeDatabase> x_tree_db_ )
 }
 
 
-void VNStep::Transform()
+void VNStep::Transform( set<int> *touched_lacing_ordinals )
 {
     ASSERTTHIS();
     ASSERT( root_engine )("VNStep needs to be configured before use");
     root_engine->Transform();
+    
+    // Touch log is cleared at end of step
+    if( touched_lacing_ordinals )
+        *touched_lacing_ordinals = x_tree_db->GetTouchedLacingOrdinals();
     x_tree_db->DeferredActionsEndOfStep();
 }                                   
 
@@ -44,7 +44,7 @@ public:
     void SetStopAfter( vector<int> ssa, int d=0 );    
             
     void SetXTreeDb( shared_ptr<XTreeDatabase> x_tree_db );
-    void Transform();
+    void Transform( set<int> *touched_lacing_ordinals = nullptr );
         
     NodeBlock GetGraphBlockInfo() const final;
     virtual string GetGraphId() const; 
@@ -0,0 +1,66 @@
+#!/bin/bash
+
+#
+# batch_check.sh
+#
+# Checks that a batch run (-b) of Inferno produces the same outputs as 
+# transforming each input in its own process, byte for byte. Inputs that
+# fail to transform on their own are reported, and will also stop the 
+# batch run, since a failed ASSERT aborts the whole process.
+#
+
+inferno=./inferno.exe
+
+if test $# -lt 2
+then
+    echo "Usage: $0 <output path> <input programs>"
+    echo "Run from inferno-cpp2v/"
+    exit 1
+fi
+
+outpath=$1
+shift
+infilelist=$*
+
+rm -rf $outpath
+mkdir -p $outpath/single $outpath/batch
+
+failed=0
+
+# The batch run puts each output under the input's path, so do the same 
+# for the single runs
+batchargs=""
+for infile in $infilelist
+do
+    mkdir -p $outpath/single/`dirname $infile`
+    if ! $inferno -tq -i$infile -o$outpath/single/$infile > $outpath/single/`basename $infile`.log 2>&1
+    then
+        echo $infile FAILED TO TRANSFORM ON ITS OWN
+        let "failed+=1"
+    fi
+    batchargs="$batchargs -b$infile"
+done
+
+if ! $inferno -tq $batchargs -o$outpath/batch > $outpath/batch.log 2>&1
+then
+    echo BATCH TRANSFORM FAILED, see $outpath/batch.log
+    let "failed+=1"
+fi
+
+for infile in $infilelist
+do
+    if ! cmp -s $outpath/single/$infile $outpath/batch/$infile
+    then
+        echo $infile BATCH OUTPUT DIFFERS
+        let "failed+=1"
+    fi
+done
+
+if test $failed -eq 0
+then
+    echo "BATCH OUTPUTS MATCH"
+    exit 0
+else
+    echo "$failed BATCH CHECKS FAILED"
+    exit 1
+fi
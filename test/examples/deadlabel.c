@@ -0,0 +1,25 @@
+// Dead code removal deletes the only goto to L2, after which the unused 
+// label removal must run again (it comes first in its fixpoint group) to 
+// remove L2, and then dead code removal again for the a=0 that follows.
+// Use with -sf to check that the group really settles.
+
+int main()
+{
+    int a=4;
+    
+    goto L1;
+    
+    goto L2;
+    
+    a=1;
+    
+    L2:
+    
+    a=0;
+    
+    L1:
+    
+    a++;
+    
+    return a;
+}
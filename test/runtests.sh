@@ -21,14 +21,16 @@ logdir=test/results
 # runtests.sh all - tests all vectors including some that are expected to fail
 # runtests.sh full - direct reference check of each intermediate
 # runtests.sh <file list> - tests all named files
+# Each input is transformed in its own process, so a crash is put down to
+# the right input. See batch_check.sh for checking batch (-b) runs.
 if test -z $1
 then
     infilelist="test/examples/*"
-    testscript="test.sh"
+    testscript="exec_test.sh"
 elif test $1 == all
 then
     infilelist="test/examples/* $clang_tests/CodeGen/*"
-    testscript="test.sh"
+    testscript="exec_test.sh"
 elif test $1 == sr
 then
     infilelist="test/examples/*"
@@ -39,7 +41,7 @@ then
     testscript="reptest.sh"
 else
     infilelist=$*
-    testscript="test.sh"
+    testscript="exec_test.sh"
 fi
 
 # Clear down output files/directories since we would not like out-of-date results
@@ -49,7 +51,7 @@ rm -rf test/results/*
 
 echo testing files $infilelist
 
-# Prevent the pipe to tee from hiding the status code from test.sh
+# Prevent the pipe to tee from hiding the status code from the test script
 set -o pipefail
 
 # Start all the tests in seperate processes to take advantage of mult-core host
@@ -59,7 +61,12 @@ do
     logfile=$logdir/`basename $infile`.log
     # Start the test and pipe output to tee so we get it on the terminal and in the 
     # log file, but turn off the normal messges because there's too many! 
-    test/$testscript $infile -tq 2>&1 | tee $logfile &
+    if test $testscript == exec_test.sh
+    then
+        test/$testscript $infile $logdir/exec -tq 2>&1 | tee $logfile &
+    else
+        test/$testscript $infile -tq 2>&1 | tee $logfile &
+    fi
 done
 
 # Wait for all the tests to complete and count failures 